@@ -37,6 +37,7 @@ void benchmark_trigo()
     xsimd::run_benchmark_1op(xsimd::sin_fn(), std::cout, size, 1000);
     xsimd::run_benchmark_1op(xsimd::cos_fn(), std::cout, size, 1000);
     xsimd::run_benchmark_1op(xsimd::tan_fn(), std::cout, size, 1000);
+    xsimd::run_benchmark_1op(xsimd::sinpi_fn(), std::cout, size, 1000);
     xsimd::run_benchmark_1op(xsimd::asin_fn(), std::cout, size, 1000, xsimd::init_method::arctrigo);
     xsimd::run_benchmark_1op(xsimd::acos_fn(), std::cout, size, 1000, xsimd::init_method::arctrigo);
     xsimd::run_benchmark_1op(xsimd::atan_fn(), std::cout, size, 1000, xsimd::init_method::arctrigo);
@@ -57,11 +58,128 @@ void benchmark_power()
 {
     std::size_t size = 20000;
     xsimd::run_benchmark_2op(xsimd::pow_fn(), std::cout, size, 1000);
+    xsimd::run_benchmark_1op(xsimd::ipow_fn(), std::cout, size, 1000);
     xsimd::run_benchmark_1op(xsimd::sqrt_fn(), std::cout, size, 1000);
     xsimd::run_benchmark_1op(xsimd::cbrt_fn(), std::cout, size, 100);
     xsimd::run_benchmark_2op(xsimd::hypot_fn(), std::cout, size, 1000);
 }
 
+void benchmark_activation()
+{
+    std::size_t size = 20000;
+    xsimd::run_benchmark_1op(xsimd::sigmoid_fn(), std::cout, size, 1000);
+    xsimd::run_benchmark_1op(xsimd::fast_sigmoid_fn(), std::cout, size, 1000);
+    xsimd::run_benchmark_1op(xsimd::gelu_fn(), std::cout, size, 100);
+}
+
+void benchmark_special()
+{
+    std::size_t size = 20000;
+    xsimd::run_benchmark_1op(xsimd::j0_fn(), std::cout, size, 100);
+}
+
+void benchmark_random()
+{
+    std::size_t size = 20000;
+    xsimd::run_benchmark_random<std::uniform_real_distribution, xsimd::uniform_distribution>("uniform", std::cout, size, 1000);
+    xsimd::run_benchmark_random<std::normal_distribution, xsimd::normal_distribution>("normal", std::cout, size, 1000);
+    xsimd::run_benchmark_random<std::exponential_distribution, xsimd::exponential_distribution>("exponential", std::cout, size, 1000);
+}
+
+void benchmark_denormal()
+{
+    std::size_t size = 20000;
+    xsimd::run_benchmark_denormal(std::cout, size, 1000);
+}
+
+void benchmark_hash()
+{
+    std::size_t size = 20000;
+    xsimd::run_benchmark_hash(std::cout, size, 1000);
+    xsimd::run_benchmark_hash_table(std::cout, size, 1000);
+    xsimd::run_benchmark_hash_table(std::cout, 1000000, 10);
+    xsimd::run_benchmark_bloom_filter(std::cout, size, 1000);
+    xsimd::run_benchmark_bloom_filter(std::cout, 10000000, 5);
+}
+
+void benchmark_bitpacking()
+{
+    std::size_t size = 1000000;
+    xsimd::run_benchmark_bitpacking(std::cout, size, 5, 100);
+    xsimd::run_benchmark_bitpacking(std::cout, size, 13, 100);
+    xsimd::run_benchmark_bitpacking(std::cout, size, 27, 100);
+}
+
+void benchmark_scan()
+{
+    std::size_t size = 1000000;
+    xsimd::run_benchmark_scan(std::cout, size, 50);
+}
+
+void benchmark_text()
+{
+    std::size_t size = 1000000;
+    xsimd::run_benchmark_text(std::cout, size, 50);
+}
+
+void benchmark_encoding()
+{
+    std::size_t size = 1000000;
+    xsimd::run_benchmark_encoding(std::cout, size, 50);
+}
+
+void benchmark_parse()
+{
+    std::size_t size = 1000000;
+    xsimd::run_benchmark_parse(std::cout, size, 20);
+}
+
+void benchmark_blas()
+{
+    xsimd::run_benchmark_blas(std::cout, 4096, 10000);
+    xsimd::run_benchmark_blas(std::cout, 1000000, 50);
+}
+
+void benchmark_gemm()
+{
+    xsimd::run_benchmark_gemm(std::cout, 64, 1000);
+    xsimd::run_benchmark_gemm(std::cout, 256, 20);
+    xsimd::run_benchmark_gemm(std::cout, 1024, 3);
+}
+
+void benchmark_spmv()
+{
+    xsimd::run_benchmark_spmv(std::cout, 20);
+}
+
+void benchmark_fir()
+{
+    std::size_t size = 1000000;
+    xsimd::run_benchmark_fir(std::cout, size, 16, 10);
+    xsimd::run_benchmark_fir(std::cout, size, 64, 10);
+    xsimd::run_benchmark_fir(std::cout, size, 256, 5);
+}
+
+void benchmark_biquad()
+{
+    xsimd::run_benchmark_biquad(std::cout, 256, 4, 4000, 10);
+    xsimd::run_benchmark_biquad(std::cout, 7, 8, 100000, 10);
+}
+
+void benchmark_histogram()
+{
+    std::size_t size = 20000;
+    xsimd::run_benchmark_histogram(std::cout, size, 16, 1000);
+    xsimd::run_benchmark_histogram(std::cout, size, 1000, 1000);
+}
+
+void benchmark_lut()
+{
+    std::size_t size = 20000;
+    xsimd::run_benchmark_lut_interpolator(std::cout, size, 16, 1000);
+    xsimd::run_benchmark_lut_interpolator(std::cout, size, 4096, 1000);
+}
+
 void benchmark_rounding()
 {
     std::size_t size = 20000;
@@ -84,6 +202,23 @@ int main(int argc, char* argv[])
         fn_map["hyperbolic"] = benchmark_hyperbolic;
         fn_map["power"] = benchmark_power;
         fn_map["rounding"] = benchmark_rounding;
+        fn_map["activation"] = benchmark_activation;
+        fn_map["special"] = benchmark_special;
+        fn_map["random"] = benchmark_random;
+        fn_map["denormal"] = benchmark_denormal;
+        fn_map["hash"] = benchmark_hash;
+        fn_map["lut"] = benchmark_lut;
+        fn_map["histogram"] = benchmark_histogram;
+        fn_map["scan"] = benchmark_scan;
+        fn_map["bitpacking"] = benchmark_bitpacking;
+        fn_map["text"] = benchmark_text;
+        fn_map["encoding"] = benchmark_encoding;
+        fn_map["parse"] = benchmark_parse;
+        fn_map["blas"] = benchmark_blas;
+        fn_map["gemm"] = benchmark_gemm;
+        fn_map["spmv"] = benchmark_spmv;
+        fn_map["fir"] = benchmark_fir;
+        fn_map["biquad"] = benchmark_biquad;
 
         if (std::string(argv[1]) == "--help" || std::string(argv[1]) == "-h")
         {
@@ -94,12 +229,38 @@ int main(int argc, char* argv[])
             std::cout << "hyperbolic: run benchmark on hyperbolic functions" << std::endl;
             std::cout << "power     : run benchmark on power functions" << std::endl;
             std::cout << "rounding  : run benchmark on rounding functions" << std::endl;
+            std::cout << "activation: run benchmark on activation functions" << std::endl;
+            std::cout << "special   : run benchmark on special functions" << std::endl;
+            std::cout << "random    : run benchmark on random number generation" << std::endl;
+            std::cout << "denormal  : run benchmark on denormal arithmetic" << std::endl;
+            std::cout << "hash      : run benchmark on integer hashing, hash tables and Bloom filters" << std::endl;
+            std::cout << "lut       : run benchmark on lookup table interpolation" << std::endl;
+            std::cout << "histogram : run benchmark on histograms" << std::endl;
+            std::cout << "scan      : run benchmark on filtered column scans" << std::endl;
+            std::cout << "bitpacking: run benchmark on bit unpacking and delta decoding" << std::endl;
+            std::cout << "text      : run benchmark on UTF-8 validation and character classes" << std::endl;
+            std::cout << "encoding  : run benchmark on base64 and hex encoding" << std::endl;
+            std::cout << "parse     : run benchmark on parsing delimited numbers" << std::endl;
+            std::cout << "blas      : run benchmark on BLAS level 1 kernels" << std::endl;
+            std::cout << "gemm      : run benchmark on matrix multiplication" << std::endl;
+            std::cout << "spmv      : run benchmark on sparse matrix-vector products" << std::endl;
+            std::cout << "<file>.mtx: run benchmark on sparse matrix-vector products with a Matrix Market file" << std::endl;
+            std::cout << "fir       : run benchmark on FIR filters and polyphase resampling" << std::endl;
+            std::cout << "biquad    : run benchmark on multi-channel IIR biquad cascades" << std::endl;
         }
         else
         {
             for (int i = 1; i < argc; ++i)
             {
-                fn_map[std::string(argv[i])]();
+                std::string arg(argv[i]);
+                if (arg.size() > 4 && arg.compare(arg.size() - 4, 4, ".mtx") == 0)
+                {
+                    xsimd::run_benchmark_spmv_file(std::cout, arg, 20);
+                }
+                else
+                {
+                    fn_map[arg]();
+                }
             }
         }
     }
@@ -111,6 +272,23 @@ int main(int argc, char* argv[])
         benchmark_hyperbolic();
         benchmark_power();
         benchmark_rounding();
+        benchmark_activation();
+        benchmark_special();
+        benchmark_random();
+        benchmark_denormal();
+        benchmark_hash();
+        benchmark_lut();
+        benchmark_histogram();
+        benchmark_scan();
+        benchmark_bitpacking();
+        benchmark_text();
+        benchmark_encoding();
+        benchmark_parse();
+        benchmark_blas();
+        benchmark_gemm();
+        benchmark_spmv();
+        benchmark_fir();
+        benchmark_biquad();
     }
     return 0;
 }
@@ -9,11 +9,36 @@
 #ifndef XSIMD_BENCHMARK_HPP
 #define XSIMD_BENCHMARK_HPP
 
+#include <algorithm>
 #include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
 #include <string>
 #include <vector>
 #include <iostream>
+#include <limits>
+#include <random>
+#include <thread>
+#include <unordered_map>
 #include "xsimd/xsimd.hpp"
+#include "xsimd/algorithms/xsimd_biquad.hpp"
+#include "xsimd/algorithms/xsimd_bitmap.hpp"
+#include "xsimd/algorithms/xsimd_bitpacking.hpp"
+#include "xsimd/algorithms/xsimd_blas.hpp"
+#include "xsimd/algorithms/xsimd_bloom_filter.hpp"
+#include "xsimd/algorithms/xsimd_encoding.hpp"
+#include "xsimd/algorithms/xsimd_fir.hpp"
+#include "xsimd/algorithms/xsimd_gemm.hpp"
+#include "xsimd/algorithms/xsimd_hash.hpp"
+#include "xsimd/algorithms/xsimd_hash_table.hpp"
+#include "xsimd/algorithms/xsimd_histogram.hpp"
+#include "xsimd/algorithms/xsimd_lut_interpolator.hpp"
+#include "xsimd/algorithms/xsimd_parse.hpp"
+#include "xsimd/algorithms/xsimd_sparse.hpp"
+#include "xsimd/algorithms/xsimd_text.hpp"
+#include "xsimd/random/xsimd_distribution.hpp"
 
 namespace xsimd
 {
@@ -299,6 +324,1197 @@ namespace xsimd
         out << "============================" << std::endl;
     }
 
+    template <class F, class V>
+    duration_type benchmark_fill(F f, V& res, std::size_t number)
+    {
+        duration_type t_res = duration_type::max();
+        for (std::size_t count = 0; count < number; ++count)
+        {
+            auto start = std::chrono::steady_clock::now();
+            f(res);
+            auto end = std::chrono::steady_clock::now();
+            auto tmp = end - start;
+            t_res = tmp < t_res ? tmp : t_res;
+        }
+        return t_res;
+    }
+
+    template <class T, template <class> class SD, template <class> class XD>
+    void run_benchmark_random_type(const std::string& type_name, std::ostream& out, std::size_t size, std::size_t iter)
+    {
+        bench_vector<T> res(size);
+        std::mt19937_64 mt(42);
+        SD<T> sd;
+        auto std_fill = [&](bench_vector<T>& v) { for (auto& x : v) { x = sd(mt); } };
+        philox4x32 philox(42);
+        xoshiro256plus xoshiro(42);
+        XD<T> xd;
+        auto philox_fill = [&](bench_vector<T>& v) { xd.fill(philox, v.data(), v.size()); };
+        auto xoshiro_fill = [&](bench_vector<T>& v) { xd.fill(xoshiro, v.data(), v.size()); };
+
+        duration_type t_std = benchmark_fill(std_fill, res, iter);
+        duration_type t_philox = benchmark_fill(philox_fill, res, iter);
+        duration_type t_xoshiro = benchmark_fill(xoshiro_fill, res, iter);
+
+        out << "std::mt19937 " << type_name << ": " << t_std.count() << "ms" << std::endl;
+        out << "philox " << type_name << "      : " << t_philox.count() << "ms" << std::endl;
+        out << "xoshiro " << type_name << "     : " << t_xoshiro.count() << "ms" << std::endl;
+    }
+
+    template <template <class> class SD, template <class> class XD, class OS>
+    void run_benchmark_random(const std::string& name, OS& out, std::size_t size, std::size_t iter)
+    {
+        out << "============================" << std::endl;
+        out << name << std::endl;
+        run_benchmark_random_type<float, SD, XD>("float ", out, size, iter);
+        run_benchmark_random_type<double, SD, XD>("double", out, size, iter);
+        out << "============================" << std::endl;
+    }
+
+    template <class T>
+    void run_benchmark_denormal_type(const std::string& type_name, std::ostream& out, std::size_t size, std::size_t iter)
+    {
+        using b_type = simd_type<T>;
+        constexpr std::size_t b_size = simd_traits<T>::size;
+        bench_vector<T> in(size), res(size);
+        for (std::size_t i = 0; i < size; ++i)
+        {
+            in[i] = std::numeric_limits<T>::min() * T(i % 7 + 1) / T(8);
+        }
+        // decaying update of a state in the denormal range
+        auto decay = [&](bench_vector<T>& r)
+        {
+            for (std::size_t i = 0; i + b_size <= size; i += b_size)
+            {
+                b_type b = load_aligned(&in[i]);
+                b = fma(b, b_type(T(0.75)), b * b_type(T(0.125)));
+                b.store_aligned(&r[i]);
+            }
+        };
+        auto guarded_decay = [&](bench_vector<T>& r)
+        {
+            denormal_guard guard;
+            decay(r);
+        };
+
+        duration_type t_denormal = benchmark_fill(decay, res, iter);
+        duration_type t_guarded = benchmark_fill(guarded_decay, res, iter);
+
+        out << "denormal " << type_name << "      : " << t_denormal.count() << "ms" << std::endl;
+        out << "denormal_guard " << type_name << ": " << t_guarded.count() << "ms" << std::endl;
+    }
+
+    template <class OS>
+    void run_benchmark_denormal(OS& out, std::size_t size, std::size_t iter)
+    {
+        out << "============================" << std::endl;
+        out << "denormal" << std::endl;
+        run_benchmark_denormal_type<float>("float ", out, size, iter);
+        run_benchmark_denormal_type<double>("double", out, size, iter);
+        out << "============================" << std::endl;
+    }
+
+    template <class T>
+    void run_benchmark_hash_type(const std::string& type_name, std::ostream& out, std::size_t size, std::size_t iter)
+    {
+        using b_type = simd_type<T>;
+        using u_type = typename std::make_unsigned<T>::type;
+        constexpr std::size_t b_size = simd_traits<T>::size;
+        bench_vector<T> keys(size), res(size);
+        std::vector<std::size_t> offsets(257);
+        std::mt19937_64 generator(1);
+        for (std::size_t i = 0; i < size; ++i)
+        {
+            keys[i] = static_cast<T>(generator());
+        }
+        auto scalar_fmix = [&](bench_vector<T>& r)
+        {
+            for (std::size_t i = 0; i < size; ++i)
+            {
+                r[i] = static_cast<T>(detail::scalar_fmix(static_cast<u_type>(keys[i])));
+            }
+        };
+        auto simd_fmix = [&](bench_vector<T>& r)
+        {
+            for (std::size_t i = 0; i + b_size <= size; i += b_size)
+            {
+                murmur3_fmix(b_type(&keys[i], aligned_mode())).store_aligned(&r[i]);
+            }
+        };
+        auto simd_crc = [&](bench_vector<T>& r)
+        {
+            for (std::size_t i = 0; i + b_size <= size; i += b_size)
+            {
+                crc32c_hash(b_type(&keys[i], aligned_mode())).store_aligned(&r[i]);
+            }
+        };
+        auto partition = [&](bench_vector<T>& r)
+        {
+            hash_partition(keys.data(), size, 256, offsets.data(), r.data());
+        };
+
+        duration_type t_scalar = benchmark_fill(scalar_fmix, res, iter);
+        duration_type t_simd = benchmark_fill(simd_fmix, res, iter);
+        duration_type t_crc = benchmark_fill(simd_crc, res, iter);
+        duration_type t_partition = benchmark_fill(partition, res, iter);
+
+        out << "scalar fmix " << type_name << "   : " << t_scalar.count() << "ms" << std::endl;
+        out << "simd fmix " << type_name << "     : " << t_simd.count() << "ms" << std::endl;
+        out << "simd crc32c " << type_name << "   : " << t_crc.count() << "ms" << std::endl;
+        out << "hash_partition " << type_name << ": " << t_partition.count() << "ms" << std::endl;
+    }
+
+    template <class OS>
+    void run_benchmark_hash(OS& out, std::size_t size, std::size_t iter)
+    {
+        out << "============================" << std::endl;
+        out << "hash" << std::endl;
+        run_benchmark_hash_type<int32_t>("int32", out, size, iter);
+        run_benchmark_hash_type<int64_t>("int64", out, size, iter);
+        out << "============================" << std::endl;
+    }
+
+    template <class K>
+    void run_benchmark_hash_table_type(const std::string& type_name, std::ostream& out, std::size_t size, std::size_t iter)
+    {
+        flat_hash_map<K, K> map(size);
+        std::unordered_map<K, K> ref(size);
+        std::mt19937_64 generator(2);
+        bench_vector<K> queries(2 * size), res(2 * size);
+        for (std::size_t i = 0; i < size; ++i)
+        {
+            K key = static_cast<K>(generator() >> 1);
+            map.insert(key, K(i));
+            ref.insert({ key, K(i) });
+            queries[2 * i] = key;
+            queries[2 * i + 1] = static_cast<K>(generator() >> 1);
+        }
+        // hits and misses interleaved
+        auto std_find = [&](bench_vector<K>& r)
+        {
+            for (std::size_t i = 0; i < queries.size(); ++i)
+            {
+                auto it = ref.find(queries[i]);
+                r[i] = it == ref.end() ? K(-1) : it->second;
+            }
+        };
+        auto simd_find = [&](bench_vector<K>& r)
+        {
+            for (std::size_t i = 0; i < queries.size(); ++i)
+            {
+                const K* v = map.find(queries[i]);
+                r[i] = v == nullptr ? K(-1) : *v;
+            }
+        };
+        auto simd_batch_find = [&](bench_vector<K>& r)
+        {
+            map.find(queries.data(), queries.size(), r.data(), K(-1));
+        };
+
+        duration_type t_std = benchmark_fill(std_find, res, iter);
+        duration_type t_simd = benchmark_fill(simd_find, res, iter);
+        duration_type t_batch = benchmark_fill(simd_batch_find, res, iter);
+
+        out << "unordered_map " << type_name << "      : " << t_std.count() << "ms" << std::endl;
+        out << "flat_hash_map " << type_name << "      : " << t_simd.count() << "ms" << std::endl;
+        out << "flat_hash_map batch " << type_name << ": " << t_batch.count() << "ms" << std::endl;
+    }
+
+    template <class OS>
+    void run_benchmark_hash_table(OS& out, std::size_t size, std::size_t iter)
+    {
+        out << "============================" << std::endl;
+        out << "hash table lookup, " << size << " keys" << std::endl;
+        run_benchmark_hash_table_type<int32_t>("int32", out, size, iter);
+        run_benchmark_hash_table_type<int64_t>("int64", out, size, iter);
+        out << "============================" << std::endl;
+    }
+
+    template <class K>
+    void run_benchmark_bloom_filter_type(const std::string& type_name, std::ostream& out, std::size_t size, std::size_t iter)
+    {
+        split_block_bloom_filter<K> filter(size);
+        std::mt19937_64 generator(3);
+        bench_vector<K> keys(size), queries(2 * size);
+        for (std::size_t i = 0; i < size; ++i)
+        {
+            keys[i] = static_cast<K>(generator());
+            queries[2 * i] = keys[i];
+            queries[2 * i + 1] = static_cast<K>(generator());
+        }
+        bench_vector<uint64_t> bitmap((queries.size() + 63) / 64);
+        auto insert = [&](bench_vector<uint64_t>&)
+        {
+            filter.clear();
+            for (std::size_t i = 0; i < keys.size(); ++i)
+            {
+                filter.insert(keys[i]);
+            }
+        };
+        auto insert_many = [&](bench_vector<uint64_t>&)
+        {
+            filter.clear();
+            filter.insert_many(keys.data(), keys.size());
+        };
+        auto contains = [&](bench_vector<uint64_t>& r)
+        {
+            std::fill(r.begin(), r.end(), 0);
+            for (std::size_t i = 0; i < queries.size(); ++i)
+            {
+                r[i / 64] |= uint64_t(filter.contains(queries[i])) << (i % 64);
+            }
+        };
+        auto contains_many = [&](bench_vector<uint64_t>& r)
+        {
+            filter.contains_many(queries.data(), queries.size(), r.data());
+        };
+
+        duration_type t_insert = benchmark_fill(insert, bitmap, iter);
+        duration_type t_insert_many = benchmark_fill(insert_many, bitmap, iter);
+        duration_type t_contains = benchmark_fill(contains, bitmap, iter);
+        duration_type t_contains_many = benchmark_fill(contains_many, bitmap, iter);
+
+        out << "insert " << type_name << "       : " << t_insert.count() << "ms" << std::endl;
+        out << "insert_many " << type_name << "  : " << t_insert_many.count() << "ms" << std::endl;
+        out << "contains " << type_name << "     : " << t_contains.count() << "ms" << std::endl;
+        out << "contains_many " << type_name << ": " << t_contains_many.count() << "ms" << std::endl;
+    }
+
+    template <class OS>
+    void run_benchmark_bloom_filter(OS& out, std::size_t size, std::size_t iter)
+    {
+        out << "============================" << std::endl;
+        out << "bloom filter, " << size << " keys" << std::endl;
+        run_benchmark_bloom_filter_type<int32_t>("int32", out, size, iter);
+        run_benchmark_bloom_filter_type<int64_t>("int64", out, size, iter);
+        out << "============================" << std::endl;
+    }
+
+    template <class T>
+    void run_benchmark_lut_interpolator_type(const std::string& type_name, std::ostream& out,
+                                             std::size_t size, std::size_t table_size, std::size_t iter)
+    {
+        std::vector<T> table(table_size);
+        for (std::size_t i = 0; i < table_size; ++i)
+        {
+            table[i] = T(std::sqrt(double(i)));
+        }
+        lut_interpolator<T> lut(table.data(), table_size, T(0), T(1));
+        bench_vector<T> x(size), res(size);
+        std::mt19937_64 generator(4);
+        std::uniform_real_distribution<T> dist(T(-0.1), T(1.1));
+        for (std::size_t i = 0; i < size; ++i)
+        {
+            x[i] = dist(generator);
+        }
+        auto scalar_eval = [&](bench_vector<T>& r)
+        {
+            for (std::size_t i = 0; i < size; ++i)
+            {
+                r[i] = lut(x[i]);
+            }
+        };
+        auto simd_eval = [&](bench_vector<T>& r)
+        {
+            lut(x.data(), size, r.data());
+        };
+
+        duration_type t_scalar = benchmark_fill(scalar_eval, res, iter);
+        duration_type t_simd = benchmark_fill(simd_eval, res, iter);
+
+        out << "scalar " << type_name << ": " << t_scalar.count() << "ms" << std::endl;
+        out << "simd   " << type_name << ": " << t_simd.count() << "ms" << std::endl;
+    }
+
+    template <class OS>
+    void run_benchmark_lut_interpolator(OS& out, std::size_t size, std::size_t table_size, std::size_t iter)
+    {
+        out << "============================" << std::endl;
+        out << "lut_interpolator, " << table_size << " values" << std::endl;
+        run_benchmark_lut_interpolator_type<float>("float ", out, size, table_size, iter);
+        run_benchmark_lut_interpolator_type<double>("double", out, size, table_size, iter);
+        out << "============================" << std::endl;
+    }
+
+    template <class T>
+    void run_benchmark_bitpacking_type(const std::string& type_name, std::ostream& out,
+                                       std::size_t size, std::size_t bits, std::size_t iter)
+    {
+        using unsigned_type = typename std::make_unsigned<T>::type;
+        bench_vector<T> values(size), res(size);
+        std::mt19937_64 generator(13);
+        for (std::size_t i = 0; i < size; ++i)
+        {
+            values[i] = static_cast<T>(generator() >> (64 - bits));
+        }
+        std::vector<T> packed(bitpacked_size<T>(size, bits));
+        bitpack(values.data(), size, bits, packed.data());
+        std::vector<T> stream(packed.size() + 1);
+        detail::bitpack_tail(values.data(), size, bits, stream.data());
+
+        const std::size_t word_bits = 8 * sizeof(T);
+        const unsigned_type mask = static_cast<unsigned_type>(detail::bitpack_mask<T>(bits));
+        auto scalar_unpack = [&](bench_vector<T>& r)
+        {
+            std::size_t pos = 0;
+            for (std::size_t i = 0; i < size; ++i, pos += bits)
+            {
+                std::size_t w = pos / word_bits, shift = pos % word_bits;
+                unsigned_type v = static_cast<unsigned_type>(stream[w]) >> shift;
+                if (shift + bits > word_bits)
+                {
+                    v |= static_cast<unsigned_type>(stream[w + 1]) << (word_bits - shift);
+                }
+                r[i] = static_cast<T>(v & mask);
+            }
+        };
+        auto simd_unpack = [&](bench_vector<T>& r) { bitunpack(packed.data(), size, bits, r.data()); };
+        auto scalar_delta = [&](bench_vector<T>& r)
+        {
+            unsigned_type acc = 0;
+            for (std::size_t i = 0; i < size; ++i)
+            {
+                acc += static_cast<unsigned_type>(values[i]);
+                r[i] = static_cast<T>(acc);
+            }
+        };
+        auto simd_delta = [&](bench_vector<T>& r) { delta_decode(values.data(), size, r.data()); };
+
+        duration_type t_scalar_unpack = benchmark_fill(scalar_unpack, res, iter);
+        duration_type t_simd_unpack = benchmark_fill(simd_unpack, res, iter);
+        duration_type t_scalar_delta = benchmark_fill(scalar_delta, res, iter);
+        duration_type t_simd_delta = benchmark_fill(simd_delta, res, iter);
+
+        out << "scalar unpack " << type_name << ": " << t_scalar_unpack.count() << "ms" << std::endl;
+        out << "simd unpack   " << type_name << ": " << t_simd_unpack.count() << "ms" << std::endl;
+        out << "scalar delta  " << type_name << ": " << t_scalar_delta.count() << "ms" << std::endl;
+        out << "simd delta    " << type_name << ": " << t_simd_delta.count() << "ms" << std::endl;
+    }
+
+    template <class OS>
+    void run_benchmark_bitpacking(OS& out, std::size_t size, std::size_t bits, std::size_t iter)
+    {
+        out << "============================" << std::endl;
+        out << "bit unpacking and delta decoding, " << bits << " bits" << std::endl;
+        run_benchmark_bitpacking_type<int32_t>("int32", out, size, bits, iter);
+        run_benchmark_bitpacking_type<int64_t>("int64", out, size, bits, iter);
+        out << "============================" << std::endl;
+    }
+
+    // col > a AND col2 <= b, with a and b chosen so that each predicate
+    // selects half of the rows
+    template <class T>
+    void run_benchmark_scan_type(const std::string& type_name, std::ostream& out, std::size_t size, std::size_t iter)
+    {
+        bench_vector<T> col(size), col2(size);
+        std::mt19937_64 generator(11);
+        for (std::size_t i = 0; i < size; ++i)
+        {
+            col[i] = static_cast<T>(generator() % 1000);
+            col2[i] = static_cast<T>(generator() % 1000);
+        }
+        const T a = T(500), b = T(499);
+        std::size_t num_words = (size + 63) / 64;
+        std::vector<uint64_t> bitmap(num_words), bitmap2(num_words);
+        std::vector<uint32_t> indices(size);
+        auto scalar_scan = [&](std::vector<uint32_t>& res)
+        {
+            std::size_t count = 0;
+            for (std::size_t i = 0; i < size; ++i)
+            {
+                if (col[i] > a && col2[i] <= b)
+                {
+                    res[count++] = static_cast<uint32_t>(i);
+                }
+            }
+            return count;
+        };
+        auto bitmap_scan = [&](std::vector<uint32_t>& res)
+        {
+            bitmap_compare(col.data(), size, compare_op::greater, a, bitmap.data());
+            bitmap_compare(col2.data(), size, compare_op::less_equal, b, bitmap2.data());
+            bitmap_and(bitmap.data(), bitmap2.data(), size, bitmap.data());
+            return bitmap_to_indices(bitmap.data(), size, res.data());
+        };
+        auto predicate = [&](std::vector<uint32_t>&)
+        {
+            bitmap_compare(col.data(), size, compare_op::greater, a, bitmap.data());
+        };
+        auto popcount = [&](std::vector<uint32_t>& res)
+        {
+            res[0] = static_cast<uint32_t>(bitmap_popcount(bitmap.data(), size));
+        };
+
+        duration_type t_scalar = benchmark_fill(scalar_scan, indices, iter);
+        duration_type t_bitmap = benchmark_fill(bitmap_scan, indices, iter);
+        duration_type t_predicate = benchmark_fill(predicate, indices, iter);
+        duration_type t_popcount = benchmark_fill(popcount, indices, iter);
+
+        out << "scalar scan  " << type_name << ": " << t_scalar.count() << "ms" << std::endl;
+        out << "bitmap scan  " << type_name << ": " << t_bitmap.count() << "ms" << std::endl;
+        out << "predicate    " << type_name << ": " << t_predicate.count() << "ms" << std::endl;
+        out << "popcount     " << type_name << ": " << t_popcount.count() << "ms" << std::endl;
+    }
+
+    template <class OS>
+    void run_benchmark_scan(OS& out, std::size_t size, std::size_t iter)
+    {
+        out << "============================" << std::endl;
+        out << "filtered scan" << std::endl;
+        run_benchmark_scan_type<int32_t>("int32 ", out, size, iter);
+        run_benchmark_scan_type<int64_t>("int64 ", out, size, iter);
+        run_benchmark_scan_type<float>("float ", out, size, iter);
+        run_benchmark_scan_type<double>("double", out, size, iter);
+        out << "============================" << std::endl;
+    }
+
+    template <class T>
+    void run_benchmark_histogram_type(const std::string& type_name, std::ostream& out,
+                                      std::size_t size, std::size_t bins, std::size_t iter)
+    {
+        const T lo = T(0), hi = T(1000);
+        bench_vector<T> values(size);
+        std::mt19937_64 generator(5);
+        std::normal_distribution<double> dist(500., 200.);
+        for (std::size_t i = 0; i < size; ++i)
+        {
+            values[i] = static_cast<T>(dist(generator));
+        }
+        std::vector<T> edges(bins + 1);
+        for (std::size_t k = 0; k <= bins; ++k)
+        {
+            edges[k] = static_cast<T>(double(lo) + double(hi - lo) * double(k) / double(bins));
+        }
+        std::vector<std::size_t> counts(bins);
+        auto scalar_hist = [&](std::vector<std::size_t>& c)
+        {
+            std::fill(c.begin(), c.end(), std::size_t(0));
+            const double scale = double(bins) / double(hi - lo);
+            for (std::size_t i = 0; i < size; ++i)
+            {
+                T x = values[i];
+                if (x >= lo && x <= hi)
+                {
+                    std::size_t k = static_cast<std::size_t>((double(x) - double(lo)) * scale);
+                    ++c[k < bins ? k : bins - 1];
+                }
+            }
+        };
+        auto uniform_hist = [&](std::vector<std::size_t>& c)
+        {
+            histogram(values.data(), size, bins, lo, hi, c.data());
+        };
+        auto scalar_edges_hist = [&](std::vector<std::size_t>& c)
+        {
+            std::fill(c.begin(), c.end(), std::size_t(0));
+            for (std::size_t i = 0; i < size; ++i)
+            {
+                T x = values[i];
+                if (x >= edges.front() && x <= edges.back())
+                {
+                    std::size_t k = static_cast<std::size_t>(std::upper_bound(edges.begin(), edges.end(), x) - edges.begin()) - 1;
+                    ++c[k < bins ? k : bins - 1];
+                }
+            }
+        };
+        auto edges_hist = [&](std::vector<std::size_t>& c)
+        {
+            histogram(values.data(), size, edges.data(), edges.size(), c.data());
+        };
+
+        duration_type t_scalar = benchmark_fill(scalar_hist, counts, iter);
+        duration_type t_uniform = benchmark_fill(uniform_hist, counts, iter);
+        duration_type t_scalar_edges = benchmark_fill(scalar_edges_hist, counts, iter);
+        duration_type t_edges = benchmark_fill(edges_hist, counts, iter);
+
+        out << "scalar uniform " << type_name << ": " << t_scalar.count() << "ms" << std::endl;
+        out << "simd uniform   " << type_name << ": " << t_uniform.count() << "ms" << std::endl;
+        out << "scalar edges   " << type_name << ": " << t_scalar_edges.count() << "ms" << std::endl;
+        out << "simd edges     " << type_name << ": " << t_edges.count() << "ms" << std::endl;
+    }
+
+    template <class OS>
+    void run_benchmark_histogram(OS& out, std::size_t size, std::size_t bins, std::size_t iter)
+    {
+        out << "============================" << std::endl;
+        out << "histogram, " << bins << " bins" << std::endl;
+        run_benchmark_histogram_type<float>("float ", out, size, bins, iter);
+        run_benchmark_histogram_type<double>("double", out, size, bins, iter);
+        run_benchmark_histogram_type<int32_t>("int32 ", out, size, bins, iter);
+        out << "============================" << std::endl;
+    }
+
+    // byte by byte UTF-8 validation, following the table 3-7 of the
+    // Unicode standard
+    inline bool scalar_utf8_validate(const std::string& text)
+    {
+        const uint8_t* p = reinterpret_cast<const uint8_t*>(text.data());
+        std::size_t n = text.size(), i = 0;
+        while (i < n)
+        {
+            uint8_t c = p[i];
+            if (c < 0x80)
+            {
+                ++i;
+                continue;
+            }
+            std::size_t len = c >= 0xf0 ? 4 : (c >= 0xe0 ? 3 : 2);
+            uint8_t lo = c == 0xe0 ? 0xa0 : (c == 0xf0 ? 0x90 : 0x80);
+            uint8_t hi = c == 0xed ? 0x9f : (c == 0xf4 ? 0x8f : 0xbf);
+            if (c < 0xc2 || c > 0xf4 || i + len > n || p[i + 1] < lo || p[i + 1] > hi)
+            {
+                return false;
+            }
+            for (std::size_t k = 2; k < len; ++k)
+            {
+                if ((p[i + k] & 0xc0) != 0x80)
+                {
+                    return false;
+                }
+            }
+            i += len;
+        }
+        return true;
+    }
+
+    inline void run_benchmark_text_input(const std::string& text_name, std::ostream& out,
+                                         const std::string& text, std::size_t iter)
+    {
+        const std::size_t size = text.size();
+        const char_class delimiters(",;\t\n\"");
+        std::vector<uint64_t> bitmap((size + 63) / 64);
+        auto scalar_utf8 = [&](std::vector<uint64_t>& res) { res[0] = scalar_utf8_validate(text); };
+        auto simd_utf8 = [&](std::vector<uint64_t>& res) { res[0] = is_valid_utf8(text.data(), size); };
+        auto scalar_ascii = [&](std::vector<uint64_t>& res)
+        {
+            uint8_t acc = 0;
+            for (std::size_t i = 0; i < size; ++i)
+            {
+                acc |= static_cast<uint8_t>(text[i]);
+            }
+            res[0] = acc < 0x80;
+        };
+        auto simd_ascii = [&](std::vector<uint64_t>& res) { res[0] = is_ascii(text.data(), size); };
+        auto scalar_class = [&](std::vector<uint64_t>& res)
+        {
+            for (std::size_t i = 0; i < size; i += 64)
+            {
+                uint64_t word = 0;
+                for (std::size_t j = 0; j < 64 && i + j < size; ++j)
+                {
+                    char c = text[i + j];
+                    word |= uint64_t(c == ',' || c == ';' || c == '\t' || c == '\n' || c == '"') << j;
+                }
+                res[i / 64] = word;
+            }
+        };
+        auto simd_class = [&](std::vector<uint64_t>& res) { char_class_bitmap(text.data(), size, delimiters, res.data()); };
+
+        auto print = [&](const std::string& name, duration_type t)
+        {
+            out << name << text_name << ": " << t.count() << "ms, " << double(size) / (t.count() * 1e6) << "GB/s" << std::endl;
+        };
+        print("scalar utf8  ", benchmark_fill(scalar_utf8, bitmap, iter));
+        print("simd utf8    ", benchmark_fill(simd_utf8, bitmap, iter));
+        print("scalar ascii ", benchmark_fill(scalar_ascii, bitmap, iter));
+        print("simd ascii   ", benchmark_fill(simd_ascii, bitmap, iter));
+        print("scalar class ", benchmark_fill(scalar_class, bitmap, iter));
+        print("simd class   ", benchmark_fill(simd_class, bitmap, iter));
+    }
+
+    // ASCII text, and text with one multibyte character every 8 ones
+    template <class OS>
+    void run_benchmark_text(OS& out, std::size_t size, std::size_t iter)
+    {
+        const char* words[] = { "lorem", "ipsum", "12.5", "\"dolor\"", "sit", "amet", "-3" };
+        const char* accents[] = { "\xc3\xa9", "\xe2\x82\xac", "\xf0\x9f\x98\x80", "\xce\xbb" };
+        std::mt19937_64 generator(17);
+        std::string ascii, utf8;
+        while (ascii.size() < size)
+        {
+            ascii += words[generator() % 7];
+            ascii += generator() % 8 == 0 ? '\n' : ',';
+        }
+        while (utf8.size() < size)
+        {
+            uint64_t r = generator();
+            utf8 += r % 8 == 0 ? accents[(r >> 8) % 4] : words[(r >> 8) % 7];
+            utf8 += r % 5 == 0 ? '\n' : ',';
+        }
+        ascii.resize(size);
+        utf8 = utf8.substr(0, utf8.rfind(',', size));
+
+        out << "============================" << std::endl;
+        out << "text scanning, " << size << " bytes" << std::endl;
+        run_benchmark_text_input("ascii", out, ascii, iter);
+        run_benchmark_text_input("utf8 ", out, utf8, iter);
+        out << "============================" << std::endl;
+    }
+
+    // base64 and hex, against byte by byte loops
+    template <class OS>
+    void run_benchmark_encoding(OS& out, std::size_t size, std::size_t iter)
+    {
+        const char* alphabet = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+        const char* digits = "0123456789abcdef";
+        std::vector<uint8_t> data(size);
+        std::mt19937_64 generator(29);
+        for (uint8_t& x : data)
+        {
+            x = static_cast<uint8_t>(generator());
+        }
+        std::string base64(base64_encoded_size(size), ' '), hex(2 * size, ' ');
+        base64_encode(data.data(), size, &base64[0]);
+        hex_encode(data.data(), size, &hex[0]);
+        int8_t values[256];
+        std::fill(values, values + 256, int8_t(-1));
+        for (int i = 0; i < 64; ++i)
+        {
+            values[static_cast<uint8_t>(alphabet[i])] = static_cast<int8_t>(i);
+        }
+
+        std::vector<char> chars(2 * size);
+        std::vector<uint8_t> bytes(size + 64);
+        auto scalar_base64_encode = [&](std::vector<char>& res)
+        {
+            std::size_t j = 0;
+            for (std::size_t i = 0; i + 3 <= size; i += 3, j += 4)
+            {
+                uint32_t v = uint32_t(data[i]) << 16 | uint32_t(data[i + 1]) << 8 | data[i + 2];
+                res[j] = alphabet[v >> 18];
+                res[j + 1] = alphabet[(v >> 12) & 0x3f];
+                res[j + 2] = alphabet[(v >> 6) & 0x3f];
+                res[j + 3] = alphabet[v & 0x3f];
+            }
+        };
+        auto simd_base64_encode = [&](std::vector<char>& res) { base64_encode(data.data(), size, res.data()); };
+        auto scalar_base64_decode = [&](std::vector<uint8_t>& res)
+        {
+            int error = 0;
+            std::size_t j = 0;
+            for (std::size_t i = 0; i + 4 <= base64.size(); i += 4, j += 3)
+            {
+                int d0 = values[static_cast<uint8_t>(base64[i])], d1 = values[static_cast<uint8_t>(base64[i + 1])];
+                int d2 = values[static_cast<uint8_t>(base64[i + 2])], d3 = values[static_cast<uint8_t>(base64[i + 3])];
+                error |= d0 | d1 | d2 | d3;
+                uint32_t v = uint32_t(d0) << 18 | uint32_t(d1) << 12 | uint32_t(d2) << 6 | uint32_t(d3);
+                res[j] = static_cast<uint8_t>(v >> 16);
+                res[j + 1] = static_cast<uint8_t>(v >> 8);
+                res[j + 2] = static_cast<uint8_t>(v);
+            }
+            res[size] = error < 0;
+        };
+        auto simd_base64_decode = [&](std::vector<uint8_t>& res)
+        {
+            std::size_t n = 0;
+            res[size] = base64_decode(base64.data(), base64.size(), res.data(), n);
+        };
+        auto scalar_hex_encode = [&](std::vector<char>& res)
+        {
+            for (std::size_t i = 0; i < size; ++i)
+            {
+                res[2 * i] = digits[data[i] >> 4];
+                res[2 * i + 1] = digits[data[i] & 0x0f];
+            }
+        };
+        auto simd_hex_encode = [&](std::vector<char>& res) { hex_encode(data.data(), size, res.data()); };
+        auto scalar_hex_decode = [&](std::vector<uint8_t>& res)
+        {
+            for (std::size_t i = 0; i < size; ++i)
+            {
+                char hi = hex[2 * i], lo = hex[2 * i + 1];
+                res[i] = static_cast<uint8_t>((hi <= '9' ? hi - '0' : hi - 'a' + 10) << 4 | (lo <= '9' ? lo - '0' : lo - 'a' + 10));
+            }
+        };
+        auto simd_hex_decode = [&](std::vector<uint8_t>& res) { res[size] = hex_decode(hex.data(), hex.size(), res.data()); };
+
+        auto print = [&](const std::string& name, duration_type t)
+        {
+            out << name << ": " << t.count() << "ms, " << double(size) / (t.count() * 1e6) << "GB/s" << std::endl;
+        };
+        out << "============================" << std::endl;
+        out << "base64 and hex, " << size << " bytes" << std::endl;
+        print("scalar base64 encode", benchmark_fill(scalar_base64_encode, chars, iter));
+        print("simd base64 encode  ", benchmark_fill(simd_base64_encode, chars, iter));
+        print("scalar base64 decode", benchmark_fill(scalar_base64_decode, bytes, iter));
+        print("simd base64 decode  ", benchmark_fill(simd_base64_decode, bytes, iter));
+        print("scalar hex encode   ", benchmark_fill(scalar_hex_encode, chars, iter));
+        print("simd hex encode     ", benchmark_fill(simd_hex_encode, chars, iter));
+        print("scalar hex decode   ", benchmark_fill(scalar_hex_decode, bytes, iter));
+        print("simd hex decode     ", benchmark_fill(simd_hex_decode, bytes, iter));
+        out << "============================" << std::endl;
+    }
+
+    template <class T>
+    void run_benchmark_parse_type(const std::string& type_name, std::ostream& out, const std::string& text,
+                                  std::size_t size, std::size_t iter)
+    {
+        using parse_vector = std::vector<T, aligned_allocator<T, XSIMD_DEFAULT_ALIGNMENT>>;
+        auto scalar_parse = [&](parse_vector& res)
+        {
+            res.clear();
+            const char* p = text.c_str();
+            while (*p != '\0')
+            {
+                char* end;
+                res.push_back(std::is_same<T, double>::value ? static_cast<T>(std::strtod(p, &end)) : static_cast<T>(std::strtoll(p, &end, 10)));
+                p = *end == ',' ? end + 1 : end;
+            }
+        };
+        auto simd_parse = [&](parse_vector& res)
+        {
+            res.clear();
+            parse_numbers(text.data(), text.size(), ',', res);
+        };
+        parse_vector res;
+        res.reserve(size);
+        auto print = [&](const std::string& name, duration_type t)
+        {
+            out << name << ": " << t.count() << "ms, " << double(text.size()) / (t.count() * 1e6) << "GB/s" << std::endl;
+        };
+        print("scalar " + type_name, benchmark_fill(scalar_parse, res, iter));
+        print("simd " + type_name + "  ", benchmark_fill(simd_parse, res, iter));
+    }
+
+    template <class OS>
+    void run_benchmark_parse(OS& out, std::size_t size, std::size_t iter)
+    {
+        std::mt19937_64 generator(37);
+        std::string integers, doubles;
+        char buffer[64];
+        for (std::size_t i = 0; i < size; ++i)
+        {
+            integers += std::to_string(static_cast<int32_t>(generator() >> (32 + generator() % 32)));
+            integers += ',';
+            std::snprintf(buffer, sizeof(buffer), "%.*f,", static_cast<int>(generator() % 7),
+                          static_cast<double>(static_cast<int64_t>(generator() % 2000000) - 1000000) / 100.);
+            doubles += buffer;
+        }
+        out << "============================" << std::endl;
+        out << "parse_numbers, " << size << " values" << std::endl;
+        run_benchmark_parse_type<int32_t>("int32 ", out, integers, size, iter);
+        run_benchmark_parse_type<double>("double", out, doubles, size, iter);
+        out << "============================" << std::endl;
+    }
+
+    template <class T>
+    void run_benchmark_blas_type(const std::string& type_name, std::ostream& out, std::size_t size, std::size_t iter)
+    {
+        bench_vector<T> x(size), y(size), res(1);
+        std::mt19937_64 generator(41);
+        std::uniform_real_distribution<T> distribution(T(-1), T(1));
+        for (std::size_t i = 0; i < size; ++i)
+        {
+            x[i] = distribution(generator);
+            y[i] = distribution(generator);
+        }
+        auto scalar_axpy = [&](bench_vector<T>&) { for (std::size_t i = 0; i < size; ++i) { y[i] += T(1e-3) * x[i]; } };
+        auto simd_axpy = [&](bench_vector<T>&) { axpy(T(1e-3), x, y); };
+        auto scalar_dot = [&](bench_vector<T>& r)
+        {
+            T s = T(0);
+            for (std::size_t i = 0; i < size; ++i)
+            {
+                s += x[i] * y[i];
+            }
+            r[0] = s;
+        };
+        auto simd_dot = [&](bench_vector<T>& r) { r[0] = dot(x, y); };
+        auto scalar_nrm2 = [&](bench_vector<T>& r)
+        {
+            T s = T(0);
+            for (std::size_t i = 0; i < size; ++i)
+            {
+                s += x[i] * x[i];
+            }
+            r[0] = std::sqrt(s);
+        };
+        auto simd_nrm2 = [&](bench_vector<T>& r) { r[0] = nrm2(x); };
+        auto scalar_asum = [&](bench_vector<T>& r)
+        {
+            T s = T(0);
+            for (std::size_t i = 0; i < size; ++i)
+            {
+                s += std::abs(x[i]);
+            }
+            r[0] = s;
+        };
+        auto simd_asum = [&](bench_vector<T>& r) { r[0] = asum(x); };
+        auto scalar_scal = [&](bench_vector<T>&) { for (std::size_t i = 0; i < size; ++i) { x[i] *= T(-1); } };
+        auto simd_scal = [&](bench_vector<T>&) { scal(T(-1), x); };
+        auto scalar_iamax = [&](bench_vector<T>& r)
+        {
+            std::size_t k = 0;
+            T m = T(-1);
+            for (std::size_t i = 0; i < size; ++i)
+            {
+                k = std::abs(x[i]) > m ? i : k;
+                m = std::abs(x[i]) > m ? std::abs(x[i]) : m;
+            }
+            r[0] = static_cast<T>(k);
+        };
+        auto simd_iamax = [&](bench_vector<T>& r) { r[0] = static_cast<T>(iamax(x)); };
+
+        auto print = [&](const std::string& name, std::size_t arrays, duration_type t)
+        {
+            out << name << " " << type_name << ": " << t.count() << "ms, "
+                << static_cast<double>(arrays * size * sizeof(T)) / (t.count() * 1e6) << "GB/s" << std::endl;
+        };
+        print("scalar axpy ", 2, benchmark_fill(scalar_axpy, res, iter));
+        print("simd axpy   ", 2, benchmark_fill(simd_axpy, res, iter));
+        print("scalar dot  ", 2, benchmark_fill(scalar_dot, res, iter));
+        print("simd dot    ", 2, benchmark_fill(simd_dot, res, iter));
+        print("scalar nrm2 ", 1, benchmark_fill(scalar_nrm2, res, iter));
+        print("simd nrm2   ", 1, benchmark_fill(simd_nrm2, res, iter));
+        print("scalar asum ", 1, benchmark_fill(scalar_asum, res, iter));
+        print("simd asum   ", 1, benchmark_fill(simd_asum, res, iter));
+        print("scalar scal ", 1, benchmark_fill(scalar_scal, res, iter));
+        print("simd scal   ", 1, benchmark_fill(simd_scal, res, iter));
+        print("scalar iamax", 1, benchmark_fill(scalar_iamax, res, iter));
+        print("simd iamax  ", 1, benchmark_fill(simd_iamax, res, iter));
+    }
+
+    template <class OS>
+    void run_benchmark_blas(OS& out, std::size_t size, std::size_t iter)
+    {
+        out << "============================" << std::endl;
+        out << "blas level 1, " << size << " values" << std::endl;
+        run_benchmark_blas_type<float>("float ", out, size, iter);
+        run_benchmark_blas_type<double>("double", out, size, iter);
+        out << "============================" << std::endl;
+    }
+
+    template <class T>
+    void run_benchmark_gemm_type(const std::string& type_name, std::ostream& out, std::size_t size, std::size_t iter)
+    {
+        bench_vector<T> a(size * size), b(size * size), c(size * size);
+        std::mt19937_64 generator(43);
+        std::uniform_real_distribution<T> distribution(T(-1), T(1));
+        for (std::size_t i = 0; i < size * size; ++i)
+        {
+            a[i] = distribution(generator);
+            b[i] = distribution(generator);
+        }
+        // the i, p, j order vectorizes the inner loop
+        auto scalar_gemm = [&](bench_vector<T>& res)
+        {
+            std::fill(res.begin(), res.end(), T(0));
+            for (std::size_t i = 0; i < size; ++i)
+            {
+                for (std::size_t p = 0; p < size; ++p)
+                {
+                    T x = a[i * size + p];
+                    for (std::size_t j = 0; j < size; ++j)
+                    {
+                        res[i * size + j] += x * b[p * size + j];
+                    }
+                }
+            }
+        };
+        auto simd_gemm = [&](bench_vector<T>& res)
+        {
+            gemm(matrix_layout::row_major, size, size, size, T(1), a.data(), size, b.data(), size, T(0), res.data(), size);
+        };
+        auto print = [&](const std::string& name, duration_type t)
+        {
+            double flops = 2. * static_cast<double>(size) * static_cast<double>(size) * static_cast<double>(size);
+            out << name << " " << type_name << ": " << t.count() << "ms, " << flops / (t.count() * 1e6) << "GFLOPS" << std::endl;
+        };
+        print("scalar gemm", benchmark_fill(scalar_gemm, c, iter));
+        print("simd gemm  ", benchmark_fill(simd_gemm, c, iter));
+    }
+
+    template <class OS>
+    void run_benchmark_gemm(OS& out, std::size_t size, std::size_t iter)
+    {
+        out << "============================" << std::endl;
+        out << "gemm, " << size << " x " << size << std::endl;
+        run_benchmark_gemm_type<float>("float ", out, size, iter);
+        run_benchmark_gemm_type<double>("double", out, size, iter);
+        out << "============================" << std::endl;
+    }
+
+    // 5 points Laplacian of a size x size grid
+    template <class T>
+    csr_matrix<T> laplacian_matrix(std::size_t size)
+    {
+        std::vector<std::size_t> offsets(1, 0);
+        std::vector<int32_t> columns;
+        std::vector<T> values;
+        for (std::size_t i = 0; i < size; ++i)
+        {
+            for (std::size_t j = 0; j < size; ++j)
+            {
+                // the neighbours outside of the grid are dropped
+                std::size_t row = i * size + j;
+                std::size_t neighbours[5] = { row - size, row - 1, row, row + 1, row + size };
+                bool inside[5] = { i > 0, j > 0, true, j + 1 < size, i + 1 < size };
+                for (std::size_t k = 0; k < 5; ++k)
+                {
+                    if (inside[k])
+                    {
+                        columns.push_back(static_cast<int32_t>(neighbours[k]));
+                        values.push_back(k == 2 ? T(4) : T(-1));
+                    }
+                }
+                offsets.push_back(columns.size());
+            }
+        }
+        return csr_matrix<T>(size * size, size * size, std::move(offsets), std::move(columns), std::move(values));
+    }
+
+    // rows of 1 to 2 * mean_length - 1 nonzeros, at random columns of a
+    // band of width 10000 around the diagonal
+    template <class T>
+    csr_matrix<T> random_sparse_matrix(std::size_t size, std::size_t mean_length)
+    {
+        std::mt19937_64 generator(44);
+        std::uniform_real_distribution<T> distribution(T(-1), T(1));
+        std::vector<std::size_t> offsets(1, 0);
+        std::vector<int32_t> columns;
+        std::vector<T> values;
+        for (std::size_t i = 0; i < size; ++i)
+        {
+            std::size_t length = 1 + generator() % (2 * mean_length - 1);
+            std::size_t first = i > 5000 ? i - 5000 : 0;
+            std::size_t width = std::min(size, first + 10000) - first;
+            std::size_t begin = columns.size();
+            for (std::size_t k = 0; k < length; ++k)
+            {
+                columns.push_back(static_cast<int32_t>(first + generator() % width));
+                values.push_back(distribution(generator));
+            }
+            std::sort(columns.begin() + static_cast<std::ptrdiff_t>(begin), columns.end());
+            offsets.push_back(columns.size());
+        }
+        return csr_matrix<T>(size, size, std::move(offsets), std::move(columns), std::move(values));
+    }
+
+    template <class T>
+    void run_benchmark_spmv_type(const std::string& type_name, std::ostream& out, const csr_matrix<T>& a, std::size_t iter)
+    {
+        std::mt19937_64 generator(45);
+        std::uniform_real_distribution<T> distribution(T(-1), T(1));
+        bench_vector<T> x(a.num_cols()), y(a.num_rows());
+        for (T& v : x)
+        {
+            v = distribution(generator);
+        }
+        sell_matrix<T> s1(a, 1), s256(a, 256);
+        std::size_t num_threads = std::max(1u, std::thread::hardware_concurrency());
+
+        auto scalar_spmv = [&](bench_vector<T>& res)
+        {
+            for (std::size_t i = 0; i < a.num_rows(); ++i)
+            {
+                T sum = T(0);
+                for (std::size_t j = a.row_offsets()[i]; j < a.row_offsets()[i + 1]; ++j)
+                {
+                    sum += a.values()[j] * x[a.columns()[j]];
+                }
+                res[i] = sum;
+            }
+        };
+        auto csr_spmv = [&](bench_vector<T>& res) { a.multiply(x.data(), res.data()); };
+        auto sell1_spmv = [&](bench_vector<T>& res) { s1.multiply(x.data(), res.data()); };
+        auto sell256_spmv = [&](bench_vector<T>& res) { s256.multiply(x.data(), res.data()); };
+        auto csr_spmv_mt = [&](bench_vector<T>& res) { a.multiply(x.data(), res.data(), num_threads); };
+        auto sell256_spmv_mt = [&](bench_vector<T>& res) { s256.multiply(x.data(), res.data(), num_threads); };
+
+        auto print = [&](const std::string& name, duration_type t)
+        {
+            double flops = 2. * static_cast<double>(a.num_nonzeros());
+            out << name << " " << type_name << ": " << t.count() << "ms, " << flops / (t.count() * 1e6) << "GFLOPS" << std::endl;
+        };
+        print("scalar csr       ", benchmark_fill(scalar_spmv, y, iter));
+        print("simd csr         ", benchmark_fill(csr_spmv, y, iter));
+        print("sell, sigma 1    ", benchmark_fill(sell1_spmv, y, iter));
+        print("sell, sigma 256  ", benchmark_fill(sell256_spmv, y, iter));
+        if (num_threads > 1)
+        {
+            out << num_threads << " threads:" << std::endl;
+            print("simd csr         ", benchmark_fill(csr_spmv_mt, y, iter));
+            print("sell, sigma 256  ", benchmark_fill(sell256_spmv_mt, y, iter));
+        }
+        out << "sell padding " << type_name << ": " << static_cast<double>(s1.storage_size()) / static_cast<double>(a.num_nonzeros())
+            << " (sigma 1), " << static_cast<double>(s256.storage_size()) / static_cast<double>(a.num_nonzeros()) << " (sigma 256)" << std::endl;
+    }
+
+    template <class OS>
+    void run_benchmark_spmv(OS& out, std::size_t iter)
+    {
+        out << "============================" << std::endl;
+        out << "spmv, 5 points Laplacian on a 1000 x 1000 grid" << std::endl;
+        run_benchmark_spmv_type<float>("float ", out, laplacian_matrix<float>(1000), iter);
+        run_benchmark_spmv_type<double>("double", out, laplacian_matrix<double>(1000), iter);
+        out << "============================" << std::endl;
+        out << "spmv, 200000 random rows of 1 to 47 nonzeros" << std::endl;
+        run_benchmark_spmv_type<float>("float ", out, random_sparse_matrix<float>(200000, 24), iter);
+        run_benchmark_spmv_type<double>("double", out, random_sparse_matrix<double>(200000, 24), iter);
+        out << "============================" << std::endl;
+    }
+
+    template <class OS>
+    void run_benchmark_spmv_file(OS& out, const std::string& path, std::size_t iter)
+    {
+        out << "============================" << std::endl;
+        out << "spmv, " << path << std::endl;
+        csr_matrix<float> af;
+        csr_matrix<double> ad;
+        std::ifstream in_float(path), in_double(path);
+        if (!read_matrix_market(in_float, af) || !read_matrix_market(in_double, ad))
+        {
+            out << "cannot read a Matrix Market coordinate matrix from " << path << std::endl;
+        }
+        else
+        {
+            out << af.num_rows() << " x " << af.num_cols() << ", " << af.num_nonzeros() << " nonzeros" << std::endl;
+            run_benchmark_spmv_type<float>("float ", out, af, iter);
+            run_benchmark_spmv_type<double>("double", out, ad, iter);
+        }
+        out << "============================" << std::endl;
+    }
+
+    template <class T>
+    void run_benchmark_fir_type(const std::string& type_name, std::ostream& out, std::size_t size, std::size_t num_taps, std::size_t iter)
+    {
+        bench_vector<T> x(size), taps(num_taps), res(4 * size);
+        std::mt19937_64 generator(46);
+        std::uniform_real_distribution<T> distribution(T(-1), T(1));
+        for (T& v : x)
+        {
+            v = distribution(generator);
+        }
+        for (T& v : taps)
+        {
+            v = distribution(generator) / static_cast<T>(num_taps);
+        }
+        auto scalar_fir = [&](bench_vector<T>& r)
+        {
+            for (std::size_t i = 0; i < size; ++i)
+            {
+                T sum = T(0);
+                for (std::size_t j = 0; j < num_taps && j <= i; ++j)
+                {
+                    sum += taps[j] * x[i - j];
+                }
+                r[i] = sum;
+            }
+        };
+        fir_filter<T> filter(taps.data(), num_taps);
+        fir_decimator<T> decimator(taps.data(), num_taps, 4);
+        fir_interpolator<T> interpolator(taps.data(), num_taps, 4);
+        auto simd_fir = [&](bench_vector<T>& r) { filter.process(size, x.data(), r.data()); };
+        auto simd_decimator = [&](bench_vector<T>& r) { decimator.process(size, x.data(), r.data()); };
+        auto simd_interpolator = [&](bench_vector<T>& r) { interpolator.process(size / 4, x.data(), r.data()); };
+
+        // the decimator and the interpolator compute a fourth of the
+        // products of the filter
+        auto print = [&](const std::string& name, std::size_t products, duration_type t)
+        {
+            out << name << " " << type_name << ": " << t.count() << "ms, "
+                << static_cast<double>(products) / (t.count() * 1e6) << "GMAC/s" << std::endl;
+        };
+        print("scalar fir          ", size * num_taps, benchmark_fill(scalar_fir, res, iter));
+        print("simd fir            ", size * num_taps, benchmark_fill(simd_fir, res, iter));
+        print("simd decimator, 4   ", size * num_taps / 4, benchmark_fill(simd_decimator, res, iter));
+        print("simd interpolator, 4", size * num_taps / 4, benchmark_fill(simd_interpolator, res, iter));
+    }
+
+    template <class OS>
+    void run_benchmark_fir(OS& out, std::size_t size, std::size_t num_taps, std::size_t iter)
+    {
+        out << "============================" << std::endl;
+        out << "fir, " << size << " samples, " << num_taps << " taps" << std::endl;
+        run_benchmark_fir_type<float>("float ", out, size, num_taps, iter);
+        run_benchmark_fir_type<double>("double", out, size, num_taps, iter);
+        out << "============================" << std::endl;
+    }
+
+    template <class T>
+    void run_benchmark_biquad_type(const std::string& type_name, std::ostream& out, std::size_t num_channels,
+                                   std::size_t num_sections, std::size_t num_frames, std::size_t iter)
+    {
+        std::size_t size = num_channels * num_frames;
+        bench_vector<T> x(size), res(size);
+        std::mt19937_64 generator(47);
+        std::uniform_real_distribution<T> distribution(T(-1), T(1));
+        for (T& v : x)
+        {
+            v = distribution(generator);
+        }
+        // lowpass sections, whose state decays into the denormal range
+        // after the input is silenced
+        std::fill(x.begin() + static_cast<std::ptrdiff_t>(size / 2), x.end(), T(0));
+        std::vector<biquad_coefficients<T>> sections(num_channels * num_sections);
+        for (biquad_coefficients<T>& k : sections)
+        {
+            T r = T(0.9) + T(0.05) * distribution(generator);
+            T theta = T(0.1) + T(0.05) * distribution(generator);
+            k.a1 = T(-2) * r * std::cos(theta);
+            k.a2 = r * r;
+            k.b0 = k.b2 = (T(1) + k.a1 + k.a2) / T(4);
+            k.b1 = T(2) * k.b0;
+        }
+        std::vector<T> state(num_channels * num_sections * 2);
+
+        // channel by channel, in direct form I
+        auto scalar_biquad = [&](bench_vector<T>& r)
+        {
+            std::fill(state.begin(), state.end(), T(0));
+            for (std::size_t c = 0; c < num_channels; ++c)
+            {
+                for (std::size_t s = 0; s < num_sections; ++s)
+                {
+                    const biquad_coefficients<T>& k = sections[c * num_sections + s];
+                    const T* src = s == 0 ? x.data() : r.data();
+                    T* z = &state[(c * num_sections + s) * 2];
+                    T z1 = z[0], z2 = z[1];
+                    for (std::size_t t = 0; t < num_frames; ++t)
+                    {
+                        T u = src[t * num_channels + c];
+                        T y = k.b0 * u + z1;
+                        z1 = k.b1 * u - k.a1 * y + z2;
+                        z2 = k.b2 * u - k.a2 * y;
+                        r[t * num_channels + c] = y;
+                    }
+                    z[0] = z1;
+                    z[1] = z2;
+                }
+            }
+        };
+        biquad_cascade<T> filter(num_channels, num_sections, false), flushing_filter(num_channels, num_sections, true);
+        for (std::size_t c = 0; c < num_channels; ++c)
+        {
+            for (std::size_t s = 0; s < num_sections; ++s)
+            {
+                filter.set_section(c, s, sections[c * num_sections + s]);
+                flushing_filter.set_section(c, s, sections[c * num_sections + s]);
+            }
+        }
+        auto simd_biquad = [&](bench_vector<T>& r) { filter.reset(); filter.process(num_frames, x.data(), r.data()); };
+        auto simd_flushing_biquad = [&](bench_vector<T>& r) { flushing_filter.reset(); flushing_filter.process(num_frames, x.data(), r.data()); };
+
+        auto print = [&](const std::string& name, duration_type t)
+        {
+            out << name << " " << type_name << ": " << t.count() << "ms, "
+                << static_cast<double>(size * num_sections) / (t.count() * 1e3) << "M section samples/s" << std::endl;
+        };
+        print("scalar biquad         ", benchmark_fill(scalar_biquad, res, iter));
+        print("simd biquad           ", benchmark_fill(simd_biquad, res, iter));
+        print("simd biquad, ftz      ", benchmark_fill(simd_flushing_biquad, res, iter));
+    }
+
+    template <class OS>
+    void run_benchmark_biquad(OS& out, std::size_t num_channels, std::size_t num_sections, std::size_t num_frames, std::size_t iter)
+    {
+        out << "============================" << std::endl;
+        out << "biquad, " << num_channels << " channels, " << num_sections << " sections, " << num_frames << " frames" << std::endl;
+        run_benchmark_biquad_type<float>("float ", out, num_channels, num_sections, num_frames, iter);
+        run_benchmark_biquad_type<double>("double", out, num_channels, num_sections, num_frames, iter);
+        out << "============================" << std::endl;
+    }
+
     template <class F, class OS>
     void run_benchmark_2op(F f, OS& out, std::size_t size, std::size_t iter)
     {
@@ -431,6 +1647,60 @@ DEFINE_FUNCTOR_1OP(sqrt);
 DEFINE_FUNCTOR_1OP(cbrt);
 DEFINE_FUNCTOR_2OP(hypot);
 
+struct ipow_fn
+{
+    template <class T>
+    inline T operator()(const T& x) const { using std::pow; using xsimd::pow; return T(pow(x, 3)); }
+    inline std::string name() const { return "pow(x, 3)"; }
+};
+
+struct sinpi_fn
+{
+    template <class T>
+    inline T operator()(const T& x) const { return xsimd::sinpi(x); }
+    inline float operator()(float x) const { return std::sin(3.14159265f * x); }
+    inline double operator()(double x) const { return std::sin(3.141592653589793 * x); }
+    inline std::string name() const { return "sinpi"; }
+};
+
+// scalar references of the activation functions, which have no std counterpart
+
+struct sigmoid_fn
+{
+    template <class T>
+    inline T operator()(const T& x) const { return xsimd::sigmoid(x); }
+    inline float operator()(float x) const { return 1.f / (1.f + std::exp(-x)); }
+    inline double operator()(double x) const { return 1. / (1. + std::exp(-x)); }
+    inline std::string name() const { return "sigmoid"; }
+};
+
+struct fast_sigmoid_fn
+{
+    template <class T>
+    inline T operator()(const T& x) const { return xsimd::sigmoid(x, xsimd::fast_approx_tag()); }
+    inline float operator()(float x) const { return 1.f / (1.f + std::exp(-x)); }
+    inline double operator()(double x) const { return 1. / (1. + std::exp(-x)); }
+    inline std::string name() const { return "sigmoid (fast)"; }
+};
+
+struct gelu_fn
+{
+    template <class T>
+    inline T operator()(const T& x) const { return xsimd::gelu(x); }
+    inline float operator()(float x) const { return 0.5f * x * std::erfc(-0.70710678f * x); }
+    inline double operator()(double x) const { return 0.5 * x * std::erfc(-0.7071067811865476 * x); }
+    inline std::string name() const { return "gelu"; }
+};
+
+struct j0_fn
+{
+    template <class T>
+    inline T operator()(const T& x) const { return xsimd::j0(x); }
+    inline float operator()(float x) const { return ::j0f(x); }
+    inline double operator()(double x) const { return ::j0(x); }
+    inline std::string name() const { return "j0"; }
+};
+
 DEFINE_FUNCTOR_1OP(ceil);
 DEFINE_FUNCTOR_1OP(floor);
 DEFINE_FUNCTOR_1OP(trunc);
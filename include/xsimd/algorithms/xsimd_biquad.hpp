@@ -0,0 +1,434 @@
+/***************************************************************************
+* Copyright (c) 2016, Johan Mabille and Sylvain Corlay                     *
+*                                                                          *
+* Distributed under the terms of the BSD 3-Clause License.                 *
+*                                                                          *
+* The full license is in the file LICENSE, distributed with this software. *
+****************************************************************************/
+
+#ifndef XSIMD_BIQUAD_HPP
+#define XSIMD_BIQUAD_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <type_traits>
+#include <vector>
+
+#include "../config/xsimd_denormal.hpp"
+#include "../xsimd.hpp"
+
+namespace xsimd
+{
+    namespace detail
+    {
+        template <class T>
+        using biquad_vector = std::vector<T, aligned_allocator<T, default_alignment>>;
+    }
+
+    /**
+     * @struct biquad_coefficients
+     * @brief Coefficients of a second order section
+     *
+     * The section computes y[n] = b0 * x[n] + b1 * x[n - 1] + b2 * x[n - 2]
+     * - a1 * y[n - 1] - a2 * y[n - 2], the coefficient a0 of the
+     * denominator being normalized to 1. The default coefficients pass
+     * the input through.
+     */
+    template <class T>
+    struct biquad_coefficients
+    {
+        T b0 = T(1);
+        T b1 = T(0);
+        T b2 = T(0);
+        T a1 = T(0);
+        T a2 = T(0);
+    };
+
+    /**
+     * @class biquad_cascade
+     * @brief Cascade of second order IIR sections over many channels
+     *
+     * Filters num_channels independent channels, each through its own
+     * cascade of num_sections biquads. The recurrence of a channel is
+     * serial, so the channels are mapped to the lanes of the batches: a
+     * batch holds one sample of as many channels as it has lanes, and the
+     * recurrences of these channels are computed by the same fused
+     * multiply-adds, with one coefficient per lane. The samples are
+     * interleaved, the sample of the channel c at the time t being at the
+     * position t * num_channels + c.
+     *
+     * The sections use the transposed direct form II. The frames are
+     * processed by blocks: for each section, the state of several batches
+     * of channels stays in registers while the section runs over the
+     * block, which hides the latency of the recurrence.
+     *
+     * The state of a decaying IIR filter ends in the denormal range, where
+     * the arithmetic is much slower on most processors; by default the
+     * filter runs under a denormal_guard, which flushes the denormal values
+     * to zero.
+     *
+     * @tparam T the type of the samples and coefficients, float or double.
+     */
+    template <class T>
+    class biquad_cascade
+    {
+    public:
+
+        static_assert(std::is_same<T, float>::value || std::is_same<T, double>::value,
+                      "biquad_cascade requires float or double samples");
+
+        using value_type = T;
+        using size_type = std::size_t;
+        using coefficients_type = biquad_coefficients<T>;
+
+        biquad_cascade(size_type num_channels, size_type num_sections, bool flush_denormals = true);
+
+        size_type num_channels() const noexcept;
+        size_type num_sections() const noexcept;
+        bool flush_denormals() const noexcept;
+
+        void set_section(size_type channel, size_type section, const coefficients_type& coefficients);
+        coefficients_type section(size_type channel, size_type section) const;
+
+        void reset() noexcept;
+
+        void process(size_type num_frames, const T* in, T* out);
+
+    private:
+
+        using simd_tag = std::integral_constant<bool, (simd_traits<T>::size > 1)>;
+
+        static constexpr size_type lanes = simd_traits<T>::size;
+
+        void process_frames(size_type num_frames, const T* in, T* out);
+
+        T* coefficient(size_type channel, size_type section, size_type index) noexcept;
+        const T* coefficient(size_type channel, size_type section, size_type index) const noexcept;
+
+        size_type m_num_channels;
+        size_type m_num_sections;
+        size_type m_num_groups;
+        bool m_flush_denormals;
+        // for each batch of channels and each section, the five
+        // coefficients b0, b1, b2, a1, a2 and the two states, one batch each
+        detail::biquad_vector<T> m_coefficients;
+        detail::biquad_vector<T> m_state;
+        detail::biquad_vector<T> m_buffer;
+    };
+
+    /*****************************************
+     * biquad_cascade implementation details *
+     *****************************************/
+
+    namespace detail
+    {
+        // number of frames filtered at once by each section
+        constexpr std::size_t biquad_block_size = 64;
+
+        // number of batches of channels filtered together: their
+        // recurrences are independent and hide the latency of each other
+        constexpr std::size_t biquad_groups = 4;
+
+        // operations on the batches of channels I, ..., N - 1, unrolled by
+        // recursion so that the states are indexed by constants and stay in
+        // registers
+        template <std::size_t I, std::size_t N>
+        struct biquad_group
+        {
+            template <class T, class B>
+            static inline void load(const T* state, std::size_t stride, B* z1, B* z2)
+            {
+                z1[I] = B(state + I * stride, aligned_mode());
+                z2[I] = B(state + I * stride + B::size, aligned_mode());
+                biquad_group<I + 1, N>::load(state, stride, z1, z2);
+            }
+
+            template <class T, class B>
+            static inline void store(const B* z1, const B* z2, T* state, std::size_t stride)
+            {
+                z1[I].store_aligned(state + I * stride);
+                z2[I].store_aligned(state + I * stride + B::size);
+                biquad_group<I + 1, N>::store(z1, z2, state, stride);
+            }
+
+            // transposed direct form II:
+            // y = b0 * x + z1, z1 = b1 * x - a1 * y + z2, z2 = b2 * x - a2 * y
+            template <class T, class B>
+            static inline void step(const T* coefficients, std::size_t stride, T* frame, B* z1, B* z2)
+            {
+                constexpr std::size_t size = B::size;
+                const T* c = coefficients + I * stride;
+                B x(frame + I * size, aligned_mode());
+                B y = fma(B(c, aligned_mode()), x, z1[I]);
+                z1[I] = fnma(B(c + 3 * size, aligned_mode()), y, fma(B(c + size, aligned_mode()), x, z2[I]));
+                z2[I] = fnma(B(c + 4 * size, aligned_mode()), y, B(c + 2 * size, aligned_mode()) * x);
+                y.store_aligned(frame + I * size);
+                biquad_group<I + 1, N>::step(coefficients, stride, frame, z1, z2);
+            }
+        };
+
+        template <std::size_t N>
+        struct biquad_group<N, N>
+        {
+            template <class T, class B>
+            static inline void load(const T*, std::size_t, B*, B*)
+            {
+            }
+
+            template <class T, class B>
+            static inline void store(const B*, const B*, T*, std::size_t)
+            {
+            }
+
+            template <class T, class B>
+            static inline void step(const T*, std::size_t, T*, B*, B*)
+            {
+            }
+        };
+
+        // Runs the sections over the frames of G batches of channels in
+        // buffer, frame by frame. coefficients and state point to the first
+        // section of the first batch, the batches are num_sections sections
+        // apart.
+        template <std::size_t G, class T>
+        inline void biquad_sections(std::size_t num_frames, T* buffer, const T* coefficients, T* state,
+                                    std::size_t num_sections, std::true_type)
+        {
+            using b_type = simd_type<T>;
+            constexpr std::size_t size = b_type::size;
+            std::size_t coefficients_stride = num_sections * 5 * size;
+            std::size_t state_stride = num_sections * 2 * size;
+            for (std::size_t s = 0; s < num_sections; ++s)
+            {
+                b_type z1[G], z2[G];
+                biquad_group<0, G>::load(state + s * 2 * size, state_stride, z1, z2);
+                const T* c = coefficients + s * 5 * size;
+                for (std::size_t t = 0; t < num_frames; ++t)
+                {
+                    biquad_group<0, G>::step(c, coefficients_stride, buffer + t * G * size, z1, z2);
+                }
+                biquad_group<0, G>::store(z1, z2, state + s * 2 * size, state_stride);
+            }
+        }
+
+        template <std::size_t G, class T>
+        inline void biquad_sections(std::size_t num_frames, T* buffer, const T* coefficients, T* state,
+                                    std::size_t num_sections, std::false_type)
+        {
+            for (std::size_t s = 0; s < num_sections; ++s)
+            {
+                for (std::size_t g = 0; g < G; ++g)
+                {
+                    const T* c = coefficients + (g * num_sections + s) * 5;
+                    T* z = state + (g * num_sections + s) * 2;
+                    T z1 = z[0], z2 = z[1];
+                    for (std::size_t t = 0; t < num_frames; ++t)
+                    {
+                        T x = buffer[t * G + g];
+                        T y = c[0] * x + z1;
+                        z1 = c[1] * x - c[3] * y + z2;
+                        z2 = c[2] * x - c[4] * y;
+                        buffer[t * G + g] = y;
+                    }
+                    z[0] = z1;
+                    z[1] = z2;
+                }
+            }
+        }
+
+        // Filters the channels of G consecutive batches: their samples are
+        // copied to the buffer by blocks of frames, padded with zeros, and
+        // filtered in place
+        template <std::size_t G, class T, class Tag>
+        inline void biquad_bundle(std::size_t num_frames, const T* in, T* out, std::size_t num_channels,
+                                  std::size_t first_channel, T* buffer, const T* coefficients, T* state,
+                                  std::size_t num_sections, Tag tag)
+        {
+            constexpr std::size_t lanes = simd_traits<T>::size;
+            std::size_t width = std::min(G * lanes, num_channels - first_channel);
+            std::fill(buffer, buffer + biquad_block_size * G * lanes, T(0));
+            for (std::size_t t0 = 0; t0 < num_frames; t0 += biquad_block_size)
+            {
+                std::size_t block = std::min(biquad_block_size, num_frames - t0);
+                for (std::size_t t = 0; t < block; ++t)
+                {
+                    const T* src = in + (t0 + t) * num_channels + first_channel;
+                    std::copy(src, src + width, buffer + t * G * lanes);
+                }
+                biquad_sections<G>(block, buffer, coefficients, state, num_sections, tag);
+                for (std::size_t t = 0; t < block; ++t)
+                {
+                    const T* src = buffer + t * G * lanes;
+                    std::copy(src, src + width, out + (t0 + t) * num_channels + first_channel);
+                }
+            }
+        }
+    }
+
+    /*********************************
+     * biquad_cascade implementation *
+     *********************************/
+
+    template <class T>
+    constexpr typename biquad_cascade<T>::size_type biquad_cascade<T>::lanes;
+
+    /**
+     * Constructs a cascade whose sections pass the input through, with a
+     * zero state.
+     * @param num_channels the number of channels.
+     * @param num_sections the number of sections of each channel.
+     * @param flush_denormals whether process runs under a denormal_guard.
+     */
+    template <class T>
+    inline biquad_cascade<T>::biquad_cascade(size_type num_channels, size_type num_sections, bool flush_denormals)
+        : m_num_channels(num_channels), m_num_sections(num_sections),
+          m_num_groups((num_channels + lanes - 1) / lanes), m_flush_denormals(flush_denormals),
+          m_coefficients(m_num_groups * num_sections * 5 * lanes, T(0)),
+          m_state(m_num_groups * num_sections * 2 * lanes, T(0)),
+          m_buffer(detail::biquad_block_size * detail::biquad_groups * lanes)
+    {
+        coefficients_type identity;
+        for (size_type c = 0; c < m_num_groups * lanes; ++c)
+        {
+            for (size_type s = 0; s < num_sections; ++s)
+            {
+                *coefficient(c, s, 0) = identity.b0;
+            }
+        }
+    }
+
+    /**
+     * Returns the number of channels.
+     */
+    template <class T>
+    inline auto biquad_cascade<T>::num_channels() const noexcept -> size_type
+    {
+        return m_num_channels;
+    }
+
+    /**
+     * Returns the number of sections of each channel.
+     */
+    template <class T>
+    inline auto biquad_cascade<T>::num_sections() const noexcept -> size_type
+    {
+        return m_num_sections;
+    }
+
+    /**
+     * Returns true if process flushes the denormal values to zero.
+     */
+    template <class T>
+    inline bool biquad_cascade<T>::flush_denormals() const noexcept
+    {
+        return m_flush_denormals;
+    }
+
+    /**
+     * Sets the coefficients of a section of a channel. The state is kept.
+     * @param channel the channel, less than num_channels.
+     * @param section the section, less than num_sections.
+     * @param coefficients the coefficients of the section.
+     */
+    template <class T>
+    inline void biquad_cascade<T>::set_section(size_type channel, size_type section, const coefficients_type& coefficients)
+    {
+        *coefficient(channel, section, 0) = coefficients.b0;
+        *coefficient(channel, section, 1) = coefficients.b1;
+        *coefficient(channel, section, 2) = coefficients.b2;
+        *coefficient(channel, section, 3) = coefficients.a1;
+        *coefficient(channel, section, 4) = coefficients.a2;
+    }
+
+    /**
+     * Returns the coefficients of a section of a channel.
+     * @param channel the channel, less than num_channels.
+     * @param section the section, less than num_sections.
+     */
+    template <class T>
+    inline auto biquad_cascade<T>::section(size_type channel, size_type section) const -> coefficients_type
+    {
+        coefficients_type res;
+        res.b0 = *coefficient(channel, section, 0);
+        res.b1 = *coefficient(channel, section, 1);
+        res.b2 = *coefficient(channel, section, 2);
+        res.a1 = *coefficient(channel, section, 3);
+        res.a2 = *coefficient(channel, section, 4);
+        return res;
+    }
+
+    /**
+     * Clears the state of all the channels.
+     */
+    template <class T>
+    inline void biquad_cascade<T>::reset() noexcept
+    {
+        std::fill(m_state.begin(), m_state.end(), T(0));
+    }
+
+    /**
+     * Filters the next frames of all the channels.
+     * @param num_frames the number of frames.
+     * @param in pointer to the num_frames * num_channels interleaved input
+     * samples.
+     * @param out pointer to the interleaved output samples; it may be \c in.
+     */
+    template <class T>
+    inline void biquad_cascade<T>::process(size_type num_frames, const T* in, T* out)
+    {
+        if (m_flush_denormals)
+        {
+            denormal_guard guard;
+            process_frames(num_frames, in, out);
+        }
+        else
+        {
+            process_frames(num_frames, in, out);
+        }
+    }
+
+    template <class T>
+    inline void biquad_cascade<T>::process_frames(size_type num_frames, const T* in, T* out)
+    {
+        // without sections, the cascade passes the input through and has
+        // neither coefficients nor state to index
+        if (m_num_sections == 0)
+        {
+            if (in != out)
+            {
+                std::copy(in, in + num_frames * m_num_channels, out);
+            }
+            return;
+        }
+        constexpr size_type groups = detail::biquad_groups;
+        T* buffer = m_buffer.data();
+        size_type g = 0;
+        for (; g + groups <= m_num_groups; g += groups)
+        {
+            detail::biquad_bundle<groups>(num_frames, in, out, m_num_channels, g * lanes, buffer,
+                                          coefficient(g * lanes, 0, 0), &m_state[g * m_num_sections * 2 * lanes],
+                                          m_num_sections, simd_tag());
+        }
+        // the last batches of channels, fewer than a bundle
+        for (; g < m_num_groups; ++g)
+        {
+            detail::biquad_bundle<1>(num_frames, in, out, m_num_channels, g * lanes, buffer,
+                                     coefficient(g * lanes, 0, 0), &m_state[g * m_num_sections * 2 * lanes],
+                                     m_num_sections, simd_tag());
+        }
+    }
+
+    template <class T>
+    inline T* biquad_cascade<T>::coefficient(size_type channel, size_type section, size_type index) noexcept
+    {
+        return &m_coefficients[((channel / lanes * m_num_sections + section) * 5 + index) * lanes + channel % lanes];
+    }
+
+    template <class T>
+    inline const T* biquad_cascade<T>::coefficient(size_type channel, size_type section, size_type index) const noexcept
+    {
+        return &m_coefficients[((channel / lanes * m_num_sections + section) * 5 + index) * lanes + channel % lanes];
+    }
+}
+
+#endif
@@ -0,0 +1,524 @@
+/***************************************************************************
+* Copyright (c) 2016, Johan Mabille and Sylvain Corlay                     *
+*                                                                          *
+* Distributed under the terms of the BSD 3-Clause License.                 *
+*                                                                          *
+* The full license is in the file LICENSE, distributed with this software. *
+****************************************************************************/
+
+#ifndef XSIMD_BITMAP_HPP
+#define XSIMD_BITMAP_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#include "../xsimd.hpp"
+
+namespace xsimd
+{
+    // A bitmap of n bits is stored in (n + 63) / 64 words: bit i is bit
+    // i % 64 of word i / 64. The functions writing a bitmap clear the bits
+    // past n in the last word, the functions reading one ignore them.
+
+    /**
+     * Comparison operators of the predicates evaluated by bitmap_compare.
+     */
+    enum class compare_op
+    {
+        equal,
+        not_equal,
+        less,
+        less_equal,
+        greater,
+        greater_equal
+    };
+
+    /**
+     * Evaluates the predicate \c column[i] \c op \c value on the \c n
+     * elements of \c column and writes the results into \c bitmap.
+     * The comparisons follow the IEEE rules: NaN only satisfies not_equal.
+     * @param column pointer to the int32, int64, float or double values.
+     * @param n number of values.
+     * @param op the comparison operator.
+     * @param value the right operand of the comparisons.
+     * @param bitmap pointer to the (n + 63) / 64 words of the result.
+     * @return the number of values satisfying the predicate.
+     */
+    template <class T>
+    std::size_t bitmap_compare(const T* column, std::size_t n, compare_op op, T value, uint64_t* bitmap);
+
+    /**
+     * Evaluates the predicate \c lo <= \c column[i] <= \c hi on the \c n
+     * elements of \c column and writes the results into \c bitmap.
+     * @param column pointer to the int32, int64, float or double values.
+     * @param n number of values.
+     * @param lo the lower bound of the range.
+     * @param hi the upper bound of the range.
+     * @param bitmap pointer to the (n + 63) / 64 words of the result.
+     * @return the number of values in the range.
+     */
+    template <class T>
+    std::size_t bitmap_between(const T* column, std::size_t n, T lo, T hi, uint64_t* bitmap);
+
+    /**
+     * Computes the intersection \c lhs & \c rhs of two bitmaps of \c n
+     * bits into \c res, which may alias \c lhs or \c rhs.
+     */
+    void bitmap_and(const uint64_t* lhs, const uint64_t* rhs, std::size_t n, uint64_t* res);
+
+    /**
+     * Computes the union \c lhs | \c rhs of two bitmaps of \c n bits into
+     * \c res, which may alias \c lhs or \c rhs.
+     */
+    void bitmap_or(const uint64_t* lhs, const uint64_t* rhs, std::size_t n, uint64_t* res);
+
+    /**
+     * Computes the difference \c lhs & ~rhs of two bitmaps of \c n bits
+     * into \c res, which may alias \c lhs or \c rhs.
+     */
+    void bitmap_andnot(const uint64_t* lhs, const uint64_t* rhs, std::size_t n, uint64_t* res);
+
+    /**
+     * Returns the number of bits set among the \c n bits of \c bitmap.
+     */
+    std::size_t bitmap_popcount(const uint64_t* bitmap, std::size_t n);
+
+    /**
+     * Writes the positions of the bits set among the \c n bits of
+     * \c bitmap into \c indices, in increasing order.
+     * @param bitmap pointer to the bitmap.
+     * @param n number of bits, at most 2^32.
+     * @param indices pointer to the result, large enough for the number
+     * of bits set, as given by bitmap_popcount.
+     * @return the number of indices written.
+     */
+    std::size_t bitmap_to_indices(const uint64_t* bitmap, std::size_t n, uint32_t* indices);
+
+    /******************
+     * implementation *
+     ******************/
+
+    namespace detail
+    {
+        template <class T>
+        inline void check_bitmap_type()
+        {
+            static_assert(std::is_same<T, int32_t>::value || std::is_same<T, int64_t>::value ||
+                              std::is_same<T, float>::value || std::is_same<T, double>::value,
+                          "bitmap predicates require int32_t, int64_t, float or double values");
+        }
+
+        inline uint64_t bitmap_tail_mask(std::size_t n)
+        {
+            return n % 64 == 0 ? ~uint64_t(0) : (uint64_t(1) << (n % 64)) - 1;
+        }
+
+        inline std::size_t scalar_popcount(uint64_t x)
+        {
+#if defined(__GNUC__)
+            return static_cast<std::size_t>(__builtin_popcountll(x));
+#else
+            x = x - ((x >> 1) & 0x5555555555555555ULL);
+            x = (x & 0x3333333333333333ULL) + ((x >> 2) & 0x3333333333333333ULL);
+            x = (x + (x >> 4)) & 0x0f0f0f0f0f0f0f0fULL;
+            return static_cast<std::size_t>((x * 0x0101010101010101ULL) >> 56);
+#endif
+        }
+
+        inline std::size_t lowest_bit_index(uint64_t mask)
+        {
+            std::size_t res = 0;
+#if defined(__GNUC__)
+            res = static_cast<std::size_t>(__builtin_ctzll(mask));
+#else
+            while ((mask & 1) == 0)
+            {
+                mask >>= 1;
+                ++res;
+            }
+#endif
+            return res;
+        }
+
+        // The predicates, applied to scalars and batches alike
+        struct bitmap_equal
+        {
+            template <class T>
+            auto operator()(const T& x, const T& v) const -> decltype(x == v) { return x == v; }
+        };
+
+        struct bitmap_not_equal
+        {
+            template <class T>
+            auto operator()(const T& x, const T& v) const -> decltype(x != v) { return x != v; }
+        };
+
+        struct bitmap_less
+        {
+            template <class T>
+            auto operator()(const T& x, const T& v) const -> decltype(x < v) { return x < v; }
+        };
+
+        struct bitmap_less_equal
+        {
+            template <class T>
+            auto operator()(const T& x, const T& v) const -> decltype(x <= v) { return x <= v; }
+        };
+
+        struct bitmap_greater
+        {
+            template <class T>
+            auto operator()(const T& x, const T& v) const -> decltype(x > v) { return x > v; }
+        };
+
+        struct bitmap_greater_equal
+        {
+            template <class T>
+            auto operator()(const T& x, const T& v) const -> decltype(x >= v) { return x >= v; }
+        };
+
+        template <class T>
+        struct bitmap_range
+        {
+            T lo;
+            T hi;
+
+            bool operator()(T x) const
+            {
+                return lo <= x && x <= hi;
+            }
+
+            template <std::size_t N>
+            batch_bool<T, N> operator()(const batch<T, N>& x) const
+            {
+                return (batch<T, N>(lo) <= x) & (x <= batch<T, N>(hi));
+            }
+        };
+
+        template <class T, class P>
+        struct bitmap_bound_predicate
+        {
+            P predicate;
+            T value;
+
+            bool operator()(T x) const
+            {
+                return predicate(x, value);
+            }
+
+            template <std::size_t N>
+            batch_bool<T, N> operator()(const batch<T, N>& x) const
+            {
+                return predicate(x, batch<T, N>(value));
+            }
+        };
+
+        template <class T, class P>
+        inline uint64_t bitmap_word(const T* values, std::size_t n, const P& predicate)
+        {
+            uint64_t word = 0;
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                word |= uint64_t(predicate(values[i])) << i;
+            }
+            return word;
+        }
+
+        // whole words of 64 values are built from the masks of the
+        // batches, the remaining values are tested one by one
+        template <class T, class P>
+        inline std::size_t bitmap_fill(const T* values, std::size_t n, const P& predicate,
+                                       uint64_t* bitmap, std::true_type)
+        {
+            constexpr std::size_t size = simd_traits<T>::size;
+            std::size_t num_words = n / 64;
+            std::size_t res = 0;
+            for (std::size_t w = 0; w < num_words; ++w)
+            {
+                const T* src = values + w * 64;
+                uint64_t word = 0;
+                for (std::size_t j = 0; j < 64; j += size)
+                {
+                    word |= to_bitmask(predicate(load_unaligned(src + j))) << j;
+                }
+                bitmap[w] = word;
+                res += scalar_popcount(word);
+            }
+            if (n % 64 != 0)
+            {
+                uint64_t word = bitmap_word(values + num_words * 64, n % 64, predicate);
+                bitmap[num_words] = word;
+                res += scalar_popcount(word);
+            }
+            return res;
+        }
+
+        template <class T, class P>
+        inline std::size_t bitmap_fill(const T* values, std::size_t n, const P& predicate,
+                                       uint64_t* bitmap, std::false_type)
+        {
+            std::size_t res = 0;
+            for (std::size_t i = 0; i < n; i += 64)
+            {
+                std::size_t count = n - i < 64 ? n - i : 64;
+                uint64_t word = bitmap_word(values + i, count, predicate);
+                bitmap[i / 64] = word;
+                res += scalar_popcount(word);
+            }
+            return res;
+        }
+
+        template <class T, class P>
+        inline std::size_t bitmap_fill(const T* values, std::size_t n, const P& predicate, uint64_t* bitmap)
+        {
+            constexpr std::size_t size = simd_traits<T>::size;
+            using simd_tag = std::integral_constant<bool, (size > 1 && 64 % size == 0)>;
+            return bitmap_fill(values, n, predicate, bitmap, simd_tag());
+        }
+
+        template <class T, class P>
+        inline std::size_t bitmap_compare_impl(const T* column, std::size_t n, P predicate, T value, uint64_t* bitmap)
+        {
+            return bitmap_fill(column, n, bitmap_bound_predicate<T, P>{predicate, value}, bitmap);
+        }
+
+        // The bitmap combinators work on batches of words
+        using bitmap_simd_tag = std::integral_constant<bool, (simd_traits<int64_t>::size > 1)>;
+
+        struct bitmap_and_op
+        {
+            template <class T>
+            T operator()(const T& x, const T& y) const { return x & y; }
+        };
+
+        struct bitmap_or_op
+        {
+            template <class T>
+            T operator()(const T& x, const T& y) const { return x | y; }
+        };
+
+        struct bitmap_andnot_op
+        {
+            template <class T>
+            T operator()(const T& x, const T& y) const { return x & ~y; }
+        };
+
+        template <class F>
+        inline void bitmap_combine(const uint64_t* lhs, const uint64_t* rhs, std::size_t num_words,
+                                   uint64_t* res, const F& f, std::false_type)
+        {
+            for (std::size_t i = 0; i < num_words; ++i)
+            {
+                res[i] = f(lhs[i], rhs[i]);
+            }
+        }
+
+        template <class F>
+        inline void bitmap_combine(const uint64_t* lhs, const uint64_t* rhs, std::size_t num_words,
+                                   uint64_t* res, const F& f, std::true_type)
+        {
+            constexpr std::size_t size = simd_traits<int64_t>::size;
+            std::size_t vec_size = num_words - num_words % size;
+            const int64_t* l = reinterpret_cast<const int64_t*>(lhs);
+            const int64_t* r = reinterpret_cast<const int64_t*>(rhs);
+            int64_t* d = reinterpret_cast<int64_t*>(res);
+            for (std::size_t i = 0; i < vec_size; i += size)
+            {
+                f(load_unaligned(l + i), load_unaligned(r + i)).store_unaligned(d + i);
+            }
+            bitmap_combine(lhs + vec_size, rhs + vec_size, num_words - vec_size, res + vec_size, f, std::false_type());
+        }
+
+        template <class F>
+        inline void bitmap_combine(const uint64_t* lhs, const uint64_t* rhs, std::size_t n, uint64_t* res, const F& f)
+        {
+            std::size_t num_words = (n + 63) / 64;
+            bitmap_combine(lhs, rhs, num_words, res, f, bitmap_simd_tag());
+            if (n % 64 != 0)
+            {
+                res[num_words - 1] &= bitmap_tail_mask(n);
+            }
+        }
+
+        inline std::size_t bitmap_popcount(const uint64_t* bitmap, std::size_t num_words, std::false_type)
+        {
+            std::size_t res = 0;
+            for (std::size_t i = 0; i < num_words; ++i)
+            {
+                res += scalar_popcount(bitmap[i]);
+            }
+            return res;
+        }
+
+        inline std::size_t bitmap_popcount(const uint64_t* bitmap, std::size_t num_words, std::true_type)
+        {
+            constexpr std::size_t size = simd_traits<int64_t>::size;
+            using b_type = batch<int64_t, size>;
+            std::size_t vec_size = num_words - num_words % size;
+            const int64_t* src = reinterpret_cast<const int64_t*>(bitmap);
+            b_type acc(int64_t(0));
+            for (std::size_t i = 0; i < vec_size; i += size)
+            {
+                acc += popcount(load_unaligned(src + i));
+            }
+            return static_cast<std::size_t>(hadd(acc)) +
+                bitmap_popcount(bitmap + vec_size, num_words - vec_size, std::false_type());
+        }
+
+        inline std::size_t bitmap_word_to_indices(uint64_t word, uint32_t base, uint32_t* indices)
+        {
+            std::size_t res = 0;
+            while (word != 0)
+            {
+                indices[res++] = base + static_cast<uint32_t>(lowest_bit_index(word));
+                word &= word - 1;
+            }
+            return res;
+        }
+
+#if XSIMD_X86_INSTR_SET >= XSIMD_X86_AVX512_VERSION
+        // compresses the positions of each 16 bits of the word
+        inline std::size_t bitmap_word_to_indices_simd(uint64_t word, uint32_t base, uint32_t* indices)
+        {
+            const __m512i iota = _mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+            std::size_t res = 0;
+            for (uint32_t j = 0; j < 64; j += 16)
+            {
+                __mmask16 mask = static_cast<__mmask16>(word >> j);
+                __m512i pos = _mm512_add_epi32(iota, _mm512_set1_epi32(static_cast<int>(base + j)));
+                _mm512_mask_compressstoreu_epi32(indices + res, mask, pos);
+                res += scalar_popcount(mask);
+            }
+            return res;
+        }
+#elif XSIMD_X86_INSTR_SET >= XSIMD_X86_AVX2_VERSION
+        // positions of the bits set in each byte, packed in the bytes of
+        // a 64 bits integer
+        inline const uint64_t* bitmap_byte_positions()
+        {
+            static const std::array<uint64_t, 256> positions = []()
+            {
+                std::array<uint64_t, 256> res;
+                for (std::size_t b = 0; b < 256; ++b)
+                {
+                    uint64_t packed = 0;
+                    std::size_t count = 0;
+                    for (std::size_t k = 0; k < 8; ++k)
+                    {
+                        if (b & (std::size_t(1) << k))
+                        {
+                            packed |= uint64_t(k) << (8 * count++);
+                        }
+                    }
+                    res[b] = packed;
+                }
+                return res;
+            }();
+            return positions.data();
+        }
+
+        // widens the positions of the bits of each byte of the word, and
+        // stores as many of them as bits set
+        inline std::size_t bitmap_word_to_indices_simd(uint64_t word, uint32_t base, uint32_t* indices)
+        {
+            const uint64_t* positions = bitmap_byte_positions();
+            const __m256i iota = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+            std::size_t res = 0;
+            for (uint32_t j = 0; j < 64; j += 8)
+            {
+                std::size_t byte = static_cast<std::size_t>((word >> j) & 0xff);
+                int count = static_cast<int>(scalar_popcount(byte));
+                __m256i pos = _mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(positions + byte)));
+                pos = _mm256_add_epi32(pos, _mm256_set1_epi32(static_cast<int>(base + j)));
+                __m256i mask = _mm256_cmpgt_epi32(_mm256_set1_epi32(count), iota);
+                _mm256_maskstore_epi32(reinterpret_cast<int*>(indices + res), mask, pos);
+                res += static_cast<std::size_t>(count);
+            }
+            return res;
+        }
+#endif
+    }
+
+    template <class T>
+    inline std::size_t bitmap_compare(const T* column, std::size_t n, compare_op op, T value, uint64_t* bitmap)
+    {
+        detail::check_bitmap_type<T>();
+        switch (op)
+        {
+        case compare_op::equal:
+            return detail::bitmap_compare_impl(column, n, detail::bitmap_equal(), value, bitmap);
+        case compare_op::not_equal:
+            return detail::bitmap_compare_impl(column, n, detail::bitmap_not_equal(), value, bitmap);
+        case compare_op::less:
+            return detail::bitmap_compare_impl(column, n, detail::bitmap_less(), value, bitmap);
+        case compare_op::less_equal:
+            return detail::bitmap_compare_impl(column, n, detail::bitmap_less_equal(), value, bitmap);
+        case compare_op::greater:
+            return detail::bitmap_compare_impl(column, n, detail::bitmap_greater(), value, bitmap);
+        default:
+            return detail::bitmap_compare_impl(column, n, detail::bitmap_greater_equal(), value, bitmap);
+        }
+    }
+
+    template <class T>
+    inline std::size_t bitmap_between(const T* column, std::size_t n, T lo, T hi, uint64_t* bitmap)
+    {
+        detail::check_bitmap_type<T>();
+        return detail::bitmap_fill(column, n, detail::bitmap_range<T>{lo, hi}, bitmap);
+    }
+
+    inline void bitmap_and(const uint64_t* lhs, const uint64_t* rhs, std::size_t n, uint64_t* res)
+    {
+        detail::bitmap_combine(lhs, rhs, n, res, detail::bitmap_and_op());
+    }
+
+    inline void bitmap_or(const uint64_t* lhs, const uint64_t* rhs, std::size_t n, uint64_t* res)
+    {
+        detail::bitmap_combine(lhs, rhs, n, res, detail::bitmap_or_op());
+    }
+
+    inline void bitmap_andnot(const uint64_t* lhs, const uint64_t* rhs, std::size_t n, uint64_t* res)
+    {
+        detail::bitmap_combine(lhs, rhs, n, res, detail::bitmap_andnot_op());
+    }
+
+    inline std::size_t bitmap_popcount(const uint64_t* bitmap, std::size_t n)
+    {
+        std::size_t num_words = n / 64;
+        std::size_t res = detail::bitmap_popcount(bitmap, num_words, detail::bitmap_simd_tag());
+        if (n % 64 != 0)
+        {
+            res += detail::scalar_popcount(bitmap[num_words] & detail::bitmap_tail_mask(n));
+        }
+        return res;
+    }
+
+    inline std::size_t bitmap_to_indices(const uint64_t* bitmap, std::size_t n, uint32_t* indices)
+    {
+        std::size_t num_words = (n + 63) / 64;
+        std::size_t res = 0;
+        for (std::size_t w = 0; w < num_words; ++w)
+        {
+            uint64_t word = bitmap[w];
+            if (w + 1 == num_words)
+            {
+                word &= detail::bitmap_tail_mask(n);
+            }
+            if (word == 0)
+            {
+                continue;
+            }
+            uint32_t base = static_cast<uint32_t>(w * 64);
+#if XSIMD_X86_INSTR_SET >= XSIMD_X86_AVX2_VERSION
+            res += detail::bitmap_word_to_indices_simd(word, base, indices + res);
+#else
+            res += detail::bitmap_word_to_indices(word, base, indices + res);
+#endif
+        }
+        return res;
+    }
+}
+
+#endif
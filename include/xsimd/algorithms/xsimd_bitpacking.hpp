@@ -0,0 +1,700 @@
+/***************************************************************************
+* Copyright (c) 2016, Johan Mabille and Sylvain Corlay                     *
+*                                                                          *
+* Distributed under the terms of the BSD 3-Clause License.                 *
+*                                                                          *
+* The full license is in the file LICENSE, distributed with this software. *
+****************************************************************************/
+
+#ifndef XSIMD_BITPACKING_HPP
+#define XSIMD_BITPACKING_HPP
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#include "../xsimd.hpp"
+
+namespace xsimd
+{
+    // The packed format does not depend on the instruction set. The values
+    // are packed by blocks of 512: a block is split into the 16 (int32) or
+    // 8 (int64) lanes of a 512 bits register, value i of the block going to
+    // lane i % lanes, and each lane packs its values into bits words. The
+    // words of the lanes are interleaved, so that any batch size dividing
+    // the number of lanes packs and unpacks a block with plain loads, shifts
+    // and masks. The values past the last whole block are packed one after
+    // the other into a stream of bits, starting from the low bits of the
+    // words. The values are considered as unsigned integers.
+
+    /**
+     * Returns the number of words needed to pack \c n values of \c bits
+     * bits each.
+     * @tparam T the type of the values and of the words, int32_t or int64_t.
+     */
+    template <class T>
+    std::size_t bitpacked_size(std::size_t n, std::size_t bits);
+
+    /**
+     * Returns the number of bits needed to represent the largest of the
+     * \c n elements of \c values, considered as unsigned integers.
+     */
+    template <class T>
+    std::size_t bitpack_width(const T* values, std::size_t n);
+
+    /**
+     * Packs the \c bits low bits of the \c n elements of \c values into
+     * \c packed.
+     * @param values pointer to the int32 or int64 values.
+     * @param n number of values.
+     * @param bits the width of the packed values, from 0 to 32 for int32
+     * values, from 0 to 64 for int64 values; with 0, nothing is written,
+     * as for a constant column after for_encode.
+     * @param packed pointer to the bitpacked_size<T>(n, bits) words of
+     * the result.
+     */
+    template <class T>
+    void bitpack(const T* values, std::size_t n, std::size_t bits, T* packed);
+
+    /**
+     * Unpacks \c n values of \c bits bits packed by bitpack.
+     * @param packed pointer to the packed words.
+     * @param n number of values.
+     * @param bits the width of the packed values; with 0, \c packed is not
+     * read and the values are zero.
+     * @param values pointer to the \c n unpacked values.
+     */
+    template <class T>
+    void bitunpack(const T* packed, std::size_t n, std::size_t bits, T* values);
+
+    /**
+     * Frame of reference encoding: subtracts the smallest of the \c n
+     * elements of \c values from all of them. The offsets are written to
+     * \c res, which may alias \c values.
+     * @return the smallest value, the base of the frame of reference.
+     */
+    template <class T>
+    T for_encode(const T* values, std::size_t n, T* res);
+
+    /**
+     * Frame of reference decoding: adds \c base to the \c n elements of
+     * \c offsets. The values are written to \c res, which may alias
+     * \c offsets.
+     */
+    template <class T>
+    void for_decode(const T* offsets, std::size_t n, T base, T* res);
+
+    /**
+     * Delta encoding: res[i] = values[i] - values[i - 1], with values[-1]
+     * given by \c initial. \c res may alias \c values. The differences wrap
+     * around modulo 2^32 or 2^64.
+     */
+    template <class T>
+    void delta_encode(const T* values, std::size_t n, T* res, T initial = T(0));
+
+    /**
+     * Delta decoding, the prefix sum of the \c n elements of \c deltas
+     * plus \c initial. \c res may alias \c deltas.
+     */
+    template <class T>
+    void delta_decode(const T* deltas, std::size_t n, T* res, T initial = T(0));
+
+    /******************
+     * implementation *
+     ******************/
+
+    namespace detail
+    {
+        template <class T>
+        inline void check_bitpacking_type()
+        {
+            static_assert(std::is_same<T, int32_t>::value || std::is_same<T, int64_t>::value,
+                          "bitpacking requires int32_t or int64_t values");
+        }
+
+        template <class T>
+        constexpr std::size_t bitpack_word_bits()
+        {
+            return 8 * sizeof(T);
+        }
+
+        template <class T>
+        constexpr std::size_t bitpack_lanes()
+        {
+            return 64 / sizeof(T);
+        }
+
+        template <class T>
+        constexpr std::size_t bitpack_block_size()
+        {
+            return bitpack_lanes<T>() * bitpack_word_bits<T>();
+        }
+
+        template <class T>
+        inline T bitpack_mask(std::size_t bits)
+        {
+            using unsigned_type = typename std::make_unsigned<T>::type;
+            return static_cast<T>(bits >= bitpack_word_bits<T>() ? ~unsigned_type(0) : (unsigned_type(1) << bits) - 1);
+        }
+
+        // The block kernels run on the lanes of batches, or on the lanes
+        // one at a time as unsigned integers
+        template <class T, std::size_t N>
+        inline void bitpack_load(const T* src, batch<T, N>& dst)
+        {
+            dst.load_unaligned(src);
+        }
+
+        template <class T, class U>
+        inline void bitpack_load(const T* src, U& dst)
+        {
+            dst = static_cast<U>(*src);
+        }
+
+        template <class T, std::size_t N>
+        inline void bitpack_store(const batch<T, N>& src, T* dst)
+        {
+            src.store_unaligned(dst);
+        }
+
+        template <class T, class U>
+        inline void bitpack_store(const U& src, T* dst)
+        {
+            *dst = static_cast<T>(src);
+        }
+
+        template <class T, class V>
+        inline void bitpack_lane(const T* values, std::size_t bits, T* packed)
+        {
+            constexpr std::size_t word_bits = bitpack_word_bits<T>();
+            constexpr std::size_t lanes = bitpack_lanes<T>();
+            const V mask(bitpack_mask<T>(bits));
+            V acc(static_cast<T>(0));
+            std::size_t shift = 0;
+            for (std::size_t r = 0; r < word_bits; ++r)
+            {
+                V v;
+                bitpack_load(values + r * lanes, v);
+                v = v & mask;
+                acc = acc | (v << static_cast<int32_t>(shift));
+                shift += bits;
+                if (shift >= word_bits)
+                {
+                    bitpack_store(acc, packed);
+                    packed += lanes;
+                    shift -= word_bits;
+                    // the masked value is non negative unless bits is the
+                    // width of the words, in which case shift is 0
+                    acc = shift == 0 ? V(static_cast<T>(0)) : V(v >> static_cast<int32_t>(bits - shift));
+                }
+            }
+        }
+
+        template <class T, class V>
+        inline void bitunpack_lane(const T* packed, std::size_t bits, T* values)
+        {
+            constexpr std::size_t word_bits = bitpack_word_bits<T>();
+            constexpr std::size_t lanes = bitpack_lanes<T>();
+            const V mask(bitpack_mask<T>(bits));
+            V word;
+            bitpack_load(packed, word);
+            std::size_t shift = 0;
+            for (std::size_t r = 0; r < word_bits; ++r)
+            {
+                V v;
+                if (shift + bits <= word_bits)
+                {
+                    v = (word >> static_cast<int32_t>(shift)) & mask;
+                    shift += bits;
+                    if (shift == word_bits && r + 1 < word_bits)
+                    {
+                        packed += lanes;
+                        bitpack_load(packed, word);
+                        shift = 0;
+                    }
+                }
+                else
+                {
+                    // the value straddles two words; the right shift may be
+                    // arithmetic, its high bits are masked
+                    V next;
+                    bitpack_load(packed + lanes, next);
+                    const V low_mask(bitpack_mask<T>(word_bits - shift));
+                    v = ((word >> static_cast<int32_t>(shift)) & low_mask) | (next << static_cast<int32_t>(word_bits - shift));
+                    v = v & mask;
+                    packed += lanes;
+                    word = next;
+                    shift = shift + bits - word_bits;
+                }
+                bitpack_store(v, values + r * lanes);
+            }
+        }
+
+        template <class T>
+        inline void bitpack_block(const T* values, std::size_t bits, T* packed, std::false_type)
+        {
+            using unsigned_type = typename std::make_unsigned<T>::type;
+            for (std::size_t l = 0; l < bitpack_lanes<T>(); ++l)
+            {
+                bitpack_lane<T, unsigned_type>(values + l, bits, packed + l);
+            }
+        }
+
+        template <class T>
+        inline void bitpack_block(const T* values, std::size_t bits, T* packed, std::true_type)
+        {
+            constexpr std::size_t size = simd_traits<T>::size;
+            static_assert(bitpack_lanes<T>() % size == 0, "the batch size must divide the lanes of a block");
+            for (std::size_t l = 0; l < bitpack_lanes<T>(); l += size)
+            {
+                bitpack_lane<T, batch<T, size>>(values + l, bits, packed + l);
+            }
+        }
+
+        template <class T>
+        inline void bitunpack_block(const T* packed, std::size_t bits, T* values, std::false_type)
+        {
+            using unsigned_type = typename std::make_unsigned<T>::type;
+            for (std::size_t l = 0; l < bitpack_lanes<T>(); ++l)
+            {
+                bitunpack_lane<T, unsigned_type>(packed + l, bits, values + l);
+            }
+        }
+
+        template <class T>
+        inline void bitunpack_block(const T* packed, std::size_t bits, T* values, std::true_type)
+        {
+            constexpr std::size_t size = simd_traits<T>::size;
+            static_assert(bitpack_lanes<T>() % size == 0, "the batch size must divide the lanes of a block");
+            for (std::size_t l = 0; l < bitpack_lanes<T>(); l += size)
+            {
+                bitunpack_lane<T, batch<T, size>>(packed + l, bits, values + l);
+            }
+        }
+
+        // the values past the last block, as a stream of bits
+        template <class T>
+        inline void bitpack_tail(const T* values, std::size_t n, std::size_t bits, T* packed)
+        {
+            using unsigned_type = typename std::make_unsigned<T>::type;
+            constexpr std::size_t word_bits = bitpack_word_bits<T>();
+            const unsigned_type mask = static_cast<unsigned_type>(bitpack_mask<T>(bits));
+            unsigned_type acc = 0;
+            std::size_t shift = 0;
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                unsigned_type v = static_cast<unsigned_type>(values[i]) & mask;
+                acc |= v << shift;
+                shift += bits;
+                if (shift >= word_bits)
+                {
+                    *packed++ = static_cast<T>(acc);
+                    shift -= word_bits;
+                    acc = shift == 0 ? unsigned_type(0) : v >> (bits - shift);
+                }
+            }
+            if (shift != 0)
+            {
+                *packed = static_cast<T>(acc);
+            }
+        }
+
+        template <class T>
+        inline void bitunpack_tail(const T* packed, std::size_t n, std::size_t bits, T* values)
+        {
+            using unsigned_type = typename std::make_unsigned<T>::type;
+            constexpr std::size_t word_bits = bitpack_word_bits<T>();
+            const unsigned_type mask = static_cast<unsigned_type>(bitpack_mask<T>(bits));
+            std::size_t pos = 0;
+            for (std::size_t i = 0; i < n; ++i, pos += bits)
+            {
+                std::size_t w = pos / word_bits, shift = pos % word_bits;
+                unsigned_type v = static_cast<unsigned_type>(packed[w]) >> shift;
+                if (shift + bits > word_bits)
+                {
+                    v |= static_cast<unsigned_type>(packed[w + 1]) << (word_bits - shift);
+                }
+                values[i] = static_cast<T>(v & mask);
+            }
+        }
+
+        // In-register inclusive prefix sums, and broadcast of the last
+        // element to carry them over to the next batch
+        template <class B>
+        struct prefix_sum_kernel
+        {
+            using value_type = typename B::value_type;
+
+            static inline B inclusive_scan(const B& x)
+            {
+                using unsigned_type = typename std::make_unsigned<value_type>::type;
+                alignas(B) std::array<value_type, B::size> buffer;
+                x.store_aligned(buffer.data());
+                unsigned_type acc = 0;
+                for (std::size_t i = 0; i < B::size; ++i)
+                {
+                    acc += static_cast<unsigned_type>(buffer[i]);
+                    buffer[i] = static_cast<value_type>(acc);
+                }
+                B res;
+                res.load_aligned(buffer.data());
+                return res;
+            }
+
+            static inline B broadcast_last(const B& x)
+            {
+                return B(x[B::size - 1]);
+            }
+        };
+
+#if XSIMD_X86_INSTR_SET >= XSIMD_X86_SSE2_VERSION
+        template <>
+        struct prefix_sum_kernel<batch<int32_t, 4>>
+        {
+            static inline batch<int32_t, 4> inclusive_scan(const batch<int32_t, 4>& x)
+            {
+                __m128i res = _mm_add_epi32(x, _mm_slli_si128(x, 4));
+                return _mm_add_epi32(res, _mm_slli_si128(res, 8));
+            }
+
+            static inline batch<int32_t, 4> broadcast_last(const batch<int32_t, 4>& x)
+            {
+                return _mm_shuffle_epi32(x, _MM_SHUFFLE(3, 3, 3, 3));
+            }
+        };
+
+        template <>
+        struct prefix_sum_kernel<batch<int64_t, 2>>
+        {
+            static inline batch<int64_t, 2> inclusive_scan(const batch<int64_t, 2>& x)
+            {
+                return _mm_add_epi64(x, _mm_slli_si128(x, 8));
+            }
+
+            static inline batch<int64_t, 2> broadcast_last(const batch<int64_t, 2>& x)
+            {
+                return _mm_shuffle_epi32(x, _MM_SHUFFLE(3, 2, 3, 2));
+            }
+        };
+#endif
+
+#if XSIMD_X86_INSTR_SET >= XSIMD_X86_AVX2_VERSION
+        // scans the 128 bits halves, then adds the last element of the
+        // low half to the high half
+        template <>
+        struct prefix_sum_kernel<batch<int32_t, 8>>
+        {
+            static inline batch<int32_t, 8> inclusive_scan(const batch<int32_t, 8>& x)
+            {
+                __m256i res = _mm256_add_epi32(x, _mm256_slli_si256(x, 4));
+                res = _mm256_add_epi32(res, _mm256_slli_si256(res, 8));
+                __m256i last = _mm256_shuffle_epi32(res, _MM_SHUFFLE(3, 3, 3, 3));
+                return _mm256_add_epi32(res, _mm256_permute2x128_si256(last, last, 0x08));
+            }
+
+            static inline batch<int32_t, 8> broadcast_last(const batch<int32_t, 8>& x)
+            {
+                return _mm256_permutevar8x32_epi32(x, _mm256_set1_epi32(7));
+            }
+        };
+
+        template <>
+        struct prefix_sum_kernel<batch<int64_t, 4>>
+        {
+            static inline batch<int64_t, 4> inclusive_scan(const batch<int64_t, 4>& x)
+            {
+                __m256i res = _mm256_add_epi64(x, _mm256_slli_si256(x, 8));
+                __m256i last = _mm256_shuffle_epi32(res, _MM_SHUFFLE(3, 2, 3, 2));
+                return _mm256_add_epi64(res, _mm256_permute2x128_si256(last, last, 0x08));
+            }
+
+            static inline batch<int64_t, 4> broadcast_last(const batch<int64_t, 4>& x)
+            {
+                return _mm256_permute4x64_epi64(x, _MM_SHUFFLE(3, 3, 3, 3));
+            }
+        };
+#endif
+
+#if XSIMD_X86_INSTR_SET >= XSIMD_X86_AVX512_VERSION
+        // valignd with a zero register shifts the elements up
+        template <>
+        struct prefix_sum_kernel<batch<int32_t, 16>>
+        {
+            static inline batch<int32_t, 16> inclusive_scan(const batch<int32_t, 16>& x)
+            {
+                const __m512i zero = _mm512_setzero_si512();
+                __m512i res = _mm512_add_epi32(x, _mm512_alignr_epi32(x, zero, 15));
+                res = _mm512_add_epi32(res, _mm512_alignr_epi32(res, zero, 14));
+                res = _mm512_add_epi32(res, _mm512_alignr_epi32(res, zero, 12));
+                return _mm512_add_epi32(res, _mm512_alignr_epi32(res, zero, 8));
+            }
+
+            static inline batch<int32_t, 16> broadcast_last(const batch<int32_t, 16>& x)
+            {
+                return _mm512_permutexvar_epi32(_mm512_set1_epi32(15), x);
+            }
+        };
+
+        template <>
+        struct prefix_sum_kernel<batch<int64_t, 8>>
+        {
+            static inline batch<int64_t, 8> inclusive_scan(const batch<int64_t, 8>& x)
+            {
+                const __m512i zero = _mm512_setzero_si512();
+                __m512i res = _mm512_add_epi64(x, _mm512_alignr_epi64(x, zero, 7));
+                res = _mm512_add_epi64(res, _mm512_alignr_epi64(res, zero, 6));
+                return _mm512_add_epi64(res, _mm512_alignr_epi64(res, zero, 4));
+            }
+
+            static inline batch<int64_t, 8> broadcast_last(const batch<int64_t, 8>& x)
+            {
+                return _mm512_permutexvar_epi64(_mm512_set1_epi64(7), x);
+            }
+        };
+#endif
+
+        template <class T>
+        using bitpacking_simd_tag = std::integral_constant<bool, (simd_traits<T>::size > 1)>;
+
+        template <class T>
+        inline void delta_decode(const T* deltas, std::size_t n, T* res, T initial, std::false_type)
+        {
+            using unsigned_type = typename std::make_unsigned<T>::type;
+            unsigned_type acc = static_cast<unsigned_type>(initial);
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                acc += static_cast<unsigned_type>(deltas[i]);
+                res[i] = static_cast<T>(acc);
+            }
+        }
+
+        template <class T>
+        inline void delta_decode(const T* deltas, std::size_t n, T* res, T initial, std::true_type)
+        {
+            constexpr std::size_t size = simd_traits<T>::size;
+            using b_type = batch<T, size>;
+            using kernel = prefix_sum_kernel<b_type>;
+            std::size_t vec_size = n - n % size;
+            b_type carry(initial);
+            for (std::size_t i = 0; i < vec_size; i += size)
+            {
+                b_type x = kernel::inclusive_scan(load_unaligned(deltas + i)) + carry;
+                x.store_unaligned(res + i);
+                carry = kernel::broadcast_last(x);
+            }
+            T last = vec_size == 0 ? initial : res[vec_size - 1];
+            delta_decode(deltas + vec_size, n - vec_size, res + vec_size, last, std::false_type());
+        }
+
+        template <class T>
+        inline void delta_encode(const T* values, std::size_t n, T* res, T initial, std::false_type)
+        {
+            using unsigned_type = typename std::make_unsigned<T>::type;
+            // backwards, so that res may alias values
+            for (std::size_t i = n; i > 1; --i)
+            {
+                res[i - 1] = static_cast<T>(static_cast<unsigned_type>(values[i - 1]) - static_cast<unsigned_type>(values[i - 2]));
+            }
+            if (n != 0)
+            {
+                res[0] = static_cast<T>(static_cast<unsigned_type>(values[0]) - static_cast<unsigned_type>(initial));
+            }
+        }
+
+        template <class T>
+        inline void delta_encode(const T* values, std::size_t n, T* res, T initial, std::true_type)
+        {
+            constexpr std::size_t size = simd_traits<T>::size;
+            // backwards as well: a batch only reads values that are not
+            // written yet
+            std::size_t i = n;
+            while (i >= size + 1)
+            {
+                i -= size;
+                (load_unaligned(values + i) - load_unaligned(values + i - 1)).store_unaligned(res + i);
+            }
+            delta_encode(values, i, res, initial, std::false_type());
+        }
+
+        template <class T>
+        inline T for_min(const T* values, std::size_t n, std::false_type)
+        {
+            T res = values[0];
+            for (std::size_t i = 1; i < n; ++i)
+            {
+                res = values[i] < res ? values[i] : res;
+            }
+            return res;
+        }
+
+        template <class T>
+        inline T for_min(const T* values, std::size_t n, std::true_type)
+        {
+            constexpr std::size_t size = simd_traits<T>::size;
+            std::size_t vec_size = n - n % size;
+            if (vec_size == 0)
+            {
+                return for_min(values, n, std::false_type());
+            }
+            batch<T, size> acc = load_unaligned(values);
+            for (std::size_t i = size; i < vec_size; i += size)
+            {
+                acc = min(acc, load_unaligned(values + i));
+            }
+            T res = acc[0];
+            for (std::size_t i = 1; i < size; ++i)
+            {
+                res = acc[i] < res ? acc[i] : res;
+            }
+            return n == vec_size ? res : std::min(res, for_min(values + vec_size, n - vec_size, std::false_type()));
+        }
+
+        template <class T>
+        inline void for_add(const T* values, std::size_t n, T offset, T* res, std::false_type)
+        {
+            using unsigned_type = typename std::make_unsigned<T>::type;
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                res[i] = static_cast<T>(static_cast<unsigned_type>(values[i]) + static_cast<unsigned_type>(offset));
+            }
+        }
+
+        template <class T>
+        inline void for_add(const T* values, std::size_t n, T offset, T* res, std::true_type)
+        {
+            constexpr std::size_t size = simd_traits<T>::size;
+            std::size_t vec_size = n - n % size;
+            const batch<T, size> b_offset(offset);
+            for (std::size_t i = 0; i < vec_size; i += size)
+            {
+                (load_unaligned(values + i) + b_offset).store_unaligned(res + i);
+            }
+            for_add(values + vec_size, n - vec_size, offset, res + vec_size, std::false_type());
+        }
+
+        template <class T>
+        inline T bitpack_or(const T* values, std::size_t n, std::false_type)
+        {
+            T res = 0;
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                res |= values[i];
+            }
+            return res;
+        }
+
+        template <class T>
+        inline T bitpack_or(const T* values, std::size_t n, std::true_type)
+        {
+            constexpr std::size_t size = simd_traits<T>::size;
+            std::size_t vec_size = n - n % size;
+            batch<T, size> acc(T(0));
+            for (std::size_t i = 0; i < vec_size; i += size)
+            {
+                acc = acc | load_unaligned(values + i);
+            }
+            T res = bitpack_or(values + vec_size, n - vec_size, std::false_type());
+            for (std::size_t i = 0; i < size; ++i)
+            {
+                res |= acc[i];
+            }
+            return res;
+        }
+    }
+
+    template <class T>
+    inline std::size_t bitpacked_size(std::size_t n, std::size_t bits)
+    {
+        detail::check_bitpacking_type<T>();
+        constexpr std::size_t block_size = detail::bitpack_block_size<T>();
+        constexpr std::size_t word_bits = detail::bitpack_word_bits<T>();
+        return (n / block_size) * detail::bitpack_lanes<T>() * bits + ((n % block_size) * bits + word_bits - 1) / word_bits;
+    }
+
+    template <class T>
+    inline std::size_t bitpack_width(const T* values, std::size_t n)
+    {
+        detail::check_bitpacking_type<T>();
+        using unsigned_type = typename std::make_unsigned<T>::type;
+        unsigned_type acc = static_cast<unsigned_type>(detail::bitpack_or(values, n, detail::bitpacking_simd_tag<T>()));
+        std::size_t res = 0;
+        for (; acc != 0; acc >>= 1)
+        {
+            ++res;
+        }
+        return res;
+    }
+
+    template <class T>
+    inline void bitpack(const T* values, std::size_t n, std::size_t bits, T* packed)
+    {
+        detail::check_bitpacking_type<T>();
+        constexpr std::size_t block_size = detail::bitpack_block_size<T>();
+        const std::size_t block_words = detail::bitpack_lanes<T>() * bits;
+        std::size_t num_blocks = n / block_size;
+        for (std::size_t b = 0; b < num_blocks; ++b)
+        {
+            detail::bitpack_block(values + b * block_size, bits, packed + b * block_words, detail::bitpacking_simd_tag<T>());
+        }
+        detail::bitpack_tail(values + num_blocks * block_size, n % block_size, bits, packed + num_blocks * block_words);
+    }
+
+    template <class T>
+    inline void bitunpack(const T* packed, std::size_t n, std::size_t bits, T* values)
+    {
+        detail::check_bitpacking_type<T>();
+        if (bits == 0)
+        {
+            std::fill(values, values + n, T(0));
+            return;
+        }
+        constexpr std::size_t block_size = detail::bitpack_block_size<T>();
+        const std::size_t block_words = detail::bitpack_lanes<T>() * bits;
+        std::size_t num_blocks = n / block_size;
+        for (std::size_t b = 0; b < num_blocks; ++b)
+        {
+            detail::bitunpack_block(packed + b * block_words, bits, values + b * block_size, detail::bitpacking_simd_tag<T>());
+        }
+        detail::bitunpack_tail(packed + num_blocks * block_words, n % block_size, bits, values + num_blocks * block_size);
+    }
+
+    template <class T>
+    inline T for_encode(const T* values, std::size_t n, T* res)
+    {
+        detail::check_bitpacking_type<T>();
+        if (n == 0)
+        {
+            return T(0);
+        }
+        T base = detail::for_min(values, n, detail::bitpacking_simd_tag<T>());
+        using unsigned_type = typename std::make_unsigned<T>::type;
+        detail::for_add(values, n, static_cast<T>(unsigned_type(0) - static_cast<unsigned_type>(base)), res,
+                        detail::bitpacking_simd_tag<T>());
+        return base;
+    }
+
+    template <class T>
+    inline void for_decode(const T* offsets, std::size_t n, T base, T* res)
+    {
+        detail::check_bitpacking_type<T>();
+        detail::for_add(offsets, n, base, res, detail::bitpacking_simd_tag<T>());
+    }
+
+    template <class T>
+    inline void delta_encode(const T* values, std::size_t n, T* res, T initial)
+    {
+        detail::check_bitpacking_type<T>();
+        detail::delta_encode(values, n, res, initial, detail::bitpacking_simd_tag<T>());
+    }
+
+    template <class T>
+    inline void delta_decode(const T* deltas, std::size_t n, T* res, T initial)
+    {
+        detail::check_bitpacking_type<T>();
+        detail::delta_decode(deltas, n, res, initial, detail::bitpacking_simd_tag<T>());
+    }
+}
+
+#endif
@@ -0,0 +1,562 @@
+/***************************************************************************
+* Copyright (c) 2016, Johan Mabille and Sylvain Corlay                     *
+*                                                                          *
+* Distributed under the terms of the BSD 3-Clause License.                 *
+*                                                                          *
+* The full license is in the file LICENSE, distributed with this software. *
+****************************************************************************/
+
+#ifndef XSIMD_BLAS_HPP
+#define XSIMD_BLAS_HPP
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <type_traits>
+
+#include "../xsimd.hpp"
+
+namespace xsimd
+{
+    /**
+     * Computes y[i] += alpha * x[i] over the \c n elements of the arrays
+     * \c x and \c y.
+     * @param n number of elements.
+     * @param alpha the scalar multiplying \c x.
+     * @param x pointer to the input array.
+     * @param y pointer to the array updated in place.
+     */
+    template <class T>
+    void axpy(std::size_t n, T alpha, const T* x, T* y);
+
+    /**
+     * Computes y[i] += alpha * x[i] over the elements of the containers
+     * \c x and \c y, which have the same size. The batches are loaded and
+     * stored with aligned instructions when both containers use an
+     * aligned_allocator.
+     * @param alpha the scalar multiplying \c x.
+     * @param x the input container.
+     * @param y the container updated in place.
+     */
+    template <class C1, class C2>
+    void axpy(typename C1::value_type alpha, const C1& x, C2& y);
+
+    /**
+     * Computes the dot product of the \c n elements of the arrays \c x
+     * and \c y.
+     * @param n number of elements.
+     * @param x pointer to the first array.
+     * @param y pointer to the second array.
+     * @return the sum of x[i] * y[i].
+     */
+    template <class T>
+    T dot(std::size_t n, const T* x, const T* y);
+
+    /**
+     * Computes the dot product of the containers \c x and \c y, which have
+     * the same size.
+     * @param x the first container.
+     * @param y the second container.
+     * @return the sum of x[i] * y[i].
+     */
+    template <class C1, class C2>
+    typename C1::value_type dot(const C1& x, const C2& y);
+
+    /**
+     * Computes the euclidean norm of the \c n elements of the array \c x.
+     * The squares are summed directly when they can neither overflow nor
+     * underflow, otherwise the elements are scaled by their maximum
+     * absolute value first, so that the result is accurate over the whole
+     * range of \c T.
+     * @param n number of elements.
+     * @param x pointer to the array.
+     * @return the square root of the sum of x[i] * x[i].
+     */
+    template <class T>
+    T nrm2(std::size_t n, const T* x);
+
+    /**
+     * Computes the euclidean norm of the elements of the container \c x.
+     * @param x the container.
+     * @return the square root of the sum of x[i] * x[i].
+     */
+    template <class C>
+    typename C::value_type nrm2(const C& x);
+
+    /**
+     * Computes the sum of the absolute values of the \c n elements of the
+     * array \c x.
+     * @param n number of elements.
+     * @param x pointer to the array.
+     * @return the sum of |x[i]|.
+     */
+    template <class T>
+    T asum(std::size_t n, const T* x);
+
+    /**
+     * Computes the sum of the absolute values of the elements of the
+     * container \c x.
+     * @param x the container.
+     * @return the sum of |x[i]|.
+     */
+    template <class C>
+    typename C::value_type asum(const C& x);
+
+    /**
+     * Computes x[i] *= alpha over the \c n elements of the array \c x.
+     * @param n number of elements.
+     * @param alpha the scalar.
+     * @param x pointer to the array updated in place.
+     */
+    template <class T>
+    void scal(std::size_t n, T alpha, T* x);
+
+    /**
+     * Computes x[i] *= alpha over the elements of the container \c x.
+     * @param alpha the scalar.
+     * @param x the container updated in place.
+     */
+    template <class C>
+    void scal(typename C::value_type alpha, C& x);
+
+    /**
+     * Returns the index of the first element of the array \c x with the
+     * largest absolute value. The NaN are ignored, as in the reference
+     * BLAS; unlike it, the index is 0-based.
+     * @param n number of elements.
+     * @param x pointer to the array.
+     * @return the index of the first maximum, 0 if \c n is 0 or if all the
+     * elements are NaN.
+     */
+    template <class T>
+    std::size_t iamax(std::size_t n, const T* x);
+
+    /**
+     * Returns the index of the first element of the container \c x with
+     * the largest absolute value.
+     * @param x the container.
+     * @return the index of the first maximum, 0 if \c x is empty or if all
+     * the elements are NaN.
+     */
+    template <class C>
+    std::size_t iamax(const C& x);
+
+    /******************
+     * implementation *
+     ******************/
+
+    namespace detail
+    {
+        template <class T>
+        using has_blas_batch = std::integral_constant<bool, (simd_traits<T>::size > 1)>;
+
+        template <class C1, class C2>
+        using common_alignment_t = typename std::conditional<std::is_same<container_alignment_t<C1>, aligned_mode>::value &&
+                                                                 std::is_same<container_alignment_t<C2>, aligned_mode>::value,
+                                                             aligned_mode, unaligned_mode>::type;
+
+        /********
+         * axpy *
+         ********/
+
+        template <class T, class M>
+        inline void axpy_impl(std::size_t n, T alpha, const T* x, T* y, M, std::false_type)
+        {
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                y[i] += alpha * x[i];
+            }
+        }
+
+        template <class T, class M>
+        inline void axpy_impl(std::size_t n, T alpha, const T* x, T* y, M mode, std::true_type)
+        {
+            using b_type = simd_type<T>;
+            constexpr std::size_t size = simd_traits<T>::size;
+            std::size_t vec_size = n - n % size;
+            std::size_t block_size = vec_size - vec_size % (4 * size);
+            b_type ba(alpha);
+            for (std::size_t i = 0; i < block_size; i += 4 * size)
+            {
+                b_type y0 = fma(ba, b_type(x + i, mode), b_type(y + i, mode));
+                b_type y1 = fma(ba, b_type(x + i + size, mode), b_type(y + i + size, mode));
+                b_type y2 = fma(ba, b_type(x + i + 2 * size, mode), b_type(y + i + 2 * size, mode));
+                b_type y3 = fma(ba, b_type(x + i + 3 * size, mode), b_type(y + i + 3 * size, mode));
+                store_simd(y + i, y0, mode);
+                store_simd(y + i + size, y1, mode);
+                store_simd(y + i + 2 * size, y2, mode);
+                store_simd(y + i + 3 * size, y3, mode);
+            }
+            for (std::size_t i = block_size; i < vec_size; i += size)
+            {
+                store_simd(y + i, fma(ba, b_type(x + i, mode), b_type(y + i, mode)), mode);
+            }
+            axpy_impl(n - vec_size, alpha, x + vec_size, y + vec_size, mode, std::false_type());
+        }
+
+        /*******
+         * dot *
+         *******/
+
+        template <class T, class M>
+        inline T dot_impl(std::size_t n, const T* x, const T* y, M, std::false_type)
+        {
+            T res = T(0);
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                res += x[i] * y[i];
+            }
+            return res;
+        }
+
+        // Four accumulators hide the latency of the fused multiply-adds
+        template <class T, class M>
+        inline T dot_impl(std::size_t n, const T* x, const T* y, M mode, std::true_type)
+        {
+            using b_type = simd_type<T>;
+            constexpr std::size_t size = simd_traits<T>::size;
+            std::size_t vec_size = n - n % size;
+            std::size_t block_size = vec_size - vec_size % (4 * size);
+            b_type s0(T(0)), s1(T(0)), s2(T(0)), s3(T(0));
+            for (std::size_t i = 0; i < block_size; i += 4 * size)
+            {
+                s0 = fma(b_type(x + i, mode), b_type(y + i, mode), s0);
+                s1 = fma(b_type(x + i + size, mode), b_type(y + i + size, mode), s1);
+                s2 = fma(b_type(x + i + 2 * size, mode), b_type(y + i + 2 * size, mode), s2);
+                s3 = fma(b_type(x + i + 3 * size, mode), b_type(y + i + 3 * size, mode), s3);
+            }
+            for (std::size_t i = block_size; i < vec_size; i += size)
+            {
+                s0 = fma(b_type(x + i, mode), b_type(y + i, mode), s0);
+            }
+            T res = hadd((s0 + s1) + (s2 + s3));
+            return res + dot_impl(n - vec_size, x + vec_size, y + vec_size, mode, std::false_type());
+        }
+
+        /********
+         * asum *
+         ********/
+
+        template <class T, class M>
+        inline T asum_impl(std::size_t n, const T* x, M, std::false_type)
+        {
+            T res = T(0);
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                res += std::abs(x[i]);
+            }
+            return res;
+        }
+
+        template <class T, class M>
+        inline T asum_impl(std::size_t n, const T* x, M mode, std::true_type)
+        {
+            using b_type = simd_type<T>;
+            constexpr std::size_t size = simd_traits<T>::size;
+            std::size_t vec_size = n - n % size;
+            std::size_t block_size = vec_size - vec_size % (4 * size);
+            b_type s0(T(0)), s1(T(0)), s2(T(0)), s3(T(0));
+            for (std::size_t i = 0; i < block_size; i += 4 * size)
+            {
+                s0 += abs(b_type(x + i, mode));
+                s1 += abs(b_type(x + i + size, mode));
+                s2 += abs(b_type(x + i + 2 * size, mode));
+                s3 += abs(b_type(x + i + 3 * size, mode));
+            }
+            for (std::size_t i = block_size; i < vec_size; i += size)
+            {
+                s0 += abs(b_type(x + i, mode));
+            }
+            T res = hadd((s0 + s1) + (s2 + s3));
+            return res + asum_impl(n - vec_size, x + vec_size, mode, std::false_type());
+        }
+
+        /********
+         * nrm2 *
+         ********/
+
+        // Sum of the squares of x[i] * scale0 * scale1; two factors are
+        // needed to bring a subnormal or a huge float to 1
+        template <class T, class M>
+        inline T sum_squares(std::size_t n, const T* x, T scale0, T scale1, M, std::false_type)
+        {
+            T res = T(0);
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                T v = x[i] * scale0 * scale1;
+                res += v * v;
+            }
+            return res;
+        }
+
+        template <class T, class M>
+        inline T sum_squares(std::size_t n, const T* x, T scale0, T scale1, M mode, std::true_type)
+        {
+            using b_type = simd_type<T>;
+            constexpr std::size_t size = simd_traits<T>::size;
+            std::size_t vec_size = n - n % size;
+            std::size_t block_size = vec_size - vec_size % (4 * size);
+            b_type bs0(scale0), bs1(scale1);
+            b_type s0(T(0)), s1(T(0)), s2(T(0)), s3(T(0));
+            for (std::size_t i = 0; i < block_size; i += 4 * size)
+            {
+                b_type v0 = b_type(x + i, mode) * bs0 * bs1;
+                b_type v1 = b_type(x + i + size, mode) * bs0 * bs1;
+                b_type v2 = b_type(x + i + 2 * size, mode) * bs0 * bs1;
+                b_type v3 = b_type(x + i + 3 * size, mode) * bs0 * bs1;
+                s0 = fma(v0, v0, s0);
+                s1 = fma(v1, v1, s1);
+                s2 = fma(v2, v2, s2);
+                s3 = fma(v3, v3, s3);
+            }
+            for (std::size_t i = block_size; i < vec_size; i += size)
+            {
+                b_type v = b_type(x + i, mode) * bs0 * bs1;
+                s0 = fma(v, v, s0);
+            }
+            T res = hadd((s0 + s1) + (s2 + s3));
+            return res + sum_squares(n - vec_size, x + vec_size, scale0, scale1, mode, std::false_type());
+        }
+
+        template <class T, class M>
+        inline T max_abs(std::size_t n, const T* x, M, std::false_type)
+        {
+            T res = T(0);
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                res = std::abs(x[i]) > res ? std::abs(x[i]) : res;
+            }
+            return res;
+        }
+
+        template <class T, class M>
+        inline T max_abs(std::size_t n, const T* x, M mode, std::true_type)
+        {
+            using b_type = simd_type<T>;
+            constexpr std::size_t size = simd_traits<T>::size;
+            std::size_t vec_size = n - n % size;
+            b_type m(T(0));
+            for (std::size_t i = 0; i < vec_size; i += size)
+            {
+                b_type a = abs(b_type(x + i, mode));
+                m = select(a > m, a, m);
+            }
+            std::array<T, size> am;
+            m.store_unaligned(am.data());
+            T res = max_abs(size, am.data(), mode, std::false_type());
+            T tail = max_abs(n - vec_size, x + vec_size, mode, std::false_type());
+            return tail > res ? tail : res;
+        }
+
+        // The plain sum of squares is accurate when it lies between the
+        // smallest normal number divided by the epsilon, below which the
+        // small squares lose bits to underflow, and the largest finite
+        // number. Otherwise the elements are divided by the largest
+        // absolute value, which bounds the sum by n.
+        template <class T, class M>
+        inline T nrm2_impl(std::size_t n, const T* x, M mode)
+        {
+            using vectorized = has_blas_batch<T>;
+            T s = sum_squares(n, x, T(1), T(1), mode, vectorized());
+            const T tiny = std::numeric_limits<T>::min() / std::numeric_limits<T>::epsilon();
+            if ((s >= tiny && s <= std::numeric_limits<T>::max()) || std::isnan(s))
+            {
+                return std::sqrt(s);
+            }
+            T m = max_abs(n, x, mode, vectorized());
+            if (m == T(0) || std::isinf(m))
+            {
+                return m;
+            }
+            // the largest element is brought to [1, 2) by an exact power of
+            // two; a reciprocal of m would be subnormal for a large m
+            int e = std::ilogb(m);
+            T scale0 = std::ldexp(T(1), -e / 2);
+            T scale1 = std::ldexp(T(1), -e - (-e / 2));
+            return std::ldexp(std::sqrt(sum_squares(n, x, scale0, scale1, mode, vectorized())), e);
+        }
+
+        /********
+         * scal *
+         ********/
+
+        template <class T, class M>
+        inline void scal_impl(std::size_t n, T alpha, T* x, M, std::false_type)
+        {
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                x[i] *= alpha;
+            }
+        }
+
+        template <class T, class M>
+        inline void scal_impl(std::size_t n, T alpha, T* x, M mode, std::true_type)
+        {
+            using b_type = simd_type<T>;
+            constexpr std::size_t size = simd_traits<T>::size;
+            std::size_t vec_size = n - n % size;
+            std::size_t block_size = vec_size - vec_size % (4 * size);
+            b_type ba(alpha);
+            for (std::size_t i = 0; i < block_size; i += 4 * size)
+            {
+                b_type x0 = b_type(x + i, mode) * ba;
+                b_type x1 = b_type(x + i + size, mode) * ba;
+                b_type x2 = b_type(x + i + 2 * size, mode) * ba;
+                b_type x3 = b_type(x + i + 3 * size, mode) * ba;
+                store_simd(x + i, x0, mode);
+                store_simd(x + i + size, x1, mode);
+                store_simd(x + i + 2 * size, x2, mode);
+                store_simd(x + i + 3 * size, x3, mode);
+            }
+            for (std::size_t i = block_size; i < vec_size; i += size)
+            {
+                store_simd(x + i, b_type(x + i, mode) * ba, mode);
+            }
+            scal_impl(n - vec_size, alpha, x + vec_size, mode, std::false_type());
+        }
+
+        /*********
+         * iamax *
+         *********/
+
+        // First index of an absolute value greater than best, which is
+        // updated; n if there is none
+        template <class T>
+        inline std::size_t iamax_scan(std::size_t n, const T* x, T& best)
+        {
+            std::size_t res = n;
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                if (std::abs(x[i]) > best)
+                {
+                    best = std::abs(x[i]);
+                    res = i;
+                }
+            }
+            return res;
+        }
+
+        template <class T, class M>
+        inline std::size_t iamax_impl(std::size_t n, const T* x, M, std::false_type)
+        {
+            T best = T(-1);
+            std::size_t res = iamax_scan(n, x, best);
+            return res == n ? 0 : res;
+        }
+
+        // The maximum of each chunk is computed with batches; the chunk is
+        // scanned for the index only when it improves on the best value,
+        // which rarely happens past the first chunks of random data.
+        template <class T, class M>
+        inline std::size_t iamax_impl(std::size_t n, const T* x, M mode, std::true_type)
+        {
+            using b_type = simd_type<T>;
+            constexpr std::size_t size = simd_traits<T>::size;
+            constexpr std::size_t chunk_size = 64 * size;
+            std::size_t vec_size = n - n % size;
+            T best = T(-1);
+            std::size_t res = n;
+            for (std::size_t base = 0; base < vec_size; base += chunk_size)
+            {
+                std::size_t end = base + chunk_size < vec_size ? base + chunk_size : vec_size;
+                b_type m(best);
+                for (std::size_t i = base; i < end; i += size)
+                {
+                    // comparisons with NaN are false, the NaN are ignored
+                    b_type a = abs(b_type(x + i, mode));
+                    m = select(a > m, a, m);
+                }
+                if (any(m > b_type(best)))
+                {
+                    std::size_t k = iamax_scan(end - base, x + base, best);
+                    res = base + k;
+                }
+            }
+            std::size_t k = iamax_scan(n - vec_size, x + vec_size, best);
+            res = k != n - vec_size ? vec_size + k : res;
+            return res == n ? 0 : res;
+        }
+    }
+
+    template <class T>
+    inline void axpy(std::size_t n, T alpha, const T* x, T* y)
+    {
+        detail::axpy_impl(n, alpha, x, y, unaligned_mode(), detail::has_blas_batch<T>());
+    }
+
+    template <class C1, class C2>
+    inline void axpy(typename C1::value_type alpha, const C1& x, C2& y)
+    {
+        using value_type = typename C1::value_type;
+        detail::axpy_impl(x.size(), alpha, x.data(), y.data(), detail::common_alignment_t<C1, C2>(),
+                          detail::has_blas_batch<value_type>());
+    }
+
+    template <class T>
+    inline T dot(std::size_t n, const T* x, const T* y)
+    {
+        return detail::dot_impl(n, x, y, unaligned_mode(), detail::has_blas_batch<T>());
+    }
+
+    template <class C1, class C2>
+    inline typename C1::value_type dot(const C1& x, const C2& y)
+    {
+        using value_type = typename C1::value_type;
+        return detail::dot_impl(x.size(), x.data(), y.data(), detail::common_alignment_t<C1, C2>(),
+                                detail::has_blas_batch<value_type>());
+    }
+
+    template <class T>
+    inline T nrm2(std::size_t n, const T* x)
+    {
+        return detail::nrm2_impl(n, x, unaligned_mode());
+    }
+
+    template <class C>
+    inline typename C::value_type nrm2(const C& x)
+    {
+        return detail::nrm2_impl(x.size(), x.data(), container_alignment_t<C>());
+    }
+
+    template <class T>
+    inline T asum(std::size_t n, const T* x)
+    {
+        return detail::asum_impl(n, x, unaligned_mode(), detail::has_blas_batch<T>());
+    }
+
+    template <class C>
+    inline typename C::value_type asum(const C& x)
+    {
+        using value_type = typename C::value_type;
+        return detail::asum_impl(x.size(), x.data(), container_alignment_t<C>(), detail::has_blas_batch<value_type>());
+    }
+
+    template <class T>
+    inline void scal(std::size_t n, T alpha, T* x)
+    {
+        detail::scal_impl(n, alpha, x, unaligned_mode(), detail::has_blas_batch<T>());
+    }
+
+    template <class C>
+    inline void scal(typename C::value_type alpha, C& x)
+    {
+        using value_type = typename C::value_type;
+        detail::scal_impl(x.size(), alpha, x.data(), container_alignment_t<C>(), detail::has_blas_batch<value_type>());
+    }
+
+    template <class T>
+    inline std::size_t iamax(std::size_t n, const T* x)
+    {
+        return detail::iamax_impl(n, x, unaligned_mode(), detail::has_blas_batch<T>());
+    }
+
+    template <class C>
+    inline std::size_t iamax(const C& x)
+    {
+        using value_type = typename C::value_type;
+        return detail::iamax_impl(x.size(), x.data(), container_alignment_t<C>(), detail::has_blas_batch<value_type>());
+    }
+}
+
+#endif
@@ -0,0 +1,323 @@
+/***************************************************************************
+* Copyright (c) 2016, Johan Mabille and Sylvain Corlay                     *
+*                                                                          *
+* Distributed under the terms of the BSD 3-Clause License.                 *
+*                                                                          *
+* The full license is in the file LICENSE, distributed with this software. *
+****************************************************************************/
+
+#ifndef XSIMD_BLOOM_FILTER_HPP
+#define XSIMD_BLOOM_FILTER_HPP
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+#include "../memory/xsimd_alignment.hpp"
+#include "xsimd_hash.hpp"
+
+namespace xsimd
+{
+    /**
+     * @class split_block_bloom_filter
+     * @brief Register blocked Bloom filter
+     *
+     * The bits of the filter are split into blocks of as many 32 bits words
+     * as a batch of int32_t holds (eight words without SIMD support), aligned
+     * on the batch size. A key sets exactly one bit in each word of a single
+     * block: the high half of its 64 bits murmur3 hash selects the block,
+     * and the low half, multiplied by one odd salt per word, gives the bit
+     * positions. Insertion and lookup thus cost one batch multiply, two
+     * shifts and one batch OR or AND / compare, and at most one cache miss.
+     *
+     * The block size depends on the instruction set, so that filters built
+     * with different instruction sets are not compatible.
+     *
+     * @tparam K the type of the keys, int32_t or int64_t.
+     */
+    template <class K>
+    class split_block_bloom_filter
+    {
+    public:
+
+        static_assert(std::is_same<K, int32_t>::value || std::is_same<K, int64_t>::value,
+                      "split_block_bloom_filter requires int32_t or int64_t keys");
+
+        using key_type = K;
+        using size_type = std::size_t;
+
+        static constexpr size_type block_size = simd_traits<int32_t>::size > 1 ? simd_traits<int32_t>::size : 8;
+
+        explicit split_block_bloom_filter(size_type num_keys = 0, size_type bits_per_key = 10);
+
+        size_type num_blocks() const noexcept;
+        void clear() noexcept;
+
+        void insert(K key);
+        bool contains(K key) const;
+
+        void insert_many(const K* keys, size_type n);
+        size_type contains_many(const K* keys, size_type n, uint64_t* bitmap) const;
+
+    private:
+
+        using simd_tag = std::integral_constant<bool, (simd_traits<int32_t>::size > 1)>;
+        using word_vector = std::vector<int32_t, aligned_allocator<int32_t, detail::default_alignment>>;
+
+        static constexpr size_type prefetch_distance = 16;
+
+        int32_t* block(uint64_t hash) noexcept;
+        const int32_t* block(uint64_t hash) const noexcept;
+
+        void insert_hash(uint64_t hash, std::true_type);
+        void insert_hash(uint64_t hash, std::false_type);
+        bool contains_hash(uint64_t hash, std::true_type) const;
+        bool contains_hash(uint64_t hash, std::false_type) const;
+
+        word_vector m_words;
+        size_type m_num_blocks;
+    };
+
+    /***************************************************
+     * split_block_bloom_filter implementation details *
+     ***************************************************/
+
+    namespace detail
+    {
+        // odd multipliers, one per word of a block; the first eight ones
+        // are those of the Parquet split block Bloom filter
+        inline const int32_t* bloom_filter_salts()
+        {
+            static const int32_t salts[16] = {
+                int32_t(0x47b6137b), int32_t(0x44974d91), int32_t(0x8824ad5b), int32_t(0xa2b7289d),
+                int32_t(0x705495c7), int32_t(0x2df1424b), int32_t(0x9efc4947), int32_t(0x5c6bfb31),
+                int32_t(0x9e3779b1), int32_t(0x85ebca77), int32_t(0xc2b2ae3d), int32_t(0x27d4eb2f),
+                int32_t(0x165667b1), int32_t(0xd3a2646d), int32_t(0xfd7046c5), int32_t(0xb55a4f09)
+            };
+            return salts;
+        }
+
+        template <class K>
+        inline uint64_t bloom_filter_hash(K key)
+        {
+            using unsigned_type = typename std::make_unsigned<K>::type;
+            return scalar_fmix(static_cast<uint64_t>(static_cast<unsigned_type>(key)));
+        }
+
+        // one bit per word, at the position given by the five high bits of
+        // the product of the hash and the salt of the word
+        template <class B>
+        inline B bloom_filter_mask(uint64_t hash)
+        {
+            B salts;
+            salts.load_unaligned(bloom_filter_salts());
+            B h(static_cast<int32_t>(static_cast<uint32_t>(hash)));
+            return B(1) << logical_shift_right(h * salts, 27);
+        }
+
+        // function templates rather than member functions, so that the
+        // block batch is not instantiated without SIMD support
+        template <class B>
+        inline void bloom_filter_insert(int32_t* words, uint64_t hash)
+        {
+            B b;
+            b.load_aligned(words);
+            (b | bloom_filter_mask<B>(hash)).store_aligned(words);
+        }
+
+        template <class B>
+        inline bool bloom_filter_contains(const int32_t* words, uint64_t hash)
+        {
+            B b;
+            b.load_aligned(words);
+            B mask = bloom_filter_mask<B>(hash);
+            return all((b & mask) == mask);
+        }
+
+        inline uint32_t bloom_filter_bit(uint64_t hash, std::size_t word)
+        {
+            uint32_t h = static_cast<uint32_t>(hash);
+            return uint32_t(1) << ((h * static_cast<uint32_t>(bloom_filter_salts()[word])) >> 27);
+        }
+    }
+
+    /*******************************************
+     * split_block_bloom_filter implementation *
+     *******************************************/
+
+    template <class K>
+    constexpr typename split_block_bloom_filter<K>::size_type split_block_bloom_filter<K>::block_size;
+
+    template <class K>
+    constexpr typename split_block_bloom_filter<K>::size_type split_block_bloom_filter<K>::prefetch_distance;
+
+    /**
+     * Constructs an empty filter sized for \c num_keys keys.
+     * @param num_keys the expected number of keys.
+     * @param bits_per_key the number of bits per expected key; 10 bits per
+     * key give a false positive rate of about 1% with blocks of 256 bits.
+     */
+    template <class K>
+    inline split_block_bloom_filter<K>::split_block_bloom_filter(size_type num_keys, size_type bits_per_key)
+    {
+        constexpr size_type block_bits = 32 * block_size;
+        m_num_blocks = std::max(size_type(1), (num_keys * bits_per_key + block_bits - 1) / block_bits);
+        m_words.assign(m_num_blocks * block_size, 0);
+    }
+
+    /**
+     * Returns the number of blocks of the filter.
+     */
+    template <class K>
+    inline auto split_block_bloom_filter<K>::num_blocks() const noexcept -> size_type
+    {
+        return m_num_blocks;
+    }
+
+    /**
+     * Removes all the keys from the filter.
+     */
+    template <class K>
+    inline void split_block_bloom_filter<K>::clear() noexcept
+    {
+        std::fill(m_words.begin(), m_words.end(), 0);
+    }
+
+    /**
+     * Inserts \c key into the filter.
+     */
+    template <class K>
+    inline void split_block_bloom_filter<K>::insert(K key)
+    {
+        insert_hash(detail::bloom_filter_hash(key), simd_tag());
+    }
+
+    /**
+     * Returns false if \c key was never inserted into the filter, true if
+     * it may have been.
+     */
+    template <class K>
+    inline bool split_block_bloom_filter<K>::contains(K key) const
+    {
+        return contains_hash(detail::bloom_filter_hash(key), simd_tag());
+    }
+
+    /**
+     * Inserts the \c n keys of \c keys into the filter. The blocks of the
+     * next keys are prefetched while the current ones are updated.
+     * @param keys pointer to the keys to insert.
+     * @param n number of keys.
+     */
+    template <class K>
+    inline void split_block_bloom_filter<K>::insert_many(const K* keys, size_type n)
+    {
+        std::array<uint64_t, prefetch_distance> hashes;
+        for (size_type i = 0; i < n; i += prefetch_distance)
+        {
+            size_type count = std::min(prefetch_distance, n - i);
+            for (size_type j = 0; j < count; ++j)
+            {
+                hashes[j] = detail::bloom_filter_hash(keys[i + j]);
+                prefetch(block(hashes[j]));
+            }
+            for (size_type j = 0; j < count; ++j)
+            {
+                insert_hash(hashes[j], simd_tag());
+            }
+        }
+    }
+
+    /**
+     * Looks up the \c n keys of \c keys and sets bit \c i % 64 of
+     * bitmap[i / 64] if the i-th key may be in the filter, clears it
+     * otherwise. The bits past \c n in the last word are cleared. The
+     * blocks of the next keys are prefetched while the current ones are
+     * tested.
+     * @param keys pointer to the keys to look up.
+     * @param n number of keys.
+     * @param bitmap pointer to the (n + 63) / 64 words of the result.
+     * @return the number of keys that may be in the filter.
+     */
+    template <class K>
+    inline auto split_block_bloom_filter<K>::contains_many(const K* keys, size_type n, uint64_t* bitmap) const -> size_type
+    {
+        static_assert(64 % prefetch_distance == 0, "a bitmap word must hold whole chunks of keys");
+        std::array<uint64_t, prefetch_distance> hashes;
+        size_type res = 0;
+        uint64_t word = 0;
+        for (size_type i = 0; i < n; i += prefetch_distance)
+        {
+            size_type count = std::min(prefetch_distance, n - i);
+            for (size_type j = 0; j < count; ++j)
+            {
+                hashes[j] = detail::bloom_filter_hash(keys[i + j]);
+                prefetch(block(hashes[j]));
+            }
+            for (size_type j = 0; j < count; ++j)
+            {
+                bool found = contains_hash(hashes[j], simd_tag());
+                word |= uint64_t(found) << ((i + j) % 64);
+                res += found;
+            }
+            if ((i + count) % 64 == 0 || i + count == n)
+            {
+                bitmap[i / 64] = word;
+                word = 0;
+            }
+        }
+        return res;
+    }
+
+    // Lemire's multiply-shift range reduction of the high half of the hash
+    template <class K>
+    inline int32_t* split_block_bloom_filter<K>::block(uint64_t hash) noexcept
+    {
+        return m_words.data() + static_cast<size_type>(((hash >> 32) * m_num_blocks) >> 32) * block_size;
+    }
+
+    template <class K>
+    inline const int32_t* split_block_bloom_filter<K>::block(uint64_t hash) const noexcept
+    {
+        return m_words.data() + static_cast<size_type>(((hash >> 32) * m_num_blocks) >> 32) * block_size;
+    }
+
+    template <class K>
+    inline void split_block_bloom_filter<K>::insert_hash(uint64_t hash, std::true_type)
+    {
+        detail::bloom_filter_insert<batch<int32_t, block_size>>(block(hash), hash);
+    }
+
+    template <class K>
+    inline void split_block_bloom_filter<K>::insert_hash(uint64_t hash, std::false_type)
+    {
+        int32_t* words = block(hash);
+        for (size_type i = 0; i < block_size; ++i)
+        {
+            words[i] = static_cast<int32_t>(static_cast<uint32_t>(words[i]) | detail::bloom_filter_bit(hash, i));
+        }
+    }
+
+    template <class K>
+    inline bool split_block_bloom_filter<K>::contains_hash(uint64_t hash, std::true_type) const
+    {
+        return detail::bloom_filter_contains<batch<int32_t, block_size>>(block(hash), hash);
+    }
+
+    template <class K>
+    inline bool split_block_bloom_filter<K>::contains_hash(uint64_t hash, std::false_type) const
+    {
+        const int32_t* words = block(hash);
+        uint32_t missing = 0;
+        for (size_type i = 0; i < block_size; ++i)
+        {
+            uint32_t bit = detail::bloom_filter_bit(hash, i);
+            missing |= ~static_cast<uint32_t>(words[i]) & bit;
+        }
+        return missing == 0;
+    }
+}
+
+#endif
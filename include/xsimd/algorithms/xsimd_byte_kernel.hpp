@@ -0,0 +1,354 @@
+/***************************************************************************
+* Copyright (c) 2016, Johan Mabille and Sylvain Corlay                     *
+*                                                                          *
+* Distributed under the terms of the BSD 3-Clause License.                 *
+*                                                                          *
+* The full license is in the file LICENSE, distributed with this software. *
+****************************************************************************/
+
+#ifndef XSIMD_BYTE_KERNEL_HPP
+#define XSIMD_BYTE_KERNEL_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#include "../memory/xsimd_alignment.hpp"
+#include "../xsimd.hpp"
+
+namespace xsimd
+{
+    namespace detail
+    {
+        // The byte kernel gives the text algorithms registers of unsigned
+        // bytes: 64 bytes with AVX512BW, 32 with AVX2, 16 with SSSE3 or
+        // AArch64 NEON, and 16 bytes processed one at a time otherwise.
+        // lookup16 reads a table of 16 bytes, repeated in each 128 bits
+        // lane, at indices lower than 16. movemask gathers the high bits
+        // of the bytes. prev<K> shifts the bytes of cur up by K, shifting
+        // in the last K bytes of prev. zip_lo and zip_hi interleave the
+        // bytes of the first and second halves of two registers.
+
+#if defined(__AVX512BW__)
+        struct byte_kernel
+        {
+            using reg = __m512i;
+            static constexpr std::size_t size = 64;
+            static constexpr bool native = true;
+
+            static inline reg load(const uint8_t* src) { return _mm512_loadu_si512(src); }
+            static inline void store(uint8_t* dst, reg x) { _mm512_storeu_si512(dst, x); }
+            static inline reg splat(uint8_t x) { return _mm512_set1_epi8(static_cast<char>(x)); }
+
+            static inline reg table16(const uint8_t* table)
+            {
+                return _mm512_maskz_broadcast_i32x4(0xffff, _mm_loadu_si128(reinterpret_cast<const __m128i*>(table)));
+            }
+
+            static inline reg lookup16(reg table, reg idx) { return _mm512_shuffle_epi8(table, idx); }
+            static inline reg eq(reg lhs, reg rhs) { return _mm512_movm_epi8(_mm512_cmpeq_epi8_mask(lhs, rhs)); }
+            static inline reg bitwise_and(reg lhs, reg rhs) { return _mm512_and_si512(lhs, rhs); }
+            static inline reg bitwise_or(reg lhs, reg rhs) { return _mm512_or_si512(lhs, rhs); }
+            static inline reg bitwise_xor(reg lhs, reg rhs) { return _mm512_xor_si512(lhs, rhs); }
+            static inline reg add(reg lhs, reg rhs) { return _mm512_add_epi8(lhs, rhs); }
+            static inline reg subs(reg lhs, reg rhs) { return _mm512_subs_epu8(lhs, rhs); }
+            static inline reg shr4(reg x) { return _mm512_and_si512(_mm512_srli_epi16(x, 4), splat(0x0f)); }
+
+            template <int K>
+            static inline reg prev(reg cur, reg prv)
+            {
+                // lane i of shifted is lane i - 1 of cur, or the last lane of prv
+                reg shifted = _mm512_permutex2var_epi64(prv, _mm512_set_epi64(13, 12, 11, 10, 9, 8, 7, 6), cur);
+                return _mm512_alignr_epi8(cur, shifted, 16 - K);
+            }
+
+            static inline reg zip_lo(reg lhs, reg rhs)
+            {
+                return _mm512_permutex2var_epi64(_mm512_unpacklo_epi8(lhs, rhs), _mm512_set_epi64(11, 10, 3, 2, 9, 8, 1, 0),
+                                                 _mm512_unpackhi_epi8(lhs, rhs));
+            }
+
+            static inline reg zip_hi(reg lhs, reg rhs)
+            {
+                return _mm512_permutex2var_epi64(_mm512_unpacklo_epi8(lhs, rhs), _mm512_set_epi64(15, 14, 7, 6, 13, 12, 5, 4),
+                                                 _mm512_unpackhi_epi8(lhs, rhs));
+            }
+
+            static inline bool any(reg x) { return _mm512_test_epi8_mask(x, x) != 0; }
+            static inline uint64_t movemask(reg x) { return static_cast<uint64_t>(_mm512_movepi8_mask(x)); }
+        };
+#elif XSIMD_X86_INSTR_SET >= XSIMD_X86_AVX2_VERSION
+        struct byte_kernel
+        {
+            using reg = __m256i;
+            static constexpr std::size_t size = 32;
+            static constexpr bool native = true;
+
+            static inline reg load(const uint8_t* src) { return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src)); }
+            static inline void store(uint8_t* dst, reg x) { _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst), x); }
+            static inline reg splat(uint8_t x) { return _mm256_set1_epi8(static_cast<char>(x)); }
+
+            static inline reg table16(const uint8_t* table)
+            {
+                return _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(table)));
+            }
+
+            static inline reg lookup16(reg table, reg idx) { return _mm256_shuffle_epi8(table, idx); }
+            static inline reg eq(reg lhs, reg rhs) { return _mm256_cmpeq_epi8(lhs, rhs); }
+            static inline reg bitwise_and(reg lhs, reg rhs) { return _mm256_and_si256(lhs, rhs); }
+            static inline reg bitwise_or(reg lhs, reg rhs) { return _mm256_or_si256(lhs, rhs); }
+            static inline reg bitwise_xor(reg lhs, reg rhs) { return _mm256_xor_si256(lhs, rhs); }
+            static inline reg add(reg lhs, reg rhs) { return _mm256_add_epi8(lhs, rhs); }
+            static inline reg subs(reg lhs, reg rhs) { return _mm256_subs_epu8(lhs, rhs); }
+            static inline reg shr4(reg x) { return _mm256_and_si256(_mm256_srli_epi16(x, 4), splat(0x0f)); }
+
+            template <int K>
+            static inline reg prev(reg cur, reg prv)
+            {
+                return _mm256_alignr_epi8(cur, _mm256_permute2x128_si256(prv, cur, 0x21), 16 - K);
+            }
+
+            static inline reg zip_lo(reg lhs, reg rhs)
+            {
+                return _mm256_permute2x128_si256(_mm256_unpacklo_epi8(lhs, rhs), _mm256_unpackhi_epi8(lhs, rhs), 0x20);
+            }
+
+            static inline reg zip_hi(reg lhs, reg rhs)
+            {
+                return _mm256_permute2x128_si256(_mm256_unpacklo_epi8(lhs, rhs), _mm256_unpackhi_epi8(lhs, rhs), 0x31);
+            }
+
+            static inline bool any(reg x) { return _mm256_testz_si256(x, x) == 0; }
+            static inline uint64_t movemask(reg x) { return static_cast<uint32_t>(_mm256_movemask_epi8(x)); }
+        };
+#elif XSIMD_X86_INSTR_SET >= XSIMD_X86_SSSE3_VERSION
+        struct byte_kernel
+        {
+            using reg = __m128i;
+            static constexpr std::size_t size = 16;
+            static constexpr bool native = true;
+
+            static inline reg load(const uint8_t* src) { return _mm_loadu_si128(reinterpret_cast<const __m128i*>(src)); }
+            static inline void store(uint8_t* dst, reg x) { _mm_storeu_si128(reinterpret_cast<__m128i*>(dst), x); }
+            static inline reg splat(uint8_t x) { return _mm_set1_epi8(static_cast<char>(x)); }
+            static inline reg table16(const uint8_t* table) { return load(table); }
+            static inline reg lookup16(reg table, reg idx) { return _mm_shuffle_epi8(table, idx); }
+            static inline reg eq(reg lhs, reg rhs) { return _mm_cmpeq_epi8(lhs, rhs); }
+            static inline reg bitwise_and(reg lhs, reg rhs) { return _mm_and_si128(lhs, rhs); }
+            static inline reg bitwise_or(reg lhs, reg rhs) { return _mm_or_si128(lhs, rhs); }
+            static inline reg bitwise_xor(reg lhs, reg rhs) { return _mm_xor_si128(lhs, rhs); }
+            static inline reg add(reg lhs, reg rhs) { return _mm_add_epi8(lhs, rhs); }
+            static inline reg subs(reg lhs, reg rhs) { return _mm_subs_epu8(lhs, rhs); }
+            static inline reg shr4(reg x) { return _mm_and_si128(_mm_srli_epi16(x, 4), splat(0x0f)); }
+
+            template <int K>
+            static inline reg prev(reg cur, reg prv)
+            {
+                return _mm_alignr_epi8(cur, prv, 16 - K);
+            }
+
+            static inline reg zip_lo(reg lhs, reg rhs) { return _mm_unpacklo_epi8(lhs, rhs); }
+            static inline reg zip_hi(reg lhs, reg rhs) { return _mm_unpackhi_epi8(lhs, rhs); }
+
+            static inline bool any(reg x) { return _mm_movemask_epi8(_mm_cmpeq_epi8(x, _mm_setzero_si128())) != 0xffff; }
+            static inline uint64_t movemask(reg x) { return static_cast<uint32_t>(_mm_movemask_epi8(x)); }
+        };
+#elif XSIMD_ARM_INSTR_SET >= XSIMD_ARM8_64_NEON_VERSION
+        struct byte_kernel
+        {
+            using reg = uint8x16_t;
+            static constexpr std::size_t size = 16;
+            static constexpr bool native = true;
+
+            static inline reg load(const uint8_t* src) { return vld1q_u8(src); }
+            static inline void store(uint8_t* dst, reg x) { vst1q_u8(dst, x); }
+            static inline reg splat(uint8_t x) { return vdupq_n_u8(x); }
+            static inline reg table16(const uint8_t* table) { return vld1q_u8(table); }
+            static inline reg lookup16(reg table, reg idx) { return vqtbl1q_u8(table, idx); }
+            static inline reg eq(reg lhs, reg rhs) { return vceqq_u8(lhs, rhs); }
+            static inline reg bitwise_and(reg lhs, reg rhs) { return vandq_u8(lhs, rhs); }
+            static inline reg bitwise_or(reg lhs, reg rhs) { return vorrq_u8(lhs, rhs); }
+            static inline reg bitwise_xor(reg lhs, reg rhs) { return veorq_u8(lhs, rhs); }
+            static inline reg add(reg lhs, reg rhs) { return vaddq_u8(lhs, rhs); }
+            static inline reg subs(reg lhs, reg rhs) { return vqsubq_u8(lhs, rhs); }
+            static inline reg shr4(reg x) { return vshrq_n_u8(x, 4); }
+
+            template <int K>
+            static inline reg prev(reg cur, reg prv)
+            {
+                return vextq_u8(prv, cur, 16 - K);
+            }
+
+            static inline reg zip_lo(reg lhs, reg rhs) { return vzip1q_u8(lhs, rhs); }
+            static inline reg zip_hi(reg lhs, reg rhs) { return vzip2q_u8(lhs, rhs); }
+
+            static inline bool any(reg x) { return vmaxvq_u8(x) != 0; }
+
+            // the high bits, spread to one bit per byte, are summed by pairs
+            static inline uint64_t movemask(reg x)
+            {
+                static const uint8_t weights[16] = { 1, 2, 4, 8, 16, 32, 64, 128, 1, 2, 4, 8, 16, 32, 64, 128 };
+                reg high = vreinterpretq_u8_s8(vshrq_n_s8(vreinterpretq_s8_u8(x), 7));
+                reg bits = vandq_u8(high, vld1q_u8(weights));
+                bits = vpaddq_u8(bits, bits);
+                bits = vpaddq_u8(bits, bits);
+                bits = vpaddq_u8(bits, bits);
+                return vgetq_lane_u16(vreinterpretq_u16_u8(bits), 0);
+            }
+        };
+#else
+        struct byte_kernel
+        {
+            using reg = std::array<uint8_t, 16>;
+            static constexpr std::size_t size = 16;
+            static constexpr bool native = false;
+
+            static inline reg load(const uint8_t* src)
+            {
+                reg res;
+                std::memcpy(res.data(), src, size);
+                return res;
+            }
+
+            static inline void store(uint8_t* dst, const reg& x) { std::memcpy(dst, x.data(), size); }
+
+            static inline reg splat(uint8_t x)
+            {
+                reg res;
+                res.fill(x);
+                return res;
+            }
+
+            static inline reg table16(const uint8_t* table) { return load(table); }
+
+            static inline reg lookup16(const reg& table, const reg& idx)
+            {
+                reg res;
+                for (std::size_t i = 0; i < size; ++i)
+                {
+                    res[i] = table[idx[i] & 0x0f];
+                }
+                return res;
+            }
+
+            template <class F>
+            static inline reg map(const reg& lhs, const reg& rhs, F f)
+            {
+                reg res;
+                for (std::size_t i = 0; i < size; ++i)
+                {
+                    res[i] = static_cast<uint8_t>(f(lhs[i], rhs[i]));
+                }
+                return res;
+            }
+
+            static inline reg eq(const reg& lhs, const reg& rhs)
+            {
+                return map(lhs, rhs, [](uint8_t x, uint8_t y) { return x == y ? 0xff : 0; });
+            }
+
+            static inline reg bitwise_and(const reg& lhs, const reg& rhs)
+            {
+                return map(lhs, rhs, [](uint8_t x, uint8_t y) { return x & y; });
+            }
+
+            static inline reg bitwise_or(const reg& lhs, const reg& rhs)
+            {
+                return map(lhs, rhs, [](uint8_t x, uint8_t y) { return x | y; });
+            }
+
+            static inline reg bitwise_xor(const reg& lhs, const reg& rhs)
+            {
+                return map(lhs, rhs, [](uint8_t x, uint8_t y) { return x ^ y; });
+            }
+
+            static inline reg add(const reg& lhs, const reg& rhs)
+            {
+                return map(lhs, rhs, [](uint8_t x, uint8_t y) { return x + y; });
+            }
+
+            static inline reg subs(const reg& lhs, const reg& rhs)
+            {
+                return map(lhs, rhs, [](uint8_t x, uint8_t y) { return x > y ? x - y : 0; });
+            }
+
+            static inline reg shr4(const reg& x)
+            {
+                return map(x, x, [](uint8_t y, uint8_t) { return y >> 4; });
+            }
+
+            template <int K>
+            static inline reg prev(const reg& cur, const reg& prv)
+            {
+                reg res;
+                for (std::size_t i = 0; i < size; ++i)
+                {
+                    res[i] = i >= std::size_t(K) ? cur[i - K] : prv[size - K + i];
+                }
+                return res;
+            }
+
+            static inline reg zip_lo(const reg& lhs, const reg& rhs)
+            {
+                reg res;
+                for (std::size_t i = 0; i < size / 2; ++i)
+                {
+                    res[2 * i] = lhs[i];
+                    res[2 * i + 1] = rhs[i];
+                }
+                return res;
+            }
+
+            static inline reg zip_hi(const reg& lhs, const reg& rhs)
+            {
+                reg res;
+                for (std::size_t i = 0; i < size / 2; ++i)
+                {
+                    res[2 * i] = lhs[size / 2 + i];
+                    res[2 * i + 1] = rhs[size / 2 + i];
+                }
+                return res;
+            }
+
+            static inline bool any(const reg& x)
+            {
+                uint8_t res = 0;
+                for (std::size_t i = 0; i < size; ++i)
+                {
+                    res |= x[i];
+                }
+                return res != 0;
+            }
+
+            static inline uint64_t movemask(const reg& x)
+            {
+                uint64_t res = 0;
+                for (std::size_t i = 0; i < size; ++i)
+                {
+                    res |= uint64_t(x[i] >> 7) << i;
+                }
+                return res;
+            }
+        };
+#endif
+
+        using byte_reg = byte_kernel::reg;
+
+        inline const uint8_t* as_bytes(const char* data)
+        {
+            return reinterpret_cast<const uint8_t*>(data);
+        }
+
+        // Loads the n < size bytes of src followed by zeros
+        inline byte_reg load_partial(const uint8_t* src, std::size_t n)
+        {
+            alignas(default_alignment) std::array<uint8_t, byte_kernel::size> buffer;
+            buffer.fill(0);
+            std::memcpy(buffer.data(), src, n);
+            return byte_kernel::load(buffer.data());
+        }
+    }
+}
+
+#endif
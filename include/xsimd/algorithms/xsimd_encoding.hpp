@@ -0,0 +1,594 @@
+/***************************************************************************
+* Copyright (c) 2016, Johan Mabille and Sylvain Corlay                     *
+*                                                                          *
+* Distributed under the terms of the BSD 3-Clause License.                 *
+*                                                                          *
+* The full license is in the file LICENSE, distributed with this software. *
+****************************************************************************/
+
+#ifndef XSIMD_ENCODING_HPP
+#define XSIMD_ENCODING_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#include "xsimd_byte_kernel.hpp"
+#include "xsimd_text.hpp"
+
+namespace xsimd
+{
+    /**
+     * Alphabets of base64_encode and base64_decode, as defined by RFC 4648.
+     */
+    enum class base64_alphabet
+    {
+        /// A-Z, a-z, 0-9, '+' and '/'
+        standard,
+        /// A-Z, a-z, 0-9, '-' and '_', safe in URLs and file names
+        url
+    };
+
+    /**
+     * Returns the number of characters written by base64_encode for
+     * \c n bytes.
+     */
+    std::size_t base64_encoded_size(std::size_t n, bool padding = true);
+
+    /**
+     * Returns the number of bytes written by base64_decode for \c n
+     * characters, at most.
+     */
+    std::size_t base64_max_decoded_size(std::size_t n);
+
+    /**
+     * Encodes the \c n bytes of \c src in base64.
+     * @param src pointer to the bytes.
+     * @param n number of bytes.
+     * @param dst pointer to the base64_encoded_size(n, padding) characters of
+     * the result.
+     * @param alphabet the alphabet of the result.
+     * @param padding if true, the result is padded with '=' to a multiple
+     * of 4 characters.
+     * @return the number of characters written.
+     */
+    std::size_t base64_encode(const uint8_t* src, std::size_t n, char* dst,
+                              base64_alphabet alphabet = base64_alphabet::standard, bool padding = true);
+
+    /**
+     * Decodes the \c n base64 characters of \c src. The padding is
+     * optional, and the string must not contain any white space or
+     * line break.
+     * @param src pointer to the characters.
+     * @param n number of characters.
+     * @param dst pointer to the result, of base64_max_decoded_size(n) bytes.
+     * @param size set to the number of bytes written.
+     * @param alphabet the alphabet of \c src.
+     * @return false if \c src is not a valid base64 string, i.e. if it
+     * holds characters outside of the alphabet, has a wrong length or
+     * ends with unused bits that are not zero.
+     */
+    bool base64_decode(const char* src, std::size_t n, uint8_t* dst, std::size_t& size,
+                       base64_alphabet alphabet = base64_alphabet::standard);
+
+    /**
+     * Encodes the \c n bytes of \c src into the 2 * \c n lower case
+     * hexadecimal digits of \c dst.
+     */
+    void hex_encode(const uint8_t* src, std::size_t n, char* dst);
+
+    /**
+     * Decodes the \c n lower or upper case hexadecimal digits of \c src
+     * into the \c n / 2 bytes of \c dst.
+     * @return false if \c n is odd or if \c src holds characters that are
+     * not hexadecimal digits.
+     */
+    bool hex_decode(const char* src, std::size_t n, uint8_t* dst);
+
+    /******************
+     * implementation *
+     ******************/
+
+    namespace detail
+    {
+        // The bytes of the base64 kernels are grouped by 128 bits lanes:
+        // base64_load puts 12 bytes of the source in the first 12 bytes of
+        // each lane, base64_split expands the 3 bytes groups of a lane into
+        // 4 sextets, base64_join packs them back, and base64_store writes
+        // the first 12 bytes of each lane. hex_join packs the pairs of
+        // nibbles of two registers into one register of bytes.
+
+        // [b1, b0, b2, b1] in each 32 bits word
+        alignas(16) static const uint8_t base64_split_shuffle[16] = { 1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10 };
+        alignas(16) static const uint8_t base64_join_shuffle[16] = { 2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, 0x80, 0x80, 0x80, 0x80 };
+
+#if defined(__AVX512BW__)
+        struct codec_kernel
+        {
+            using reg = __m512i;
+
+            static inline reg base64_load(const uint8_t* src)
+            {
+                reg x = _mm512_loadu_si512(src);
+                return _mm512_permutex2var_epi32(x, _mm512_setr_epi32(0, 1, 2, 0, 3, 4, 5, 0, 6, 7, 8, 0, 9, 10, 11, 0), x);
+            }
+
+            // Muła's multiplications, shifting the sextets of each 16 bits
+            // word at the right place
+            static inline reg base64_split(reg x)
+            {
+                x = _mm512_shuffle_epi8(x, byte_kernel::table16(base64_split_shuffle));
+                reg t0 = _mm512_mulhi_epu16(_mm512_and_si512(x, _mm512_set1_epi32(0x0fc0fc00)), _mm512_set1_epi32(0x04000040));
+                reg t1 = _mm512_mullo_epi16(_mm512_and_si512(x, _mm512_set1_epi32(0x003f03f0)), _mm512_set1_epi32(0x01000010));
+                return _mm512_or_si512(t0, t1);
+            }
+
+            static inline reg base64_join(reg x)
+            {
+                x = _mm512_maddubs_epi16(x, _mm512_set1_epi32(0x01400140));
+                x = _mm512_madd_epi16(x, _mm512_set1_epi32(0x00011000));
+                return _mm512_shuffle_epi8(x, byte_kernel::table16(base64_join_shuffle));
+            }
+
+            static inline void base64_store(uint8_t* dst, reg x)
+            {
+                _mm512_storeu_si512(dst, _mm512_permutex2var_epi32(x, _mm512_setr_epi32(0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14, 0, 0, 0, 0), x));
+            }
+
+            static inline reg hex_join(reg lhs, reg rhs)
+            {
+                const reg weights = _mm512_set1_epi16(0x0110);
+                reg x = _mm512_packus_epi16(_mm512_maddubs_epi16(lhs, weights), _mm512_maddubs_epi16(rhs, weights));
+                return _mm512_permutex2var_epi64(x, _mm512_setr_epi64(0, 2, 4, 6, 1, 3, 5, 7), x);
+            }
+        };
+#elif XSIMD_X86_INSTR_SET >= XSIMD_X86_AVX2_VERSION
+        struct codec_kernel
+        {
+            using reg = __m256i;
+
+            static inline reg base64_load(const uint8_t* src)
+            {
+                return _mm256_permutevar8x32_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(src)),
+                                                   _mm256_setr_epi32(0, 1, 2, 0, 3, 4, 5, 0));
+            }
+
+            static inline reg base64_split(reg x)
+            {
+                x = _mm256_shuffle_epi8(x, byte_kernel::table16(base64_split_shuffle));
+                reg t0 = _mm256_mulhi_epu16(_mm256_and_si256(x, _mm256_set1_epi32(0x0fc0fc00)), _mm256_set1_epi32(0x04000040));
+                reg t1 = _mm256_mullo_epi16(_mm256_and_si256(x, _mm256_set1_epi32(0x003f03f0)), _mm256_set1_epi32(0x01000010));
+                return _mm256_or_si256(t0, t1);
+            }
+
+            static inline reg base64_join(reg x)
+            {
+                x = _mm256_maddubs_epi16(x, _mm256_set1_epi32(0x01400140));
+                x = _mm256_madd_epi16(x, _mm256_set1_epi32(0x00011000));
+                return _mm256_shuffle_epi8(x, byte_kernel::table16(base64_join_shuffle));
+            }
+
+            static inline void base64_store(uint8_t* dst, reg x)
+            {
+                x = _mm256_permutevar8x32_epi32(x, _mm256_setr_epi32(0, 1, 2, 4, 5, 6, 0, 0));
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst), x);
+            }
+
+            static inline reg hex_join(reg lhs, reg rhs)
+            {
+                const reg weights = _mm256_set1_epi16(0x0110);
+                reg x = _mm256_packus_epi16(_mm256_maddubs_epi16(lhs, weights), _mm256_maddubs_epi16(rhs, weights));
+                return _mm256_permute4x64_epi64(x, 0xd8);
+            }
+        };
+#elif XSIMD_X86_INSTR_SET >= XSIMD_X86_SSSE3_VERSION
+        struct codec_kernel
+        {
+            using reg = __m128i;
+
+            static inline reg base64_load(const uint8_t* src)
+            {
+                return _mm_loadu_si128(reinterpret_cast<const __m128i*>(src));
+            }
+
+            static inline reg base64_split(reg x)
+            {
+                x = _mm_shuffle_epi8(x, byte_kernel::table16(base64_split_shuffle));
+                reg t0 = _mm_mulhi_epu16(_mm_and_si128(x, _mm_set1_epi32(0x0fc0fc00)), _mm_set1_epi32(0x04000040));
+                reg t1 = _mm_mullo_epi16(_mm_and_si128(x, _mm_set1_epi32(0x003f03f0)), _mm_set1_epi32(0x01000010));
+                return _mm_or_si128(t0, t1);
+            }
+
+            static inline reg base64_join(reg x)
+            {
+                x = _mm_maddubs_epi16(x, _mm_set1_epi32(0x01400140));
+                x = _mm_madd_epi16(x, _mm_set1_epi32(0x00011000));
+                return _mm_shuffle_epi8(x, byte_kernel::table16(base64_join_shuffle));
+            }
+
+            static inline void base64_store(uint8_t* dst, reg x)
+            {
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(dst), x);
+            }
+
+            static inline reg hex_join(reg lhs, reg rhs)
+            {
+                const reg weights = _mm_set1_epi16(0x0110);
+                return _mm_packus_epi16(_mm_maddubs_epi16(lhs, weights), _mm_maddubs_epi16(rhs, weights));
+            }
+        };
+#elif XSIMD_ARM_INSTR_SET >= XSIMD_ARM8_64_NEON_VERSION
+        struct codec_kernel
+        {
+            using reg = uint8x16_t;
+
+            static inline reg base64_load(const uint8_t* src)
+            {
+                return vld1q_u8(src);
+            }
+
+            // the 16 bits words are [b0 b1] and [b1 b2], the sextets are
+            // shifted by variable amounts
+            static inline reg base64_split(reg x)
+            {
+                static const int16_t right[8] = { -10, -6, -10, -6, -10, -6, -10, -6 };
+                static const int16_t left[8] = { 4, 8, 4, 8, 4, 8, 4, 8 };
+                uint16x8_t w = vreinterpretq_u16_u8(vqtbl1q_u8(x, vld1q_u8(base64_split_shuffle)));
+                uint16x8_t lo = vandq_u16(vshlq_u16(w, vld1q_s16(right)), vdupq_n_u16(0x003f));
+                uint16x8_t hi = vandq_u16(vshlq_u16(w, vld1q_s16(left)), vdupq_n_u16(0x3f00));
+                return vreinterpretq_u8_u16(vorrq_u16(lo, hi));
+            }
+
+            static inline reg base64_join(reg x)
+            {
+                uint16x8_t w = vreinterpretq_u16_u8(x);
+                w = vorrq_u16(vshlq_n_u16(vandq_u16(w, vdupq_n_u16(0x00ff)), 6), vshrq_n_u16(w, 8));
+                uint32x4_t d = vreinterpretq_u32_u16(w);
+                d = vorrq_u32(vshlq_n_u32(vandq_u32(d, vdupq_n_u32(0xffff)), 12), vshrq_n_u32(d, 16));
+                return vqtbl1q_u8(vreinterpretq_u8_u32(d), vld1q_u8(base64_join_shuffle));
+            }
+
+            static inline void base64_store(uint8_t* dst, reg x)
+            {
+                vst1q_u8(dst, x);
+            }
+
+            static inline reg hex_join(reg lhs, reg rhs)
+            {
+                uint16x8_t l = vreinterpretq_u16_u8(lhs), r = vreinterpretq_u16_u8(rhs);
+                l = vorrq_u16(vshlq_n_u16(l, 4), vshrq_n_u16(l, 8));
+                r = vorrq_u16(vshlq_n_u16(r, 4), vshrq_n_u16(r, 8));
+                return vcombine_u8(vmovn_u16(l), vmovn_u16(r));
+            }
+        };
+#else
+        struct codec_kernel
+        {
+        };
+#endif
+
+        struct base64_tables
+        {
+            const char* alphabet;
+            // additions mapping the sextets to characters, indexed by the
+            // range of the sextet
+            uint8_t encode_shift[16];
+            // additions mapping the characters to sextets, indexed by the
+            // high nibble, or 1 for the character of 63
+            uint8_t decode_roll[16];
+            uint8_t char_63;
+            uint8_t char_63_index;
+            // sextet of each character, 0xff if invalid
+            uint8_t decode[256];
+            char_class chars;
+
+            explicit base64_tables(const char* a)
+                : alphabet(a), chars(a, 64)
+            {
+                uint8_t c62 = static_cast<uint8_t>(a[62]), c63 = static_cast<uint8_t>(a[63]);
+                for (std::size_t i = 0; i < 16; ++i)
+                {
+                    encode_shift[i] = 0;
+                    decode_roll[i] = 0;
+                }
+                encode_shift[0] = 'a' - 26;
+                for (std::size_t i = 1; i < 11; ++i)
+                {
+                    encode_shift[i] = static_cast<uint8_t>('0' - 52);
+                }
+                encode_shift[11] = static_cast<uint8_t>(c62 - 62);
+                encode_shift[12] = static_cast<uint8_t>(c63 - 63);
+                encode_shift[13] = 'A';
+
+                decode_roll[1] = static_cast<uint8_t>(63 - c63);
+                decode_roll[c62 >> 4] = static_cast<uint8_t>(62 - c62);
+                decode_roll[3] = static_cast<uint8_t>(52 - '0');
+                decode_roll[4] = decode_roll[5] = static_cast<uint8_t>(-'A');
+                decode_roll[6] = decode_roll[7] = static_cast<uint8_t>(26 - 'a');
+                char_63 = c63;
+                char_63_index = static_cast<uint8_t>(1 - (c63 >> 4));
+
+                for (std::size_t i = 0; i < 256; ++i)
+                {
+                    decode[i] = 0xff;
+                }
+                for (std::size_t i = 0; i < 64; ++i)
+                {
+                    decode[static_cast<uint8_t>(a[i])] = static_cast<uint8_t>(i);
+                }
+            }
+        };
+
+        inline const base64_tables& get_base64_tables(base64_alphabet alphabet)
+        {
+            static const base64_tables standard("ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/");
+            static const base64_tables url("ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-_");
+            return alphabet == base64_alphabet::url ? url : standard;
+        }
+
+        inline const char_class& hex_digits()
+        {
+            static const char_class digits("0123456789abcdefABCDEF");
+            return digits;
+        }
+
+        inline uint8_t hex_value(uint8_t c)
+        {
+            return c >= '0' && c <= '9' ? static_cast<uint8_t>(c - '0')
+                                        : ((c | 0x20) >= 'a' && (c | 0x20) <= 'f' ? static_cast<uint8_t>((c | 0x20) - 'a' + 10) : 0xff);
+        }
+
+        // The block functions process the beginning of the data and return
+        // the number of bytes or characters consumed.
+
+        template <class C>
+        inline std::size_t base64_encode_blocks(const uint8_t* src, std::size_t n, char* dst,
+                                                const base64_tables& tables, std::true_type)
+        {
+            using kernel = byte_kernel;
+            constexpr std::size_t size = kernel::size;
+            const byte_reg shift = kernel::table16(tables.encode_shift);
+            const byte_reg max_upper = kernel::splat(25);
+            const byte_reg max_lower = kernel::splat(51);
+            const byte_reg upper = kernel::splat(13);
+            const byte_reg zero = kernel::splat(0);
+            std::size_t i = 0;
+            uint8_t* out = reinterpret_cast<uint8_t*>(dst);
+            for (; i + size <= n; i += size / 4 * 3, out += size)
+            {
+                byte_reg sextets = C::base64_split(C::base64_load(src + i));
+                // 0 for a-z, 1 to 10 for 0-9, 11 and 12 for the last two
+                // characters, 13 for A-Z
+                byte_reg range = kernel::subs(sextets, max_lower);
+                range = kernel::bitwise_or(range, kernel::bitwise_and(kernel::eq(kernel::subs(sextets, max_upper), zero), upper));
+                kernel::store(out, kernel::add(sextets, kernel::lookup16(shift, range)));
+            }
+            return i;
+        }
+
+        template <class C>
+        inline std::size_t base64_encode_blocks(const uint8_t*, std::size_t, char*, const base64_tables&, std::false_type)
+        {
+            return 0;
+        }
+
+        // Stops at the first block holding an invalid character, left to
+        // the scalar loop. The last store of a block writes size / 4 bytes
+        // past its result, which the following size / 2 characters at
+        // least overwrite.
+        template <class C>
+        inline std::size_t base64_decode_blocks(const uint8_t* src, std::size_t n, uint8_t* dst,
+                                                const base64_tables& tables, std::true_type)
+        {
+            using kernel = byte_kernel;
+            constexpr std::size_t size = kernel::size;
+            const char_class_kernel classifier(tables.chars);
+            const byte_reg roll = kernel::table16(tables.decode_roll);
+            const byte_reg char_63 = kernel::splat(tables.char_63);
+            const byte_reg char_63_index = kernel::splat(tables.char_63_index);
+            std::size_t i = 0;
+            for (; i + size + size / 2 <= n; i += size, dst += size / 4 * 3)
+            {
+                byte_reg x = kernel::load(src + i);
+                if (classifier.outside(x) != 0)
+                {
+                    break;
+                }
+                byte_reg index = kernel::add(kernel::shr4(x), kernel::bitwise_and(kernel::eq(x, char_63), char_63_index));
+                C::base64_store(dst, C::base64_join(kernel::add(x, kernel::lookup16(roll, index))));
+            }
+            return i;
+        }
+
+        template <class C>
+        inline std::size_t base64_decode_blocks(const uint8_t*, std::size_t, uint8_t*, const base64_tables&, std::false_type)
+        {
+            return 0;
+        }
+
+        template <class C>
+        inline std::size_t hex_encode_blocks(const uint8_t* src, std::size_t n, char* dst, std::true_type)
+        {
+            using kernel = byte_kernel;
+            constexpr std::size_t size = kernel::size;
+            static const uint8_t digits_table[16] = { '0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'a', 'b', 'c', 'd', 'e', 'f' };
+            const byte_reg digits = kernel::table16(digits_table);
+            const byte_reg low_nibble = kernel::splat(0x0f);
+            uint8_t* out = reinterpret_cast<uint8_t*>(dst);
+            std::size_t i = 0;
+            for (; i + size <= n; i += size, out += 2 * size)
+            {
+                byte_reg x = kernel::load(src + i);
+                byte_reg hi = kernel::lookup16(digits, kernel::shr4(x));
+                byte_reg lo = kernel::lookup16(digits, kernel::bitwise_and(x, low_nibble));
+                kernel::store(out, kernel::zip_lo(hi, lo));
+                kernel::store(out + size, kernel::zip_hi(hi, lo));
+            }
+            return i;
+        }
+
+        template <class C>
+        inline std::size_t hex_encode_blocks(const uint8_t*, std::size_t, char*, std::false_type)
+        {
+            return 0;
+        }
+
+        template <class C>
+        inline std::size_t hex_decode_blocks(const uint8_t* src, std::size_t n, uint8_t* dst, std::true_type)
+        {
+            using kernel = byte_kernel;
+            constexpr std::size_t size = kernel::size;
+            // '0' to '9' have the high nibble 3, 'A' to 'F' 4 and 'a' to 'f' 6
+            static const uint8_t roll_table[16] = { 0, 0, 0, 0xd0, 0xc9, 0, 0xa9, 0, 0, 0, 0, 0, 0, 0, 0, 0 };
+            const char_class_kernel classifier(hex_digits());
+            const byte_reg roll = kernel::table16(roll_table);
+            std::size_t i = 0;
+            for (; i + 2 * size <= n; i += 2 * size, dst += size)
+            {
+                byte_reg lhs = kernel::load(src + i);
+                byte_reg rhs = kernel::load(src + i + size);
+                if ((classifier.outside(lhs) | classifier.outside(rhs)) != 0)
+                {
+                    break;
+                }
+                lhs = kernel::add(lhs, kernel::lookup16(roll, kernel::shr4(lhs)));
+                rhs = kernel::add(rhs, kernel::lookup16(roll, kernel::shr4(rhs)));
+                kernel::store(dst, C::hex_join(lhs, rhs));
+            }
+            return i;
+        }
+
+        template <class C>
+        inline std::size_t hex_decode_blocks(const uint8_t*, std::size_t, uint8_t*, std::false_type)
+        {
+            return 0;
+        }
+
+        using codec_native = std::integral_constant<bool, byte_kernel::native>;
+    }
+
+    inline std::size_t base64_encoded_size(std::size_t n, bool padding)
+    {
+        return padding ? (n + 2) / 3 * 4 : n / 3 * 4 + (n % 3 == 0 ? 0 : n % 3 + 1);
+    }
+
+    inline std::size_t base64_max_decoded_size(std::size_t n)
+    {
+        return (n + 3) / 4 * 3;
+    }
+
+    inline std::size_t base64_encode(const uint8_t* src, std::size_t n, char* dst, base64_alphabet alphabet, bool padding)
+    {
+        const detail::base64_tables& tables = detail::get_base64_tables(alphabet);
+        const char* a = tables.alphabet;
+        std::size_t i = detail::base64_encode_blocks<detail::codec_kernel>(src, n, dst, tables, detail::codec_native());
+        char* out = dst + i / 3 * 4;
+        for (; i + 3 <= n; i += 3, out += 4)
+        {
+            uint32_t v = uint32_t(src[i]) << 16 | uint32_t(src[i + 1]) << 8 | uint32_t(src[i + 2]);
+            out[0] = a[v >> 18];
+            out[1] = a[(v >> 12) & 0x3f];
+            out[2] = a[(v >> 6) & 0x3f];
+            out[3] = a[v & 0x3f];
+        }
+        if (i < n)
+        {
+            uint32_t v = uint32_t(src[i]) << 16 | (i + 1 < n ? uint32_t(src[i + 1]) << 8 : 0);
+            *out++ = a[v >> 18];
+            *out++ = a[(v >> 12) & 0x3f];
+            if (i + 1 < n)
+            {
+                *out++ = a[(v >> 6) & 0x3f];
+            }
+            else if (padding)
+            {
+                *out++ = '=';
+            }
+            if (padding)
+            {
+                *out++ = '=';
+            }
+        }
+        return static_cast<std::size_t>(out - dst);
+    }
+
+    inline bool base64_decode(const char* src, std::size_t n, uint8_t* dst, std::size_t& size, base64_alphabet alphabet)
+    {
+        if (n % 4 == 0 && n != 0 && src[n - 1] == '=')
+        {
+            n -= src[n - 2] == '=' ? 2 : 1;
+        }
+        if (n % 4 == 1)
+        {
+            return false;
+        }
+        const detail::base64_tables& tables = detail::get_base64_tables(alphabet);
+        const uint8_t* in = detail::as_bytes(src);
+        std::size_t i = detail::base64_decode_blocks<detail::codec_kernel>(in, n, dst, tables, detail::codec_native());
+        uint8_t* out = dst + i / 4 * 3;
+        const uint8_t* d = tables.decode;
+        for (; i + 4 <= n; i += 4, out += 3)
+        {
+            uint8_t d0 = d[in[i]], d1 = d[in[i + 1]], d2 = d[in[i + 2]], d3 = d[in[i + 3]];
+            if (((d0 | d1 | d2 | d3) & 0x80) != 0)
+            {
+                return false;
+            }
+            uint32_t v = uint32_t(d0) << 18 | uint32_t(d1) << 12 | uint32_t(d2) << 6 | uint32_t(d3);
+            out[0] = static_cast<uint8_t>(v >> 16);
+            out[1] = static_cast<uint8_t>(v >> 8);
+            out[2] = static_cast<uint8_t>(v);
+        }
+        if (i < n)
+        {
+            // 2 or 3 characters, for 1 or 2 bytes
+            uint8_t d0 = d[in[i]], d1 = d[in[i + 1]], d2 = i + 2 < n ? d[in[i + 2]] : 0;
+            uint32_t v = uint32_t(d0) << 18 | uint32_t(d1) << 12 | uint32_t(d2) << 6;
+            uint32_t unused_bits = i + 2 < n ? 0xff : 0xffff;
+            if (((d0 | d1 | d2) & 0x80) != 0 || (v & unused_bits) != 0)
+            {
+                return false;
+            }
+            *out++ = static_cast<uint8_t>(v >> 16);
+            if (i + 2 < n)
+            {
+                *out++ = static_cast<uint8_t>(v >> 8);
+            }
+        }
+        size = static_cast<std::size_t>(out - dst);
+        return true;
+    }
+
+    inline void hex_encode(const uint8_t* src, std::size_t n, char* dst)
+    {
+        static const char digits[] = "0123456789abcdef";
+        std::size_t i = detail::hex_encode_blocks<detail::codec_kernel>(src, n, dst, detail::codec_native());
+        for (; i < n; ++i)
+        {
+            dst[2 * i] = digits[src[i] >> 4];
+            dst[2 * i + 1] = digits[src[i] & 0x0f];
+        }
+    }
+
+    inline bool hex_decode(const char* src, std::size_t n, uint8_t* dst)
+    {
+        if (n % 2 != 0)
+        {
+            return false;
+        }
+        const uint8_t* in = detail::as_bytes(src);
+        std::size_t i = detail::hex_decode_blocks<detail::codec_kernel>(in, n, dst, detail::codec_native());
+        for (; i < n; i += 2)
+        {
+            uint8_t hi = detail::hex_value(in[i]), lo = detail::hex_value(in[i + 1]);
+            if (((hi | lo) & 0x80) != 0)
+            {
+                return false;
+            }
+            dst[i / 2] = static_cast<uint8_t>(hi << 4 | lo);
+        }
+        return true;
+    }
+}
+
+#endif
@@ -0,0 +1,579 @@
+/***************************************************************************
+* Copyright (c) 2016, Johan Mabille and Sylvain Corlay                     *
+*                                                                          *
+* Distributed under the terms of the BSD 3-Clause License.                 *
+*                                                                          *
+* The full license is in the file LICENSE, distributed with this software. *
+****************************************************************************/
+
+#ifndef XSIMD_FIR_HPP
+#define XSIMD_FIR_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <type_traits>
+#include <vector>
+
+#include "../xsimd.hpp"
+
+namespace xsimd
+{
+    namespace detail
+    {
+        template <class T>
+        using fir_vector = std::vector<T, aligned_allocator<T, default_alignment>>;
+    }
+
+    /**
+     * @class fir_filter
+     * @brief Streaming finite impulse response filter
+     *
+     * Computes y[n] = h[0] * x[n] + h[1] * x[n - 1] + ... + h[K - 1] * x[n - K + 1]
+     * over a stream split into blocks of any size: the last K - 1 samples of
+     * a block are kept for the next one, the samples before the first block
+     * are zeros.
+     *
+     * The coefficients are stored reversed, so that consecutive outputs are
+     * the dot products of the coefficients with a window sliding along the
+     * input. Several batches of consecutive outputs are computed at once:
+     * each coefficient is broadcast and multiplied, with fused
+     * multiply-adds, with the unaligned loads of the windows of the
+     * batches.
+     *
+     * @tparam T the type of the samples and coefficients, float or double.
+     */
+    template <class T>
+    class fir_filter
+    {
+    public:
+
+        static_assert(std::is_same<T, float>::value || std::is_same<T, double>::value,
+                      "fir_filter requires float or double samples");
+
+        using value_type = T;
+        using size_type = std::size_t;
+
+        fir_filter(const T* taps, size_type num_taps);
+
+        size_type num_taps() const noexcept;
+        void reset() noexcept;
+
+        void process(size_type n, const T* in, T* out);
+
+    private:
+
+        using simd_tag = std::integral_constant<bool, (simd_traits<T>::size > 1)>;
+
+        size_type m_num_taps;
+        size_type m_block_size;
+        detail::fir_vector<T> m_taps;
+        detail::fir_vector<T> m_buffer;
+    };
+
+    /**
+     * @class fir_decimator
+     * @brief Streaming FIR filter followed by a downsampling
+     *
+     * Filters the stream like fir_filter and keeps one output out of
+     * \c factor, those of the input samples 0, factor, 2 * factor, ... of
+     * the stream; the discarded outputs are not computed. Each output is
+     * the dot product of the reversed coefficients with a window of the
+     * input: several outputs are computed at once with aligned loads of
+     * the coefficients, unaligned loads of the windows and fused
+     * multiply-adds, and reduced together.
+     *
+     * @tparam T the type of the samples and coefficients, float or double.
+     */
+    template <class T>
+    class fir_decimator
+    {
+    public:
+
+        static_assert(std::is_same<T, float>::value || std::is_same<T, double>::value,
+                      "fir_decimator requires float or double samples");
+
+        using value_type = T;
+        using size_type = std::size_t;
+
+        fir_decimator(const T* taps, size_type num_taps, size_type factor);
+
+        size_type num_taps() const noexcept;
+        size_type factor() const noexcept;
+        void reset() noexcept;
+
+        size_type process(size_type n, const T* in, T* out);
+
+    private:
+
+        using simd_tag = std::integral_constant<bool, (simd_traits<T>::size > 1)>;
+
+        size_type m_num_taps;
+        size_type m_factor;
+        size_type m_block_size;
+        size_type m_phase;
+        detail::fir_vector<T> m_taps;
+        detail::fir_vector<T> m_buffer;
+    };
+
+    /**
+     * @class fir_interpolator
+     * @brief Streaming upsampling followed by a FIR filter
+     *
+     * Inserts \c factor - 1 zeros after each input sample and filters the
+     * result like fir_filter, without computing the products by the
+     * inserted zeros: the coefficients are split into \c factor polyphase
+     * subfilters h[p], h[p + factor], h[p + 2 * factor], ..., and the
+     * output factor * i + p is the output i of the subfilter p on the
+     * input stream. The coefficients usually include a gain of \c factor,
+     * which compensates the inserted zeros.
+     *
+     * @tparam T the type of the samples and coefficients, float or double.
+     */
+    template <class T>
+    class fir_interpolator
+    {
+    public:
+
+        static_assert(std::is_same<T, float>::value || std::is_same<T, double>::value,
+                      "fir_interpolator requires float or double samples");
+
+        using value_type = T;
+        using size_type = std::size_t;
+
+        fir_interpolator(const T* taps, size_type num_taps, size_type factor);
+
+        size_type num_taps() const noexcept;
+        size_type factor() const noexcept;
+        void reset() noexcept;
+
+        void process(size_type n, const T* in, T* out);
+
+    private:
+
+        using simd_tag = std::integral_constant<bool, (simd_traits<T>::size > 1)>;
+
+        size_type m_num_taps;
+        size_type m_factor;
+        size_type m_phase_taps;
+        size_type m_phase_stride;
+        size_type m_block_size;
+        detail::fir_vector<T> m_taps;
+        detail::fir_vector<T> m_buffer;
+        detail::fir_vector<T> m_outputs;
+    };
+
+
+    /**************************************
+     * FIR filters implementation details *
+     **************************************/
+
+    namespace detail
+    {
+        // number of input samples filtered at once, after the K - 1 samples
+        // kept from the previous block
+        inline std::size_t fir_block_size(std::size_t num_taps)
+        {
+            return std::max(std::size_t(2048), num_taps);
+        }
+
+        // number of batches of outputs computed at once by the sliding
+        // kernel: the accumulators, the broadcast coefficient and the
+        // loaded window fit in 16 registers
+        constexpr std::size_t fir_output_batches = 8;
+
+        // operations on acc[I], ..., acc[N - 1], unrolled by recursion so
+        // that the accumulators are indexed by constants and stay in registers
+        template <std::size_t I, std::size_t N>
+        struct fir_accumulators
+        {
+            template <class B>
+            static inline void zero(B* acc)
+            {
+                acc[I] = B(typename B::value_type(0));
+                fir_accumulators<I + 1, N>::zero(acc);
+            }
+
+            // acc[i] += tap * x[i * stride, i * stride + size)
+            template <class T, class B>
+            static inline void update(const B& tap, const T* x, std::size_t stride, B* acc)
+            {
+                acc[I] = fma(tap, B(x + I * stride, unaligned_mode()), acc[I]);
+                fir_accumulators<I + 1, N>::update(tap, x, stride, acc);
+            }
+
+            template <class T, class B>
+            static inline void store(const B* acc, T* out)
+            {
+                acc[I].store_unaligned(out + I * B::size);
+                fir_accumulators<I + 1, N>::store(acc, out);
+            }
+        };
+
+        template <std::size_t N>
+        struct fir_accumulators<N, N>
+        {
+            template <class B>
+            static inline void zero(B*)
+            {
+            }
+
+            template <class T, class B>
+            static inline void update(const B&, const T*, std::size_t, B*)
+            {
+            }
+
+            template <class T, class B>
+            static inline void store(const B*, T*)
+            {
+            }
+        };
+
+        /******************
+         * window outputs *
+         ******************/
+
+        // out[i] = r[0] * x[i * stride] + ... + r[k - 1] * x[i * stride + k - 1]
+        template <class T>
+        inline void fir_window_outputs(std::size_t n, const T* x, std::size_t stride, const T* r, std::size_t k,
+                                       T* out, std::false_type)
+        {
+            for (std::size_t i = 0; i < n; ++i, x += stride)
+            {
+                T res = T(0);
+                for (std::size_t j = 0; j < k; ++j)
+                {
+                    res += r[j] * x[j];
+                }
+                out[i] = res;
+            }
+        }
+
+        // Computes as many outputs as a batch has lanes at once: the
+        // accumulator of an output sums the products over the lanes of the
+        // aligned coefficients r, and the accumulators are reduced together
+        template <class T>
+        inline void fir_window_outputs(std::size_t n, const T* x, std::size_t stride, const T* r, std::size_t k,
+                                       T* out, std::true_type)
+        {
+            using b_type = simd_type<T>;
+            constexpr std::size_t size = b_type::size;
+            std::size_t vec_size = k - k % size;
+            std::size_t i = 0;
+            for (; i + size <= n; i += size)
+            {
+                const T* xi = x + i * stride;
+                b_type acc[size];
+                fir_accumulators<0, size>::zero(acc);
+                for (std::size_t j = 0; j < vec_size; j += size)
+                {
+                    fir_accumulators<0, size>::update(b_type(r + j, aligned_mode()), xi + j, stride, acc);
+                }
+                haddp(acc).store_unaligned(out + i);
+                for (std::size_t l = 0; l < size && vec_size < k; ++l)
+                {
+                    for (std::size_t j = vec_size; j < k; ++j)
+                    {
+                        out[i + l] += r[j] * xi[l * stride + j];
+                    }
+                }
+            }
+            for (; i < n; ++i)
+            {
+                const T* xi = x + i * stride;
+                b_type acc(T(0));
+                for (std::size_t j = 0; j < vec_size; j += size)
+                {
+                    acc = fma(b_type(r + j, aligned_mode()), b_type(xi + j, unaligned_mode()), acc);
+                }
+                T res = hadd(acc);
+                for (std::size_t j = vec_size; j < k; ++j)
+                {
+                    res += r[j] * xi[j];
+                }
+                out[i] = res;
+            }
+        }
+
+        /*******************
+         * sliding outputs *
+         *******************/
+
+        // out[i] = r[0] * x[i] + ... + r[k - 1] * x[i + k - 1]
+        template <class T>
+        inline void fir_sliding_outputs(std::size_t n, const T* x, const T* r, std::size_t k, T* out, std::false_type)
+        {
+            fir_window_outputs(n, x, 1, r, k, out, std::false_type());
+        }
+
+        // Computes fir_output_batches batches of consecutive outputs at
+        // once: each coefficient is broadcast and multiplied with the
+        // windows of the batches, shifted by one sample per coefficient
+        template <class T>
+        inline void fir_sliding_outputs(std::size_t n, const T* x, const T* r, std::size_t k, T* out, std::true_type)
+        {
+            using b_type = simd_type<T>;
+            constexpr std::size_t size = b_type::size;
+            constexpr std::size_t batches = fir_output_batches;
+            std::size_t i = 0;
+            for (; i + batches * size <= n; i += batches * size)
+            {
+                b_type acc[batches];
+                fir_accumulators<0, batches>::zero(acc);
+                for (std::size_t j = 0; j < k; ++j)
+                {
+                    fir_accumulators<0, batches>::update(b_type(r[j]), x + i + j, size, acc);
+                }
+                fir_accumulators<0, batches>::store(acc, out + i);
+            }
+            for (; i + size <= n; i += size)
+            {
+                b_type acc(T(0));
+                for (std::size_t j = 0; j < k; ++j)
+                {
+                    acc = fma(b_type(r[j]), b_type(x + i + j, unaligned_mode()), acc);
+                }
+                acc.store_unaligned(out + i);
+            }
+            fir_window_outputs(n - i, x + i, 1, r, k, out + i, std::true_type());
+        }
+    }
+
+    /*****************************
+     * fir_filter implementation *
+     *****************************/
+
+    /**
+     * Constructs a filter with the coefficients h[0], ..., h[num_taps - 1]
+     * and a zero state.
+     * @param taps pointer to the coefficients.
+     * @param num_taps the number of coefficients; a filter without
+     * coefficients outputs zeros.
+     */
+    template <class T>
+    inline fir_filter<T>::fir_filter(const T* taps, size_type num_taps)
+        : m_num_taps(std::max(size_type(1), num_taps)), m_block_size(detail::fir_block_size(m_num_taps)),
+          m_taps(m_num_taps, T(0)), m_buffer(m_num_taps - 1 + m_block_size, T(0))
+    {
+        std::reverse_copy(taps, taps + num_taps, m_taps.begin() + static_cast<std::ptrdiff_t>(m_num_taps - num_taps));
+    }
+
+    /**
+     * Returns the number of coefficients of the filter.
+     */
+    template <class T>
+    inline auto fir_filter<T>::num_taps() const noexcept -> size_type
+    {
+        return m_num_taps;
+    }
+
+    /**
+     * Clears the state of the filter: the samples before the next block
+     * are zeros.
+     */
+    template <class T>
+    inline void fir_filter<T>::reset() noexcept
+    {
+        std::fill(m_buffer.begin(), m_buffer.end(), T(0));
+    }
+
+    /**
+     * Filters the next \c n samples of the stream.
+     * @param n the number of samples.
+     * @param in pointer to the input samples.
+     * @param out pointer to the \c n output samples; it may be \c in.
+     */
+    template <class T>
+    inline void fir_filter<T>::process(size_type n, const T* in, T* out)
+    {
+        size_type history = m_num_taps - 1;
+        T* buffer = m_buffer.data();
+        while (n > 0)
+        {
+            size_type block = std::min(n, m_block_size);
+            std::copy(in, in + block, buffer + history);
+            detail::fir_sliding_outputs(block, buffer, m_taps.data(), m_num_taps, out, simd_tag());
+            std::copy(buffer + block, buffer + block + history, buffer);
+            in += block;
+            out += block;
+            n -= block;
+        }
+    }
+
+    /********************************
+     * fir_decimator implementation *
+     ********************************/
+
+    /**
+     * Constructs a decimator with the coefficients h[0], ..., h[num_taps - 1]
+     * and a zero state.
+     * @param taps pointer to the coefficients.
+     * @param num_taps the number of coefficients.
+     * @param factor the downsampling factor, at least 1.
+     */
+    template <class T>
+    inline fir_decimator<T>::fir_decimator(const T* taps, size_type num_taps, size_type factor)
+        : m_num_taps(std::max(size_type(1), num_taps)), m_factor(std::max(size_type(1), factor)),
+          m_block_size(detail::fir_block_size(m_num_taps)), m_phase(0),
+          m_taps(m_num_taps, T(0)), m_buffer(m_num_taps - 1 + m_block_size, T(0))
+    {
+        std::reverse_copy(taps, taps + num_taps, m_taps.begin() + static_cast<std::ptrdiff_t>(m_num_taps - num_taps));
+    }
+
+    /**
+     * Returns the number of coefficients of the filter.
+     */
+    template <class T>
+    inline auto fir_decimator<T>::num_taps() const noexcept -> size_type
+    {
+        return m_num_taps;
+    }
+
+    /**
+     * Returns the downsampling factor.
+     */
+    template <class T>
+    inline auto fir_decimator<T>::factor() const noexcept -> size_type
+    {
+        return m_factor;
+    }
+
+    /**
+     * Clears the state of the decimator: the samples before the next block
+     * are zeros, and the first sample of the next block is kept.
+     */
+    template <class T>
+    inline void fir_decimator<T>::reset() noexcept
+    {
+        std::fill(m_buffer.begin(), m_buffer.end(), T(0));
+        m_phase = 0;
+    }
+
+    /**
+     * Filters and downsamples the next \c n samples of the stream.
+     * @param n the number of input samples.
+     * @param in pointer to the input samples.
+     * @param out pointer to the output samples, room for n / factor + 1
+     * samples; it may be \c in.
+     * @return the number of output samples.
+     */
+    template <class T>
+    inline auto fir_decimator<T>::process(size_type n, const T* in, T* out) -> size_type
+    {
+        size_type history = m_num_taps - 1;
+        T* buffer = m_buffer.data();
+        size_type res = 0;
+        while (n > 0)
+        {
+            size_type block = std::min(n, m_block_size);
+            std::copy(in, in + block, buffer + history);
+            if (m_phase < block)
+            {
+                // the window of the input sample i starts at buffer + i
+                size_type count = (block - m_phase + m_factor - 1) / m_factor;
+                detail::fir_window_outputs(count, buffer + m_phase, m_factor, m_taps.data(), m_num_taps, out + res, simd_tag());
+                res += count;
+                m_phase += count * m_factor;
+            }
+            m_phase -= block;
+            std::copy(buffer + block, buffer + block + history, buffer);
+            in += block;
+            n -= block;
+        }
+        return res;
+    }
+
+    /***********************************
+     * fir_interpolator implementation *
+     ***********************************/
+
+    /**
+     * Constructs an interpolator with the coefficients h[0], ...,
+     * h[num_taps - 1] and a zero state.
+     * @param taps pointer to the coefficients.
+     * @param num_taps the number of coefficients.
+     * @param factor the upsampling factor, at least 1.
+     */
+    template <class T>
+    inline fir_interpolator<T>::fir_interpolator(const T* taps, size_type num_taps, size_type factor)
+        : m_num_taps(std::max(size_type(1), num_taps)), m_factor(std::max(size_type(1), factor)),
+          m_phase_taps((m_num_taps + m_factor - 1) / m_factor)
+    {
+        // the subfilters are reversed, padded with zeros to the same
+        // length, and aligned
+        constexpr size_type alignment = detail::default_alignment / sizeof(T);
+        m_phase_stride = (m_phase_taps + alignment - 1) / alignment * alignment;
+        m_block_size = detail::fir_block_size(m_phase_taps);
+        m_taps.assign(m_factor * m_phase_stride, T(0));
+        for (size_type p = 0; p < m_factor; ++p)
+        {
+            for (size_type q = 0; q < m_phase_taps && p + q * m_factor < num_taps; ++q)
+            {
+                m_taps[p * m_phase_stride + m_phase_taps - 1 - q] = taps[p + q * m_factor];
+            }
+        }
+        m_buffer.assign(m_phase_taps - 1 + m_block_size, T(0));
+        m_outputs.resize(m_block_size);
+    }
+
+    /**
+     * Returns the number of coefficients of the filter.
+     */
+    template <class T>
+    inline auto fir_interpolator<T>::num_taps() const noexcept -> size_type
+    {
+        return m_num_taps;
+    }
+
+    /**
+     * Returns the upsampling factor.
+     */
+    template <class T>
+    inline auto fir_interpolator<T>::factor() const noexcept -> size_type
+    {
+        return m_factor;
+    }
+
+    /**
+     * Clears the state of the interpolator: the samples before the next
+     * block are zeros.
+     */
+    template <class T>
+    inline void fir_interpolator<T>::reset() noexcept
+    {
+        std::fill(m_buffer.begin(), m_buffer.end(), T(0));
+    }
+
+    /**
+     * Upsamples and filters the next \c n samples of the stream.
+     * @param n the number of input samples.
+     * @param in pointer to the input samples.
+     * @param out pointer to the n * factor output samples, which must not
+     * overlap the input samples.
+     */
+    template <class T>
+    inline void fir_interpolator<T>::process(size_type n, const T* in, T* out)
+    {
+        size_type history = m_phase_taps - 1;
+        T* buffer = m_buffer.data();
+        T* outputs = m_outputs.data();
+        while (n > 0)
+        {
+            size_type block = std::min(n, m_block_size);
+            std::copy(in, in + block, buffer + history);
+            for (size_type p = 0; p < m_factor; ++p)
+            {
+                detail::fir_sliding_outputs(block, buffer, m_taps.data() + p * m_phase_stride, m_phase_taps, outputs, simd_tag());
+                for (size_type i = 0; i < block; ++i)
+                {
+                    out[i * m_factor + p] = outputs[i];
+                }
+            }
+            std::copy(buffer + block, buffer + block + history, buffer);
+            in += block;
+            out += block * m_factor;
+            n -= block;
+        }
+    }
+}
+
+#endif
@@ -0,0 +1,387 @@
+/***************************************************************************
+* Copyright (c) 2016, Johan Mabille and Sylvain Corlay                     *
+*                                                                          *
+* Distributed under the terms of the BSD 3-Clause License.                 *
+*                                                                          *
+* The full license is in the file LICENSE, distributed with this software. *
+****************************************************************************/
+
+#ifndef XSIMD_GEMM_HPP
+#define XSIMD_GEMM_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#include "../xsimd.hpp"
+
+namespace xsimd
+{
+    /**
+     * @enum matrix_layout
+     * Storage order of a matrix: the elements of a row are contiguous in
+     * the row_major order, the elements of a column in the column_major
+     * order.
+     */
+    enum class matrix_layout
+    {
+        row_major,
+        column_major
+    };
+
+    /**
+     * Computes C = alpha * A * B + beta * C, where A is a m x k matrix, B a
+     * k x n matrix and C a m x n matrix, all stored in the same layout. As
+     * in BLAS, C is not read when \c beta is 0.
+     *
+     * The blocks of A and B are packed into aligned buffers sized for the
+     * caches, and C is computed by tiles held in registers.
+     * @param layout the storage order of the matrices.
+     * @param m number of rows of A and C.
+     * @param n number of columns of B and C.
+     * @param k number of columns of A and rows of B.
+     * @param alpha the scalar multiplying A * B.
+     * @param a pointer to A.
+     * @param lda the leading dimension of A: the distance between two rows
+     * in the row_major layout, between two columns in the column_major
+     * layout.
+     * @param b pointer to B.
+     * @param ldb the leading dimension of B.
+     * @param beta the scalar multiplying C.
+     * @param c pointer to C.
+     * @param ldc the leading dimension of C.
+     * @param num_threads the number of threads computing independent
+     * slices of C; the calling thread computes one of them.
+     */
+    template <class T>
+    void gemm(matrix_layout layout, std::size_t m, std::size_t n, std::size_t k, T alpha,
+              const T* a, std::size_t lda, const T* b, std::size_t ldb, T beta, T* c, std::size_t ldc,
+              std::size_t num_threads = 1);
+
+    /******************
+     * implementation *
+     ******************/
+
+    namespace detail
+    {
+#if XSIMD_X86_INSTR_SET >= XSIMD_X86_AVX512_VERSION || XSIMD_ARM_INSTR_SET >= XSIMD_ARM8_64_NEON_VERSION
+        constexpr std::size_t gemm_vector_registers = 32;
+#else
+        constexpr std::size_t gemm_vector_registers = 16;
+#endif
+
+        // The micro-kernel keeps a mr x nr tile of C in registers, with nr
+        // made of two batches: the 2 * mr accumulators, the two rows of B
+        // and the broadcast element of A fill the register file. The
+        // blocks of A (mc x kc) and of B (kc x nc) are sized for the L2
+        // and L3 caches, a kc x nr panel of B for the L1 cache.
+        template <class T>
+        struct gemm_traits
+        {
+            static constexpr std::size_t size = simd_traits<T>::size;
+            static constexpr bool vectorized = size > 1;
+            static constexpr std::size_t num_batches = 2;
+            static constexpr std::size_t nr = vectorized ? num_batches * size : 4;
+            static constexpr std::size_t mr = vectorized ? (gemm_vector_registers - num_batches - 1) / num_batches : 4;
+            static constexpr std::size_t kc = 256;
+            static constexpr std::size_t mc = (128 * 1024 / (kc * sizeof(T))) / mr * mr;
+            static constexpr std::size_t nc = 4096 / nr * nr;
+        };
+
+        template <class T>
+        using gemm_buffer = std::vector<T, aligned_allocator<T, default_alignment>>;
+
+        // Copies the rows [i, i + mc) and columns [p, p + kc) of A into
+        // panels of mr rows, stored column after column; the missing rows
+        // of the last panel are zeros
+        template <class T>
+        inline void pack_a(std::size_t mc, std::size_t kc, const T* a, std::size_t lda, T* res)
+        {
+            constexpr std::size_t mr = gemm_traits<T>::mr;
+            for (std::size_t ir = 0; ir < mc; ir += mr)
+            {
+                std::size_t rows = std::min(mr, mc - ir);
+                for (std::size_t p = 0; p < kc; ++p, res += mr)
+                {
+                    for (std::size_t i = 0; i < rows; ++i)
+                    {
+                        res[i] = a[(ir + i) * lda + p];
+                    }
+                    std::fill(res + rows, res + mr, T(0));
+                }
+            }
+        }
+
+        // Copies the rows [p, p + kc) and columns [j, j + nc) of B into
+        // panels of nr columns, stored row after row
+        template <class T>
+        inline void pack_b(std::size_t kc, std::size_t nc, const T* b, std::size_t ldb, T* res)
+        {
+            constexpr std::size_t nr = gemm_traits<T>::nr;
+            for (std::size_t jr = 0; jr < nc; jr += nr)
+            {
+                std::size_t cols = std::min(nr, nc - jr);
+                for (std::size_t p = 0; p < kc; ++p, res += nr)
+                {
+                    const T* src = b + p * ldb + jr;
+                    std::copy(src, src + cols, res);
+                    std::fill(res + cols, res + nr, T(0));
+                }
+            }
+        }
+
+        // C = alpha * tile + beta * C on the rows x cols corner of a tile
+        // stored in t, with a stride of nr
+        template <class T>
+        inline void update_tile(std::size_t rows, std::size_t cols, const T* t, T alpha, T beta, T* c, std::size_t ldc)
+        {
+            constexpr std::size_t nr = gemm_traits<T>::nr;
+            for (std::size_t i = 0; i < rows; ++i)
+            {
+                for (std::size_t j = 0; j < cols; ++j)
+                {
+                    T v = alpha * t[i * nr + j];
+                    c[i * ldc + j] = beta == T(0) ? v : v + beta * c[i * ldc + j];
+                }
+            }
+        }
+
+        template <class T>
+        inline void micro_kernel(std::size_t kc, const T* a, const T* b, T alpha, T beta, T* c, std::size_t ldc,
+                                 std::size_t rows, std::size_t cols, std::false_type)
+        {
+            constexpr std::size_t mr = gemm_traits<T>::mr;
+            constexpr std::size_t nr = gemm_traits<T>::nr;
+            T acc[mr * nr] = {};
+            for (std::size_t p = 0; p < kc; ++p, a += mr, b += nr)
+            {
+                for (std::size_t i = 0; i < mr; ++i)
+                {
+                    for (std::size_t j = 0; j < nr; ++j)
+                    {
+                        acc[i * nr + j] += a[i] * b[j];
+                    }
+                }
+            }
+            update_tile(rows, cols, acc, alpha, beta, c, ldc);
+        }
+
+        // Rows [I, N) of a tile held in the accumulators acc0 and acc1;
+        // the recursion unrolls the loops over the rows, so that the
+        // accumulators are only indexed by constants and stay in registers
+        template <std::size_t I, std::size_t N>
+        struct gemm_rows
+        {
+            template <class B>
+            static inline void zero(B* acc0, B* acc1)
+            {
+                acc0[I] = B(typename B::value_type(0));
+                acc1[I] = B(typename B::value_type(0));
+                gemm_rows<I + 1, N>::zero(acc0, acc1);
+            }
+
+            // acc[i] += a[i] * b
+            template <class T, class B>
+            static inline void update(const T* a, const B& b0, const B& b1, B* acc0, B* acc1)
+            {
+                B ai(a[I]);
+                acc0[I] = fma(ai, b0, acc0[I]);
+                acc1[I] = fma(ai, b1, acc1[I]);
+                gemm_rows<I + 1, N>::update(a, b0, b1, acc0, acc1);
+            }
+
+            // c[i] = alpha * acc[i] + beta * c[i], c is not read if beta is 0
+            template <class T, class B>
+            static inline void write(const B* acc0, const B* acc1, const B& alpha, const B& beta, bool load_c,
+                                     T* c, std::size_t ldc)
+            {
+                constexpr std::size_t size = B::size;
+                B r0 = acc0[I] * alpha;
+                B r1 = acc1[I] * alpha;
+                if (load_c)
+                {
+                    r0 = fma(beta, B(c, unaligned_mode()), r0);
+                    r1 = fma(beta, B(c + size, unaligned_mode()), r1);
+                }
+                store_simd(c, r0, unaligned_mode());
+                store_simd(c + size, r1, unaligned_mode());
+                gemm_rows<I + 1, N>::write(acc0, acc1, alpha, beta, load_c, c + ldc, ldc);
+            }
+        };
+
+        template <std::size_t N>
+        struct gemm_rows<N, N>
+        {
+            template <class B>
+            static inline void zero(B*, B*)
+            {
+            }
+
+            template <class T, class B>
+            static inline void update(const T*, const B&, const B&, B*, B*)
+            {
+            }
+
+            template <class T, class B>
+            static inline void write(const B*, const B*, const B&, const B&, bool, T*, std::size_t)
+            {
+            }
+        };
+
+        template <class T>
+        inline void micro_kernel(std::size_t kc, const T* a, const T* b, T alpha, T beta, T* c, std::size_t ldc,
+                                 std::size_t rows, std::size_t cols, std::true_type)
+        {
+            using b_type = simd_type<T>;
+            constexpr std::size_t size = gemm_traits<T>::size;
+            constexpr std::size_t mr = gemm_traits<T>::mr;
+            constexpr std::size_t nr = gemm_traits<T>::nr;
+            b_type acc0[mr], acc1[mr];
+            gemm_rows<0, mr>::zero(acc0, acc1);
+            for (std::size_t p = 0; p < kc; ++p, a += mr, b += nr)
+            {
+                b_type b0(b, aligned_mode());
+                b_type b1(b + size, aligned_mode());
+                gemm_rows<0, mr>::update(a, b0, b1, acc0, acc1);
+            }
+            if (rows == mr && cols == nr)
+            {
+                gemm_rows<0, mr>::write(acc0, acc1, b_type(alpha), b_type(beta), beta != T(0), c, ldc);
+            }
+            else
+            {
+                // the tile is written to an aligned buffer, then the valid
+                // corner is copied to C
+                alignas(default_alignment) T tile[mr * nr];
+                gemm_rows<0, mr>::write(acc0, acc1, b_type(T(1)), b_type(T(0)), false, tile, nr);
+                update_tile(rows, cols, tile, alpha, beta, c, ldc);
+            }
+        }
+
+        template <class T>
+        inline void scale_matrix(std::size_t m, std::size_t n, T beta, T* c, std::size_t ldc)
+        {
+            for (std::size_t i = 0; i < m; ++i)
+            {
+                for (std::size_t j = 0; j < n; ++j)
+                {
+                    c[i * ldc + j] = beta == T(0) ? T(0) : beta * c[i * ldc + j];
+                }
+            }
+        }
+
+        // Row-major product, blocked as in Goto and van de Geijn, "Anatomy
+        // of High-Performance Matrix Multiplication": the loops over the
+        // blocks of B, the blocks of A, then the panels of both.
+        template <class T>
+        inline void gemm_row_major(std::size_t m, std::size_t n, std::size_t k, T alpha,
+                                   const T* a, std::size_t lda, const T* b, std::size_t ldb, T beta, T* c, std::size_t ldc)
+        {
+            using traits = gemm_traits<T>;
+            constexpr std::size_t mr = traits::mr, nr = traits::nr;
+            constexpr std::size_t kc = traits::kc, mc = traits::mc, nc = traits::nc;
+            if (m == 0 || n == 0)
+            {
+                return;
+            }
+            if (k == 0 || alpha == T(0))
+            {
+                scale_matrix(m, n, beta, c, ldc);
+                return;
+            }
+            gemm_buffer<T> packed_a(std::min(mc, (m + mr - 1) / mr * mr) * std::min(kc, k));
+            gemm_buffer<T> packed_b(std::min(nc, (n + nr - 1) / nr * nr) * std::min(kc, k));
+            for (std::size_t jc = 0; jc < n; jc += nc)
+            {
+                std::size_t ncur = std::min(nc, n - jc);
+                for (std::size_t pc = 0; pc < k; pc += kc)
+                {
+                    std::size_t kcur = std::min(kc, k - pc);
+                    // the first block of k applies beta, the next ones add
+                    T bcur = pc == 0 ? beta : T(1);
+                    pack_b(kcur, ncur, b + pc * ldb + jc, ldb, packed_b.data());
+                    for (std::size_t ic = 0; ic < m; ic += mc)
+                    {
+                        std::size_t mcur = std::min(mc, m - ic);
+                        pack_a(mcur, kcur, a + ic * lda + pc, lda, packed_a.data());
+                        for (std::size_t jr = 0; jr < ncur; jr += nr)
+                        {
+                            for (std::size_t ir = 0; ir < mcur; ir += mr)
+                            {
+                                micro_kernel(kcur, packed_a.data() + ir * kcur, packed_b.data() + jr * kcur, alpha, bcur,
+                                             c + (ic + ir) * ldc + jc + jr, ldc, std::min(mr, mcur - ir), std::min(nr, ncur - jr),
+                                             std::integral_constant<bool, traits::vectorized>());
+                            }
+                        }
+                    }
+                }
+            }
+        }
+
+        // The slices of C along its largest dimension are independent
+        // products; they are rounded to whole tiles.
+        template <class T>
+        inline void gemm_parallel(std::size_t m, std::size_t n, std::size_t k, T alpha,
+                                  const T* a, std::size_t lda, const T* b, std::size_t ldb, T beta, T* c, std::size_t ldc,
+                                  std::size_t num_threads)
+        {
+            bool split_rows = m >= n;
+            std::size_t extent = split_rows ? m : n;
+            std::size_t unit = split_rows ? gemm_traits<T>::mr : gemm_traits<T>::nr;
+            std::size_t units = (extent + unit - 1) / unit;
+            num_threads = std::max(std::size_t(1), std::min(num_threads, units));
+            std::vector<std::thread> threads;
+            for (std::size_t t = 0; t < num_threads; ++t)
+            {
+                std::size_t begin = std::min(extent, units * t / num_threads * unit);
+                std::size_t end = std::min(extent, units * (t + 1) / num_threads * unit);
+                auto task = [=]()
+                {
+                    if (split_rows)
+                    {
+                        gemm_row_major(end - begin, n, k, alpha, a + begin * lda, lda, b, ldb, beta, c + begin * ldc, ldc);
+                    }
+                    else
+                    {
+                        gemm_row_major(m, end - begin, k, alpha, a, lda, b + begin, ldb, beta, c + begin, ldc);
+                    }
+                };
+                if (t + 1 == num_threads)
+                {
+                    task();
+                }
+                else
+                {
+                    threads.emplace_back(task);
+                }
+            }
+            for (std::thread& thread : threads)
+            {
+                thread.join();
+            }
+        }
+    }
+
+    template <class T>
+    inline void gemm(matrix_layout layout, std::size_t m, std::size_t n, std::size_t k, T alpha,
+                     const T* a, std::size_t lda, const T* b, std::size_t ldb, T beta, T* c, std::size_t ldc,
+                     std::size_t num_threads)
+    {
+        static_assert(std::is_same<T, float>::value || std::is_same<T, double>::value,
+                      "gemm requires float or double values");
+        // a column-major product is the row-major product of the
+        // transposed matrices, in reverse order: C' = B' * A'
+        if (layout == matrix_layout::row_major)
+        {
+            detail::gemm_parallel(m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, num_threads);
+        }
+        else
+        {
+            detail::gemm_parallel(n, m, k, alpha, b, ldb, a, lda, beta, c, ldc, num_threads);
+        }
+    }
+}
+
+#endif
@@ -0,0 +1,370 @@
+/***************************************************************************
+* Copyright (c) 2016, Johan Mabille and Sylvain Corlay                     *
+*                                                                          *
+* Distributed under the terms of the BSD 3-Clause License.                 *
+*                                                                          *
+* The full license is in the file LICENSE, distributed with this software. *
+****************************************************************************/
+
+#ifndef XSIMD_HASH_HPP
+#define XSIMD_HASH_HPP
+
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+#include "../math/xsimd_bit_manipulation.hpp"
+#include "../memory/xsimd_alignment.hpp"
+#include "../xsimd.hpp"
+
+#if XSIMD_X86_INSTR_SET >= XSIMD_X86_SSE4_2_VERSION
+    #define XSIMD_HASH_CRC32C_X86
+#elif XSIMD_ARM_INSTR_SET >= XSIMD_ARM8_32_NEON_VERSION && defined(__ARM_FEATURE_CRC32)
+    #include <arm_acle.h>
+    #define XSIMD_HASH_CRC32C_ARM
+#endif
+
+namespace xsimd
+{
+    // The hash functions consider the scalars as unsigned integers and
+    // return the same bits as their scalar counterparts on uint32_t and
+    // uint64_t, whatever the instruction set.
+
+    /**
+     * Multiply-xorshift finalizer: two rounds of xor with the high half
+     * and multiplication by an odd constant. Cheap and good enough for
+     * hash tables whose keys are not adversarial.
+     * @param x batch of int32 or int64 keys.
+     * @return the batch of hash values.
+     */
+    template <class T, std::size_t N>
+    batch<T, N> multiply_xorshift_hash(const batch<T, N>& x);
+
+    /**
+     * Finalization mix of MurmurHash3 (fmix32 and fmix64): every bit of
+     * the input affects every bit of the result.
+     * @param x batch of int32 or int64 keys.
+     * @return the batch of hash values.
+     */
+    template <class T, std::size_t N>
+    batch<T, N> murmur3_fmix(const batch<T, N>& x);
+
+    /**
+     * CRC32C (Castagnoli) of the bytes of the scalars of \c x, without
+     * initial and final inversion, starting from \c seed. Uses the crc32
+     * instructions of SSE 4.2 and ARMv8 where available, a bitwise SIMD
+     * implementation otherwise. The result fits in 32 bits; the high bits
+     * of the int64 scalars are zero.
+     * @param x batch of int32 or int64 keys.
+     * @param seed initial value of the CRC.
+     * @return the batch of CRC values.
+     */
+    template <class T, std::size_t N>
+    batch<T, N> crc32c_hash(const batch<T, N>& x, uint32_t seed = 0);
+
+    /**
+     * Computes the partition of each of the \c n keys of \c keys into
+     * \c ids: the murmur3_fmix hash of the key, reduced to
+     * [0, num_partitions) by multiplication with the high half of the hash.
+     * @param keys pointer to the int32 or int64 keys.
+     * @param n number of keys.
+     * @param num_partitions number of partitions, at least 1, at most 65536
+     * for int32 keys and 2^32 for int64 keys; with 0 partitions, nothing is
+     * written.
+     * @param ids pointer to the output partition ids, may alias \c keys.
+     */
+    template <class T>
+    void hash_partition_ids(const T* keys, std::size_t n, std::size_t num_partitions, T* ids);
+
+    /**
+     * Partitions the \c n keys of \c keys by hash: computes the partition
+     * ids and their histogram, the start offset of each partition in
+     * \c out_offsets, and copies the keys partition by partition into
+     * \c out_keys, keeping their relative order.
+     * @param keys pointer to the int32 or int64 keys.
+     * @param n number of keys.
+     * @param num_partitions number of partitions, see hash_partition_ids;
+     * with 0 partitions, nothing is written.
+     * @param out_offsets pointer to num_partitions + 1 offsets; the keys of
+     * partition \c p are in [out_offsets[p], out_offsets[p + 1]).
+     * @param out_keys pointer to the \c n partitioned keys, must not alias
+     * \c keys.
+     */
+    template <class T>
+    void hash_partition(const T* keys, std::size_t n, std::size_t num_partitions,
+                        std::size_t* out_offsets, T* out_keys);
+
+    /******************
+     * implementation *
+     ******************/
+
+    namespace detail
+    {
+        template <class B, class T = typename B::value_type>
+        struct hash_kernel;
+
+        template <class B>
+        struct hash_kernel<B, int32_t>
+        {
+            static inline B multiply_xorshift(const B& a)
+            {
+                const B m(int32_t(0x045d9f3b));
+                B x = (a ^ logical_shift_right(a, 16)) * m;
+                x = (x ^ logical_shift_right(x, 16)) * m;
+                return x ^ logical_shift_right(x, 16);
+            }
+
+            static inline B fmix(const B& a)
+            {
+                B x = (a ^ logical_shift_right(a, 16)) * B(static_cast<int32_t>(0x85ebca6bu));
+                x = (x ^ logical_shift_right(x, 13)) * B(static_cast<int32_t>(0xc2b2ae35u));
+                return x ^ logical_shift_right(x, 16);
+            }
+
+            static constexpr int32_t half_width() noexcept
+            {
+                return 16;
+            }
+        };
+
+        template <class B>
+        struct hash_kernel<B, int64_t>
+        {
+            static inline B multiply_xorshift(const B& a)
+            {
+                const B m(static_cast<int64_t>(0xd6e8feb86659fd93ull));
+                B x = (a ^ logical_shift_right(a, 32)) * m;
+                x = (x ^ logical_shift_right(x, 32)) * m;
+                return x ^ logical_shift_right(x, 32);
+            }
+
+            static inline B fmix(const B& a)
+            {
+                B x = (a ^ logical_shift_right(a, 33)) * B(static_cast<int64_t>(0xff51afd7ed558ccdull));
+                x = (x ^ logical_shift_right(x, 33)) * B(static_cast<int64_t>(0xc4ceb9fe1a85ec53ull));
+                return x ^ logical_shift_right(x, 33);
+            }
+
+            static constexpr int32_t half_width() noexcept
+            {
+                return 32;
+            }
+        };
+
+        /**********
+         * crc32c *
+         **********/
+
+        // reflected Castagnoli polynomial
+        constexpr uint32_t crc32c_polynomial = 0x82f63b78u;
+
+#if defined(XSIMD_HASH_CRC32C_X86)
+        inline uint32_t crc32c_scalar(uint32_t crc, uint32_t x)
+        {
+            return _mm_crc32_u32(crc, x);
+        }
+
+        inline uint32_t crc32c_scalar(uint32_t crc, uint64_t x)
+        {
+#if defined(__x86_64__) || defined(_M_X64)
+            return static_cast<uint32_t>(_mm_crc32_u64(crc, x));
+#else
+            crc = _mm_crc32_u32(crc, static_cast<uint32_t>(x));
+            return _mm_crc32_u32(crc, static_cast<uint32_t>(x >> 32));
+#endif
+        }
+#elif defined(XSIMD_HASH_CRC32C_ARM)
+        inline uint32_t crc32c_scalar(uint32_t crc, uint32_t x)
+        {
+            return __crc32cw(crc, x);
+        }
+
+        inline uint32_t crc32c_scalar(uint32_t crc, uint64_t x)
+        {
+            return __crc32cd(crc, x);
+        }
+#endif
+
+#if defined(XSIMD_HASH_CRC32C_X86) || defined(XSIMD_HASH_CRC32C_ARM)
+        // one crc32 instruction per scalar, they pipeline well
+        template <class T, std::size_t N>
+        inline batch<T, N> crc32c_impl(const batch<T, N>& x, uint32_t seed)
+        {
+            using unsigned_type = typename std::make_unsigned<T>::type;
+            alignas(default_alignment) std::array<T, N> buf;
+            x.store_aligned(buf.data());
+            for (std::size_t i = 0; i < N; ++i)
+            {
+                buf[i] = static_cast<T>(crc32c_scalar(seed, static_cast<unsigned_type>(buf[i])));
+            }
+            batch<T, N> res;
+            res.load_aligned(buf.data());
+            return res;
+        }
+#else
+        // bitwise CRC, all the lanes at once: the polynomial is xored where
+        // the bit shifted out is set
+        template <class T, std::size_t N>
+        inline batch<T, N> crc32c_impl(const batch<T, N>& x, uint32_t seed)
+        {
+            using b_type = batch<T, N>;
+            const b_type poly(static_cast<T>(crc32c_polynomial));
+            const b_type one(T(1));
+            b_type crc = x ^ b_type(static_cast<T>(seed));
+            for (std::size_t i = 0; i < 8 * sizeof(T); ++i)
+            {
+                crc = logical_shift_right(crc, 1) ^ (poly & (b_type(T(0)) - (crc & one)));
+            }
+            return crc;
+        }
+#endif
+
+#undef XSIMD_HASH_CRC32C_X86
+#undef XSIMD_HASH_CRC32C_ARM
+
+        /*************
+         * partition *
+         *************/
+
+        // Lemire's multiply-shift range reduction on the high half of the
+        // hash, which stays exact in a scalar of the same width
+        template <class B>
+        inline B partition_ids(const B& keys, const B& num_partitions)
+        {
+            using kernel = hash_kernel<B>;
+            B h = logical_shift_right(kernel::fmix(keys), kernel::half_width());
+            return logical_shift_right(h * num_partitions, kernel::half_width());
+        }
+
+        inline uint32_t scalar_fmix(uint32_t x)
+        {
+            x = (x ^ (x >> 16)) * 0x85ebca6bu;
+            x = (x ^ (x >> 13)) * 0xc2b2ae35u;
+            return x ^ (x >> 16);
+        }
+
+        inline uint64_t scalar_fmix(uint64_t x)
+        {
+            x = (x ^ (x >> 33)) * 0xff51afd7ed558ccdull;
+            x = (x ^ (x >> 33)) * 0xc4ceb9fe1a85ec53ull;
+            return x ^ (x >> 33);
+        }
+
+        template <class T>
+        inline T partition_id(T key, T num_partitions)
+        {
+            using unsigned_type = typename std::make_unsigned<T>::type;
+            constexpr int half_width = 4 * sizeof(T);
+            unsigned_type h = scalar_fmix(static_cast<unsigned_type>(key)) >> half_width;
+            return static_cast<T>((h * static_cast<unsigned_type>(num_partitions)) >> half_width);
+        }
+
+        template <class T>
+        inline void hash_partition_ids_impl(const T* keys, std::size_t n, T num_partitions, T* ids, std::false_type)
+        {
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                ids[i] = partition_id(keys[i], num_partitions);
+            }
+        }
+
+        template <class T>
+        inline void hash_partition_ids_impl(const T* keys, std::size_t n, T num_partitions, T* ids, std::true_type)
+        {
+            using b_type = simd_type<T>;
+            constexpr std::size_t size = simd_traits<T>::size;
+            std::size_t vec_size = n - n % size;
+            b_type bp(num_partitions);
+            for (std::size_t i = 0; i < vec_size; i += size)
+            {
+                partition_ids(load_unaligned(keys + i), bp).store_unaligned(ids + i);
+            }
+            hash_partition_ids_impl(keys + vec_size, n - vec_size, num_partitions, ids + vec_size, std::false_type());
+        }
+    }
+
+    template <class T, std::size_t N>
+    inline batch<T, N> multiply_xorshift_hash(const batch<T, N>& x)
+    {
+        return detail::hash_kernel<batch<T, N>>::multiply_xorshift(x);
+    }
+
+    template <class T, std::size_t N>
+    inline batch<T, N> murmur3_fmix(const batch<T, N>& x)
+    {
+        return detail::hash_kernel<batch<T, N>>::fmix(x);
+    }
+
+    template <class T, std::size_t N>
+    inline batch<T, N> crc32c_hash(const batch<T, N>& x, uint32_t seed)
+    {
+        return detail::crc32c_impl(x, seed);
+    }
+
+    template <class T>
+    inline void hash_partition_ids(const T* keys, std::size_t n, std::size_t num_partitions, T* ids)
+    {
+        static_assert(std::is_same<T, int32_t>::value || std::is_same<T, int64_t>::value,
+                      "hash_partition_ids requires int32_t or int64_t keys");
+        assert(num_partitions > 0);
+        if (num_partitions == 0)
+        {
+            return;
+        }
+        detail::hash_partition_ids_impl(keys, n, static_cast<T>(num_partitions), ids,
+                                        std::integral_constant<bool, (simd_traits<T>::size > 1)>());
+    }
+
+    template <class T>
+    inline void hash_partition(const T* keys, std::size_t n, std::size_t num_partitions,
+                               std::size_t* out_offsets, T* out_keys)
+    {
+        assert(num_partitions > 0);
+        if (num_partitions == 0)
+        {
+            return;
+        }
+        // The ids are computed in batches; the histogram is accumulated
+        // into four interleaved copies, so that runs of equal ids do not
+        // serialize on the same counter.
+        std::vector<T, aligned_allocator<T, detail::default_alignment>> ids(n);
+        hash_partition_ids(keys, n, num_partitions, ids.data());
+
+        std::vector<std::size_t> histogram(4 * num_partitions, 0);
+        std::size_t block_size = n - n % 4;
+        for (std::size_t i = 0; i < block_size; i += 4)
+        {
+            ++histogram[4 * static_cast<std::size_t>(ids[i])];
+            ++histogram[4 * static_cast<std::size_t>(ids[i + 1]) + 1];
+            ++histogram[4 * static_cast<std::size_t>(ids[i + 2]) + 2];
+            ++histogram[4 * static_cast<std::size_t>(ids[i + 3]) + 3];
+        }
+        for (std::size_t i = block_size; i < n; ++i)
+        {
+            ++histogram[4 * static_cast<std::size_t>(ids[i])];
+        }
+
+        std::size_t offset = 0;
+        for (std::size_t p = 0; p < num_partitions; ++p)
+        {
+            out_offsets[p] = offset;
+            offset += histogram[4 * p] + histogram[4 * p + 1] + histogram[4 * p + 2] + histogram[4 * p + 3];
+        }
+        out_offsets[num_partitions] = offset;
+
+        // scatter, reusing the first copy of the histogram as write cursors
+        for (std::size_t p = 0; p < num_partitions; ++p)
+        {
+            histogram[4 * p] = out_offsets[p];
+        }
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            out_keys[histogram[4 * static_cast<std::size_t>(ids[i])]++] = keys[i];
+        }
+    }
+}
+
+#endif
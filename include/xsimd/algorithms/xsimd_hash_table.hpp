@@ -0,0 +1,486 @@
+/***************************************************************************
+* Copyright (c) 2016, Johan Mabille and Sylvain Corlay                     *
+*                                                                          *
+* Distributed under the terms of the BSD 3-Clause License.                 *
+*                                                                          *
+* The full license is in the file LICENSE, distributed with this software. *
+****************************************************************************/
+
+#ifndef XSIMD_HASH_TABLE_HPP
+#define XSIMD_HASH_TABLE_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "../memory/xsimd_alignment.hpp"
+#include "xsimd_bitmap.hpp"
+#include "xsimd_hash.hpp"
+
+namespace xsimd
+{
+    /**
+     * @class flat_hash_map
+     * @brief Open addressing hash map with SIMD probing
+     *
+     * The keys are stored with linear probing: a key is in the first empty
+     * slot met from its home slot, given by its murmur3_fmix hash, when it
+     * is inserted. The slots are grouped by as many as a batch of int32_t
+     * or int64_t holds, aligned on the batch size, and a lookup compares the
+     * key against a whole group with a single batch comparison, until it
+     * finds the key or an empty slot. Empty slots hold a reserved key value,
+     * \c empty_key, which cannot be inserted: insert() returns false and
+     * operator[] throws std::invalid_argument for it.
+     *
+     * The table doubles its number of groups when it is 7/8 full. Elements
+     * are never erased.
+     *
+     * @tparam K the type of the keys, int32_t or int64_t.
+     * @tparam V the type of the mapped values.
+     */
+    template <class K, class V>
+    class flat_hash_map
+    {
+    public:
+
+        static_assert(std::is_same<K, int32_t>::value || std::is_same<K, int64_t>::value,
+                      "flat_hash_map requires int32_t or int64_t keys");
+
+        using key_type = K;
+        using mapped_type = V;
+        using size_type = std::size_t;
+
+        static constexpr size_type group_size = simd_traits<K>::size;
+
+        explicit flat_hash_map(size_type capacity = 0, K empty_key = std::numeric_limits<K>::min());
+
+        size_type size() const noexcept;
+        bool empty() const noexcept;
+        size_type capacity() const noexcept;
+        K empty_key() const noexcept;
+
+        void reserve(size_type capacity);
+
+        bool insert(K key, const V& value);
+        V& operator[](K key);
+
+        V* find(K key);
+        const V* find(K key) const;
+        bool contains(K key) const;
+
+        size_type find(const K* keys, size_type n, V* values, const V& missing) const;
+
+    private:
+
+        using key_vector = std::vector<K, aligned_allocator<K, detail::default_alignment>>;
+
+        size_type find_slot(K key, size_type slot) const;
+        void hash_slots(const K* keys, K* slots) const;
+        size_type find_batch(const K* keys, size_type n, V* values, const V& missing, std::true_type) const;
+        size_type find_batch(const K* keys, size_type n, V* values, const V& missing, std::false_type) const;
+        size_type insert_slot(K key);
+        void rehash(size_type num_groups);
+
+        key_vector m_keys;
+        std::vector<V> m_values;
+        size_type m_size;
+        size_type m_group_mask;
+        K m_empty_key;
+    };
+
+    /****************************************
+     * flat_hash_map implementation details *
+     ****************************************/
+
+    namespace detail
+    {
+        constexpr std::size_t hash_table_npos = std::numeric_limits<std::size_t>::max();
+
+        // gather steps of the batched find before the remaining lanes fall
+        // back to the group comparisons
+        constexpr std::size_t hash_table_gather_steps = 2;
+
+        // home slot of key, the probes walk the slots linearly from it
+        template <class K>
+        inline std::size_t hash_table_slot(K key, std::size_t slot_mask)
+        {
+            using unsigned_type = typename std::make_unsigned<K>::type;
+            return static_cast<std::size_t>(scalar_fmix(static_cast<unsigned_type>(key))) & slot_mask;
+        }
+
+        // Probes the slots from slot, a group at a time: returns the slot of
+        // key, or the first empty slot met (with found = false). The slots
+        // of the first group before slot are ignored.
+        template <class K>
+        inline std::size_t probe_group(const K* keys, std::size_t group_mask, std::size_t slot,
+                                       K key, K empty_key, bool& found, std::true_type)
+        {
+            using b_type = simd_type<K>;
+            constexpr std::size_t size = simd_traits<K>::size;
+            b_type bkey(key), bempty(empty_key);
+            std::size_t group = slot / size;
+            uint64_t valid = ~uint64_t(0) << (slot % size);
+            while (true)
+            {
+                b_type g = load_aligned(keys + group * size);
+                uint64_t match = to_bitmask(g == bkey) & valid;
+                if (match != 0)
+                {
+                    found = true;
+                    return group * size + lowest_bit_index(match);
+                }
+                uint64_t empty = to_bitmask(g == bempty) & valid;
+                if (empty != 0)
+                {
+                    found = false;
+                    return group * size + lowest_bit_index(empty);
+                }
+                group = (group + 1) & group_mask;
+                valid = ~uint64_t(0);
+            }
+        }
+
+        template <class K>
+        inline std::size_t probe_group(const K* keys, std::size_t group_mask, std::size_t slot,
+                                       K key, K empty_key, bool& found, std::false_type)
+        {
+            while (true)
+            {
+                if (keys[slot] == key || keys[slot] == empty_key)
+                {
+                    found = keys[slot] == key;
+                    return slot;
+                }
+                slot = (slot + 1) & group_mask;
+            }
+        }
+
+        template <class K>
+        inline std::size_t probe_group(const K* keys, std::size_t group_mask, std::size_t slot,
+                                       K key, K empty_key, bool& found)
+        {
+            return probe_group(keys, group_mask, slot, key, empty_key, found,
+                               std::integral_constant<bool, (simd_traits<K>::size > 1)>());
+        }
+    }
+
+    /********************************
+     * flat_hash_map implementation *
+     ********************************/
+
+    template <class K, class V>
+    constexpr typename flat_hash_map<K, V>::size_type flat_hash_map<K, V>::group_size;
+
+    /**
+     * Constructs an empty map that can hold \c capacity elements without
+     * rehashing.
+     * @param capacity the initial capacity.
+     * @param empty_key the key value marking the empty slots.
+     */
+    template <class K, class V>
+    inline flat_hash_map<K, V>::flat_hash_map(size_type capacity, K empty_key)
+        : m_size(0), m_group_mask(0), m_empty_key(empty_key)
+    {
+        rehash(1);
+        reserve(capacity);
+    }
+
+    /**
+     * Returns the number of elements in the map.
+     */
+    template <class K, class V>
+    inline auto flat_hash_map<K, V>::size() const noexcept -> size_type
+    {
+        return m_size;
+    }
+
+    /**
+     * Returns true if the map holds no element.
+     */
+    template <class K, class V>
+    inline bool flat_hash_map<K, V>::empty() const noexcept
+    {
+        return m_size == 0;
+    }
+
+    /**
+     * Returns the number of elements the map can hold without rehashing.
+     */
+    template <class K, class V>
+    inline auto flat_hash_map<K, V>::capacity() const noexcept -> size_type
+    {
+        // at least one slot stays empty, so that the probes terminate
+        return m_keys.size() * 7 / 8;
+    }
+
+    /**
+     * Returns the key value marking the empty slots.
+     */
+    template <class K, class V>
+    inline K flat_hash_map<K, V>::empty_key() const noexcept
+    {
+        return m_empty_key;
+    }
+
+    /**
+     * Grows the table so that it can hold \c capacity elements without
+     * rehashing.
+     */
+    template <class K, class V>
+    inline void flat_hash_map<K, V>::reserve(size_type capacity)
+    {
+        size_type num_groups = m_group_mask + 1;
+        while (num_groups * group_size * 7 / 8 < capacity)
+        {
+            num_groups *= 2;
+        }
+        if (num_groups != m_group_mask + 1)
+        {
+            rehash(num_groups);
+        }
+    }
+
+    /**
+     * Inserts \c value with \c key if the key is not in the map yet.
+     * @param key the key, must differ from empty_key().
+     * @param value the value to insert.
+     * @return true if the element was inserted, false if the key
+     * was already present or is empty_key().
+     */
+    template <class K, class V>
+    inline bool flat_hash_map<K, V>::insert(K key, const V& value)
+    {
+        if (key == m_empty_key)
+        {
+            return false;
+        }
+        size_type size = m_size;
+        size_type slot = insert_slot(key);
+        if (m_size != size)
+        {
+            m_values[slot] = value;
+            return true;
+        }
+        return false;
+    }
+
+    /**
+     * Returns a reference to the value mapped to \c key, inserting a
+     * default constructed value if the key is not in the map yet.
+     * @param key the key, must differ from empty_key().
+     * @throw std::invalid_argument if \c key is empty_key().
+     */
+    template <class K, class V>
+    inline V& flat_hash_map<K, V>::operator[](K key)
+    {
+        if (key == m_empty_key)
+        {
+            throw std::invalid_argument("flat_hash_map: the empty key cannot be inserted");
+        }
+        return m_values[insert_slot(key)];
+    }
+
+    /**
+     * Returns a pointer to the value mapped to \c key, or nullptr if the
+     * key is not in the map.
+     */
+    template <class K, class V>
+    inline V* flat_hash_map<K, V>::find(K key)
+    {
+        size_type slot = find_slot(key, detail::hash_table_slot(key, m_keys.size() - 1));
+        return slot == detail::hash_table_npos ? nullptr : &m_values[slot];
+    }
+
+    template <class K, class V>
+    inline const V* flat_hash_map<K, V>::find(K key) const
+    {
+        size_type slot = find_slot(key, detail::hash_table_slot(key, m_keys.size() - 1));
+        return slot == detail::hash_table_npos ? nullptr : &m_values[slot];
+    }
+
+    /**
+     * Returns true if \c key is in the map.
+     */
+    template <class K, class V>
+    inline bool flat_hash_map<K, V>::contains(K key) const
+    {
+        return find(key) != nullptr;
+    }
+
+    /**
+     * Looks up the \c n keys of \c keys, and stores the mapped values into
+     * \c values, or \c missing for the keys not in the map. The keys are
+     * probed a batch at a time: their groups are computed with the SIMD
+     * version of the hash and prefetched, then each lane walks its slots
+     * with gather until it meets its key or an empty slot, so that the
+     * cache misses of the probes overlap.
+     * @param keys pointer to the keys to look up.
+     * @param n number of keys.
+     * @param values pointer to the output values.
+     * @param missing the value stored for the keys not in the map.
+     * @return the number of keys found.
+     */
+    template <class K, class V>
+    inline auto flat_hash_map<K, V>::find(const K* keys, size_type n, V* values, const V& missing) const -> size_type
+    {
+        return find_batch(keys, n, values, missing, std::integral_constant<bool, (group_size > 1)>());
+    }
+
+    template <class K, class V>
+    inline auto flat_hash_map<K, V>::find_batch(const K* keys, size_type n, V* values, const V& missing,
+                                                std::true_type) const -> size_type
+    {
+        using b_type = batch<K, group_size>;
+        using bool_type = batch_bool<K, group_size>;
+        size_type vec_size = n - n % group_size;
+        size_type count = 0;
+        alignas(detail::default_alignment) std::array<K, group_size> slots;
+        alignas(detail::default_alignment) std::array<K, group_size> next_slots;
+        b_type slot_mask(static_cast<K>(m_keys.size() - 1));
+        b_type empty(m_empty_key);
+        if (vec_size != 0)
+        {
+            hash_slots(keys, next_slots.data());
+        }
+        for (size_type i = 0; i < vec_size; i += group_size)
+        {
+            b_type bkeys = load_unaligned(keys + i);
+            b_type slot = load_aligned(next_slots.data());
+            // the home slots of the next batch are prefetched while this
+            // one is probed
+            if (i + group_size < vec_size)
+            {
+                hash_slots(keys + i + group_size, next_slots.data());
+            }
+            // each lane walks the slots of its key with gather
+            bool_type found(false);
+            bool_type active = bkeys != empty;
+            for (size_type step = 0; step < detail::hash_table_gather_steps; ++step)
+            {
+                b_type k = gather(m_keys.data(), slot);
+                bool_type hit = k == bkeys;
+                found = found || (active && hit);
+                active = active && !(hit || k == empty);
+                if (!any(active))
+                {
+                    break;
+                }
+                slot = select(active, (slot + b_type(K(1))) & slot_mask, slot);
+            }
+            slot.store_aligned(slots.data());
+            uint64_t found_mask = to_bitmask(found);
+            for (size_type j = 0; j < group_size; ++j)
+            {
+                bool lane_found = (found_mask >> j) & 1;
+                values[i + j] = lane_found ? m_values[static_cast<size_type>(slots[j])] : missing;
+                count += lane_found;
+            }
+            // the longer probes go on with the group comparisons
+            for (uint64_t active_mask = to_bitmask(active); active_mask != 0; active_mask &= active_mask - 1)
+            {
+                size_type j = detail::lowest_bit_index(active_mask);
+                size_type lane_slot = find_slot(keys[i + j], static_cast<size_type>(slots[j]));
+                bool lane_found = lane_slot != detail::hash_table_npos;
+                values[i + j] = lane_found ? m_values[lane_slot] : missing;
+                count += lane_found;
+            }
+        }
+        return count + find_batch(keys + vec_size, n - vec_size, values + vec_size, missing, std::false_type());
+    }
+
+    template <class K, class V>
+    inline auto flat_hash_map<K, V>::find_batch(const K* keys, size_type n, V* values, const V& missing,
+                                                std::false_type) const -> size_type
+    {
+        size_type count = 0;
+        for (size_type i = 0; i < n; ++i)
+        {
+            const V* v = find(keys[i]);
+            values[i] = v != nullptr ? *v : missing;
+            count += v != nullptr;
+        }
+        return count;
+    }
+
+    // home slots of a batch of keys, whose cache lines are prefetched
+    template <class K, class V>
+    inline void flat_hash_map<K, V>::hash_slots(const K* keys, K* slots) const
+    {
+        using b_type = batch<K, group_size>;
+        b_type slot_mask(static_cast<K>(m_keys.size() - 1));
+        (murmur3_fmix(b_type(keys, unaligned_mode())) & slot_mask).store_aligned(slots);
+        for (size_type j = 0; j < group_size; ++j)
+        {
+            prefetch(m_keys.data() + slots[j]);
+            prefetch(m_values.data() + slots[j]);
+        }
+    }
+
+    template <class K, class V>
+    inline auto flat_hash_map<K, V>::find_slot(K key, size_type slot) const -> size_type
+    {
+        if (key == m_empty_key)
+        {
+            return detail::hash_table_npos;
+        }
+        bool found;
+        slot = detail::probe_group(m_keys.data(), m_group_mask, slot, key, m_empty_key, found);
+        return found ? slot : detail::hash_table_npos;
+    }
+
+    template <class K, class V>
+    inline auto flat_hash_map<K, V>::insert_slot(K key) -> size_type
+    {
+        // the empty key would match the first empty slot, the callers
+        // reject it
+        bool found;
+        size_type slot = detail::probe_group(m_keys.data(), m_group_mask,
+                                             detail::hash_table_slot(key, m_keys.size() - 1),
+                                             key, m_empty_key, found);
+        if (found)
+        {
+            return slot;
+        }
+        if (m_size + 1 > capacity())
+        {
+            rehash(2 * (m_group_mask + 1));
+            slot = detail::probe_group(m_keys.data(), m_group_mask,
+                                       detail::hash_table_slot(key, m_keys.size() - 1),
+                                       key, m_empty_key, found);
+        }
+        m_keys[slot] = key;
+        m_values[slot] = V();
+        ++m_size;
+        return slot;
+    }
+
+    template <class K, class V>
+    inline void flat_hash_map<K, V>::rehash(size_type num_groups)
+    {
+        key_vector keys(num_groups * group_size, m_empty_key);
+        std::vector<V> values(num_groups * group_size);
+        size_type group_mask = num_groups - 1;
+        for (size_type i = 0; i < m_keys.size(); ++i)
+        {
+            if (m_keys[i] != m_empty_key)
+            {
+                bool found;
+                size_type slot = detail::probe_group(keys.data(), group_mask,
+                                                     detail::hash_table_slot(m_keys[i], keys.size() - 1),
+                                                     m_keys[i], m_empty_key, found);
+                keys[slot] = m_keys[i];
+                values[slot] = std::move(m_values[i]);
+            }
+        }
+        m_keys.swap(keys);
+        m_values.swap(values);
+        m_group_mask = group_mask;
+    }
+}
+
+#endif
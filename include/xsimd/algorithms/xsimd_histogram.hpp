@@ -0,0 +1,365 @@
+/***************************************************************************
+* Copyright (c) 2016, Johan Mabille and Sylvain Corlay                     *
+*                                                                          *
+* Distributed under the terms of the BSD 3-Clause License.                 *
+*                                                                          *
+* The full license is in the file LICENSE, distributed with this software. *
+****************************************************************************/
+
+#ifndef XSIMD_HISTOGRAM_HPP
+#define XSIMD_HISTOGRAM_HPP
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+#include "../memory/xsimd_alignment.hpp"
+#include "../xsimd.hpp"
+
+namespace xsimd
+{
+    /**
+     * Counts the \c n elements of \c values into \c bins bins of equal
+     * width. For float and double values, the bins split [lo, hi]: the
+     * bin of x is floor((x - lo) * bins / (hi - lo)), and \c hi falls into
+     * the last bin. For int32 values, the bins split the integers of
+     * [lo, hi]: the bin of x is floor((x - lo) * bins / (hi - lo + 1)),
+     * computed exactly, so that bins = hi - lo + 1 counts each value
+     * separately. The values out of [lo, hi] and NaN are not counted.
+     *
+     * The bin indices are computed in batches, and counted into four
+     * interleaved sub-histograms so that runs of equal indices do not
+     * serialize on the same counter; they are summed at the end.
+     * @param values pointer to the float, double or int32 values.
+     * @param n number of values.
+     * @param bins number of bins, at least 1, at most 2^22 for int32 values.
+     * @param lo lower bound of the first bin.
+     * @param hi upper bound of the last bin, greater than \c lo.
+     * @param counts pointer to the \c bins counts, overwritten.
+     * @return the number of values counted; 0 if \c bins is 0, in which
+     * case nothing is written.
+     */
+    template <class T>
+    std::size_t histogram(const T* values, std::size_t n, std::size_t bins, T lo, T hi, std::size_t* counts);
+
+    /**
+     * Counts the \c n elements of \c values into the num_edges - 1 bins
+     * delimited by the sorted \c edges: the bin of x is the largest k such
+     * that edges[k] <= x, and edges[num_edges - 1] falls into the last bin.
+     * The values out of [edges[0], edges[num_edges - 1]] and NaN are not
+     * counted. The bins are found with a branchless binary search over the
+     * edges, run on whole batches of values.
+     * @param values pointer to the float, double or int32 values.
+     * @param n number of values.
+     * @param edges pointer to the sorted bin edges.
+     * @param num_edges number of edges, at least 2.
+     * @param counts pointer to the num_edges - 1 counts, overwritten.
+     * @return the number of values counted; 0 if there are fewer than two
+     * edges, in which case nothing is written.
+     */
+    template <class T>
+    std::size_t histogram(const T* values, std::size_t n, const T* edges, std::size_t num_edges, std::size_t* counts);
+
+    /******************
+     * implementation *
+     ******************/
+
+    namespace detail
+    {
+        template <class T>
+        struct histogram_index;
+
+        template <>
+        struct histogram_index<float>
+        {
+            using type = int32_t;
+        };
+
+        template <>
+        struct histogram_index<double>
+        {
+            using type = int64_t;
+        };
+
+        template <>
+        struct histogram_index<int32_t>
+        {
+            using type = int32_t;
+        };
+
+        template <class T>
+        using histogram_index_t = typename histogram_index<T>::type;
+
+        template <std::size_t N>
+        inline batch_bool<int32_t, N> histogram_mask(const batch_bool<int32_t, N>& mask)
+        {
+            return mask;
+        }
+
+        template <std::size_t N>
+        inline batch_bool<int32_t, N> histogram_mask(const batch_bool<float, N>& mask)
+        {
+            return bool_cast(mask);
+        }
+
+        template <std::size_t N>
+        inline batch_bool<int64_t, N> histogram_mask(const batch_bool<double, N>& mask)
+        {
+            return bool_cast(mask);
+        }
+
+        // The binners return the bin of a value, or bins for the values
+        // that are not counted; that extra bin is dropped at the end.
+
+        template <class T>
+        class uniform_binner
+        {
+        public:
+
+            using index_type = histogram_index_t<T>;
+
+            uniform_binner(std::size_t bins, T lo, T hi)
+                : m_lo(lo), m_hi(hi), m_scale(T(bins) / (hi - lo)), m_last(T(bins - 1)), m_none(T(bins))
+            {
+            }
+
+            index_type operator()(T x) const
+            {
+                if (!(x >= m_lo && x <= m_hi))
+                {
+                    return index_type(m_none);
+                }
+                T fi = std::floor((x - m_lo) * m_scale);
+                return index_type(fi < m_last ? fi : m_last);
+            }
+
+            template <std::size_t N>
+            batch<index_type, N> operator()(const batch<T, N>& x) const
+            {
+                using b_type = batch<T, N>;
+                b_type fi = floor((x - b_type(m_lo)) * b_type(m_scale));
+                fi = select(fi < b_type(m_last), fi, b_type(m_last));
+                fi = select((x >= b_type(m_lo)) & (x <= b_type(m_hi)), fi, b_type(m_none));
+                return to_int(fi);
+            }
+
+        private:
+
+            T m_lo;
+            T m_hi;
+            T m_scale;
+            T m_last;
+            T m_none;
+        };
+
+        // The batch version estimates the bin in float arithmetic, which
+        // is off by one bin at most, and fixes it up with the exact lower
+        // bounds of the bins; with one bin per value, the bin is the
+        // offset of the value
+        template <>
+        class uniform_binner<int32_t>
+        {
+        public:
+
+            using index_type = int32_t;
+
+            uniform_binner(std::size_t bins, int32_t lo, int32_t hi)
+                : m_lo(lo), m_hi(hi), m_bins(static_cast<uint64_t>(bins)),
+                  m_range(static_cast<uint64_t>(int64_t(hi) - int64_t(lo)) + 1),
+                  m_scale(float(bins) / float(m_range)), m_bounds(bins + 1), m_identity(m_bins == m_range)
+            {
+                // smallest value of each bin, wraps for the bound past hi
+                for (std::size_t k = 0; k <= bins; ++k)
+                {
+                    uint64_t offset = (k * m_range + m_bins - 1) / m_bins;
+                    m_bounds[k] = static_cast<int32_t>(static_cast<uint32_t>(int64_t(lo) + int64_t(offset)));
+                }
+            }
+
+            index_type operator()(int32_t x) const
+            {
+                if (x < m_lo || x > m_hi)
+                {
+                    return index_type(m_bins);
+                }
+                uint64_t offset = static_cast<uint64_t>(int64_t(x) - int64_t(m_lo));
+                return index_type(offset * m_bins / m_range);
+            }
+
+            template <std::size_t N>
+            batch<int32_t, N> operator()(const batch<int32_t, N>& x) const
+            {
+                using i_type = batch<int32_t, N>;
+                using f_type = batch<float, N>;
+                const i_type zero(0), last(static_cast<int32_t>(m_bins - 1));
+                const auto valid = (x >= i_type(m_lo)) & (x <= i_type(m_hi));
+                if (m_identity)
+                {
+                    return select(valid, x - i_type(m_lo), i_type(static_cast<int32_t>(m_bins)));
+                }
+                // x - lo as an unsigned 32 bits integer
+                f_type offset = to_float(x - i_type(m_lo));
+                offset = select(offset < f_type(0.f), offset + f_type(4294967296.f), offset);
+                i_type b = to_int(offset * f_type(m_scale));
+                b = select(b < zero, zero, select(b > last, last, b));
+                b = select(x < gather(m_bounds.data(), b), b - i_type(1), b);
+                b = select(x >= gather(m_bounds.data(), b + i_type(1)), b + i_type(1), b);
+                b = select(b > last, last, b);
+                return select(valid, b, i_type(static_cast<int32_t>(m_bins)));
+            }
+
+        private:
+
+            int32_t m_lo;
+            int32_t m_hi;
+            uint64_t m_bins;
+            uint64_t m_range;
+            float m_scale;
+            std::vector<int32_t> m_bounds;
+            bool m_identity;
+        };
+
+        // Branchless binary search: the number of steps only depends on
+        // the number of edges, all the lanes of a batch take them together
+        template <class T>
+        class edges_binner
+        {
+        public:
+
+            using index_type = histogram_index_t<T>;
+
+            edges_binner(const T* edges, std::size_t num_edges)
+                : m_edges(edges), m_num_edges(num_edges)
+            {
+            }
+
+            index_type operator()(T x) const
+            {
+                if (!(x >= m_edges[0] && x <= m_edges[m_num_edges - 1]))
+                {
+                    return index_type(m_num_edges - 1);
+                }
+                std::size_t base = 0;
+                for (std::size_t len = m_num_edges; len > 1; len -= len / 2)
+                {
+                    std::size_t half = len / 2;
+                    base = m_edges[base + half] <= x ? base + half : base;
+                }
+                return index_type(std::min(base, m_num_edges - 2));
+            }
+
+            template <std::size_t N>
+            batch<index_type, N> operator()(const batch<T, N>& x) const
+            {
+                using i_type = batch<index_type, N>;
+                i_type base(index_type(0));
+                for (std::size_t len = m_num_edges; len > 1; len -= len / 2)
+                {
+                    i_type candidate = base + i_type(index_type(len / 2));
+                    base = select(histogram_mask(gather(m_edges, candidate) <= x), candidate, base);
+                }
+                const i_type last(index_type(m_num_edges - 2));
+                base = select(base > last, last, base);
+                auto valid = (x >= batch<T, N>(m_edges[0])) & (x <= batch<T, N>(m_edges[m_num_edges - 1]));
+                return select(histogram_mask(valid), base, i_type(index_type(m_num_edges - 1)));
+            }
+
+        private:
+
+            const T* m_edges;
+            std::size_t m_num_edges;
+        };
+
+        constexpr std::size_t histogram_sub_count = 4;
+
+        template <class T, class B>
+        inline void histogram_count(const T* values, std::size_t n, const B& binner, uint32_t* sub, std::false_type)
+        {
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                ++sub[static_cast<std::size_t>(binner(values[i])) * histogram_sub_count + i % histogram_sub_count];
+            }
+        }
+
+        template <class T, class B>
+        inline void histogram_count(const T* values, std::size_t n, const B& binner, uint32_t* sub, std::true_type)
+        {
+            using index_type = typename B::index_type;
+            constexpr std::size_t size = simd_traits<T>::size;
+            std::size_t vec_size = n - n % size;
+            alignas(detail::default_alignment) std::array<index_type, size> indices;
+            for (std::size_t i = 0; i < vec_size; i += size)
+            {
+                binner(load_unaligned(values + i)).store_aligned(indices.data());
+                for (std::size_t j = 0; j < size; ++j)
+                {
+                    ++sub[static_cast<std::size_t>(indices[j]) * histogram_sub_count + j % histogram_sub_count];
+                }
+            }
+            histogram_count(values + vec_size, n - vec_size, binner, sub, std::false_type());
+        }
+
+        template <class T, class B>
+        inline std::size_t histogram_impl(const T* values, std::size_t n, const B& binner,
+                                          std::size_t bins, std::size_t* counts)
+        {
+            // the 32 bits counters are flushed before they can overflow
+            constexpr std::size_t chunk_size = std::size_t(1) << 30;
+            std::vector<uint32_t> sub((bins + 1) * histogram_sub_count);
+            std::fill(counts, counts + bins, std::size_t(0));
+            std::size_t res = 0;
+            for (std::size_t start = 0; start < n; start += chunk_size)
+            {
+                std::fill(sub.begin(), sub.end(), uint32_t(0));
+                histogram_count(values + start, std::min(chunk_size, n - start), binner, sub.data(),
+                                std::integral_constant<bool, (simd_traits<T>::size > 1)>());
+                for (std::size_t k = 0; k < bins; ++k)
+                {
+                    std::size_t count = 0;
+                    for (std::size_t s = 0; s < histogram_sub_count; ++s)
+                    {
+                        count += sub[k * histogram_sub_count + s];
+                    }
+                    counts[k] += count;
+                    res += count;
+                }
+            }
+            return res;
+        }
+
+        template <class T>
+        inline void check_histogram_type()
+        {
+            static_assert(std::is_same<T, float>::value || std::is_same<T, double>::value || std::is_same<T, int32_t>::value,
+                          "histogram requires float, double or int32_t values");
+        }
+    }
+
+    template <class T>
+    inline std::size_t histogram(const T* values, std::size_t n, std::size_t bins, T lo, T hi, std::size_t* counts)
+    {
+        detail::check_histogram_type<T>();
+        if (bins == 0)
+        {
+            return 0;
+        }
+        return detail::histogram_impl(values, n, detail::uniform_binner<T>(bins, lo, hi), bins, counts);
+    }
+
+    template <class T>
+    inline std::size_t histogram(const T* values, std::size_t n, const T* edges, std::size_t num_edges, std::size_t* counts)
+    {
+        detail::check_histogram_type<T>();
+        if (num_edges < 2)
+        {
+            return 0;
+        }
+        return detail::histogram_impl(values, n, detail::edges_binner<T>(edges, num_edges), num_edges - 1, counts);
+    }
+}
+
+#endif
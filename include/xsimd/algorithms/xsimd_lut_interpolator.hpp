@@ -0,0 +1,354 @@
+/***************************************************************************
+* Copyright (c) 2016, Johan Mabille and Sylvain Corlay                     *
+*                                                                          *
+* Distributed under the terms of the BSD 3-Clause License.                 *
+*                                                                          *
+* The full license is in the file LICENSE, distributed with this software. *
+****************************************************************************/
+
+#ifndef XSIMD_LUT_INTERPOLATOR_HPP
+#define XSIMD_LUT_INTERPOLATOR_HPP
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <type_traits>
+#include <vector>
+
+#include "../memory/xsimd_alignment.hpp"
+#include "../xsimd.hpp"
+
+namespace xsimd
+{
+    /**
+     * @class lut_interpolator
+     * @brief Piecewise linear interpolation of a uniformly sampled function
+     *
+     * The table holds the values of a function at \c size points evenly
+     * spaced over [x_min, x_max]. An input is mapped to the fractional
+     * position \c u of the table, the table is read at floor(u) and the
+     * result is interpolated with one fma from the value and the slope at
+     * that point. The reads are gathers, or register permutes when the
+     * table fits in one or two batches and the instruction set has
+     * variable permutes (32 floats or 16 doubles on AVX512, 16 floats or
+     * 4 doubles on AVX2).
+     *
+     * Out of the domain, the inputs are either clamped to it, which
+     * extends the table with its first and last values, or the first and
+     * last segments are extrapolated linearly. NaN inputs give NaN.
+     *
+     * @tparam T the type of the values, float or double.
+     */
+    template <class T>
+    class lut_interpolator
+    {
+    public:
+
+        static_assert(std::is_same<T, float>::value || std::is_same<T, double>::value,
+                      "lut_interpolator requires float or double values");
+
+        using value_type = T;
+        using size_type = std::size_t;
+
+        lut_interpolator(const T* table, size_type size, T x_min, T x_max, bool clamp = true);
+
+        size_type size() const noexcept;
+        T x_min() const noexcept;
+        T x_max() const noexcept;
+        bool clamp() const noexcept;
+
+        T operator()(T x) const;
+
+        template <std::size_t N>
+        batch<T, N> operator()(const batch<T, N>& x) const;
+
+        void operator()(const T* x, size_type n, T* res) const;
+
+    private:
+
+        using value_vector = std::vector<T, aligned_allocator<T, detail::default_alignment>>;
+
+        void evaluate(const T* x, size_type n, T* res, std::true_type) const;
+        void evaluate(const T* x, size_type n, T* res, std::false_type) const;
+
+        value_vector m_values;
+        value_vector m_slopes;
+        size_type m_size;
+        T m_x_min;
+        T m_x_max;
+        T m_scale;
+        bool m_clamp;
+    };
+
+    /*******************************************
+     * lut_interpolator implementation details *
+     *******************************************/
+
+    namespace detail
+    {
+        // The tables are padded so that the permutes can load two full
+        // batches of the widest instruction set
+        template <class T>
+        constexpr std::size_t lut_min_size()
+        {
+            return 128 / sizeof(T);
+        }
+
+        // permute_size is the largest table that permute can read, the
+        // other tables are gathered
+        template <class B>
+        struct lut_lookup
+        {
+            using value_type = typename B::value_type;
+            using index_type = as_integer_t<B>;
+
+            static constexpr std::size_t permute_size = 0;
+
+            static inline B permute(const value_type* table, const index_type& idx)
+            {
+                return gather(table, idx);
+            }
+        };
+
+#if XSIMD_X86_INSTR_SET >= XSIMD_X86_AVX2_VERSION
+        template <>
+        struct lut_lookup<batch<float, 4>>
+        {
+            static constexpr std::size_t permute_size = 4;
+
+            static inline batch<float, 4> permute(const float* table, const batch<int32_t, 4>& idx)
+            {
+                return _mm_permutevar_ps(_mm_load_ps(table), idx);
+            }
+        };
+
+        template <>
+        struct lut_lookup<batch<double, 2>>
+        {
+            static constexpr std::size_t permute_size = 2;
+
+            // vpermilpd selects with the second bit of the index
+            static inline batch<double, 2> permute(const double* table, const batch<int64_t, 2>& idx)
+            {
+                return _mm_permutevar_pd(_mm_load_pd(table), _mm_slli_epi64(idx, 1));
+            }
+        };
+
+        template <>
+        struct lut_lookup<batch<float, 8>>
+        {
+            static constexpr std::size_t permute_size = 16;
+
+            // vpermps ignores the high bits of the index, the half of the
+            // table is selected with a blend
+            static inline batch<float, 8> permute(const float* table, const batch<int32_t, 8>& idx)
+            {
+                __m256 lo = _mm256_permutevar8x32_ps(_mm256_load_ps(table), idx);
+                __m256 hi = _mm256_permutevar8x32_ps(_mm256_load_ps(table + 8), idx);
+                __m256i high_half = _mm256_cmpgt_epi32(idx, _mm256_set1_epi32(7));
+                return _mm256_blendv_ps(lo, hi, _mm256_castsi256_ps(high_half));
+            }
+        };
+
+        template <>
+        struct lut_lookup<batch<double, 4>>
+        {
+            static constexpr std::size_t permute_size = 4;
+
+            // vpermps on the two halves of each double: index i becomes
+            // the pair of 32 bits indices (2i, 2i + 1)
+            static inline batch<double, 4> permute(const double* table, const batch<int64_t, 4>& idx)
+            {
+                __m256i lo = _mm256_slli_epi64(idx, 1);
+                __m256i pair = _mm256_or_si256(lo, _mm256_slli_epi64(_mm256_add_epi64(lo, _mm256_set1_epi64x(1)), 32));
+                __m256 res = _mm256_permutevar8x32_ps(_mm256_castpd_ps(_mm256_load_pd(table)), pair);
+                return _mm256_castps_pd(res);
+            }
+        };
+#endif
+
+#if XSIMD_X86_INSTR_SET >= XSIMD_X86_AVX512_VERSION
+        template <>
+        struct lut_lookup<batch<float, 16>>
+        {
+            static constexpr std::size_t permute_size = 32;
+
+            static inline batch<float, 16> permute(const float* table, const batch<int32_t, 16>& idx)
+            {
+                return _mm512_permutex2var_ps(_mm512_load_ps(table), idx, _mm512_load_ps(table + 16));
+            }
+        };
+
+        template <>
+        struct lut_lookup<batch<double, 8>>
+        {
+            static constexpr std::size_t permute_size = 16;
+
+            static inline batch<double, 8> permute(const double* table, const batch<int64_t, 8>& idx)
+            {
+                return _mm512_permutex2var_pd(_mm512_load_pd(table), idx, _mm512_load_pd(table + 8));
+            }
+        };
+#endif
+    }
+
+    /***********************************
+     * lut_interpolator implementation *
+     ***********************************/
+
+    /**
+     * Builds the interpolator of the \c size values of \c table, sampled
+     * at x_min + i * (x_max - x_min) / (size - 1).
+     * @param table pointer to the sampled values, copied.
+     * @param size number of values; a table of fewer than two values is
+     * taken as a constant, its single value or 0.
+     * @param x_min the abscissa of the first value.
+     * @param x_max the abscissa of the last value, greater than \c x_min.
+     * @param clamp whether the inputs out of [x_min, x_max] are clamped,
+     * or extrapolated from the first and last segments.
+     */
+    template <class T>
+    inline lut_interpolator<T>::lut_interpolator(const T* table, size_type size, T x_min, T x_max, bool clamp)
+        : m_values(std::max(size, detail::lut_min_size<T>()), T(0)),
+          m_slopes(std::max(size, detail::lut_min_size<T>()), T(0)),
+          m_size(std::max(size, size_type(2))), m_x_min(x_min), m_x_max(x_max),
+          m_scale(T(m_size - 1) / (x_max - x_min)), m_clamp(clamp)
+    {
+        std::copy(table, table + size, m_values.begin());
+        // a constant table has a single segment, of slope 0
+        if (size == 1)
+        {
+            m_values[1] = table[0];
+        }
+        for (size_type i = 0; i + 1 < m_size; ++i)
+        {
+            m_slopes[i] = m_values[i + 1] - m_values[i];
+        }
+    }
+
+    /**
+     * Returns the number of values of the table, 2 for a constant table
+     * built from fewer values.
+     */
+    template <class T>
+    inline auto lut_interpolator<T>::size() const noexcept -> size_type
+    {
+        return m_size;
+    }
+
+    /**
+     * Returns the abscissa of the first value of the table.
+     */
+    template <class T>
+    inline T lut_interpolator<T>::x_min() const noexcept
+    {
+        return m_x_min;
+    }
+
+    /**
+     * Returns the abscissa of the last value of the table.
+     */
+    template <class T>
+    inline T lut_interpolator<T>::x_max() const noexcept
+    {
+        return m_x_max;
+    }
+
+    /**
+     * Returns true if the inputs are clamped to [x_min, x_max], false if
+     * they are extrapolated.
+     */
+    template <class T>
+    inline bool lut_interpolator<T>::clamp() const noexcept
+    {
+        return m_clamp;
+    }
+
+    /**
+     * Interpolates the table at \c x.
+     */
+    template <class T>
+    inline T lut_interpolator<T>::operator()(T x) const
+    {
+        // same comparisons as the batch version, so that NaN
+        // propagates without producing an invalid index
+        const T last = T(m_size - 1);
+        T u = (x - m_x_min) * m_scale;
+        if (m_clamp)
+        {
+            u = u < T(0) ? T(0) : u;
+            u = u > last ? last : u;
+        }
+        T fi = std::floor(u);
+        fi = fi > T(0) ? fi : T(0);
+        fi = fi < last - T(1) ? fi : last - T(1);
+        size_type i = static_cast<size_type>(fi);
+        return (u - fi) * m_slopes[i] + m_values[i];
+    }
+
+    /**
+     * Interpolates the table at each scalar of \c x.
+     */
+    template <class T>
+    template <std::size_t N>
+    inline batch<T, N> lut_interpolator<T>::operator()(const batch<T, N>& x) const
+    {
+        using b_type = batch<T, N>;
+        using lookup = detail::lut_lookup<b_type>;
+        const b_type zero(T(0)), last(T(m_size - 1));
+        b_type u = (x - b_type(m_x_min)) * b_type(m_scale);
+        if (m_clamp)
+        {
+            u = select(u < zero, zero, u);
+            u = select(u > last, last, u);
+        }
+        // select instead of min / max, so that a NaN maps to index 0
+        b_type fi = floor(u);
+        fi = select(fi > zero, fi, zero);
+        fi = select(fi < last - b_type(T(1)), fi, last - b_type(T(1)));
+        as_integer_t<b_type> idx = to_int(fi);
+        b_type t = u - fi;
+        if (m_size <= lookup::permute_size)
+        {
+            return fma(t, lookup::permute(m_slopes.data(), idx), lookup::permute(m_values.data(), idx));
+        }
+        return fma(t, gather(m_slopes.data(), idx), gather(m_values.data(), idx));
+    }
+
+    /**
+     * Interpolates the table at the \c n elements of \c x into \c res,
+     * which may alias \c x.
+     * @param x pointer to the inputs.
+     * @param n number of inputs.
+     * @param res pointer to the results.
+     */
+    template <class T>
+    inline void lut_interpolator<T>::operator()(const T* x, size_type n, T* res) const
+    {
+        evaluate(x, n, res, std::integral_constant<bool, (simd_traits<T>::size > 1)>());
+    }
+
+    template <class T>
+    inline void lut_interpolator<T>::evaluate(const T* x, size_type n, T* res, std::true_type) const
+    {
+        constexpr size_type size = simd_traits<T>::size;
+        size_type vec_size = n - n % size;
+        for (size_type i = 0; i < vec_size; i += size)
+        {
+            (*this)(load_unaligned(x + i)).store_unaligned(res + i);
+        }
+        evaluate(x + vec_size, n - vec_size, res + vec_size, std::false_type());
+    }
+
+    template <class T>
+    inline void lut_interpolator<T>::evaluate(const T* x, size_type n, T* res, std::false_type) const
+    {
+        for (size_type i = 0; i < n; ++i)
+        {
+            res[i] = (*this)(x[i]);
+        }
+    }
+}
+
+#endif
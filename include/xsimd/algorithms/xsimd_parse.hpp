@@ -0,0 +1,347 @@
+/***************************************************************************
+* Copyright (c) 2016, Johan Mabille and Sylvain Corlay                     *
+*                                                                          *
+* Distributed under the terms of the BSD 3-Clause License.                 *
+*                                                                          *
+* The full license is in the file LICENSE, distributed with this software. *
+****************************************************************************/
+
+#ifndef XSIMD_PARSE_HPP
+#define XSIMD_PARSE_HPP
+
+#include <clocale>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "xsimd_bitmap.hpp"
+#include "xsimd_byte_kernel.hpp"
+
+namespace xsimd
+{
+    /**
+     * Parses the decimal numbers of \c data, separated by \c delimiter, and
+     * appends them to \c res. The integers are written [+-]?[0-9]+ and the
+     * floating point numbers [+-]?[0-9]*[.]?[0-9]*([eE][+-]?[0-9]+)?, with at
+     * least one digit in the mantissa. The fields hold no white space, and
+     * a delimiter may end the data. The floating point numbers are
+     * correctly rounded.
+     * @param data pointer to the characters.
+     * @param n number of characters.
+     * @param delimiter the character separating the numbers, for instance
+     * ',' or '\\n'.
+     * @param res the vector of int32_t, int64_t or double values receiving
+     * the numbers, typically with an aligned_allocator.
+     * @return false if a field is empty, is not a number or holds an
+     * integer out of the range of \c T. The numbers preceding that field
+     * are appended to \c res.
+     */
+    template <class T, class A>
+    bool parse_numbers(const char* data, std::size_t n, char delimiter, std::vector<T, A>& res);
+
+    /******************
+     * implementation *
+     ******************/
+
+    namespace detail
+    {
+        // Loads the 8 characters at p, or the characters before end
+        // followed by zeros
+        inline uint64_t load_eight_chars(const char* p, const char* end)
+        {
+            uint64_t res = 0;
+            std::memcpy(&res, p, p + 8 <= end ? 8 : static_cast<std::size_t>(end - p));
+            return res;
+        }
+
+        // Reduces the 8 digits of a little endian word by multiply-adds:
+        // pairs of digits, then groups of 4, then the 8 of them
+        inline uint64_t reduce_eight_digits(uint64_t x)
+        {
+            x = (x & 0x0f0f0f0f0f0f0f0fULL) * 2561 >> 8;
+            x = (x & 0x00ff00ff00ff00ffULL) * 6553601 >> 16;
+            return (x & 0x0000ffff0000ffffULL) * 42949672960001ULL >> 32;
+        }
+
+        inline bool is_eight_digits(uint64_t x)
+        {
+            return (((x & 0xf0f0f0f0f0f0f0f0ULL) | (((x + 0x0606060606060606ULL) & 0xf0f0f0f0f0f0f0f0ULL) >> 4)) ==
+                    0x3333333333333333ULL);
+        }
+
+        // Value of the count <= 19 digits at p. The first count % 8 digits
+        // are shifted to the end of a word, behind zeros.
+        inline uint64_t parse_digits(const char* p, std::size_t count, const char* end)
+        {
+            uint64_t res = 0;
+            std::size_t head = count % 8;
+            if (head != 0)
+            {
+                res = reduce_eight_digits((load_eight_chars(p, end) & 0x0f0f0f0f0f0f0f0fULL) << (8 * (8 - head)));
+                p += head;
+            }
+            for (std::size_t i = head; i < count; i += 8, p += 8)
+            {
+                res = res * 100000000 + reduce_eight_digits(load_eight_chars(p, end));
+            }
+            return res;
+        }
+
+        // Digits read one at a time, eight at a time when possible; stops
+        // adding them to the value after 19 significant digits
+        struct digit_reader
+        {
+            uint64_t value = 0;
+            std::size_t significant = 0;
+            std::size_t dropped = 0;
+
+            const char* read(const char* p, const char* end)
+            {
+                while (p < end)
+                {
+                    if (significant + 8 <= 19 && p + 8 <= end)
+                    {
+                        uint64_t x = load_eight_chars(p, end);
+                        if (is_eight_digits(x))
+                        {
+                            // the leading zeros are not significant
+                            uint64_t d = x & 0x0f0f0f0f0f0f0f0fULL;
+                            significant += value != 0 ? 8 : (d == 0 ? 0 : 8 - lowest_bit_index(d) / 8);
+                            value = value * 100000000 + reduce_eight_digits(x);
+                            p += 8;
+                            continue;
+                        }
+                    }
+                    unsigned d = static_cast<unsigned>(*p) - '0';
+                    if (d > 9)
+                    {
+                        break;
+                    }
+                    if (significant < 19)
+                    {
+                        value = value * 10 + d;
+                        significant += value == 0 ? 0 : 1;
+                    }
+                    else
+                    {
+                        ++dropped;
+                    }
+                    ++p;
+                }
+                return p;
+            }
+        };
+
+        template <class T>
+        inline bool parse_integer(const char* begin, const char* end, bool plain, const char* data_end, T& value)
+        {
+            using unsigned_type = typename std::make_unsigned<T>::type;
+            if (!plain || begin == end)
+            {
+                return false;
+            }
+            bool negative = *begin == '-';
+            begin += (*begin == '-' || *begin == '+') ? 1 : 0;
+            if (begin == end || static_cast<unsigned>(*begin) - '0' > 9)
+            {
+                return false;
+            }
+            while (begin + 1 < end && *begin == '0')
+            {
+                ++begin;
+            }
+            std::size_t count = static_cast<std::size_t>(end - begin);
+            if (count > std::size_t(std::numeric_limits<T>::digits10 + 1))
+            {
+                return false;
+            }
+            uint64_t x = parse_digits(begin, count, data_end);
+            uint64_t max = uint64_t(std::numeric_limits<T>::max()) + (negative ? 1 : 0);
+            if (x > max)
+            {
+                return false;
+            }
+            value = static_cast<T>(negative ? unsigned_type(0) - static_cast<unsigned_type>(x) : static_cast<unsigned_type>(x));
+            return true;
+        }
+
+        inline bool parse_field(const char* begin, const char* end, bool plain, const char* data_end, int32_t& value)
+        {
+            return parse_integer(begin, end, plain, data_end, value);
+        }
+
+        inline bool parse_field(const char* begin, const char* end, bool plain, const char* data_end, int64_t& value)
+        {
+            return parse_integer(begin, end, plain, data_end, value);
+        }
+
+        // strtod rounds correctly, but follows the decimal point of the
+        // current locale
+        inline double parse_double_slow(const char* begin, const char* end)
+        {
+            std::string buffer(begin, end);
+            char point = *std::localeconv()->decimal_point;
+            if (point != '.')
+            {
+                std::size_t pos = buffer.find('.');
+                if (pos != std::string::npos)
+                {
+                    buffer[pos] = point;
+                }
+            }
+            return std::strtod(buffer.c_str(), nullptr);
+        }
+
+        // The mantissa w and the powers of 10 up to 1e22 are exact doubles,
+        // so that w * 10^e and w / 10^e are correctly rounded (Clinger,
+        // "How to Read Floating Point Numbers Accurately").
+        inline bool parse_field(const char* begin, const char* end, bool plain, const char* data_end, double& value)
+        {
+            static const double powers[] = { 1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+                                             1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22 };
+            if (plain)
+            {
+                int64_t x;
+                if (parse_integer(begin, end, plain, data_end, x))
+                {
+                    value = x == 0 && *begin == '-' ? -0. : static_cast<double>(x);
+                    return true;
+                }
+            }
+            const char* p = begin;
+            bool negative = p < end && *p == '-';
+            p += (p < end && (*p == '-' || *p == '+')) ? 1 : 0;
+            digit_reader mantissa;
+            const char* int_end = mantissa.read(p, end);
+            int64_t exponent = static_cast<int64_t>(mantissa.dropped);
+            std::size_t num_digits = static_cast<std::size_t>(int_end - p);
+            p = int_end;
+            if (p < end && *p == '.')
+            {
+                std::size_t int_dropped = mantissa.dropped;
+                const char* frac_end = mantissa.read(p + 1, end);
+                std::size_t frac_digits = static_cast<std::size_t>(frac_end - p - 1);
+                // the dropped digits of the fraction don't scale the value
+                exponent -= static_cast<int64_t>(frac_digits - (mantissa.dropped - int_dropped));
+                num_digits += frac_digits;
+                p = frac_end;
+            }
+            if (num_digits == 0)
+            {
+                return false;
+            }
+            if (p < end && (*p == 'e' || *p == 'E'))
+            {
+                ++p;
+                bool negative_exponent = p < end && *p == '-';
+                p += (p < end && (*p == '-' || *p == '+')) ? 1 : 0;
+                if (p == end)
+                {
+                    return false;
+                }
+                int64_t e = 0;
+                for (; p < end && static_cast<unsigned>(*p) - '0' <= 9; ++p)
+                {
+                    e = e < 100000 ? e * 10 + (*p - '0') : e;
+                }
+                exponent += negative_exponent ? -e : e;
+            }
+            if (p != end)
+            {
+                return false;
+            }
+            if (mantissa.value == 0 && mantissa.dropped == 0)
+            {
+                value = negative ? -0. : 0.;
+            }
+            else if (mantissa.dropped == 0 && mantissa.value <= (uint64_t(1) << 53) && exponent >= -22 && exponent <= 22)
+            {
+                double x = static_cast<double>(mantissa.value);
+                x = exponent < 0 ? x / powers[-exponent] : x * powers[exponent];
+                value = negative ? -x : x;
+            }
+            else
+            {
+                value = parse_double_slow(begin, end);
+            }
+            return true;
+        }
+
+        // Calls f(begin, end, plain) on each field of data. The characters
+        // are classified 64 at a time into bitmaps of delimiters, digits and
+        // others; a field is plain if it holds no other character past its
+        // first one.
+        template <class F>
+        inline bool for_each_field(const char* data, std::size_t n, char delimiter, F f)
+        {
+            using kernel = byte_kernel;
+            constexpr std::size_t size = kernel::size;
+            const uint8_t* src = as_bytes(data);
+            const byte_reg delim = kernel::splat(static_cast<uint8_t>(delimiter));
+            const byte_reg minus_zero = kernel::splat(static_cast<uint8_t>(-'0'));
+            const byte_reg nine = kernel::splat(9);
+            const byte_reg zero = kernel::splat(0);
+            std::size_t field_start = 0;
+            bool field_dirty = false;
+            uint64_t start_carry = 1;
+            for (std::size_t base = 0; base < n; base += 64)
+            {
+                uint64_t delimiters = 0, digits = 0;
+                for (std::size_t j = 0; j < 64 && base + j < n; j += size)
+                {
+                    std::size_t m = n - base - j;
+                    byte_reg x = m >= size ? kernel::load(src + base + j) : load_partial(src + base + j, m);
+                    delimiters |= kernel::movemask(kernel::eq(x, delim)) << j;
+                    byte_reg value = kernel::add(x, minus_zero);
+                    digits |= kernel::movemask(kernel::eq(kernel::subs(value, nine), zero)) << j;
+                }
+                uint64_t valid = n - base >= 64 ? ~uint64_t(0) : bitmap_tail_mask(n - base);
+                delimiters &= valid;
+                uint64_t starts = (delimiters << 1) | start_carry;
+                uint64_t others = ~(delimiters | digits | starts) & valid;
+                start_carry = delimiters >> 63;
+                while (delimiters != 0)
+                {
+                    std::size_t pos = lowest_bit_index(delimiters);
+                    std::size_t lo = field_start > base ? field_start - base : 0;
+                    uint64_t range = (uint64_t(1) << pos) - (uint64_t(1) << lo);
+                    if (!f(data + field_start, data + base + pos, !field_dirty && (others & range) == 0))
+                    {
+                        return false;
+                    }
+                    field_start = base + pos + 1;
+                    field_dirty = false;
+                    delimiters &= delimiters - 1;
+                }
+                std::size_t lo = field_start > base ? field_start - base : 0;
+                field_dirty |= lo < 64 && (others >> lo) != 0;
+            }
+            return field_start == n || f(data + field_start, data + n, !field_dirty);
+        }
+    }
+
+    template <class T, class A>
+    inline bool parse_numbers(const char* data, std::size_t n, char delimiter, std::vector<T, A>& res)
+    {
+        static_assert(std::is_same<T, int32_t>::value || std::is_same<T, int64_t>::value || std::is_same<T, double>::value,
+                      "parse_numbers requires int32_t, int64_t or double values");
+        const char* data_end = data + n;
+        return detail::for_each_field(data, n, delimiter, [&](const char* begin, const char* end, bool plain)
+        {
+            T value;
+            if (!detail::parse_field(begin, end, plain, data_end, value))
+            {
+                return false;
+            }
+            res.push_back(value);
+            return true;
+        });
+    }
+}
+
+#endif
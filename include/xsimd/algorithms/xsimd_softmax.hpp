@@ -0,0 +1,268 @@
+/***************************************************************************
+* Copyright (c) 2016, Johan Mabille and Sylvain Corlay                     *
+*                                                                          *
+* Distributed under the terms of the BSD 3-Clause License.                 *
+*                                                                          *
+* The full license is in the file LICENSE, distributed with this software. *
+****************************************************************************/
+
+#ifndef XSIMD_SOFTMAX_HPP
+#define XSIMD_SOFTMAX_HPP
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <type_traits>
+
+#include "../xsimd.hpp"
+
+namespace xsimd
+{
+    /**
+     * Computes log(sum(exp(x[i]))) over the \c n elements of the array
+     * \c x, without overflow. The maximum and the sum of the rescaled
+     * exponentials are computed in a single streaming pass.
+     * @param x pointer to the input array.
+     * @param n number of elements of \c x.
+     * @return the logarithm of the sum of the exponentials of \c x, NaN if
+     * an element of \c x is NaN.
+     */
+    template <class T>
+    T log_sum_exp(const T* x, std::size_t n);
+
+    template <class T>
+    T log_sum_exp(const T* x, std::size_t n, fast_approx_tag);
+
+    /**
+     * Computes the softmax exp(x[i]) / sum(exp(x[j])) of the \c n elements
+     * of the array \c x into \c res. The maximum and the normalization
+     * factor are computed in a single streaming pass, the output in a
+     * second one. \c res may alias \c x.
+     *
+     * If an element of \c x is NaN, every output is NaN. If every element
+     * is -inf, the output is uniform, 1 / n, the limit of the softmax of
+     * equal inputs.
+     * @param x pointer to the input array.
+     * @param n number of elements of \c x.
+     * @param res pointer to the output array.
+     */
+    template <class T>
+    void softmax(const T* x, std::size_t n, T* res);
+
+    template <class T>
+    void softmax(const T* x, std::size_t n, T* res, fast_approx_tag);
+
+    /******************
+     * implementation *
+     ******************/
+
+    namespace detail
+    {
+        struct accurate_exp
+        {
+            template <class B>
+            static inline B apply(const B& x)
+            {
+                return exp(x);
+            }
+        };
+
+        struct approx_exp
+        {
+            template <class B>
+            static inline B apply(const B& x)
+            {
+                return fast_exp(x);
+            }
+        };
+
+        // exp(x - m) where m is a running maximum of x: when both are -inf,
+        // the difference is taken as 0 instead of NaN, the lane is discarded
+        // once a finite maximum shows up
+        template <class E, class B>
+        inline B exp_diff(const B& x, const B& m)
+        {
+            return E::apply(select(x == m, B(0.), x - m));
+        }
+
+        template <class T>
+        inline T max_sum_exp_tail(const T* x, std::size_t n, T m, T s, T& sum)
+        {
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                if (std::isnan(x[i]))
+                {
+                    sum = x[i];
+                    return x[i];
+                }
+                if (x[i] > m)
+                {
+                    s = (m == -std::numeric_limits<T>::infinity() ? T(0) : s * std::exp(m - x[i])) + T(1);
+                    m = x[i];
+                }
+                else if (m != -std::numeric_limits<T>::infinity())
+                {
+                    s += std::exp(x[i] - m);
+                }
+            }
+            sum = s;
+            return m;
+        }
+
+        // Streaming maximum / sum: each lane keeps its running maximum m and
+        // the sum s of exp(x - m); when a block raises the maximum, the sum is
+        // rescaled by exp(m_old - m_new). Blocks of four batches amortize the
+        // rescaling. Returns the maximum and stores the sum in sum, or NaN
+        // in both if an element is NaN: the max reduction and fast_exp
+        // would drop it, so the NaN lanes are tracked on the side.
+        template <class E, class T>
+        inline T max_sum_exp(const T* x, std::size_t n, T& sum, std::true_type)
+        {
+            using b_type = simd_type<T>;
+            constexpr std::size_t size = simd_traits<T>::size;
+            std::size_t vec_size = n - n % size;
+            std::size_t block_size = vec_size - vec_size % (4 * size);
+
+            T m = -std::numeric_limits<T>::infinity();
+            T s = T(0);
+            if (vec_size != 0)
+            {
+                b_type bm = load_unaligned(x);
+                b_type bs(0.);
+                simd_bool_type<T> bnan(false);
+                for (std::size_t i = 0; i < block_size; i += 4 * size)
+                {
+                    b_type x0 = load_unaligned(x + i);
+                    b_type x1 = load_unaligned(x + i + size);
+                    b_type x2 = load_unaligned(x + i + 2 * size);
+                    b_type x3 = load_unaligned(x + i + 3 * size);
+                    bnan = bnan || ((isnan(x0) || isnan(x1)) || (isnan(x2) || isnan(x3)));
+                    b_type nm = max(max(bm, max(x0, x1)), max(x2, x3));
+                    b_type e = (exp_diff<E>(x0, nm) + exp_diff<E>(x1, nm)) + (exp_diff<E>(x2, nm) + exp_diff<E>(x3, nm));
+                    bs = fma(bs, exp_diff<E>(bm, nm), e);
+                    bm = nm;
+                }
+                for (std::size_t i = block_size; i < vec_size; i += size)
+                {
+                    b_type bx = load_unaligned(x + i);
+                    bnan = bnan || isnan(bx);
+                    b_type nm = max(bm, bx);
+                    bs = fma(bs, exp_diff<E>(bm, nm), exp_diff<E>(bx, nm));
+                    bm = nm;
+                }
+
+                if (any(bnan))
+                {
+                    sum = std::numeric_limits<T>::quiet_NaN();
+                    return sum;
+                }
+
+                std::array<T, size> am, as;
+                bm.store_unaligned(am.data());
+                bs.store_unaligned(as.data());
+                for (std::size_t i = 0; i < size; ++i)
+                {
+                    m = am[i] > m ? am[i] : m;
+                }
+                if (m != -std::numeric_limits<T>::infinity())
+                {
+                    for (std::size_t i = 0; i < size; ++i)
+                    {
+                        s += as[i] * std::exp(am[i] - m);
+                    }
+                }
+            }
+            return max_sum_exp_tail(x + vec_size, n - vec_size, m, s, sum);
+        }
+
+        template <class E, class T>
+        inline T max_sum_exp(const T* x, std::size_t n, T& sum, std::false_type)
+        {
+            return max_sum_exp_tail(x, n, -std::numeric_limits<T>::infinity(), T(0), sum);
+        }
+
+        template <class E, class T>
+        inline T max_sum_exp(const T* x, std::size_t n, T& sum)
+        {
+            return max_sum_exp<E>(x, n, sum, std::integral_constant<bool, (simd_traits<T>::size > 1)>());
+        }
+
+        template <class E, class T>
+        inline T log_sum_exp_impl(const T* x, std::size_t n)
+        {
+            T sum;
+            T m = max_sum_exp<E>(x, n, sum);
+            if (std::isinf(m))
+            {
+                return m;
+            }
+            return m + std::log(sum);
+        }
+
+        template <class E, class T>
+        inline void softmax_scale(const T* x, std::size_t n, T* res, T m, T inv_sum, std::false_type)
+        {
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                res[i] = std::exp(x[i] - m) * inv_sum;
+            }
+        }
+
+        template <class E, class T>
+        inline void softmax_scale(const T* x, std::size_t n, T* res, T m, T inv_sum, std::true_type)
+        {
+            using b_type = simd_type<T>;
+            constexpr std::size_t size = simd_traits<T>::size;
+            std::size_t vec_size = n - n % size;
+            b_type bm(m), binv(inv_sum);
+            for (std::size_t i = 0; i < vec_size; i += size)
+            {
+                b_type bx = load_unaligned(x + i);
+                b_type r = E::apply(bx - bm) * binv;
+                r.store_unaligned(res + i);
+            }
+            softmax_scale<E>(x + vec_size, n - vec_size, res + vec_size, m, inv_sum, std::false_type());
+        }
+
+        template <class E, class T>
+        inline void softmax_impl(const T* x, std::size_t n, T* res)
+        {
+            T sum;
+            T m = max_sum_exp<E>(x, n, sum);
+            if (std::isnan(m) || m == -std::numeric_limits<T>::infinity())
+            {
+                std::fill(res, res + n, std::isnan(m) ? m : T(1) / T(n));
+                return;
+            }
+            softmax_scale<E>(x, n, res, m, T(1) / sum, std::integral_constant<bool, (simd_traits<T>::size > 1)>());
+        }
+    }
+
+    template <class T>
+    inline T log_sum_exp(const T* x, std::size_t n)
+    {
+        return detail::log_sum_exp_impl<detail::accurate_exp>(x, n);
+    }
+
+    template <class T>
+    inline T log_sum_exp(const T* x, std::size_t n, fast_approx_tag)
+    {
+        return detail::log_sum_exp_impl<detail::approx_exp>(x, n);
+    }
+
+    template <class T>
+    inline void softmax(const T* x, std::size_t n, T* res)
+    {
+        detail::softmax_impl<detail::accurate_exp>(x, n, res);
+    }
+
+    template <class T>
+    inline void softmax(const T* x, std::size_t n, T* res, fast_approx_tag)
+    {
+        detail::softmax_impl<detail::approx_exp>(x, n, res);
+    }
+}
+
+#endif
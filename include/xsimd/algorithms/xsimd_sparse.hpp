@@ -0,0 +1,769 @@
+/***************************************************************************
+* Copyright (c) 2016, Johan Mabille and Sylvain Corlay                     *
+*                                                                          *
+* Distributed under the terms of the BSD 3-Clause License.                 *
+*                                                                          *
+* The full license is in the file LICENSE, distributed with this software. *
+****************************************************************************/
+
+#ifndef XSIMD_SPARSE_HPP
+#define XSIMD_SPARSE_HPP
+
+#include <algorithm>
+#include <array>
+#include <cctype>
+#include <cstddef>
+#include <cstdint>
+#include <istream>
+#include <limits>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "../xsimd.hpp"
+
+namespace xsimd
+{
+    /**
+     * @class csr_matrix
+     * @brief Sparse matrix in the compressed sparse row format
+     *
+     * The nonzeros of the row i are stored at the positions
+     * [row_offsets[i], row_offsets[i + 1]) of the columns and values
+     * arrays. The product with a vector loads the values of a row by
+     * batches and gathers the matching elements of the vector; rows
+     * shorter than a batch are computed by the scalar loop.
+     *
+     * @tparam T the type of the values, float or double.
+     */
+    template <class T>
+    class csr_matrix
+    {
+    public:
+
+        static_assert(std::is_same<T, float>::value || std::is_same<T, double>::value,
+                      "csr_matrix requires float or double values");
+
+        using value_type = T;
+        using index_type = int32_t;
+        using size_type = std::size_t;
+
+        csr_matrix();
+        csr_matrix(size_type num_rows, size_type num_cols, std::vector<size_type> row_offsets,
+                   std::vector<index_type> columns, std::vector<T> values);
+
+        size_type num_rows() const noexcept;
+        size_type num_cols() const noexcept;
+        size_type num_nonzeros() const noexcept;
+
+        const size_type* row_offsets() const noexcept;
+        const index_type* columns() const noexcept;
+        const T* values() const noexcept;
+
+        void multiply(const T* x, T* y, size_type num_threads = 1) const;
+
+    private:
+
+        using simd_tag = std::integral_constant<bool, (simd_traits<T>::size > 1)>;
+
+        size_type m_num_rows;
+        size_type m_num_cols;
+        std::vector<size_type> m_row_offsets;
+        std::vector<index_type> m_columns;
+        std::vector<T> m_values;
+    };
+
+    /**
+     * @class sell_matrix
+     * @brief Sparse matrix in the SELL-C-sigma format
+     *
+     * The rows are grouped into chunks of C consecutive rows, C being the
+     * size of a batch of T, and each chunk is stored column by column,
+     * padded to its longest row: the k-th nonzeros of the C rows of a
+     * chunk are contiguous and aligned. The product with a vector thus
+     * computes the C rows of a chunk in the lanes of a single batch, with
+     * aligned loads of the values and of the column indices, and a gather
+     * of the elements of the vector.
+     *
+     * Before the chunks are formed, the rows are sorted by decreasing
+     * length within windows of sigma consecutive rows, so that the rows of
+     * a chunk have close lengths and the padding stays small; a sigma of 1
+     * keeps the original order. The sort only permutes the rows of the
+     * computation, the product is returned in the original order.
+     *
+     * @tparam T the type of the values, float or double.
+     */
+    template <class T>
+    class sell_matrix
+    {
+    public:
+
+        static_assert(std::is_same<T, float>::value || std::is_same<T, double>::value,
+                      "sell_matrix requires float or double values");
+
+        using value_type = T;
+        using index_type = int32_t;
+        using size_type = std::size_t;
+
+        static constexpr size_type chunk_size = simd_traits<T>::size;
+
+        sell_matrix();
+        explicit sell_matrix(const csr_matrix<T>& matrix, size_type sigma = 1);
+
+        size_type num_rows() const noexcept;
+        size_type num_cols() const noexcept;
+        size_type num_nonzeros() const noexcept;
+        size_type num_chunks() const noexcept;
+        size_type storage_size() const noexcept;
+        size_type sigma() const noexcept;
+
+        void multiply(const T* x, T* y, size_type num_threads = 1) const;
+
+    private:
+
+        using simd_tag = std::integral_constant<bool, (chunk_size > 1)>;
+
+        void multiply_chunks(size_type begin, size_type end, const T* x, T* y, std::true_type) const;
+        void multiply_chunks(size_type begin, size_type end, const T* x, T* y, std::false_type) const;
+
+        template <class V>
+        using aligned_vector = std::vector<V, aligned_allocator<V, detail::default_alignment>>;
+
+        size_type m_num_rows;
+        size_type m_num_cols;
+        size_type m_num_nonzeros;
+        size_type m_sigma;
+        // first stored element of each chunk, and number of leading
+        // columns of each chunk without padding
+        std::vector<size_type> m_chunk_offsets;
+        std::vector<size_type> m_chunk_full;
+        // original row and length of the row of each lane; the lanes past
+        // the last row have the row num_rows and the length 0
+        std::vector<size_type> m_rows;
+        aligned_vector<index_type> m_lengths;
+        aligned_vector<index_type> m_columns;
+        aligned_vector<T> m_values;
+    };
+
+    /**
+     * Reads a sparse matrix in the coordinate format of Matrix Market
+     * files, with real, integer or pattern entries and a general, symmetric
+     * or skew-symmetric structure. The entries of a symmetric matrix are
+     * mirrored, the duplicated entries are summed.
+     * @param in the input stream, positioned at the header line.
+     * @param res the matrix read, left unchanged on failure.
+     * @return false if the stream does not hold a supported Matrix Market
+     * coordinate matrix, or if its dimensions exceed INT32_MAX, true
+     * otherwise.
+     */
+    template <class T>
+    bool read_matrix_market(std::istream& in, csr_matrix<T>& res);
+
+    /******************************************
+     * sparse matrices implementation details *
+     ******************************************/
+
+    namespace detail
+    {
+        // the indices of the gathers have the width of the values
+        template <class T>
+        using sparse_index_t = typename std::conditional<sizeof(T) == 4, int32_t, int64_t>::type;
+
+        template <class T>
+        using sparse_index_batch = batch<sparse_index_t<T>, simd_traits<T>::size>;
+
+        template <class T>
+        inline T csr_row_dot(std::size_t n, const T* values, const int32_t* columns, const T* x, std::false_type)
+        {
+            T res = T(0);
+            for (std::size_t j = 0; j < n; ++j)
+            {
+                res += values[j] * x[columns[j]];
+            }
+            return res;
+        }
+
+        template <class T>
+        inline T csr_row_dot(std::size_t n, const T* values, const int32_t* columns, const T* x, std::true_type)
+        {
+            using b_type = batch<T, simd_traits<T>::size>;
+            using i_type = sparse_index_batch<T>;
+            constexpr std::size_t size = b_type::size;
+            if (n < size)
+            {
+                return csr_row_dot(n, values, columns, x, std::false_type());
+            }
+            b_type s0(T(0)), s1(T(0));
+            i_type i0, i1;
+            std::size_t j = 0;
+            for (; j + 2 * size <= n; j += 2 * size)
+            {
+                i0.load_unaligned(columns + j);
+                i1.load_unaligned(columns + j + size);
+                s0 = fma(b_type(values + j, unaligned_mode()), gather(x, i0), s0);
+                s1 = fma(b_type(values + j + size, unaligned_mode()), gather(x, i1), s1);
+            }
+            if (j + size <= n)
+            {
+                i0.load_unaligned(columns + j);
+                s0 = fma(b_type(values + j, unaligned_mode()), gather(x, i0), s0);
+                j += size;
+            }
+            T res = hadd(s0 + s1);
+            return res + csr_row_dot(n - j, values + j, columns + j, x, std::false_type());
+        }
+
+        // First index i in [first, n] such that offsets[i] + i * unit is not
+        // less than target
+        inline std::size_t sparse_partition_point(const std::size_t* offsets, std::size_t unit,
+                                                  std::size_t first, std::size_t n, std::size_t target)
+        {
+            std::size_t last = n;
+            while (first < last)
+            {
+                std::size_t middle = first + (last - first) / 2;
+                if (offsets[middle] + middle * unit < target)
+                {
+                    first = middle + 1;
+                }
+                else
+                {
+                    last = middle;
+                }
+            }
+            return first;
+        }
+
+        // Calls f(begin, end) on num_threads consecutive ranges of the n
+        // rows or chunks, of about the same cost: the stored elements given
+        // by the prefix sums offsets, plus unit per row or chunk for the
+        // store of the results. The calling thread computes the last range.
+        template <class F>
+        inline void sparse_parallel(std::size_t n, const std::size_t* offsets, std::size_t unit,
+                                    std::size_t num_threads, F f)
+        {
+            num_threads = std::max(std::size_t(1), std::min(num_threads, n));
+            std::size_t total = offsets[n] + n * unit;
+            std::vector<std::thread> threads;
+            std::size_t begin = 0;
+            for (std::size_t t = 0; t < num_threads; ++t)
+            {
+                std::size_t end = n;
+                if (t + 1 < num_threads)
+                {
+                    std::size_t target = static_cast<std::size_t>(static_cast<double>(total) * static_cast<double>(t + 1) / static_cast<double>(num_threads));
+                    end = sparse_partition_point(offsets, unit, begin, n, target);
+                }
+                if (t + 1 == num_threads)
+                {
+                    f(begin, end);
+                }
+                else
+                {
+                    threads.emplace_back(f, begin, end);
+                }
+                begin = end;
+            }
+            for (std::thread& thread : threads)
+            {
+                thread.join();
+            }
+        }
+
+        template <class T>
+        struct sparse_entry
+        {
+            std::size_t row;
+            int32_t column;
+            T value;
+        };
+
+        // Builds a CSR matrix from unordered entries: the entries are
+        // bucketed by row, sorted by column, and the duplicates summed
+        template <class T>
+        inline csr_matrix<T> csr_from_entries(std::size_t num_rows, std::size_t num_cols,
+                                              const std::vector<sparse_entry<T>>& entries)
+        {
+            std::vector<std::size_t> offsets(num_rows + 1, 0);
+            for (const sparse_entry<T>& e : entries)
+            {
+                ++offsets[e.row + 1];
+            }
+            for (std::size_t i = 0; i < num_rows; ++i)
+            {
+                offsets[i + 1] += offsets[i];
+            }
+            std::vector<std::pair<int32_t, T>> sorted(entries.size());
+            std::vector<std::size_t> next(offsets.begin(), offsets.end() - 1);
+            for (const sparse_entry<T>& e : entries)
+            {
+                sorted[next[e.row]++] = std::make_pair(e.column, e.value);
+            }
+            std::vector<std::size_t> row_offsets(num_rows + 1, 0);
+            std::vector<int32_t> columns;
+            std::vector<T> values;
+            columns.reserve(entries.size());
+            values.reserve(entries.size());
+            for (std::size_t i = 0; i < num_rows; ++i)
+            {
+                auto first = sorted.begin() + static_cast<std::ptrdiff_t>(offsets[i]);
+                auto last = sorted.begin() + static_cast<std::ptrdiff_t>(offsets[i + 1]);
+                std::sort(first, last, [](const std::pair<int32_t, T>& lhs, const std::pair<int32_t, T>& rhs)
+                {
+                    return lhs.first < rhs.first;
+                });
+                for (; first != last; ++first)
+                {
+                    if (columns.size() > row_offsets[i] && columns.back() == first->first)
+                    {
+                        values.back() += first->second;
+                    }
+                    else
+                    {
+                        columns.push_back(first->first);
+                        values.push_back(first->second);
+                    }
+                }
+                row_offsets[i + 1] = columns.size();
+            }
+            return csr_matrix<T>(num_rows, num_cols, std::move(row_offsets), std::move(columns), std::move(values));
+        }
+
+        inline std::string matrix_market_lower(std::string s)
+        {
+            for (char& c : s)
+            {
+                c = static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+            }
+            return s;
+        }
+    }
+
+    /*****************************
+     * csr_matrix implementation *
+     *****************************/
+
+    /**
+     * Constructs an empty 0 x 0 matrix.
+     */
+    template <class T>
+    inline csr_matrix<T>::csr_matrix()
+        : m_num_rows(0), m_num_cols(0), m_row_offsets(1, 0)
+    {
+    }
+
+    /**
+     * Constructs a matrix from its CSR arrays. The column indices must be
+     * in [0, num_cols); they need not be sorted within a row.
+     * @param num_rows the number of rows.
+     * @param num_cols the number of columns, at most the maximum of int32_t.
+     * @param row_offsets the num_rows + 1 offsets of the rows in the columns
+     * and values arrays, starting at 0.
+     * @param columns the column of each nonzero.
+     * @param values the value of each nonzero.
+     */
+    template <class T>
+    inline csr_matrix<T>::csr_matrix(size_type num_rows, size_type num_cols, std::vector<size_type> row_offsets,
+                                     std::vector<index_type> columns, std::vector<T> values)
+        : m_num_rows(num_rows), m_num_cols(num_cols), m_row_offsets(std::move(row_offsets)),
+          m_columns(std::move(columns)), m_values(std::move(values))
+    {
+    }
+
+    /**
+     * Returns the number of rows of the matrix.
+     */
+    template <class T>
+    inline auto csr_matrix<T>::num_rows() const noexcept -> size_type
+    {
+        return m_num_rows;
+    }
+
+    /**
+     * Returns the number of columns of the matrix.
+     */
+    template <class T>
+    inline auto csr_matrix<T>::num_cols() const noexcept -> size_type
+    {
+        return m_num_cols;
+    }
+
+    /**
+     * Returns the number of stored nonzeros of the matrix.
+     */
+    template <class T>
+    inline auto csr_matrix<T>::num_nonzeros() const noexcept -> size_type
+    {
+        return m_row_offsets[m_num_rows];
+    }
+
+    /**
+     * Returns a pointer to the num_rows + 1 row offsets.
+     */
+    template <class T>
+    inline auto csr_matrix<T>::row_offsets() const noexcept -> const size_type*
+    {
+        return m_row_offsets.data();
+    }
+
+    /**
+     * Returns a pointer to the column indices of the nonzeros.
+     */
+    template <class T>
+    inline auto csr_matrix<T>::columns() const noexcept -> const index_type*
+    {
+        return m_columns.data();
+    }
+
+    /**
+     * Returns a pointer to the values of the nonzeros.
+     */
+    template <class T>
+    inline const T* csr_matrix<T>::values() const noexcept
+    {
+        return m_values.data();
+    }
+
+    /**
+     * Computes y = A * x. The rows are split into ranges of about the same
+     * number of nonzeros, computed by independent threads.
+     * @param x pointer to the num_cols elements of x.
+     * @param y pointer to the num_rows elements of y, which must not
+     * overlap x.
+     * @param num_threads the number of threads; the calling thread
+     * computes one of the ranges.
+     */
+    template <class T>
+    inline void csr_matrix<T>::multiply(const T* x, T* y, size_type num_threads) const
+    {
+        const size_type* offsets = m_row_offsets.data();
+        const index_type* columns = m_columns.data();
+        const T* values = m_values.data();
+        detail::sparse_parallel(m_num_rows, offsets, 1, num_threads, [=](size_type begin, size_type end)
+        {
+            for (size_type i = begin; i < end; ++i)
+            {
+                y[i] = detail::csr_row_dot(offsets[i + 1] - offsets[i], values + offsets[i],
+                                           columns + offsets[i], x, simd_tag());
+            }
+        });
+    }
+
+    /******************************
+     * sell_matrix implementation *
+     ******************************/
+
+    template <class T>
+    constexpr typename sell_matrix<T>::size_type sell_matrix<T>::chunk_size;
+
+    /**
+     * Constructs an empty 0 x 0 matrix.
+     */
+    template <class T>
+    inline sell_matrix<T>::sell_matrix()
+        : m_num_rows(0), m_num_cols(0), m_num_nonzeros(0), m_sigma(1), m_chunk_offsets(1, 0)
+    {
+    }
+
+    /**
+     * Converts a CSR matrix to the SELL-C-sigma format.
+     * @param matrix the matrix to convert.
+     * @param sigma the number of consecutive rows sorted by length before
+     * forming the chunks; a multiple of chunk_size keeps the chunks within
+     * a single window.
+     */
+    template <class T>
+    inline sell_matrix<T>::sell_matrix(const csr_matrix<T>& matrix, size_type sigma)
+        : m_num_rows(matrix.num_rows()), m_num_cols(matrix.num_cols()),
+          m_num_nonzeros(matrix.num_nonzeros()), m_sigma(std::max(size_type(1), sigma))
+    {
+        const size_type* offsets = matrix.row_offsets();
+        auto length = [offsets](size_type i) { return offsets[i + 1] - offsets[i]; };
+
+        size_type num_chunks = (m_num_rows + chunk_size - 1) / chunk_size;
+        m_rows.resize(num_chunks * chunk_size, m_num_rows);
+        for (size_type i = 0; i < m_num_rows; ++i)
+        {
+            m_rows[i] = i;
+        }
+        for (size_type first = 0; m_sigma > 1 && first < m_num_rows; first += m_sigma)
+        {
+            auto window = m_rows.begin() + static_cast<std::ptrdiff_t>(first);
+            std::stable_sort(window, window + static_cast<std::ptrdiff_t>(std::min(m_sigma, m_num_rows - first)),
+                             [&length](size_type lhs, size_type rhs) { return length(lhs) > length(rhs); });
+        }
+
+        m_lengths.resize(num_chunks * chunk_size, 0);
+        m_chunk_offsets.resize(num_chunks + 1, 0);
+        m_chunk_full.resize(num_chunks, 0);
+        for (size_type c = 0; c < num_chunks; ++c)
+        {
+            size_type width = 0, full = std::numeric_limits<size_type>::max();
+            for (size_type l = 0; l < chunk_size; ++l)
+            {
+                size_type row = m_rows[c * chunk_size + l];
+                size_type len = row < m_num_rows ? length(row) : 0;
+                m_lengths[c * chunk_size + l] = static_cast<index_type>(len);
+                width = std::max(width, len);
+                full = std::min(full, len);
+            }
+            m_chunk_full[c] = full;
+            m_chunk_offsets[c + 1] = m_chunk_offsets[c] + width * chunk_size;
+        }
+
+        // the padding repeats the last column of the row, or the first
+        // column for an empty row, with a zero value
+        m_columns.resize(m_chunk_offsets[num_chunks]);
+        m_values.resize(m_chunk_offsets[num_chunks]);
+        for (size_type c = 0; c < num_chunks; ++c)
+        {
+            size_type width = (m_chunk_offsets[c + 1] - m_chunk_offsets[c]) / chunk_size;
+            for (size_type l = 0; l < chunk_size; ++l)
+            {
+                size_type row = m_rows[c * chunk_size + l];
+                size_type len = static_cast<size_type>(m_lengths[c * chunk_size + l]);
+                const index_type* columns = len > 0 ? matrix.columns() + offsets[row] : nullptr;
+                const T* values = len > 0 ? matrix.values() + offsets[row] : nullptr;
+                for (size_type k = 0; k < width; ++k)
+                {
+                    size_type pos = m_chunk_offsets[c] + k * chunk_size + l;
+                    m_columns[pos] = k < len ? columns[k] : (len > 0 ? columns[len - 1] : 0);
+                    m_values[pos] = k < len ? values[k] : T(0);
+                }
+            }
+        }
+    }
+
+    /**
+     * Returns the number of rows of the matrix.
+     */
+    template <class T>
+    inline auto sell_matrix<T>::num_rows() const noexcept -> size_type
+    {
+        return m_num_rows;
+    }
+
+    /**
+     * Returns the number of columns of the matrix.
+     */
+    template <class T>
+    inline auto sell_matrix<T>::num_cols() const noexcept -> size_type
+    {
+        return m_num_cols;
+    }
+
+    /**
+     * Returns the number of nonzeros of the matrix, without the padding.
+     */
+    template <class T>
+    inline auto sell_matrix<T>::num_nonzeros() const noexcept -> size_type
+    {
+        return m_num_nonzeros;
+    }
+
+    /**
+     * Returns the number of chunks of chunk_size rows.
+     */
+    template <class T>
+    inline auto sell_matrix<T>::num_chunks() const noexcept -> size_type
+    {
+        return m_chunk_offsets.size() - 1;
+    }
+
+    /**
+     * Returns the number of stored elements, padding included.
+     */
+    template <class T>
+    inline auto sell_matrix<T>::storage_size() const noexcept -> size_type
+    {
+        return m_chunk_offsets.back();
+    }
+
+    /**
+     * Returns the size of the windows of rows sorted by length.
+     */
+    template <class T>
+    inline auto sell_matrix<T>::sigma() const noexcept -> size_type
+    {
+        return m_sigma;
+    }
+
+    /**
+     * Computes y = A * x. The chunks are split into ranges of about the
+     * same number of stored elements, computed by independent threads.
+     * @param x pointer to the num_cols elements of x.
+     * @param y pointer to the num_rows elements of y, which must not
+     * overlap x.
+     * @param num_threads the number of threads; the calling thread
+     * computes one of the ranges.
+     */
+    template <class T>
+    inline void sell_matrix<T>::multiply(const T* x, T* y, size_type num_threads) const
+    {
+        detail::sparse_parallel(num_chunks(), m_chunk_offsets.data(), chunk_size, num_threads,
+                                [this, x, y](size_type begin, size_type end)
+        {
+            multiply_chunks(begin, end, x, y, simd_tag());
+        });
+    }
+
+    template <class T>
+    inline void sell_matrix<T>::multiply_chunks(size_type begin, size_type end, const T* x, T* y, std::false_type) const
+    {
+        for (size_type c = begin; c < end; ++c)
+        {
+            const T* values = m_values.data() + m_chunk_offsets[c];
+            const index_type* columns = m_columns.data() + m_chunk_offsets[c];
+            for (size_type l = 0; l < chunk_size; ++l)
+            {
+                size_type row = m_rows[c * chunk_size + l];
+                if (row < m_num_rows)
+                {
+                    size_type len = static_cast<size_type>(m_lengths[c * chunk_size + l]);
+                    T res = T(0);
+                    for (size_type k = 0; k < len; ++k)
+                    {
+                        res += values[k * chunk_size + l] * x[columns[k * chunk_size + l]];
+                    }
+                    y[row] = res;
+                }
+            }
+        }
+    }
+
+    template <class T>
+    inline void sell_matrix<T>::multiply_chunks(size_type begin, size_type end, const T* x, T* y, std::true_type) const
+    {
+        using b_type = batch<T, chunk_size>;
+        using i_type = detail::sparse_index_batch<T>;
+        using i_value = detail::sparse_index_t<T>;
+        for (size_type c = begin; c < end; ++c)
+        {
+            const T* values = m_values.data() + m_chunk_offsets[c];
+            const index_type* columns = m_columns.data() + m_chunk_offsets[c];
+            size_type width = (m_chunk_offsets[c + 1] - m_chunk_offsets[c]) / chunk_size;
+            size_type full = m_chunk_full[c];
+            b_type s0(T(0)), s1(T(0));
+            i_type i0, i1;
+            size_type k = 0;
+            for (; k + 2 <= full; k += 2)
+            {
+                i0.load_aligned(columns + k * chunk_size);
+                i1.load_aligned(columns + (k + 1) * chunk_size);
+                s0 = fma(b_type(values + k * chunk_size, aligned_mode()), gather(x, i0), s0);
+                s1 = fma(b_type(values + (k + 1) * chunk_size, aligned_mode()), gather(x, i1), s1);
+            }
+            if (k < full)
+            {
+                i0.load_aligned(columns + k * chunk_size);
+                s0 = fma(b_type(values + k * chunk_size, aligned_mode()), gather(x, i0), s0);
+                ++k;
+            }
+            if (k < width)
+            {
+                // the padding lanes are masked out rather than multiplied
+                // by zero, which would turn an infinite x into a NaN
+                i_type lengths;
+                lengths.load_aligned(m_lengths.data() + c * chunk_size);
+                for (; k < width; ++k)
+                {
+                    i0.load_aligned(columns + k * chunk_size);
+                    auto mask = bool_cast(i_type(static_cast<i_value>(k)) < lengths);
+                    s0 = fma(b_type(values + k * chunk_size, aligned_mode()), select(mask, gather(x, i0), b_type(T(0))), s0);
+                }
+            }
+            s0 += s1;
+
+            const size_type* rows = m_rows.data() + c * chunk_size;
+            if (m_sigma == 1 && (c + 1) * chunk_size <= m_num_rows)
+            {
+                s0.store_unaligned(y + c * chunk_size);
+            }
+            else
+            {
+                std::array<T, chunk_size> res;
+                s0.store_unaligned(res.data());
+                for (size_type l = 0; l < chunk_size; ++l)
+                {
+                    if (rows[l] < m_num_rows)
+                    {
+                        y[rows[l]] = res[l];
+                    }
+                }
+            }
+        }
+    }
+
+    /*************************************
+     * read_matrix_market implementation *
+     *************************************/
+
+    template <class T>
+    inline bool read_matrix_market(std::istream& in, csr_matrix<T>& res)
+    {
+        std::string line;
+        if (!std::getline(in, line))
+        {
+            return false;
+        }
+        std::istringstream header(detail::matrix_market_lower(line));
+        std::string banner, object, format, field, symmetry;
+        header >> banner >> object >> format >> field >> symmetry;
+        bool pattern = field == "pattern";
+        bool symmetric = symmetry == "symmetric";
+        bool skew = symmetry == "skew-symmetric";
+        if (banner != "%%matrixmarket" || object != "matrix" || format != "coordinate" ||
+            (field != "real" && field != "double" && field != "integer" && !pattern) ||
+            (symmetry != "general" && !symmetric && !skew))
+        {
+            return false;
+        }
+
+        // comment lines start with a '%', the size line follows them
+        while (std::getline(in, line) && (line.empty() || line[0] == '%'))
+        {
+        }
+        std::istringstream size_line(line);
+        std::size_t num_rows = 0, num_cols = 0, num_entries = 0;
+        // the dimensions of the header are not trusted either: they are
+        // bounded like the int32 column indices
+        const std::size_t max_dimension = static_cast<std::size_t>(std::numeric_limits<int32_t>::max());
+        if (!(size_line >> num_rows >> num_cols >> num_entries) ||
+            num_rows > max_dimension || num_cols > max_dimension)
+        {
+            return false;
+        }
+
+        // the number of entries of the header is not trusted, the vector
+        // grows past the reservation as the entries are actually read
+        std::size_t reserved = std::min(num_entries, std::size_t(1) << 20);
+        std::vector<detail::sparse_entry<T>> entries;
+        entries.reserve(symmetric || skew ? 2 * reserved : reserved);
+        for (std::size_t e = 0; e < num_entries; ++e)
+        {
+            std::size_t i = 0, j = 0;
+            double value = 1.;
+            if (!(in >> i >> j) || (!pattern && !(in >> value)) ||
+                i == 0 || i > num_rows || j == 0 || j > num_cols)
+            {
+                return false;
+            }
+            entries.push_back({ i - 1, static_cast<int32_t>(j - 1), static_cast<T>(value) });
+            if ((symmetric || skew) && i != j)
+            {
+                if (j > num_rows || i > num_cols)
+                {
+                    return false;
+                }
+                entries.push_back({ j - 1, static_cast<int32_t>(i - 1), static_cast<T>(skew ? -value : value) });
+            }
+        }
+        res = detail::csr_from_entries(num_rows, num_cols, entries);
+        return true;
+    }
+}
+
+#endif
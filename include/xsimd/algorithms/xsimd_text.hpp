@@ -0,0 +1,368 @@
+/***************************************************************************
+* Copyright (c) 2016, Johan Mabille and Sylvain Corlay                     *
+*                                                                          *
+* Distributed under the terms of the BSD 3-Clause License.                 *
+*                                                                          *
+* The full license is in the file LICENSE, distributed with this software. *
+****************************************************************************/
+
+#ifndef XSIMD_TEXT_HPP
+#define XSIMD_TEXT_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#include "xsimd_bitmap.hpp"
+#include "xsimd_byte_kernel.hpp"
+
+namespace xsimd
+{
+    /**
+     * Returns true if the \c n bytes of \c data are ASCII characters,
+     * i.e. lower than 0x80.
+     */
+    bool is_ascii(const char* data, std::size_t n);
+
+    /**
+     * Returns true if the \c n bytes of \c data are a valid UTF-8 string:
+     * no truncated or overlong sequences, no surrogates and no code points
+     * above U+10FFFF.
+     */
+    bool is_valid_utf8(const char* data, std::size_t n);
+
+    namespace detail
+    {
+        struct char_class_kernel;
+    }
+
+    /**
+     * @class char_class
+     * @brief Set of bytes classified by char_class_bitmap.
+     *
+     * A char_class can hold any subset of the 256 byte values, for
+     * instance the delimiters, quotes or white spaces of a text format.
+     */
+    class char_class
+    {
+    public:
+
+        char_class();
+        explicit char_class(const char* chars);
+        char_class(const char* chars, std::size_t n);
+
+        char_class& add(char c);
+        bool contains(char c) const;
+
+    private:
+
+        // row of the low nibble, bit h % 8 set if the byte with high
+        // nibble h belongs to the class
+        std::array<uint8_t, 16> m_ascii_rows;
+        std::array<uint8_t, 16> m_high_rows;
+
+        friend struct detail::char_class_kernel;
+    };
+
+    /**
+     * Sets the bit i of \c bitmap if the byte \c data[i] belongs to
+     * \c cls. The bitmap has the format of the bitmap_* functions.
+     * @param data pointer to the bytes.
+     * @param n number of bytes.
+     * @param cls the class of bytes to look for.
+     * @param bitmap pointer to the (n + 63) / 64 words of the result.
+     * @return the number of bytes belonging to the class.
+     */
+    std::size_t char_class_bitmap(const char* data, std::size_t n, const char_class& cls, uint64_t* bitmap);
+
+    /******************
+     * implementation *
+     ******************/
+
+    namespace detail
+    {
+        // Lookup UTF-8 validation, after Keiser and Lemire, "Validating
+        // UTF-8 In Less Than One Instruction Per Byte". The error bits of
+        // a pair of consecutive bytes are looked up from the high and low
+        // nibbles of the first byte and the high nibble of the second one.
+        struct utf8_checker
+        {
+            static constexpr uint8_t too_short = 1 << 0;
+            static constexpr uint8_t too_long = 1 << 1;
+            static constexpr uint8_t overlong_3 = 1 << 2;
+            static constexpr uint8_t too_large = 1 << 3;
+            static constexpr uint8_t surrogate = 1 << 4;
+            static constexpr uint8_t overlong_2 = 1 << 5;
+            static constexpr uint8_t too_large_1000 = 1 << 6;
+            static constexpr uint8_t overlong_4 = 1 << 6;
+            static constexpr uint8_t two_conts = 1 << 7;
+            static constexpr uint8_t carry = too_short | too_long | two_conts;
+
+            byte_reg byte_1_high;
+            byte_reg byte_1_low;
+            byte_reg byte_2_high;
+            byte_reg low_nibble;
+            byte_reg third_byte;
+            byte_reg fourth_byte;
+            byte_reg high_bit;
+            byte_reg incomplete_max;
+
+            byte_reg error;
+            byte_reg prev_input;
+            byte_reg prev_incomplete;
+
+            utf8_checker()
+            {
+                static const uint8_t byte_1_high_table[16] = {
+                    // 0___ ASCII
+                    too_long, too_long, too_long, too_long, too_long, too_long, too_long, too_long,
+                    // 10__ continuation
+                    two_conts, two_conts, two_conts, two_conts,
+                    // 1100 two bytes lead
+                    too_short | overlong_2,
+                    // 1101 two bytes lead
+                    too_short,
+                    // 1110 three bytes lead
+                    too_short | overlong_3 | surrogate,
+                    // 1111 four bytes lead
+                    too_short | too_large | too_large_1000 | overlong_4
+                };
+                static const uint8_t byte_1_low_table[16] = {
+                    carry | overlong_3 | overlong_2 | overlong_4,
+                    carry | overlong_2,
+                    carry,
+                    carry,
+                    carry | too_large,
+                    carry | too_large | too_large_1000,
+                    carry | too_large | too_large_1000,
+                    carry | too_large | too_large_1000,
+                    carry | too_large | too_large_1000,
+                    carry | too_large | too_large_1000,
+                    carry | too_large | too_large_1000,
+                    carry | too_large | too_large_1000,
+                    carry | too_large | too_large_1000,
+                    carry | too_large | too_large_1000 | surrogate,
+                    carry | too_large | too_large_1000,
+                    carry | too_large | too_large_1000
+                };
+                static const uint8_t byte_2_high_table[16] = {
+                    // 0___ ASCII
+                    too_short, too_short, too_short, too_short, too_short, too_short, too_short, too_short,
+                    // 1000
+                    too_long | overlong_2 | two_conts | overlong_3 | too_large_1000 | overlong_4,
+                    // 1001
+                    too_long | overlong_2 | two_conts | overlong_3 | too_large,
+                    // 101_
+                    too_long | overlong_2 | two_conts | surrogate | too_large,
+                    too_long | overlong_2 | two_conts | surrogate | too_large,
+                    // 11__ lead
+                    too_short, too_short, too_short, too_short
+                };
+                // a block is incomplete if one of its last three bytes
+                // starts a sequence ending in the next block
+                alignas(64) static const uint8_t incomplete_table[64] = {
+                    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+                    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+                    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+                    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+                    0xf0 - 1, 0xe0 - 1, 0xc0 - 1
+                };
+                byte_1_high = byte_kernel::table16(byte_1_high_table);
+                byte_1_low = byte_kernel::table16(byte_1_low_table);
+                byte_2_high = byte_kernel::table16(byte_2_high_table);
+                low_nibble = byte_kernel::splat(0x0f);
+                // saturating subtractions leaving the high bit set only
+                // for the bytes greater than or equal to 0xe0 or 0xf0
+                third_byte = byte_kernel::splat(0xe0 - 0x80);
+                fourth_byte = byte_kernel::splat(0xf0 - 0x80);
+                high_bit = byte_kernel::splat(0x80);
+                incomplete_max = byte_kernel::load(incomplete_table + 64 - byte_kernel::size);
+
+                error = byte_kernel::splat(0);
+                prev_input = error;
+                prev_incomplete = error;
+            }
+
+            inline void check(const byte_reg& input)
+            {
+                if (byte_kernel::movemask(input) == 0)
+                {
+                    error = byte_kernel::bitwise_or(error, prev_incomplete);
+                    prev_incomplete = byte_kernel::splat(0);
+                }
+                else
+                {
+                    byte_reg prev1 = byte_kernel::prev<1>(input, prev_input);
+                    byte_reg sc = byte_kernel::lookup16(byte_1_high, byte_kernel::shr4(prev1));
+                    sc = byte_kernel::bitwise_and(sc, byte_kernel::lookup16(byte_1_low, byte_kernel::bitwise_and(prev1, low_nibble)));
+                    sc = byte_kernel::bitwise_and(sc, byte_kernel::lookup16(byte_2_high, byte_kernel::shr4(input)));
+
+                    // the third and fourth bytes of a sequence are
+                    // continuations, which the pairs alone can't tell
+                    byte_reg prev2 = byte_kernel::prev<2>(input, prev_input);
+                    byte_reg prev3 = byte_kernel::prev<3>(input, prev_input);
+                    byte_reg must23 = byte_kernel::bitwise_or(byte_kernel::subs(prev2, third_byte),
+                                                              byte_kernel::subs(prev3, fourth_byte));
+                    must23 = byte_kernel::bitwise_and(must23, high_bit);
+                    error = byte_kernel::bitwise_or(error, byte_kernel::bitwise_xor(must23, sc));
+                    prev_incomplete = byte_kernel::subs(input, incomplete_max);
+                }
+                prev_input = input;
+            }
+
+            inline bool finish()
+            {
+                return !byte_kernel::any(byte_kernel::bitwise_or(error, prev_incomplete));
+            }
+        };
+
+        // For the class rows of the byte x, the bit (x >> 4) % 8 of the
+        // row of x & 0x0f
+        struct char_class_kernel
+        {
+            byte_reg ascii_rows;
+            byte_reg high_rows;
+            byte_reg ascii_bits;
+            byte_reg high_bits;
+            byte_reg low_nibble;
+            byte_reg zero;
+
+            explicit char_class_kernel(const char_class& cls)
+            {
+                static const uint8_t ascii_bits_table[16] = { 1, 2, 4, 8, 16, 32, 64, 128, 0, 0, 0, 0, 0, 0, 0, 0 };
+                static const uint8_t high_bits_table[16] = { 0, 0, 0, 0, 0, 0, 0, 0, 1, 2, 4, 8, 16, 32, 64, 128 };
+                ascii_rows = byte_kernel::table16(cls.m_ascii_rows.data());
+                high_rows = byte_kernel::table16(cls.m_high_rows.data());
+                ascii_bits = byte_kernel::table16(ascii_bits_table);
+                high_bits = byte_kernel::table16(high_bits_table);
+                low_nibble = byte_kernel::splat(0x0f);
+                zero = byte_kernel::splat(0);
+            }
+
+            // bit i of the result is set if the byte i does not belong to the class
+            inline uint64_t outside(const byte_reg& x) const
+            {
+                byte_reg lo = byte_kernel::bitwise_and(x, low_nibble);
+                byte_reg hi = byte_kernel::shr4(x);
+                byte_reg ascii = byte_kernel::bitwise_and(byte_kernel::lookup16(ascii_rows, lo), byte_kernel::lookup16(ascii_bits, hi));
+                byte_reg high = byte_kernel::bitwise_and(byte_kernel::lookup16(high_rows, lo), byte_kernel::lookup16(high_bits, hi));
+                return byte_kernel::movemask(byte_kernel::eq(byte_kernel::bitwise_or(ascii, high), zero));
+            }
+        };
+    }
+
+    inline bool is_ascii(const char* data, std::size_t n)
+    {
+        using kernel = detail::byte_kernel;
+        constexpr std::size_t size = kernel::size;
+        const uint8_t* src = detail::as_bytes(data);
+        std::size_t i = 0;
+        for (; i + 4 * size <= n; i += 4 * size)
+        {
+            detail::byte_reg acc = kernel::bitwise_or(kernel::bitwise_or(kernel::load(src + i), kernel::load(src + i + size)),
+                                                      kernel::bitwise_or(kernel::load(src + i + 2 * size), kernel::load(src + i + 3 * size)));
+            if (kernel::movemask(acc) != 0)
+            {
+                return false;
+            }
+        }
+        uint8_t acc = 0;
+        for (; i < n; ++i)
+        {
+            acc |= src[i];
+        }
+        return acc < 0x80;
+    }
+
+    inline bool is_valid_utf8(const char* data, std::size_t n)
+    {
+        using kernel = detail::byte_kernel;
+        constexpr std::size_t size = kernel::size;
+        const uint8_t* src = detail::as_bytes(data);
+        detail::utf8_checker checker;
+        std::size_t i = 0;
+        for (; i + size <= n; i += size)
+        {
+            checker.check(kernel::load(src + i));
+        }
+        // the zeros following the tail are ASCII characters, they end any
+        // sequence still open
+        if (i < n)
+        {
+            checker.check(detail::load_partial(src + i, n - i));
+        }
+        return checker.finish();
+    }
+
+    inline char_class::char_class()
+    {
+        m_ascii_rows.fill(0);
+        m_high_rows.fill(0);
+    }
+
+    inline char_class::char_class(const char* chars)
+        : char_class(chars, std::strlen(chars))
+    {
+    }
+
+    inline char_class::char_class(const char* chars, std::size_t n)
+        : char_class()
+    {
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            add(chars[i]);
+        }
+    }
+
+    inline char_class& char_class::add(char c)
+    {
+        uint8_t x = static_cast<uint8_t>(c);
+        std::array<uint8_t, 16>& rows = x < 0x80 ? m_ascii_rows : m_high_rows;
+        rows[x & 0x0f] |= static_cast<uint8_t>(1 << ((x >> 4) & 7));
+        return *this;
+    }
+
+    inline bool char_class::contains(char c) const
+    {
+        uint8_t x = static_cast<uint8_t>(c);
+        const std::array<uint8_t, 16>& rows = x < 0x80 ? m_ascii_rows : m_high_rows;
+        return ((rows[x & 0x0f] >> ((x >> 4) & 7)) & 1) != 0;
+    }
+
+    inline std::size_t char_class_bitmap(const char* data, std::size_t n, const char_class& cls, uint64_t* bitmap)
+    {
+        using kernel = detail::byte_kernel;
+        constexpr std::size_t size = kernel::size;
+        const uint8_t* src = detail::as_bytes(data);
+        const detail::char_class_kernel classifier(cls);
+        std::size_t count = 0;
+        std::size_t i = 0;
+        for (; i + 64 <= n; i += 64)
+        {
+            uint64_t outside = 0;
+            for (std::size_t j = 0; j < 64; j += size)
+            {
+                outside |= classifier.outside(kernel::load(src + i + j)) << j;
+            }
+            bitmap[i / 64] = ~outside;
+            count += detail::scalar_popcount(~outside);
+        }
+        if (i < n)
+        {
+            uint64_t outside = 0;
+            for (std::size_t j = 0; i + j < n; j += size)
+            {
+                std::size_t m = n - i - j;
+                kernel::reg x = m >= size ? kernel::load(src + i + j) : detail::load_partial(src + i + j, m);
+                outside |= classifier.outside(x) << j;
+            }
+            uint64_t word = ~outside & detail::bitmap_tail_mask(n);
+            bitmap[i / 64] = word;
+            count += detail::scalar_popcount(word);
+        }
+        return count;
+    }
+}
+
+#endif
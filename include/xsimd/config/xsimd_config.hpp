@@ -27,4 +27,32 @@
     #define XSIMD_STACK_ALLOCATION_LIMIT 20000
 #endif
 
+// Polynomial evaluation scheme selection (see xsimd_horner.hpp): polynomials
+// up to XSIMD_HORNER_MAX_DEGREE are evaluated with the Horner scheme, those of
+// degree XSIMD_ESTRIN_MIN_DEGREE and above with the Estrin scheme, the others
+// with a second order Horner scheme (even and odd parts evaluated in x^2).
+// Without hardware fma, each Horner step costs a multiplication and an addition
+// on the critical path, so the switch happens earlier.
+#if XSIMD_X86_INSTR_SET >= XSIMD_X86_FMA3_VERSION || XSIMD_X86_AMD_INSTR_SET >= XSIMD_X86_AMD_FMA4_VERSION || XSIMD_ARM_INSTR_SET >= XSIMD_ARM8_64_NEON_VERSION
+    #define XSIMD_HAS_HARDWARE_FMA 1
+#else
+    #define XSIMD_HAS_HARDWARE_FMA 0
+#endif
+
+#ifndef XSIMD_HORNER_MAX_DEGREE
+    #if XSIMD_HAS_HARDWARE_FMA
+        #define XSIMD_HORNER_MAX_DEGREE 4
+    #else
+        #define XSIMD_HORNER_MAX_DEGREE 3
+    #endif
+#endif
+
+#ifndef XSIMD_ESTRIN_MIN_DEGREE
+    #if XSIMD_HAS_HARDWARE_FMA
+        #define XSIMD_ESTRIN_MIN_DEGREE 8
+    #else
+        #define XSIMD_ESTRIN_MIN_DEGREE 6
+    #endif
+#endif
+
 #endif
@@ -0,0 +1,144 @@
+/***************************************************************************
+* Copyright (c) 2016, Johan Mabille and Sylvain Corlay                     *
+*                                                                          *
+* Distributed under the terms of the BSD 3-Clause License.                 *
+*                                                                          *
+* The full license is in the file LICENSE, distributed with this software. *
+****************************************************************************/
+
+#ifndef XSIMD_DENORMAL_HPP
+#define XSIMD_DENORMAL_HPP
+
+#include <cstdint>
+
+#include "xsimd_include.hpp"
+
+#if XSIMD_X86_INSTR_SET >= XSIMD_X86_SSE2_VERSION
+    #define XSIMD_DENORMAL_CONTROL_MXCSR
+#elif XSIMD_ARM_INSTR_SET >= XSIMD_ARM8_64_NEON_VERSION && defined(__GNUC__)
+    #define XSIMD_DENORMAL_CONTROL_FPCR
+#elif XSIMD_ARM_INSTR_SET >= XSIMD_ARM7_NEON_VERSION && defined(__GNUC__)
+    #define XSIMD_DENORMAL_CONTROL_FPSCR
+#endif
+
+namespace xsimd
+{
+    /**
+     * @class denormal_guard
+     * @brief Scoped flush-to-zero / denormals-are-zero mode
+     *
+     * Arithmetic on denormal (subnormal) numbers is 10 to 100 times slower
+     * than on normal numbers on most x86 processors. A denormal_guard sets
+     * the floating point unit of the current thread in a mode where denormal
+     * results are flushed to zero and denormal inputs are read as zero, and
+     * restores the previous mode when it goes out of scope:
+     *
+     * - the FTZ and DAZ bits of MXCSR on x86,
+     * - the FZ bit of FPCR on ARMv8 64 bits, of FPSCR on ARMv7 and ARMv8 32
+     *   bits, which covers both inputs and results.
+     *
+     * On other targets the guard does nothing, see is_supported. Scalar
+     * code compiled to SSE, as on x86-64, is affected as well, x87 code is
+     * not. Under this mode, the math functions return the same results
+     * for normal inputs whose result is normal; denormal inputs behave as
+     * zeros of the same sign, denormal results are flushed to zero.
+     */
+    class denormal_guard
+    {
+    public:
+
+        denormal_guard() noexcept;
+        ~denormal_guard();
+
+        denormal_guard(const denormal_guard&) = delete;
+        denormal_guard& operator=(const denormal_guard&) = delete;
+
+        static constexpr bool is_supported() noexcept;
+
+    private:
+
+#if defined(XSIMD_DENORMAL_CONTROL_MXCSR)
+        unsigned int m_state;
+#elif defined(XSIMD_DENORMAL_CONTROL_FPCR)
+        uint64_t m_state;
+#elif defined(XSIMD_DENORMAL_CONTROL_FPSCR)
+        uint32_t m_state;
+#endif
+    };
+
+    /*********************************
+     * denormal_guard implementation *
+     *********************************/
+
+    namespace detail
+    {
+        // MXCSR: flush-to-zero is bit 15, denormals-are-zero bit 6.
+        // FPCR / FPSCR: flush-to-zero is bit 24.
+        constexpr unsigned int mxcsr_ftz_daz = 0x8040u;
+        constexpr uint32_t fpcr_fz = uint32_t(1) << 24;
+    }
+
+    /**
+     * Enables the flush-to-zero and denormals-are-zero modes, and saves
+     * the previous mode.
+     */
+    inline denormal_guard::denormal_guard() noexcept
+    {
+#if defined(XSIMD_DENORMAL_CONTROL_MXCSR)
+        m_state = _mm_getcsr();
+        _mm_setcsr(m_state | detail::mxcsr_ftz_daz);
+#elif defined(XSIMD_DENORMAL_CONTROL_FPCR)
+        __asm__ __volatile__("mrs %0, fpcr"
+                             : "=r"(m_state));
+        uint64_t state = m_state | detail::fpcr_fz;
+        __asm__ __volatile__("msr fpcr, %0"
+                             :
+                             : "r"(state));
+#elif defined(XSIMD_DENORMAL_CONTROL_FPSCR)
+        __asm__ __volatile__("vmrs %0, fpscr"
+                             : "=r"(m_state));
+        uint32_t state = m_state | detail::fpcr_fz;
+        __asm__ __volatile__("vmsr fpscr, %0"
+                             :
+                             : "r"(state));
+#endif
+    }
+
+    /**
+     * Restores the mode saved by the constructor.
+     */
+    inline denormal_guard::~denormal_guard()
+    {
+#if defined(XSIMD_DENORMAL_CONTROL_MXCSR)
+        // only the two bits, so that exception flags raised in the scope are kept
+        _mm_setcsr((_mm_getcsr() & ~detail::mxcsr_ftz_daz) | (m_state & detail::mxcsr_ftz_daz));
+#elif defined(XSIMD_DENORMAL_CONTROL_FPCR)
+        __asm__ __volatile__("msr fpcr, %0"
+                             :
+                             : "r"(m_state));
+#elif defined(XSIMD_DENORMAL_CONTROL_FPSCR)
+        uint32_t state;
+        __asm__ __volatile__("vmrs %0, fpscr"
+                             : "=r"(state));
+        state = (state & ~detail::fpcr_fz) | (m_state & detail::fpcr_fz);
+        __asm__ __volatile__("vmsr fpscr, %0"
+                             :
+                             : "r"(state));
+#endif
+    }
+
+    /**
+     * Returns true if the guard controls the denormal mode on the
+     * target architecture, false if it does nothing.
+     */
+    constexpr bool denormal_guard::is_supported() noexcept
+    {
+#if defined(XSIMD_DENORMAL_CONTROL_MXCSR) || defined(XSIMD_DENORMAL_CONTROL_FPCR) || defined(XSIMD_DENORMAL_CONTROL_FPSCR)
+        return true;
+#else
+        return false;
+#endif
+    }
+}
+
+#endif
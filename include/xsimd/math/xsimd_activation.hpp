@@ -0,0 +1,376 @@
+/***************************************************************************
+* Copyright (c) 2016, Johan Mabille and Sylvain Corlay                     *
+*                                                                          *
+* Distributed under the terms of the BSD 3-Clause License.                 *
+*                                                                          *
+* The full license is in the file LICENSE, distributed with this software. *
+****************************************************************************/
+
+#ifndef XSIMD_ACTIVATION_HPP
+#define XSIMD_ACTIVATION_HPP
+
+#include "xsimd_basic_math.hpp"
+#include "xsimd_error.hpp"
+#include "xsimd_exponential.hpp"
+#include "xsimd_fp_manipulation.hpp"
+#include "xsimd_horner.hpp"
+#include "xsimd_logarithm.hpp"
+#include "xsimd_numerical_constant.hpp"
+#include "xsimd_rounding.hpp"
+
+namespace xsimd
+{
+    /**
+     * Tag selecting the fast approximations of the activation functions.
+     * These replace exp with a short polynomial, do not handle infinities
+     * and NaN, and have a relative error below 3e-6 for both float and
+     * double.
+     */
+    struct fast_approx_tag
+    {
+    };
+
+    /**
+     * Computes the logistic sigmoid 1 / (1 + exp(-x)) of the batch \c x.
+     * @param x batch of floating point values.
+     * @return the sigmoid of \c x.
+     */
+    template <class T, std::size_t N>
+    batch<T, N> sigmoid(const batch<T, N>& x);
+
+    template <class T, std::size_t N>
+    batch<T, N> sigmoid(const batch<T, N>& x, fast_approx_tag);
+
+    /**
+     * Computes the logarithm of the sigmoid of the batch \c x,
+     * without overflow for large negative values.
+     * @param x batch of floating point values.
+     * @return the logarithm of the sigmoid of \c x.
+     */
+    template <class T, std::size_t N>
+    batch<T, N> log_sigmoid(const batch<T, N>& x);
+
+    template <class T, std::size_t N>
+    batch<T, N> log_sigmoid(const batch<T, N>& x, fast_approx_tag);
+
+    /**
+     * Computes the softplus log(1 + exp(x)) of the batch \c x,
+     * without overflow for large values.
+     * @param x batch of floating point values.
+     * @return the softplus of \c x.
+     */
+    template <class T, std::size_t N>
+    batch<T, N> softplus(const batch<T, N>& x);
+
+    template <class T, std::size_t N>
+    batch<T, N> softplus(const batch<T, N>& x, fast_approx_tag);
+
+    /**
+     * Computes the sigmoid linear unit x * sigmoid(x) of the batch \c x.
+     * @param x batch of floating point values.
+     * @return the SiLU of \c x.
+     */
+    template <class T, std::size_t N>
+    batch<T, N> silu(const batch<T, N>& x);
+
+    template <class T, std::size_t N>
+    batch<T, N> silu(const batch<T, N>& x, fast_approx_tag);
+
+    /**
+     * Computes the gaussian error linear unit x * Phi(x) of the batch \c x,
+     * where Phi is the cumulative distribution function of the standard
+     * normal distribution. The fast approximation evaluates Phi with the
+     * erfc approximation of Numerical Recipes; for the tanh formula, see
+     * gelu_tanh.
+     * @param x batch of floating point values.
+     * @return the GELU of \c x.
+     */
+    template <class T, std::size_t N>
+    batch<T, N> gelu(const batch<T, N>& x);
+
+    template <class T, std::size_t N>
+    batch<T, N> gelu(const batch<T, N>& x, fast_approx_tag);
+
+    /**
+     * Computes the tanh approximation of the gaussian error linear unit
+     * 0.5 * x * (1 + tanh(sqrt(2 / pi) * (x + 0.044715 * x^3))) of the
+     * batch \c x.
+     * @param x batch of floating point values.
+     * @return the tanh approximation of the GELU of \c x.
+     */
+    template <class T, std::size_t N>
+    batch<T, N> gelu_tanh(const batch<T, N>& x);
+
+    template <class T, std::size_t N>
+    batch<T, N> gelu_tanh(const batch<T, N>& x, fast_approx_tag);
+
+    /*******************
+     * fast exp kernel *
+     *******************/
+
+    namespace detail
+    {
+        // exp(x) = 2^k * exp(r), |r| <= log(2) / 2, exp(r) approximated by
+        // the polynomial of degree 5 interpolating it at the Chebyshev nodes
+        // of [-0.35, 0.35], with a relative error below 1.1e-7 (1.6e-7 with
+        // float coefficients). k * log(2) is subtracted in two parts, so
+        // that r does not depend on fma for its accuracy. Arguments are
+        // clamped to the range of exp instead of being tested.
+        template <class B, class T = typename B::value_type>
+        struct fast_exp_kernel;
+
+        template <class B>
+        struct fast_exp_kernel<B, float>
+        {
+            static inline B approx(const B& r)
+            {
+                return polynomial<B,
+                                  0x3f800001,  // 1.0000001192
+                                  0x3f800000,  // 1.0000000000
+                                  0x3efffe75,  // 0.4999882281
+                                  0x3e2aaa3a,  // 0.1666649878
+                                  0x3d2bb6ee,  // 0.0419225022
+                                  0x3c0921be  // 0.0083698612
+                                  >(r);
+            }
+        };
+
+        template <class B>
+        struct fast_exp_kernel<B, double>
+        {
+            static inline B approx(const B& r)
+            {
+                return polynomial<B,
+                                  0x3ff00000157cdbe3ull,  // 1.0000000800
+                                  0x3ff00000031143b1ull,  // 1.0000000114
+                                  0x3fdfffceac028690ull,  // 0.4999882393
+                                  0x3fc555473fde2a2cull,  // 0.1666649877
+                                  0x3fa576ddcea2281cull,  // 0.0419225039
+                                  0x3f812437cc5310dcull  // 0.0083698615
+                                  >(r);
+            }
+        };
+
+        template <class B>
+        inline B fast_exp(const B& x)
+        {
+            B a = min(max(x, minlog<B>()), maxlog<B>());
+            B k = nearbyint(invlog_2<B>() * a);
+            B r = fnma(k, log_2lo<B>(), fnma(k, log_2hi<B>(), a));
+            return ldexp(fast_exp_kernel<B>::approx(r), to_int(k));
+        }
+
+        // exp(x + c) for a small c, which is added after the reduction
+        // so that x + c is never rounded
+        template <class B>
+        inline B fast_exp(const B& x, const B& c)
+        {
+            B a = min(max(x + c, minlog<B>()), maxlog<B>());
+            B k = nearbyint(invlog_2<B>() * a);
+            B r = min(max(fnma(k, log_2lo<B>(), fnma(k, log_2hi<B>(), x)) + c, B(-0.35)), B(0.35));
+            return ldexp(fast_exp_kernel<B>::approx(r), to_int(k));
+        }
+    }
+
+    /**************************
+     * sigmoid implementation *
+     **************************/
+
+    template <class T, std::size_t N>
+    inline batch<T, N> sigmoid(const batch<T, N>& x)
+    {
+        using b_type = batch<T, N>;
+        return b_type(1.) / (b_type(1.) + exp(-x));
+    }
+
+    template <class T, std::size_t N>
+    inline batch<T, N> sigmoid(const batch<T, N>& x, fast_approx_tag)
+    {
+        using b_type = batch<T, N>;
+        return b_type(1.) / (b_type(1.) + detail::fast_exp(-x));
+    }
+
+    /***************************
+     * softplus implementation *
+     ***************************/
+
+    // log(1 + exp(x)) = max(x, 0) + log1p(exp(-|x|))
+
+    template <class T, std::size_t N>
+    inline batch<T, N> softplus(const batch<T, N>& x)
+    {
+        using b_type = batch<T, N>;
+        return max(x, b_type(0.)) + log1p(exp(-abs(x)));
+    }
+
+    template <class T, std::size_t N>
+    inline batch<T, N> softplus(const batch<T, N>& x, fast_approx_tag)
+    {
+        using b_type = batch<T, N>;
+        return max(x, b_type(0.)) + log1p(detail::fast_exp(-abs(x)));
+    }
+
+    /******************************
+     * log_sigmoid implementation *
+     ******************************/
+
+    template <class T, std::size_t N>
+    inline batch<T, N> log_sigmoid(const batch<T, N>& x)
+    {
+        return -softplus(-x);
+    }
+
+    template <class T, std::size_t N>
+    inline batch<T, N> log_sigmoid(const batch<T, N>& x, fast_approx_tag tag)
+    {
+        return -softplus(-x, tag);
+    }
+
+    /***********************
+     * silu implementation *
+     ***********************/
+
+    template <class T, std::size_t N>
+    inline batch<T, N> silu(const batch<T, N>& x)
+    {
+        return x * sigmoid(x);
+    }
+
+    template <class T, std::size_t N>
+    inline batch<T, N> silu(const batch<T, N>& x, fast_approx_tag tag)
+    {
+        return x * sigmoid(x, tag);
+    }
+
+    /***********************
+     * gelu implementation *
+     ***********************/
+
+    // 0.5 * x * (1 + erf(x / sqrt(2))) = 0.5 * x * erfc(-x / sqrt(2)),
+    // the latter does not suffer from cancellation for negative x
+
+    template <class T, std::size_t N>
+    inline batch<T, N> gelu(const batch<T, N>& x)
+    {
+        using b_type = batch<T, N>;
+        return b_type(0.5) * x * erfc(x * b_type(T(-0.707106781186547524400844362104849039)));
+    }
+
+    namespace detail
+    {
+        // erfc(z) = t * exp(-z^2 + P(t)), t = 1 / (1 + z / 2), z >= 0, with a
+        // relative error below 1.2e-7 (Numerical Recipes, erfcc)
+        template <class B, class T = typename B::value_type>
+        struct fast_erfc_kernel;
+
+        template <class B>
+        struct fast_erfc_kernel<B, float>
+        {
+            static inline B approx(const B& t)
+            {
+                return polynomial<B,
+                                  0xbfa1fc4e,  // -1.26551223
+                                  0x3f8000c7,  //  1.00002368
+                                  0x3ebf88fb,  //  0.37409196
+                                  0x3dc636c9,  //  0.09678418
+                                  0xbe3ec24c,  // -0.18628806
+                                  0x3e8ec7cc,  //  0.27886807
+                                  0xbf914e5d,  // -1.13520398
+                                  0x3fbe87b0,  //  1.48851587
+                                  0xbf527892,  // -0.82215223
+                                  0x3e2ef945  //  0.17087277
+                                  >(t);
+            }
+
+            // 2^12 + 1, splits a float in two halves of 12 bits
+            static inline B split_factor()
+            {
+                return B(4097.f);
+            }
+        };
+
+        template <class B>
+        struct fast_erfc_kernel<B, double>
+        {
+            static inline B approx(const B& t)
+            {
+                return polynomial<B,
+                                  0xbff43f89c0889bc5ull,  // -1.26551223
+                                  0x3ff00018d48d3588ull,  //  1.00002368
+                                  0x3fd7f11f677960eaull,  //  0.37409196
+                                  0x3fb8c6d917dec3f0ull,  //  0.09678418
+                                  0xbfc7d84982aaeaa5ull,  // -0.18628806
+                                  0x3fd1d8f976231ce6ull,  //  0.27886807
+                                  0xbff229cba6063980ull,  // -1.13520398
+                                  0x3ff7d0f60453a1beull,  //  1.48851587
+                                  0xbfea4f123185defdull,  // -0.82215223
+                                  0x3fc5df28af76a5a4ull  //  0.17087277
+                                  >(t);
+            }
+
+            // 2^27 + 1, splits a double in two halves of 26 bits
+            static inline B split_factor()
+            {
+                return B(134217729.);
+            }
+        };
+
+        // Phi(-|x|) = erfc(z) / 2, z = |x| / sqrt(2). x^2 is split into its
+        // rounded value and its rounding error (exact with the Veltkamp
+        // split of |x|, with or without fma), the latter is only added after
+        // the reduction of the exponential. Beyond 40, Phi(-|x|) underflows.
+        template <class B>
+        inline B fast_normal_cdf_tail(const B& x)
+        {
+            using kernel = fast_erfc_kernel<B>;
+            B ax = min(abs(x), B(40.));
+            B t = B(1.) / fma(ax, B(0.353553390593273762200422181052424520), B(1.));
+            B c = ax * kernel::split_factor();
+            B ah = c - (c - ax);
+            B al = ax - ah;
+            B x2 = ax * ax;
+            B x2_lo = ((ah * ah - x2) + B(2.) * ah * al) + al * al;
+            return B(0.5) * t * fast_exp(B(-0.5) * x2, kernel::approx(t) - B(0.5) * x2_lo);
+        }
+    }
+
+    template <class T, std::size_t N>
+    inline batch<T, N> gelu(const batch<T, N>& x, fast_approx_tag)
+    {
+        using b_type = batch<T, N>;
+        // Phi(|x|) = 1 - Phi(-|x|) does not cancel
+        b_type h = detail::fast_normal_cdf_tail(x);
+        return x * select(x < b_type(0.), h, b_type(1.) - h);
+    }
+
+    /****************************
+     * gelu_tanh implementation *
+     ****************************/
+
+    // 0.5 * (1 + tanh(u)) = sigmoid(2 * u)
+
+    namespace detail
+    {
+        template <class B>
+        inline B gelu_tanh_arg(const B& x)
+        {
+            // 2 * sqrt(2 / pi) * (x + 0.044715 * x^3)
+            B x2 = x * x;
+            return x * fma(B(0.0713548162726008), x2, B(1.595769121605730711759));
+        }
+    }
+
+    template <class T, std::size_t N>
+    inline batch<T, N> gelu_tanh(const batch<T, N>& x)
+    {
+        return x * sigmoid(detail::gelu_tanh_arg(x));
+    }
+
+    template <class T, std::size_t N>
+    inline batch<T, N> gelu_tanh(const batch<T, N>& x, fast_approx_tag tag)
+    {
+        return x * sigmoid(detail::gelu_tanh_arg(x), tag);
+    }
+}
+
+#endif
@@ -0,0 +1,702 @@
+/***************************************************************************
+* Copyright (c) 2016, Johan Mabille and Sylvain Corlay                     *
+*                                                                          *
+* Distributed under the terms of the BSD 3-Clause License.                 *
+*                                                                          *
+* The full license is in the file LICENSE, distributed with this software. *
+****************************************************************************/
+
+#ifndef XSIMD_BESSEL_HPP
+#define XSIMD_BESSEL_HPP
+
+#include "xsimd_basic_math.hpp"
+#include "xsimd_exponential.hpp"
+#include "xsimd_fp_sign.hpp"
+#include "xsimd_horner.hpp"
+#include "xsimd_logarithm.hpp"
+#include "xsimd_numerical_constant.hpp"
+#include "xsimd_trigonometric.hpp"
+
+namespace xsimd
+{
+    /**
+     * Computes the Bessel function of the first kind of order 0
+     * of the batch \c x.
+     * @param x batch of floating point values.
+     * @return the Bessel function J0 of \c x.
+     */
+    template <class T, std::size_t N>
+    batch<T, N> j0(const batch<T, N>& x);
+
+    /**
+     * Computes the Bessel function of the first kind of order 1
+     * of the batch \c x.
+     * @param x batch of floating point values.
+     * @return the Bessel function J1 of \c x.
+     */
+    template <class T, std::size_t N>
+    batch<T, N> j1(const batch<T, N>& x);
+
+    /**
+     * Computes the Bessel function of the second kind of order 0
+     * of the batch \c x.
+     * @param x batch of positive floating point values.
+     * @return the Bessel function Y0 of \c x.
+     */
+    template <class T, std::size_t N>
+    batch<T, N> y0(const batch<T, N>& x);
+
+    /**
+     * Computes the Bessel function of the second kind of order 1
+     * of the batch \c x.
+     * @param x batch of positive floating point values.
+     * @return the Bessel function Y1 of \c x.
+     */
+    template <class T, std::size_t N>
+    batch<T, N> y1(const batch<T, N>& x);
+
+    /**
+     * Computes the exponentially scaled modified Bessel function of the
+     * first kind of order 0, exp(-|x|) * I0(x), of the batch \c x.
+     * @param x batch of floating point values.
+     * @return the scaled modified Bessel function I0 of \c x.
+     */
+    template <class T, std::size_t N>
+    batch<T, N> i0e(const batch<T, N>& x);
+
+    /******************
+     * bessel kernels *
+     ******************/
+
+    /*
+     * Chebyshev expansions of the smooth parts of the functions, computed
+     * from the power series (x <= 8) and the Hankel asymptotic amplitudes
+     * (x > 8):
+     *
+     *     J0(x) = sqrt(2 / (pi x)) * (P0(x) cos(x - pi / 4) - Q0(x) sin(x - pi / 4))
+     *     Y0(x) = sqrt(2 / (pi x)) * (P0(x) sin(x - pi / 4) + Q0(x) cos(x - pi / 4))
+     *
+     * and the same for J1 and Y1 with P1, Q1 and x - 3 pi / 4. Expansions
+     * are truncated to the precision of the value type. The absolute error
+     * is a few ulps, the relative error grows near the zeros of J and Y.
+     */
+
+    namespace detail
+    {
+        template <class B, class T = typename B::value_type>
+        struct bessel_kernel;
+
+        template <class B>
+        struct bessel_kernel<B, float>
+        {
+            // J0(x), x <= 8, t = x^2 / 32 - 1
+            static inline B j0_small(const B& t)
+            {
+                return chebyshev<B,
+                                 0x3e218371,  //   1.577279716730118e-01
+                                 0xbc0eecc5,  //  -8.723442442715168e-03
+                                 0x3e87c57e,  //   2.651786208152771e-01
+                                 0xbebd7d17,  //  -3.700949847698212e-01
+                                 0x3e21dc58,  //   1.580671072006226e-01
+                                 0xbd0eecc5,  //  -3.489376977086067e-02
+                                 0x3b9dea36,  //   4.819179885089397e-03
+                                 0xb9f18033,  //  -4.606261791195720e-04
+                                 0x38082603,  //   3.246032792958431e-05
+                                 0xb5ec7c09,  //  -1.761946919032198e-06
+                                 0x33a36252,  //   7.608163343775232e-08
+                                 0xb1381ded  //  -2.679253485737831e-09
+                                 >(t);
+            }
+
+            // Y0(x) - 2 / pi * log(x) * J0(x), x <= 8, t = x^2 / 32 - 1
+            static inline B y0_small(const B& t)
+            {
+                return chebyshev<B,
+                                 0xbd07c438,  //  -3.314611315727234e-02
+                                 0xbe8c87e5,  //  -2.744742929935455e-01
+                                 0x3e3754c5,  //   1.790343075990677e-01
+                                 0x3e85ec28,  //   2.615673542022705e-01
+                                 0xbe358ea9,  //  -1.773020178079605e-01
+                                 0x3d415151,  //   4.719668999314308e-02
+                                 0xbbeecfdc,  //  -7.287962362170219e-03
+                                 0x3a456c99,  //   7.531135925091803e-04
+                                 0xb86c39fd,  //  -5.632079046336003e-05
+                                 0x36572fcf,  //   3.206532483090996e-06
+                                 0xb41ab24d,  //  -1.440723309542591e-07
+                                 0x31b458e3  //   5.248794732182205e-09
+                                 >(t);
+            }
+
+            // J1(x) / x, x <= 8, t = x^2 / 32 - 1
+            static inline B j1_small(const B& t)
+            {
+                return chebyshev<B,
+                                 0x3da5fad7,  //   8.104484528303146e-02
+                                 0xbe188cf1,  //  -1.489751487970352e-01
+                                 0x3e24dcfe,  //   1.609992682933807e-01
+                                 0xbda95464,  //  -8.268049359321594e-02
+                                 0x3cb5f961,  //   2.221363969147205e-02
+                                 0xbb6f0183,  //  -3.646940691396594e-03
+                                 0x39d45ab6,  //   4.050337593071163e-04
+                                 0xb8088c41,  //  -3.255554838688113e-05
+                                 0x3605451d,  //   1.985877361221355e-06
+                                 0xb3cc7baa,  //  -9.521984623006574e-08
+                                 0x317d60be  //   3.687133709462387e-09
+                                 >(t);
+            }
+
+            // (Y1(x) - 2 / pi * (log(x) * J1(x) - 1 / x)) / x, x <= 8, t = x^2 / 32 - 1
+            static inline B y1_small(const B& t)
+            {
+                return chebyshev<B,
+                                 0x3b2654cc,  //   2.538013271987438e-03
+                                 0xbc83c93f,  //  -1.608717255294323e-02
+                                 0xbdc46d89,  //  -9.591204673051834e-02
+                                 0x3dacf528,  //   8.445197343826294e-02
+                                 0xbce81062,  //  -2.832812443375587e-02
+                                 0x3bad56e0,  //   5.289897322654724e-03
+                                 0xba282753,  //  -6.414551171474159e-04
+                                 0x3866f00a,  //   5.505982699105516e-05
+                                 0xb66d6fc0,  //  -3.538079909048975e-06
+                                 0x343e22d8,  //   1.770780500010005e-07
+                                 0xb1f4510f  //  -7.110549926636622e-09
+                                 >(t);
+            }
+
+            // P0(x), x > 8, t = 128 / x^2 - 1
+            static inline B p0(const B& t)
+            {
+                return chebyshev<B,
+                                 0x3f7fdca2,  //   9.994603395462036e-01
+                                 0xba0ca563,  //  -5.365220713429153e-04
+                                 0x364e5f46,  //   3.075184849876678e-06
+                                 0xb35e134a  //  -5.170594619130497e-08
+                                 >(t);
+            }
+
+            // x * Q0(x), x > 8, t = 128 / x^2 - 1
+            static inline B q0(const B& t)
+            {
+                return chebyshev<B,
+                                 0xbdfeddfc,  //  -1.244468390941620e-01
+                                 0x3a0f6a06,  //   5.470815813168883e-04
+                                 0xb6c7080c,  //  -5.931598934694193e-06
+                                 0x341a61da,  //   1.437796584013995e-07
+                                 0xb1c7e38f  //  -5.817532677809822e-09
+                                 >(t);
+            }
+
+            // P1(x), x > 8, t = 128 / x^2 - 1
+            static inline B p1(const B& t)
+            {
+                return chebyshev<B,
+                                 0x3f801d97,  //   1.000903010368347e+00
+                                 0x3a6baa30,  //   8.989898487925529e-04
+                                 0xb685ca83,  //  -3.987284344475484e-06
+                                 0x3384a9e7  //   6.177634048754044e-08
+                                 >(t);
+            }
+
+            // x * Q1(x), x > 8, t = 128 / x^2 - 1
+            static inline B q1(const B& t)
+            {
+                return chebyshev<B,
+                                 0x3ebf9a11,  //   3.742223083972931e-01
+                                 0xba49e872,  //  -7.702178554609418e-04
+                                 0x36f55016,  //   7.310892215173226e-06
+                                 0xb4340b0c,  //  -1.676782517279207e-07
+                                 0x31e233cd  //   6.583354750233639e-09
+                                 >(t);
+            }
+
+            // exp(-x) * I0(x), 0 <= x <= 8, t = x / 4 - 1
+            static inline B i0e_small(const B& t)
+            {
+                return chebyshev<B,
+                                 0x3ead4275,  //   3.383976519107819e-01
+                                 0xbe9bff5e,  //  -3.046826720237732e-01
+                                 0x3e2fbd64,  //   1.716209053993225e-01
+                                 0xbdc25b82,  //  -9.490109980106354e-02
+                                 0x3d49f456,  //   4.930528253316879e-02
+                                 0xbcc274f8,  //  -2.373741567134857e-02
+                                 0x3c2ccb10,  //   1.054646074771881e-02
+                                 0xbb8db2f1,  //  -4.324309993535280e-03
+                                 0x3ad6e3ac,  //   1.639475580304861e-03
+                                 0xba1717e9,  //  -5.763755762018263e-04
+                                 0x3945a8dc,  //   1.885028905235231e-04
+                                 0xb8715933,  //  -5.754195080953650e-05
+                                 0x3789fac6,  //   1.644844815018587e-05
+                                 0xb694337e,  //  -4.416738192958292e-06
+                                 0x3595f925,  //   1.117387569138373e-06
+                                 0xb48f631c,  //  -2.670793719516951e-07
+                                 0x3381dbb5,  //   6.046995082442663e-08
+                                 0xb25f57b4,  //  -1.300024976558234e-08
+                                 0x3136c81d  //   2.659823694628471e-09
+                                 >(t);
+            }
+
+            // sqrt(x) * exp(-x) * I0(x), x > 8, t = 16 / x - 1
+            static inline B i0e_large(const B& t)
+            {
+                return chebyshev<B,
+                                 0x3ecdf315,  //   4.022451937198639e-01
+                                 0x3b5ccc65,  //   3.369116457179189e-03
+                                 0x38907d1c,  //   6.889758515171707e-05
+                                 0x3642095e,  //   2.891370513680158e-06
+                                 0x345c003f,  //   2.048918616992523e-07
+                                 0x32c2b494,  //   2.266668985839715e-08
+                                 0x31696325  //   3.396231962327079e-09
+                                 >(t);
+            }
+        };
+
+        template <class B>
+        struct bessel_kernel<B, double>
+        {
+            // J0(x), x <= 8, t = x^2 / 32 - 1
+            static inline B j0_small(const B& t)
+            {
+                return chebyshev<B,
+                                 0x3fc4306e1f9314dbll,  // 1.577279714748901e-01
+                                 0xbf81dd989ce98ea2ll,  // -8.723442352852221e-03
+                                 0x3fd0f8afb7d3a552ll,  // 2.651786132033368e-01
+                                 0xbfd7afa2e9c62a9ell,  // -3.700949938726498e-01
+                                 0x3fc43b8af58b7ffall,  // 1.580671023320973e-01
+                                 0xbfa1dd989ce98ea2ll,  // -3.489376941140888e-02
+                                 0x3f73bd46ccab9da0ll,  // 4.819180069467605e-03
+                                 0xbf3e300651cd3ae3ll,  // -4.606261662062750e-04
+                                 0x3f0104c067d74d17ll,  // 3.246032882100508e-05
+                                 0xbebd8f811cd3e853ll,  // -1.761946907762151e-06
+                                 0x3e746c4a4b32aa3bll,  // 7.608163592418782e-08
+                                 0xbe2703bda6758f6fll,  // -2.679253530557673e-09
+                                 0x3dd593076e904d04ll,  // 7.848696314479465e-11
+                                 0xbd81192067e71726ll,  // -1.943834686737016e-12
+                                 0x3d273936aa3d0207ll,  // 4.125320595634374e-14
+                                 0xbccb5729d242acaell,  // -7.588508125447546e-16
+                                 0x3c6c2c89ea282aaall  // 1.221851587396141e-17
+                                 >(t);
+            }
+
+            // Y0(x) - 2 / pi * log(x) * J0(x), x <= 8, t = x^2 / 32 - 1
+            static inline B y0_small(const B& t)
+            {
+                return chebyshev<B,
+                                 0xbfa0f88700652ecbll,  // -3.314611320328494e-02
+                                 0xbfd190fcad75eca2ll,  // -2.744743055297453e-01
+                                 0x3fc6ea98ade961a1ll,  // 1.790343140771826e-01
+                                 0x3fd0bd84f7777bd6ll,  // 2.615673462550466e-01
+                                 0xbfc6b1d515347a69ll,  // -1.773020127811436e-01
+                                 0x3fa82a2a1c96271fll,  // 4.719668959576339e-02
+                                 0xbf7dd9fb881100e6ll,  // -7.287962479552079e-03
+                                 0x3f48ad9320695af0ll,  // 7.531135932577742e-04
+                                 0xbf0d873fa854ed4dll,  // -5.632079141056987e-05
+                                 0x3ecae5f9e7adde46ll,  // 3.206532537654801e-06
+                                 0xbe835649a4058471ll,  // -1.440723327401870e-07
+                                 0x3e368b1c63f94e89ll,  // 5.248794787330516e-09
+                                 0xbde5c457ea1daccell,  // -1.583755254181201e-10
+                                 0x3d91b53ed8a54178ll,  // 4.026330818306120e-12
+                                 0xbd389f1fa5209ce6ll,  // -8.747341203310769e-14
+                                 0x3cdd9b425efafdd8ll,  // 1.643489871491947e-15
+                                 0xbc7f1a7711576130ll  // -2.697788115256684e-17
+                                 >(t);
+            }
+
+            // J1(x) / x, x <= 8, t = x^2 / 32 - 1
+            static inline B j1_small(const B& t)
+            {
+                return chebyshev<B,
+                                 0x3fb4bf5ae47a6150ll,  // 8.104484632565812e-02
+                                 0xbfc3119e17fdbffdll,  // -1.489751450676521e-01
+                                 0x3fc49b9fb3408e33ll,  // 1.609992623572097e-01
+                                 0xbfb52a8c7827daa8ll,  // -8.268049176681791e-02
+                                 0x3f96bf2c1f5f71e1ll,  // 2.221363965496604e-02
+                                 0xbf6de030538b55b0ll,  // -3.646940600769276e-03
+                                 0x3f3a8b56cedfe580ll,  // 4.050337728354822e-04
+                                 0xbf011188227a5012ll,  // -3.255554866857259e-05
+                                 0x3ec0a8a3a628fc7bll,  // 1.985877404991517e-06
+                                 0xbe798f754605f635ll,  // -9.521984756750436e-08
+                                 0x3e2fac17c7273311ll,  // 3.687133759097148e-09
+                                 0xbde030d00d42d6f4ll,  // -1.178026622695885e-10
+                                 0x3d8bcc0916376113ll,  // 3.160154580348003e-12
+                                 0xbd3453d2b4e985cbll,  // -7.221755239651773e-14
+                                 0x3cd9a36afedba862ll,  // 1.423214400351394e-15
+                                 0xbc7c2dff424052f8ll  // -2.444197291619046e-17
+                                 >(t);
+            }
+
+            // (Y1(x) - 2 / pi * (log(x) * J1(x) - 1 / x)) / x, x <= 8, t = x^2 / 32 - 1
+            static inline B y1_small(const B& t)
+            {
+                return chebyshev<B,
+                                 0x3f64ca997b04b826ll,  // 2.538013235741782e-03
+                                 0xbf907927e87fd36bll,  // -1.608717304766875e-02
+                                 0xbfb88db11a1e0337ll,  // -9.591204536083074e-02
+                                 0x3fb59ea4fc627f66ll,  // 8.445197259652346e-02
+                                 0xbf9d020c3798a51all,  // -2.832812394459436e-02
+                                 0x3f75aadc0f38e31dll,  // 5.289897544167113e-03
+                                 0xbf4504ea6f6291cdll,  // -6.414551451326356e-04
+                                 0x3f0cde014f53622dll,  // 5.505982873338744e-05
+                                 0xbecdadf80f6e35f9ll,  // -3.538080018689350e-06
+                                 0x3e87c45af600d3dcll,  // 1.770780455615440e-07
+                                 0xbe3e8a21e8e1cb71ll,  // -7.110550049899280e-09
+                                 0x3df01c33ee943bc5ll,  // 2.344337905911516e-10
+                                 0xbd9c6f1d25aa2e2all,  // -6.465151841411595e-12
+                                 0x3d454fcf661706ffll,  // 1.514291512050020e-13
+                                 0xbceb7b8e4b5d24fcll,  // -3.051185969447325e-15
+                                 0x3c8ed24ebd671b40ll  // 5.346680385728670e-17
+                                 >(t);
+            }
+
+            // P0(x), x > 8, t = 128 / x^2 - 1
+            static inline B p0(const B& t)
+            {
+                return chebyshev<B,
+                                 0x3feffb944543151ell,  // 9.994603493475187e-01
+                                 0xbf4194ac5283c04all,  // -5.365220468132117e-04
+                                 0x3ec9cbe8b7395851ll,  // 3.075184787519474e-06
+                                 0xbe6bc26938a82ce2ll,  // -5.170594537606098e-08
+                                 0x3e1c03a8b38ca73cll,  // 1.630646463515138e-09
+                                 0xbdd59ddcc28538a8ll,  // -7.864091377237070e-11
+                                 0x3d96baf23642c655ll,  // 5.168262387349193e-12
+                                 0xbd5e4a709e74825bll,  // -4.304578869925391e-13
+                                 0x3d285b481672b1eell,  // 4.326595743154940e-14
+                                 0xbcf6d432cb7153fell,  // -5.069034095935236e-15
+                                 0x3cc84fff80b613c2ll,  // 6.748072215733873e-16
+                                 0xbc9cdb3179595bbdll,  // -1.001151372346779e-16
+                                 0x3c72cca86c6338d9ll,  // 1.630591923374419e-17
+                                 0xbc4a9240bf60d14bll  // -2.880866169482871e-18
+                                 >(t);
+            }
+
+            // x * Q0(x), x > 8, t = 128 / x^2 - 1
+            static inline B q0(const B& t)
+            {
+                return chebyshev<B,
+                                 0xbfbfdbbf76547cafll,  // -1.244468368426961e-01
+                                 0x3f41ed40c7bf4761ll,  // 5.470815954089319e-04
+                                 0xbed8e1017183d060ll,  // -5.931598728848518e-06
+                                 0x3e834c3b3f0f3e19ll,  // 1.437796579837519e-07
+                                 0xbe38fc71e52a5280ll,  // -5.817532749493056e-09
+                                 0x3df7334b27ad2886ll,  // 3.376097523734991e-10
+                                 0xbdbc34f407df8ba4ll,  // -2.565397936797308e-11
+                                 0x3d852763be90a889ll,  // 2.404916100281365e-12
+                                 0xbd52c827d7f6e2d5ll,  // -2.669062548257941e-13
+                                 0x3d2329f0c1b6c667ll,  // 3.404180032196369e-14
+                                 0xbcf5fa3147b301call,  // -4.879944105312040e-15
+                                 0x3ccbd9648f62c6c0ll,  // 7.729703176242613e-16
+                                 0xbca33cdb710c05f6ll,  // -1.334885217150260e-16
+                                 0x3c7cab223df72a72ll,  // 2.486595238939129e-17
+                                 0xbc56d757f20d1a5ell,  // -4.952892629887286e-18
+                                 0x3c3351cf3ac94450ll  // 1.047315897378380e-18
+                                 >(t);
+            }
+
+            // P1(x), x > 8, t = 128 / x^2 - 1
+            static inline B p1(const B& t)
+            {
+                return chebyshev<B,
+                                 0x3ff003b2e82f5f12ll,  // 1.000903040860014e+00
+                                 0x3f4d7545f75d7da9ll,  // 8.989898330859408e-04
+                                 0xbed0b9505ce79bball,  // -3.987284300488908e-06
+                                 0x3e70953cdc0829efll,  // 6.177633960644299e-08
+                                 0xbe201454cf5d6ac0ll,  // -1.871890749106307e-09
+                                 0x3dd83c5742be2cc3ll,  // 8.816898659582339e-11
+                                 0xbd99171afe32fc02ll,  // -5.704863640395645e-12
+                                 0x3d6088a8b6783e50ll,  // 4.699195515230542e-13
+                                 0xbd2a5ead8bea617fll,  // -4.684223783990490e-14
+                                 0x3cf88e8192bcb004ll,  // 5.452674896044717e-15
+                                 0xbcca045d1e6aa4e8ll,  // -7.221180842274018e-16
+                                 0x3c9ebf5d803cd896ll,  // 1.066768911433541e-16
+                                 0xbc73f5b1671b84fbll,  // -1.731231321611633e-17
+                                 0x3c4c1ff43803bc35ll  // 3.049299119766587e-18
+                                 >(t);
+            }
+
+            // x * Q1(x), x > 8, t = 128 / x^2 - 1
+            static inline B q1(const B& t)
+            {
+                return chebyshev<B,
+                                 0x3fd7f34213492af6ll,  // 3.742222965562826e-01
+                                 0xbf493d0e4fa70662ll,  // -7.702178839325664e-04
+                                 0x3edeaa02bf61504bll,  // 7.310892206364364e-06
+                                 0xbe8681617e8645adll,  // -1.676782510726674e-07
+                                 0x3e3c467999a69933ll,  // 6.583354662120443e-09
+                                 0xbdf9c37875f5ebc0ll,  // -3.749090950541556e-10
+                                 0x3dbeeb91abca8164ll,  // 2.812175035974887e-11
+                                 0xbd86f877e53fb185ll,  // -2.611452539462320e-12
+                                 0x3d543f8057a1761fll,  // 2.877421266333224e-13
+                                 0xbd248ac416e30219ll,  // -3.649001916061838e-14
+                                 0x3cf772d4dd737bf2ll,  // 5.206626366226707e-15
+                                 0xbccd994b1fddb9eall,  // -8.215318025458589e-16
+                                 0x3ca46123a8bbc881ll,  // 1.414108439021178e-16
+                                 0xbc7e48d4f144b7ffll,  // -2.626761589838474e-17
+                                 0x3c5811d207bb2bacll,  // 5.219264919670869e-18
+                                 0xbc34508fb9dad42cll  // -1.101261718787433e-18
+                                 >(t);
+            }
+
+            // exp(-x) * I0(x), 0 <= x <= 8, t = x / 4 - 1
+            static inline B i0e_small(const B& t)
+            {
+                return chebyshev<B,
+                                 0x3fd5a84e9035a22all,  // 3.383976372047380e-01
+                                 0xbfd37febc057cd8dll,  // -3.046826723431984e-01
+                                 0x3fc5f7ac77ac88c0ll,  // 1.716209015222088e-01
+                                 0xbfb84b70342d06eall,  // -9.490109704804764e-02
+                                 0x3fa93e8acea8a32dll,  // 4.930528423967071e-02
+                                 0xbf984e9ef121b6f0ll,  // -2.373741480589947e-02
+                                 0x3f859961f3dde3ddll,  // 1.054646039459500e-02
+                                 0xbf71b65e201aa849ll,  // -4.324309995050576e-03
+                                 0x3f5adc758a12100ell,  // 1.639475616941336e-03
+                                 0xbf42e2fd1f15eb52ll,  // -5.763755745385824e-04
+                                 0x3f28b51b74107cabll,  // 1.885028850958416e-04
+                                 0xbf0e2b2659c41d5all,  // -5.754195010082104e-05
+                                 0x3ef13f58be9a2859ll,  // 1.644844807072890e-05
+                                 0xbed2866fcba56427ll,  // -4.416738358458751e-06
+                                 0x3eb2bf24978cf4acll,  // 1.117387539120104e-06
+                                 0xbe91ec638f227f8dll,  // -2.670793853940612e-07
+                                 0x3e703b769d4d6435ll,  // 6.046995022541919e-08
+                                 0xbe4beaf68c0b30abll,  // -1.300025009986248e-08
+                                 0x3e26d903a454cb34ll,  // 2.659823724682387e-09
+                                 0xbe01d4fe13ae9556ll,  // -5.189795601635263e-10
+                                 0x3dda98becc743c10ll,  // 9.675809035373237e-11
+                                 0xbdb2fc957a946abcll,  // -1.726826291441556e-11
+                                 0x3d89fe2fe19bd324ll,  // 2.955052663129640e-12
+                                 0xbd61164c62ee1af0ll,  // -4.856446783111929e-13
+                                 0x3d359b464b262627ll,  // 7.676185498604936e-14
+                                 0xbd0a5022c297fbebll,  // -1.168533287799345e-14
+                                 0x3cdee6d893f65eball,  // 1.715391285555133e-15
+                                 0xbcb184eb721ebbb4ll,  // -2.431279846547955e-16
+                                 0x3c833362977da588ll,  // 3.330794518822238e-17
+                                 0xbc545cb72134d0efll  // -4.415341646479340e-18
+                                 >(t);
+            }
+
+            // sqrt(x) * exp(-x) * I0(x), x > 8, t = 16 / x - 1
+            static inline B i0e_large(const B& t)
+            {
+                return chebyshev<B,
+                                 0x3fd9be62aca809cbll,  // 4.022452055070544e-01
+                                 0x3f6b998ca2e59049ll,  // 3.369116478255694e-03
+                                 0x3f120fa378999e52ll,  // 6.889758346916825e-05
+                                 0x3ec8412bc101c586ll,  // 2.891370520834757e-06
+                                 0x3e8b8007d9cd616ell,  // 2.048918589469064e-07
+                                 0x3e58569280d6d56dll,  // 2.266668990498178e-08
+                                 0x3e2d2c64a9225b87ll,  // 3.396232025708387e-09
+                                 0x3e00f9ccc0f46f75ll,  // 4.940602388224970e-10
+                                 0x3daa24feabe8004fll,  // 1.188914710784644e-11
+                                 0xbdc1511d08397425ll,  // -3.149916527963242e-11
+                                 0xbdad0fd7357e7bf2ll,  // -1.321581184044771e-11
+                                 0xbd7f904303178d66ll,  // -1.794178531506806e-12
+                                 0x3d694347fa268cecll,  // 7.180124451383666e-13
+                                 0x3d5b1c8c6b83c073ll,  // 3.852778382742143e-13
+                                 0x3d1156ff0d5fc545ll,  // 1.540086217521410e-14
+                                 0xbd275d99cf68bb32ll,  // -4.150569347287222e-14
+                                 0xbd0583fe7e65629all,  // -9.554846698828307e-15
+                                 0x3cf12a919094e6d7ll,  // 3.811680669352622e-15
+                                 0x3cdfee7da3eafb1fll,  // 1.772560133056526e-15
+                                 0xbcb8aee7d908de38ll,  // -3.425485619677219e-16
+                                 0xbcb4600babd21fe4ll,  // -2.827623980516584e-16
+                                 0x3c83f3dd076041cdll,  // 3.461222867697461e-17
+                                 0x3c89be1812d98421ll,  // 4.465621420296760e-17
+                                 0xbc5646da66119130ll,  // -4.830504485944182e-18
+                                 0xbc60adb754ca8b19ll,  // -7.233180487874754e-18
+                                 0x3c324d48c789b293ll,  // 9.921475412173699e-19
+                                 0x3c3604db61ad3deall  // 1.193650890845982e-18
+                                 >(t);
+            }
+        };
+
+        template <class B>
+        inline B bessel_small_arg(const B& x)
+        {
+            return fms(x * x, B(0.03125), B(1.));
+        }
+
+        template <class B>
+        inline B bessel_large_arg(const B& x)
+        {
+            B w = B(64.) / (x * x);
+            return w + w - B(1.);
+        }
+
+        // Terms of the Hankel expansion for x > 8. The shifted cosine and
+        // sine are expanded, cos(x - pi / 4) = (cos(x) + sin(x)) / sqrt(2) and
+        // so on, so that only x itself is reduced; the factor 1 / sqrt(2) is
+        // folded into the scale, sqrt(1 / (pi x)).
+        template <class B>
+        struct bessel_hankel
+        {
+            B p;
+            B q;
+            B scale;
+            B s;
+            B c;
+        };
+
+        template <class B>
+        inline bessel_hankel<B> bessel_hankel_terms(const B& x, const B& p, const B& xq)
+        {
+            bessel_hankel<B> res;
+            res.p = p;
+            res.q = xq / x;
+            // 1 / sqrt(pi), the quotient 1 / (pi x) would be denormal for large x
+            res.scale = B(typename B::value_type(0.56418958354775628695)) / sqrt(x);
+            auto sc = sincos_impl(x);
+            res.s = sc.first;
+            res.c = sc.second;
+            return res;
+        }
+
+        template <class B>
+        inline B j0_small(const B& x)
+        {
+            return bessel_kernel<B>::j0_small(bessel_small_arg(x));
+        }
+
+        template <class B>
+        inline B j1_small(const B& x)
+        {
+            return x * bessel_kernel<B>::j1_small(bessel_small_arg(x));
+        }
+
+        template <class B>
+        inline B bessel_infinity(const B& x, const B& r)
+        {
+#ifndef XSIMD_NO_INFINITIES
+            return select(x == infinity<B>(), B(0.), r);
+#else
+            return r;
+#endif
+        }
+    }
+
+    /*********************
+     * j0 implementation *
+     *********************/
+
+    template <class T, std::size_t N>
+    inline batch<T, N> j0(const batch<T, N>& a)
+    {
+        using b_type = batch<T, N>;
+        using kernel = detail::bessel_kernel<b_type>;
+        b_type x = abs(a);
+        auto small = x <= b_type(8.);
+        b_type r(0.);
+        if (any(small))
+        {
+            r = detail::j0_small(x);
+            if (all(small))
+                return r;
+        }
+        b_type xl = select(small, b_type(8.), x);
+        b_type t = detail::bessel_large_arg(xl);
+        auto h = detail::bessel_hankel_terms(xl, kernel::p0(t), kernel::q0(t));
+        b_type rl = h.scale * fms(h.p, h.c + h.s, h.q * (h.s - h.c));
+        return select(small, r, detail::bessel_infinity(x, rl));
+    }
+
+    /*********************
+     * j1 implementation *
+     *********************/
+
+    template <class T, std::size_t N>
+    inline batch<T, N> j1(const batch<T, N>& a)
+    {
+        using b_type = batch<T, N>;
+        using kernel = detail::bessel_kernel<b_type>;
+        b_type x = abs(a);
+        auto small = x <= b_type(8.);
+        b_type r(0.);
+        if (any(small))
+        {
+            r = detail::j1_small(a);
+            if (all(small))
+                return r;
+        }
+        b_type xl = select(small, b_type(8.), x);
+        b_type t = detail::bessel_large_arg(xl);
+        auto h = detail::bessel_hankel_terms(xl, kernel::p1(t), kernel::q1(t));
+        b_type rl = h.scale * fma(h.p, h.s - h.c, h.q * (h.s + h.c));
+        rl = detail::bessel_infinity(x, rl) ^ bitofsign(a);
+        return select(small, r, rl);
+    }
+
+    /*********************
+     * y0 implementation *
+     *********************/
+
+    template <class T, std::size_t N>
+    inline batch<T, N> y0(const batch<T, N>& x)
+    {
+        using b_type = batch<T, N>;
+        using kernel = detail::bessel_kernel<b_type>;
+        auto small = x <= b_type(8.);
+        b_type r(0.);
+        if (any(small))
+        {
+            b_type xs = select(small, x, b_type(1.));
+            b_type j = detail::j0_small(xs);
+            r = fma(twoopi<b_type>() * log(xs), j, kernel::y0_small(detail::bessel_small_arg(xs)));
+            if (all(small))
+                return r;
+        }
+        b_type xl = select(small, b_type(8.), x);
+        b_type t = detail::bessel_large_arg(xl);
+        auto h = detail::bessel_hankel_terms(xl, kernel::p0(t), kernel::q0(t));
+        b_type rl = h.scale * fma(h.p, h.s - h.c, h.q * (h.c + h.s));
+        return select(small, r, detail::bessel_infinity(x, rl));
+    }
+
+    /*********************
+     * y1 implementation *
+     *********************/
+
+    template <class T, std::size_t N>
+    inline batch<T, N> y1(const batch<T, N>& x)
+    {
+        using b_type = batch<T, N>;
+        using kernel = detail::bessel_kernel<b_type>;
+        auto small = x <= b_type(8.);
+        b_type r(0.);
+        if (any(small))
+        {
+            b_type xs = select(small, x, b_type(1.));
+            b_type j = detail::j1_small(xs);
+            b_type s = fms(log(xs), j, b_type(1.) / xs);
+            r = fma(twoopi<b_type>(), s, xs * kernel::y1_small(detail::bessel_small_arg(xs)));
+            r = select(x == b_type(0.), minusinfinity<b_type>(), r);
+            if (all(small))
+                return r;
+        }
+        b_type xl = select(small, b_type(8.), x);
+        b_type t = detail::bessel_large_arg(xl);
+        auto h = detail::bessel_hankel_terms(xl, kernel::p1(t), kernel::q1(t));
+        b_type rl = h.scale * fms(h.q, h.s - h.c, h.p * (h.s + h.c));
+        return select(small, r, detail::bessel_infinity(x, rl));
+    }
+
+    /**********************
+     * i0e implementation *
+     **********************/
+
+    template <class T, std::size_t N>
+    inline batch<T, N> i0e(const batch<T, N>& a)
+    {
+        using b_type = batch<T, N>;
+        using kernel = detail::bessel_kernel<b_type>;
+        b_type x = abs(a);
+        auto small = x <= b_type(8.);
+        b_type r(0.);
+        if (any(small))
+        {
+            r = kernel::i0e_small(fms(x, b_type(0.25), b_type(1.)));
+            if (all(small))
+                return r;
+        }
+        b_type rl = kernel::i0e_large(b_type(16.) / x - b_type(1.)) / sqrt(x);
+        return select(small, r, rl);
+    }
+}
+
+#endif
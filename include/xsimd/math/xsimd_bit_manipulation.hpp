@@ -0,0 +1,396 @@
+/***************************************************************************
+* Copyright (c) 2016, Johan Mabille and Sylvain Corlay                     *
+*                                                                          *
+* Distributed under the terms of the BSD 3-Clause License.                 *
+*                                                                          *
+* The full license is in the file LICENSE, distributed with this software. *
+****************************************************************************/
+
+#ifndef XSIMD_BIT_MANIPULATION_HPP
+#define XSIMD_BIT_MANIPULATION_HPP
+
+#include <cstdint>
+#include <type_traits>
+
+#include "../types/xsimd_types_include.hpp"
+
+namespace xsimd
+{
+    // The scalars are considered as unsigned integers: the sign bit is
+    // the most significant bit. The generic implementations mask the
+    // results of the right shifts, which are arithmetic for the fallback.
+
+    /**
+     * Computes the number of bits set to 1 in the scalars of \c x.
+     * @param x batch of int32 or int64 values.
+     * @return the batch of bit counts.
+     */
+    template <class T, std::size_t N>
+    batch<T, N> popcount(const batch<T, N>& x);
+
+    /**
+     * Computes the number of consecutive 0 bits in the scalars of \c x,
+     * starting from the most significant bit. Returns the width of the
+     * scalars for zero.
+     * @param x batch of int32 or int64 values.
+     * @return the batch of leading zero counts.
+     */
+    template <class T, std::size_t N>
+    batch<T, N> countl_zero(const batch<T, N>& x);
+
+    /**
+     * Computes the number of consecutive 0 bits in the scalars of \c x,
+     * starting from the least significant bit. Returns the width of the
+     * scalars for zero.
+     * @param x batch of int32 or int64 values.
+     * @return the batch of trailing zero counts.
+     */
+    template <class T, std::size_t N>
+    batch<T, N> countr_zero(const batch<T, N>& x);
+
+    /**
+     * Reverses the order of the bytes in the scalars of \c x.
+     * @param x batch of int32 or int64 values.
+     * @return the batch of byte swapped values.
+     */
+    template <class T, std::size_t N>
+    batch<T, N> byteswap(const batch<T, N>& x);
+
+    /*************************
+     * generic bit functions *
+     *************************/
+
+    namespace detail
+    {
+        // The right shift of integer batches is logical on x86 but
+        // arithmetic on NEON and for the fallback
+        template <class B>
+        inline B logical_shift_right(const B& x, int32_t n)
+        {
+            using unsigned_type = typename std::make_unsigned<typename B::value_type>::type;
+            return (x >> n) & B(static_cast<typename B::value_type>(~unsigned_type(0) >> n));
+        }
+
+        template <class B, class T = typename B::value_type>
+        struct bit_kernel;
+
+        template <class B>
+        struct bit_kernel<B, int32_t>
+        {
+            static inline B popcount(const B& a)
+            {
+                B x = a - ((a >> 1) & B(0x55555555));
+                x = (x & B(0x33333333)) + ((x >> 2) & B(0x33333333));
+                x = (x + (x >> 4)) & B(0x0f0f0f0f);
+                x = x + (x >> 8);
+                x = x + (x >> 16);
+                return x & B(0x3f);
+            }
+
+            // sets all the bits below the most significant bit set
+            static inline B smear_right(const B& a)
+            {
+                B x = a | (a >> 1);
+                x = x | (x >> 2);
+                x = x | (x >> 4);
+                x = x | (x >> 8);
+                return x | (x >> 16);
+            }
+
+            static inline B byteswap(const B& a)
+            {
+                B x = ((a & B(0x00ff00ff)) << 8) | ((a >> 8) & B(0x00ff00ff));
+                return (x << 16) | ((x >> 16) & B(0x0000ffff));
+            }
+
+            static constexpr int32_t width() noexcept
+            {
+                return 32;
+            }
+        };
+
+        template <class B>
+        struct bit_kernel<B, int64_t>
+        {
+            static inline B popcount(const B& a)
+            {
+                B x = a - ((a >> 1) & B(0x5555555555555555ll));
+                x = (x & B(0x3333333333333333ll)) + ((x >> 2) & B(0x3333333333333333ll));
+                x = (x + (x >> 4)) & B(0x0f0f0f0f0f0f0f0fll);
+                x = x + (x >> 8);
+                x = x + (x >> 16);
+                x = x + (x >> 32);
+                return x & B(0x7fll);
+            }
+
+            static inline B smear_right(const B& a)
+            {
+                B x = a | (a >> 1);
+                x = x | (x >> 2);
+                x = x | (x >> 4);
+                x = x | (x >> 8);
+                x = x | (x >> 16);
+                return x | (x >> 32);
+            }
+
+            static inline B byteswap(const B& a)
+            {
+                B x = ((a & B(0x00ff00ff00ff00ffll)) << 8) | ((a >> 8) & B(0x00ff00ff00ff00ffll));
+                x = ((x & B(0x0000ffff0000ffffll)) << 16) | ((x >> 16) & B(0x0000ffff0000ffffll));
+                return (x << 32) | ((x >> 32) & B(0x00000000ffffffffll));
+            }
+
+            static constexpr int64_t width() noexcept
+            {
+                return 64;
+            }
+        };
+
+        // ~x & (x - 1) keeps the trailing zeros of x as ones
+        template <class B>
+        inline B trailing_ones_mask(const B& x)
+        {
+            return ~x & (x - B(1));
+        }
+    }
+
+    /**********************
+     * SSE implementation *
+     **********************/
+
+#if XSIMD_X86_INSTR_SET >= XSIMD_X86_SSSE3_VERSION
+
+    namespace detail
+    {
+        // number of bits set in each byte, looked up by nibble
+        inline __m128i sse_popcount_epi8(__m128i x)
+        {
+            const __m128i lut = _mm_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+            const __m128i low_mask = _mm_set1_epi8(0x0f);
+            __m128i lo = _mm_shuffle_epi8(lut, _mm_and_si128(x, low_mask));
+            __m128i hi = _mm_shuffle_epi8(lut, _mm_and_si128(_mm_srli_epi16(x, 4), low_mask));
+            return _mm_add_epi8(lo, hi);
+        }
+    }
+
+    template <>
+    inline batch<int32_t, 4> popcount(const batch<int32_t, 4>& x)
+    {
+        __m128i c = detail::sse_popcount_epi8(x);
+        return _mm_madd_epi16(_mm_maddubs_epi16(c, _mm_set1_epi8(1)), _mm_set1_epi16(1));
+    }
+
+    template <>
+    inline batch<int64_t, 2> popcount(const batch<int64_t, 2>& x)
+    {
+        return _mm_sad_epu8(detail::sse_popcount_epi8(x), _mm_setzero_si128());
+    }
+
+    template <>
+    inline batch<int32_t, 4> byteswap(const batch<int32_t, 4>& x)
+    {
+        return _mm_shuffle_epi8(x, _mm_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12));
+    }
+
+    template <>
+    inline batch<int64_t, 2> byteswap(const batch<int64_t, 2>& x)
+    {
+        return _mm_shuffle_epi8(x, _mm_setr_epi8(7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8));
+    }
+
+#endif
+
+    /**********************
+     * AVX implementation *
+     **********************/
+
+#if XSIMD_X86_INSTR_SET >= XSIMD_X86_AVX2_VERSION
+
+    namespace detail
+    {
+        inline __m256i avx_popcount_epi8(__m256i x)
+        {
+            const __m256i lut = _mm256_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4,
+                                                 0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+            const __m256i low_mask = _mm256_set1_epi8(0x0f);
+            __m256i lo = _mm256_shuffle_epi8(lut, _mm256_and_si256(x, low_mask));
+            __m256i hi = _mm256_shuffle_epi8(lut, _mm256_and_si256(_mm256_srli_epi16(x, 4), low_mask));
+            return _mm256_add_epi8(lo, hi);
+        }
+    }
+
+    template <>
+    inline batch<int32_t, 8> popcount(const batch<int32_t, 8>& x)
+    {
+        __m256i c = detail::avx_popcount_epi8(x);
+        return _mm256_madd_epi16(_mm256_maddubs_epi16(c, _mm256_set1_epi8(1)), _mm256_set1_epi16(1));
+    }
+
+    template <>
+    inline batch<int64_t, 4> popcount(const batch<int64_t, 4>& x)
+    {
+        return _mm256_sad_epu8(detail::avx_popcount_epi8(x), _mm256_setzero_si256());
+    }
+
+    template <>
+    inline batch<int32_t, 8> byteswap(const batch<int32_t, 8>& x)
+    {
+        return _mm256_shuffle_epi8(x, _mm256_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12,
+                                                       3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12));
+    }
+
+    template <>
+    inline batch<int64_t, 4> byteswap(const batch<int64_t, 4>& x)
+    {
+        return _mm256_shuffle_epi8(x, _mm256_setr_epi8(7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8,
+                                                       7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8));
+    }
+
+#endif
+
+    /*************************
+     * AVX512 implementation *
+     *************************/
+
+#if XSIMD_X86_INSTR_SET >= XSIMD_X86_AVX512_VERSION
+
+#if defined(__AVX512VPOPCNTDQ__)
+    template <>
+    inline batch<int32_t, 16> popcount(const batch<int32_t, 16>& x)
+    {
+        return _mm512_popcnt_epi32(x);
+    }
+
+    template <>
+    inline batch<int64_t, 8> popcount(const batch<int64_t, 8>& x)
+    {
+        return _mm512_popcnt_epi64(x);
+    }
+#endif
+
+#if defined(__AVX512CD__)
+    template <>
+    inline batch<int32_t, 16> countl_zero(const batch<int32_t, 16>& x)
+    {
+        return _mm512_lzcnt_epi32(x);
+    }
+
+    template <>
+    inline batch<int64_t, 8> countl_zero(const batch<int64_t, 8>& x)
+    {
+        return _mm512_lzcnt_epi64(x);
+    }
+
+    // The trailing ones mask has as many leading zeros as x has
+    // significant bits
+
+    template <>
+    inline batch<int32_t, 16> countr_zero(const batch<int32_t, 16>& x)
+    {
+        using btype = batch<int32_t, 16>;
+        return btype(32) - btype(_mm512_lzcnt_epi32(detail::trailing_ones_mask(x)));
+    }
+
+    template <>
+    inline batch<int64_t, 8> countr_zero(const batch<int64_t, 8>& x)
+    {
+        using btype = batch<int64_t, 8>;
+        return btype(64) - btype(_mm512_lzcnt_epi64(detail::trailing_ones_mask(x)));
+    }
+#endif
+
+#if defined(__AVX512BW__)
+    template <>
+    inline batch<int32_t, 16> byteswap(const batch<int32_t, 16>& x)
+    {
+        const __m512i mask = _mm512_set_epi64(0x0c0d0e0f08090a0bll, 0x0405060700010203ll,
+                                              0x0c0d0e0f08090a0bll, 0x0405060700010203ll,
+                                              0x0c0d0e0f08090a0bll, 0x0405060700010203ll,
+                                              0x0c0d0e0f08090a0bll, 0x0405060700010203ll);
+        return _mm512_shuffle_epi8(x, mask);
+    }
+
+    template <>
+    inline batch<int64_t, 8> byteswap(const batch<int64_t, 8>& x)
+    {
+        const __m512i mask = _mm512_set_epi64(0x08090a0b0c0d0e0fll, 0x0001020304050607ll,
+                                              0x08090a0b0c0d0e0fll, 0x0001020304050607ll,
+                                              0x08090a0b0c0d0e0fll, 0x0001020304050607ll,
+                                              0x08090a0b0c0d0e0fll, 0x0001020304050607ll);
+        return _mm512_shuffle_epi8(x, mask);
+    }
+#endif
+
+#endif
+
+    /***********************
+     * NEON implementation *
+     ***********************/
+
+#if XSIMD_ARM_INSTR_SET >= XSIMD_ARM7_NEON_VERSION
+
+    template <>
+    inline batch<int32_t, 4> popcount(const batch<int32_t, 4>& x)
+    {
+        uint8x16_t c = vcntq_u8(vreinterpretq_u8_s32(x));
+        return vreinterpretq_s32_u32(vpaddlq_u16(vpaddlq_u8(c)));
+    }
+
+    template <>
+    inline batch<int64_t, 2> popcount(const batch<int64_t, 2>& x)
+    {
+        uint8x16_t c = vcntq_u8(vreinterpretq_u8_s64(x));
+        return vreinterpretq_s64_u64(vpaddlq_u32(vpaddlq_u16(vpaddlq_u8(c))));
+    }
+
+    template <>
+    inline batch<int32_t, 4> countl_zero(const batch<int32_t, 4>& x)
+    {
+        return vclzq_s32(x);
+    }
+
+    template <>
+    inline batch<int32_t, 4> byteswap(const batch<int32_t, 4>& x)
+    {
+        return vreinterpretq_s32_u8(vrev32q_u8(vreinterpretq_u8_s32(x)));
+    }
+
+    template <>
+    inline batch<int64_t, 2> byteswap(const batch<int64_t, 2>& x)
+    {
+        return vreinterpretq_s64_u8(vrev64q_u8(vreinterpretq_u8_s64(x)));
+    }
+
+#endif
+
+    /**************************
+     * generic implementation *
+     **************************/
+
+    template <class T, std::size_t N>
+    inline batch<T, N> popcount(const batch<T, N>& x)
+    {
+        return detail::bit_kernel<batch<T, N>>::popcount(x);
+    }
+
+    template <class T, std::size_t N>
+    inline batch<T, N> countl_zero(const batch<T, N>& x)
+    {
+        using kernel = detail::bit_kernel<batch<T, N>>;
+        return batch<T, N>(kernel::width()) - popcount(kernel::smear_right(x));
+    }
+
+    template <class T, std::size_t N>
+    inline batch<T, N> countr_zero(const batch<T, N>& x)
+    {
+        return popcount(detail::trailing_ones_mask(x));
+    }
+
+    template <class T, std::size_t N>
+    inline batch<T, N> byteswap(const batch<T, N>& x)
+    {
+        return detail::bit_kernel<batch<T, N>>::byteswap(x);
+    }
+}
+
+#endif
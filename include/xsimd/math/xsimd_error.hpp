@@ -12,6 +12,7 @@
 #include "xsimd_exponential.hpp"
 #include "xsimd_fp_sign.hpp"
 #include "xsimd_horner.hpp"
+#include "xsimd_logarithm.hpp"
 
 namespace xsimd
 {
@@ -31,6 +32,32 @@ namespace xsimd
     template <class T, std::size_t N>
     batch<T, N> erfc(const batch<T, N>& x);
 
+    /**
+     * Computes the inverse error function of the batch \c x.
+     * @param x batch of floating point values in [-1, 1].
+     * @return the inverse error function of \c x.
+     */
+    template <class T, std::size_t N>
+    batch<T, N> erfinv(const batch<T, N>& x);
+
+    /**
+     * Computes the inverse complementary error function of the batch \c x.
+     * @param x batch of floating point values in [0, 2].
+     * @return the inverse complementary error function of \c x.
+     */
+    template <class T, std::size_t N>
+    batch<T, N> erfcinv(const batch<T, N>& x);
+
+    /**
+     * Computes the quantile function of the standard normal distribution,
+     * that is the inverse of its cumulative distribution function, for
+     * the batch \c p.
+     * @param p batch of probabilities in [0, 1].
+     * @return the standard normal quantile of \c p.
+     */
+    template <class T, std::size_t N>
+    batch<T, N> normal_quantile(const batch<T, N>& p);
+
     /**********************
      * erf implementation *
      **********************/
@@ -356,6 +383,214 @@ namespace xsimd
     {
         return detail::erfc_impl<batch<T, N>>::compute(x);
     }
+
+    /*************************
+     * erfinv implementation *
+     *************************/
+
+    namespace detail
+    {
+        /* origin: Algorithm AS 241, Applied Statistics 37 (1988) */
+        /*
+         * ====================================================
+         * M. J. Wichura, The percentage points of the normal
+         * distribution. PPND7 for float and PPND16 for double.
+         * ====================================================
+         */
+        template <class B, class T = typename B::value_type>
+        struct erfinv_kernel;
+
+        template <class B>
+        struct erfinv_kernel<B, float>
+        {
+            // |p - 1/2| <= 0.425, x is 0.180625 - (p - 1/2)^2
+            static inline B central(const B& x)
+            {
+                return polynomial<B,
+                                  0x4058c6c8,  //   3.387132717900000e+00
+                                  0x4249bcb2,  //   5.043427193800000e+01
+                                  0x431f4a88,  //   1.592911320200000e+02
+                                  0x426c7000  //   5.910937472000000e+01
+                                  >(x) /
+                       polynomial<B,
+                                  0x3f800000,  //   1.000000000000000e+00
+                                  0x418f294f,  //   1.789516946900000e+01
+                                  0x429d83f9,  //   7.875775766400000e+01
+                                  0x42866008  //   6.718756360000000e+01
+                                  >(x);
+            }
+
+            // x is sqrt(-log(p)) - 1.6, sqrt(-log(p)) <= 5
+            static inline B intermediate(const B& x)
+            {
+                return polynomial<B,
+                                  0x3fb63331,  //   1.423437277700000e+00
+                                  0x40306faa,  //   2.756815390000000e+00
+                                  0x3fa742e1,  //   1.306728481600000e+00
+                                  0x3e2e52ed  //   1.702382110300000e-01
+                                  >(x) /
+                       polynomial<B,
+                                  0x3f800000,  //   1.000000000000000e+00
+                                  0x3f3cac24,  //   7.370016425000000e-01
+                                  0x3df6315c  //   1.202113297500000e-01
+                                  >(x);
+            }
+
+            // x is sqrt(-log(p)) - 5, sqrt(-log(p)) > 5
+            static inline B tail(const B& x)
+            {
+                return polynomial<B,
+                                  0x40d50d8f,  //   6.657905115000000e+00
+                                  0x404532d0,  //   3.081226386000000e+00
+                                  0x3edb7c55,  //   4.286829433700000e-01
+                                  0x3c8e06c1  //   1.733720399700000e-02
+                                  >(x) /
+                       polynomial<B,
+                                  0x3f800000,  //   1.000000000000000e+00
+                                  0x3e77c954,  //   2.419789422500000e-01
+                                  0x3c48d6a1  //   1.225820263500000e-02
+                                  >(x);
+            }
+        };
+
+        template <class B>
+        struct erfinv_kernel<B, double>
+        {
+            // |p - 1/2| <= 0.425, x is 0.180625 - (p - 1/2)^2
+            static inline B central(const B& x)
+            {
+                return polynomial<B,
+                                  0x400b18d91e9eef75ll,  // 3.387132872796367e+00
+                                  0x4060a4888b1a436ell,  // 1.331416678917844e+02
+                                  0x409ece5d2213c0ccll,  // 1.971590950306551e+03
+                                  0x40cad1d8cd4ee71dll,  // 1.373169376550946e+04
+                                  0x40e66c3e869b752all,  // 4.592195393154987e+04
+                                  0x40f06c1c55b78f20ll,  // 6.726577092700871e+04
+                                  0x40e052d26b2e45e4ll,  // 3.343057558358813e+04
+                                  0x40a39a296f7d925ell  // 2.509080928730123e+03
+                                  >(x) /
+                       polynomial<B,
+                                  0x3ff0000000000000ll,  // 1.000000000000000e+00
+                                  0x4045281b386e1ab5ll,  // 4.231333070160091e+01
+                                  0x4085797efdc8b3f7ll,  // 6.871870074920579e+02
+                                  0x40b512322e75c89fll,  // 5.394196021424751e+03
+                                  0x40d4b772d5d65266ll,  // 2.121379430158660e+04
+                                  0x40e3317caa64f4bell,  // 3.930789580009271e+04
+                                  0x40dc0e457cb1ae76ll,  // 2.872908573572194e+04
+                                  0x40b46a7eca984a16ll  // 5.226495278852546e+03
+                                  >(x);
+            }
+
+            // x is sqrt(-log(p)) - 1.6, sqrt(-log(p)) <= 5
+            static inline B intermediate(const B& x)
+            {
+                return polynomial<B,
+                                  0x3ff6c665fde9526all,  // 1.423437110749683e+00
+                                  0x4012857748cab19bll,  // 4.630337846156546e+00
+                                  0x401713f71462256all,  // 5.769497221460691e+00
+                                  0x400d2ecb1a3d02c4ll,  // 3.647848324763205e+00
+                                  0x3ff453cc085375b2ll,  // 1.270458252452368e+00
+                                  0x3fcef2abb9b85c37ll,  // 2.417807251774506e-01
+                                  0x3f9744eb6c45ec67ll,  // 2.272384498926918e-02
+                                  0x3f49615ac0b7ace9ll  // 7.745450142783414e-04
+                                  >(x) /
+                       polynomial<B,
+                                  0x3ff0000000000000ll,  // 1.000000000000000e+00
+                                  0x40006cefbb46a449ll,  // 2.053191626637759e+00
+                                  0x3ffad278e6526633ll,  // 1.676384830183804e+00
+                                  0x3fe61292f23385c9ll,  // 6.897673349851000e-01
+                                  0x3fc2f5123394f040ll,  // 1.481039764274801e-01
+                                  0x3f8f207a7eab17bfll,  // 1.519866656361646e-02
+                                  0x3f41f18cbfdf2728ll,  // 5.475938084995345e-04
+                                  0x3e120d3f686439e4ll  // 1.050750071644417e-09
+                                  >(x);
+            }
+
+            // x is sqrt(-log(p)) - 5, sqrt(-log(p)) > 5
+            static inline B tail(const B& x)
+            {
+                return polynomial<B,
+                                  0x401aa1b1c13ee526ll,  // 6.657904643501103e+00
+                                  0x4015daea6e875003ll,  // 5.463784911164114e+00
+                                  0x3ffc8ea6461fa445ll,  // 1.784826539917291e+00
+                                  0x3fd2fad9315255cfll,  // 2.965605718285049e-01
+                                  0x3f9b2b41193b4ee7ll,  // 2.653218952657612e-02
+                                  0x3f545c1908425345ll,  // 1.242660947388078e-03
+                                  0x3efc6ec6cc59e02all,  // 2.711555568743488e-05
+                                  0x3e8afb74d693bf93ll  // 2.010334399292288e-07
+                                  >(x) /
+                       polynomial<B,
+                                  0x3ff0000000000000ll,  // 1.000000000000000e+00
+                                  0x3fe331d34fc7d77fll,  // 5.998322065558880e-01
+                                  0x3fc186eb183443fbll,  // 1.369298809227358e-01
+                                  0x3f8e76f93215462all,  // 1.487536129085061e-02
+                                  0x3f49c8bc979dc5d7ll,  // 7.868691311456133e-04
+                                  0x3ef35c2c496374bfll,  // 1.846318317510055e-05
+                                  0x3e831446f740b9e0ll,  // 1.421511758316446e-07
+                                  0x3ce269bff1f8c190ll  // 2.044263103389940e-15
+                                  >(x);
+            }
+        };
+
+        // Standard normal quantile of p, given q = p - 1/2 and the tail
+        // probability pt = min(p, 1 - p). Callers compute both without
+        // cancellation, so that the result is accurate in the center and
+        // in both tails.
+        template <class B>
+        inline B ndtri_impl(const B& q, const B& pt)
+        {
+            using kernel = erfinv_kernel<B>;
+            auto test1 = abs(q) <= B(0.425);
+            B r1 = B(0.);
+            if (any(test1))
+            {
+                r1 = q * kernel::central(fnma(q, q, B(0.180625)));
+                if (all(test1))
+                    return r1;
+            }
+            B r = sqrt(-log(pt));
+            auto test2 = r <= B(5.);
+            B r2 = B(0.);
+            if (any(test2))
+            {
+                r2 = kernel::intermediate(r - B(1.6));
+            }
+            if (!all(test2))
+            {
+                r2 = select(test2, r2, kernel::tail(r - B(5.)));
+            }
+#ifndef XSIMD_NO_INFINITIES
+            r2 = select(pt == B(0.), infinity<B>(), r2);
+#endif
+            r2 = r2 ^ bitofsign(q);
+            return select(test1, r1, r2);
+        }
+    }
+
+    template <class T, std::size_t N>
+    inline batch<T, N> erfinv(const batch<T, N>& x)
+    {
+        using b_type = batch<T, N>;
+        b_type q = x * b_type(0.5);
+        b_type pt = (b_type(1.) - abs(x)) * b_type(0.5);
+        return detail::ndtri_impl(q, pt) * b_type(0.707106781186547524400844362104849039);
+    }
+
+    template <class T, std::size_t N>
+    inline batch<T, N> erfcinv(const batch<T, N>& x)
+    {
+        using b_type = batch<T, N>;
+        b_type q = (x - b_type(1.)) * b_type(0.5);
+        b_type pt = min(x, b_type(2.) - x) * b_type(0.5);
+        return detail::ndtri_impl(q, pt) * b_type(-0.707106781186547524400844362104849039);
+    }
+
+    template <class T, std::size_t N>
+    inline batch<T, N> normal_quantile(const batch<T, N>& p)
+    {
+        using b_type = batch<T, N>;
+        return detail::ndtri_impl(p - b_type(0.5), min(p, b_type(1.) - p));
+    }
 }
 
 #endif
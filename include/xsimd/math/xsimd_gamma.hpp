@@ -9,6 +9,10 @@
 #ifndef XSIMD_GAMMA_HPP
 #define XSIMD_GAMMA_HPP
 
+#include <cstddef>
+#include <limits>
+#include <utility>
+
 #include "xsimd_basic_math.hpp"
 #include "xsimd_exponential.hpp"
 #include "xsimd_horner.hpp"
@@ -33,6 +37,48 @@ namespace xsimd
     template <class T, std::size_t N>
     batch<T, N> lgamma(const batch<T, N>& x);
 
+    /**
+     * Computes the digamma function, the logarithmic derivative of the
+     * gamma function, of the batch \c x.
+     * @param x batch of floating point values.
+     * @return the digamma function of \c x.
+     */
+    template <class T, std::size_t N>
+    batch<T, N> digamma(const batch<T, N>& x);
+
+    /**
+     * Computes the regularized lower incomplete gamma function
+     * P(a, x) = gamma(a, x) / Gamma(a) of the batches \c a and \c x.
+     * The prefactor x^a * exp(-x) / Gamma(a) is computed from lgamma, so
+     * that the relative error slowly grows with \c a.
+     * @param a batch of positive floating point values.
+     * @param x batch of non-negative floating point values.
+     * @return the regularized lower incomplete gamma function of \c a and \c x.
+     */
+    template <class T, std::size_t N>
+    batch<T, N> gamma_p(const batch<T, N>& a, const batch<T, N>& x);
+
+    /**
+     * Computes the regularized upper incomplete gamma function
+     * Q(a, x) = 1 - P(a, x) of the batches \c a and \c x.
+     * @param a batch of positive floating point values.
+     * @param x batch of non-negative floating point values.
+     * @return the regularized upper incomplete gamma function of \c a and \c x.
+     */
+    template <class T, std::size_t N>
+    batch<T, N> gamma_q(const batch<T, N>& a, const batch<T, N>& x);
+
+    /**
+     * Computes the regularized incomplete beta function I_x(a, b)
+     * of the batches \c a, \c b and \c x.
+     * @param a batch of positive floating point values.
+     * @param b batch of positive floating point values.
+     * @param x batch of floating point values in [0, 1].
+     * @return the regularized incomplete beta function of \c a, \c b and \c x.
+     */
+    template <class T, std::size_t N>
+    batch<T, N> ibeta(const batch<T, N>& a, const batch<T, N>& b, const batch<T, N>& x);
+
     /*************************
      * tgamma implementation *
      *************************/
@@ -274,8 +320,10 @@ namespace xsimd
                 if (all(test))
                     return select(nan_result, nan<B>(), r);
             }
-            B r1 = tgamma_other(a, test);
-            B r2 = select(test, r, r1);
+            // the recurrence of tgamma_other would take a steps to overflow
+            auto overflow = a > maxgamma<B>();
+            B r1 = tgamma_other(a, test || overflow);
+            B r2 = select(test, r, select(overflow, infinity<B>(), r1));
             return select(a == B(0.), copysign(infinity<B>(), a), select(nan_result, nan<B>(), r2));
         }
     }
@@ -481,7 +529,7 @@ namespace xsimd
                     if (any(xge075t))
                     {
                         kernelC = xge075t;
-                        r0x = select(xge075t, x - B(1.), x);
+                        r0x = select(xge075t, x - B(1.), r0x);
                         r0z = select(xge075t, B(1.), r0z);
                         r0s = select(xge075t, B(-1.), r0s);
                         p = lgamma_kernel<B>::gammalnC(r0x);
@@ -536,7 +584,8 @@ namespace xsimd
                     if (all(test))
                         return select(inf_result, nan<B>(), r);
                 }
-                B r1 = other(a);
+                // the recurrence of other does not end for large negative lanes
+                B r1 = other(select(test, B(2.), a));
                 B r2 = select(test, r, r1);
                 return select(a == minusinfinity<B>(), nan<B>(), select(inf_result, infinity<B>(), r2));
             }
@@ -602,6 +651,327 @@ namespace xsimd
     {
         return detail::lgamma_impl<batch<T, N>>::compute(x);
     }
+
+    /**************************
+     * digamma implementation *
+     **************************/
+
+    namespace detail
+    {
+        template <class B, class T = typename B::value_type>
+        struct digamma_kernel;
+
+        template <class B>
+        struct digamma_kernel<B, float>
+        {
+            // log(x) - 1 / (2x) - digamma(x) = z * P(z), z = 1 / x^2, x >= 10
+            static inline B asymptotic(const B& z)
+            {
+                return polynomial<B,
+                                  0x3daaaaab,  //   1/12
+                                  0xbc088889,  //  -1/120
+                                  0x3b820821,  //   1/252
+                                  0xbb888889  //  -1/240
+                                  >(z);
+            }
+
+            // x * digamma(x) / (x - x0), 1 <= x <= 2, t = 2x - 3
+            static inline B central(const B& t)
+            {
+                return chebyshev<B,
+                                 0x3fb59456,  //   1.418589353561401e+00
+                                 0x3e235c27,  //   1.595312207937241e-01
+                                 0xbc03c57f,  //  -8.042692206799984e-03
+                                 0x3a1885a2,  //   5.818252684548497e-04
+                                 0xb84c1262,  //  -4.865451046498492e-05
+                                 0x3692f0c8,  //   4.379169695312157e-06
+                                 0xb4dc9f7a,  //  -4.109422775400162e-07
+                                 0x3329ddae,  //   3.954999527877590e-08
+                                 0xb184e472  //  -3.867676845459300e-09
+                                 >(t);
+            }
+
+            // positive root x0 of digamma, as a sum of two floats
+            static inline B root_hi()
+            {
+                return B(detail::caster32_t(uint32_t(0x3fbb16c3)).f);
+            }
+
+            static inline B root_lo()
+            {
+                return B(detail::caster32_t(uint32_t(0x3255af90)).f);
+            }
+        };
+
+        template <class B>
+        struct digamma_kernel<B, double>
+        {
+            // log(x) - 1 / (2x) - digamma(x) = z * P(z), z = 1 / x^2, x >= 10
+            static inline B asymptotic(const B& z)
+            {
+                return polynomial<B,
+                                  0x3fb5555555555555ll,  // 1/12
+                                  0xbf81111111111111ll,  // -1/120
+                                  0x3f70410410410410ll,  // 1/252
+                                  0xbf71111111111111ll,  // -1/240
+                                  0x3f7f07c1f07c1f08ll,  // 1/132
+                                  0xbf95995995995996ll,  // -691/32760
+                                  0x3fb5555555555555ll  // 1/12
+                                  >(z);
+            }
+
+            // x * digamma(x) / (x - x0), 1 <= x <= 2, t = 2x - 3
+            static inline B central(const B& t)
+            {
+                return chebyshev<B,
+                                 0x3ff6b28ac42a5705ll,  // 1.418589369078689e+00
+                                 0x3fc46b84ea0d72call,  // 1.595312254747994e-01
+                                 0xbf8078afe5756460ll,  // -8.042692365665072e-03
+                                 0x3f4310b441f79c54ll,  // 5.818252720332187e-04
+                                 0xbf09824c31d12da3ll,  // -4.865450885257617e-05
+                                 0x3ed25e18f6058d23ll,  // 4.379169553511770e-06
+                                 0xbe9b93ef3cd4fad3ll,  // -4.109422747262246e-07
+                                 0x3e653bb5b81b4c28ll,  // 3.954999440243587e-08
+                                 0xbe309c8e44ed77a5ll,  // -3.867676913843583e-09
+                                 0x3dfa436a6ff73193ll,  // 3.821819388440119e-10
+                                 0xbdc4e7d42528129all,  // -3.802703000107295e-11
+                                 0x3d90b7fa3ce35de1ll,  // 3.801383644823147e-12
+                                 0xbd5ad372b31f382bll,  // -3.812199470367741e-13
+                                 0x3d2591b568ec4f14ll,  // 3.831455036746569e-14
+                                 0xbcf15e73d468c0ddll,  // -3.856682733464439e-15
+                                 0x3cbc00c9267f998cll,  // 3.886206538695648e-16
+                                 0xbc86973c91ffb0adll,  // -3.918873555447008e-17
+                                 0x3c523bebe3f6a2d1ll  // 3.953883260969791e-18
+                                 >(t);
+            }
+
+            // positive root x0 of digamma, as a sum of two doubles
+            static inline B root_hi()
+            {
+                return B(detail::caster64_t(uint64_t(0x3ff762d86356be3f)).f);
+            }
+
+            static inline B root_lo()
+            {
+                return B(detail::caster64_t(uint64_t(0x3c9b86a722197829)).f);
+            }
+        };
+
+        /*
+         * Negative arguments are reflected, digamma(x) = digamma(1 - x) - pi / tan(pi x).
+         * Arguments below 10 are brought back to [1, 2] with the recurrence
+         * digamma(x + 1) = digamma(x) + 1 / x, where the expansion factors
+         * out the positive root so that the relative error stays small
+         * around it. Larger arguments use the asymptotic expansion.
+         */
+        template <class B>
+        inline B digamma_impl(const B& a)
+        {
+            using kernel = digamma_kernel<B>;
+            auto negative = a < B(0.);
+            B x = select(negative, B(1.) - a, a);
+            auto large = x >= B(10.);
+            B r(0.);
+            if (any(large))
+            {
+                B w = B(1.) / x;
+                r = log(x) - fma(w * w, kernel::asymptotic(w * w), B(0.5) * w);
+            }
+            if (!all(large))
+            {
+                B y = select(large, B(1.5), x);
+                B acc(0.);
+                auto down = y > B(2.);
+                while (any(down))
+                {
+                    y = select(down, y - B(1.), y);
+                    acc += select(down, B(1.) / y, B(0.));
+                    down = y > B(2.);
+                }
+                auto up = y < B(1.);
+                if (any(up))
+                {
+                    acc -= select(up, B(1.) / y, B(0.));
+                    y = select(up, y + B(1.), y);
+                }
+                B p = ((y - kernel::root_hi()) - kernel::root_lo()) * kernel::central(fms(B(2.), y, B(3.)));
+                r = select(large, r, p / y + acc);
+            }
+            if (any(negative))
+            {
+                auto sc = sincospi(a);
+                B reflected = fnma(pi<B>(), sc.second / sc.first, r);
+                reflected = select(is_flint(a), nan<B>(), reflected);
+                r = select(negative, reflected, r);
+            }
+            return r;
+        }
+    }
+
+    template <class T, std::size_t N>
+    inline batch<T, N> digamma(const batch<T, N>& x)
+    {
+        return detail::digamma_impl(x);
+    }
+
+    /********************************************
+     * incomplete gamma and beta implementation *
+     ********************************************/
+
+    namespace detail
+    {
+        // Floor of the modified Lentz algorithm, replacing the zero
+        // denominators of the continued fractions
+        template <class B>
+        inline B lentz_floor(const B& x)
+        {
+            using value_type = typename B::value_type;
+            const B tiny = B(std::numeric_limits<value_type>::min() / std::numeric_limits<value_type>::epsilon());
+            return select(abs(x) < tiny, tiny, x);
+        }
+
+        constexpr std::size_t special_function_max_iterations = 1000;
+
+        /*
+         * Regularized incomplete gamma functions P(a, x) and Q(a, x) = 1 - P(a, x),
+         * with the prefactor x^a * exp(-x) / gamma(a) computed from lgamma.
+         * For x < a + 1, P is given by the series
+         *
+         *     P(a, x) = x^a * exp(-x) / gamma(a + 1) * sum(x^n / ((a + 1) ... (a + n)))
+         *
+         * otherwise Q by its continued fraction, evaluated with the modified
+         * Lentz algorithm. Lanes iterate until all of them have converged;
+         * the number of iterations grows as sqrt(a).
+         */
+        template <class B>
+        inline std::pair<B, B> gamma_pq_impl(const B& a, const B& x)
+        {
+            using value_type = typename B::value_type;
+            const B eps = B(std::numeric_limits<value_type>::epsilon());
+            B prefix = exp(fms(a, log(x), x) - lgamma(a));
+            auto series = x < a + B(1.);
+            B p(0.), q(0.);
+            if (any(series))
+            {
+                B ap = a;
+                B del = B(1.) / a;
+                B sum = del;
+                auto active = series;
+                for (std::size_t n = 0; n < special_function_max_iterations && any(active); ++n)
+                {
+                    ap += B(1.);
+                    del *= x / ap;
+                    sum += del;
+                    active = active && (abs(del) >= abs(sum) * eps);
+                }
+                p = prefix * sum;
+            }
+            if (!all(series))
+            {
+                B b = x + B(1.) - a;
+                B c = B(1.) / lentz_floor(B(0.));
+                B d = B(1.) / b;
+                B h = d;
+                auto active = !series;
+                for (std::size_t n = 1; n < special_function_max_iterations && any(active); ++n)
+                {
+                    B i = B(value_type(n));
+                    B an = i * (a - i);
+                    b += B(2.);
+                    d = lentz_floor(fma(an, d, b));
+                    c = lentz_floor(b + an / c);
+                    d = B(1.) / d;
+                    B del = d * c;
+                    h *= del;
+                    active = active && (abs(del - B(1.)) >= eps);
+                }
+                q = prefix * h;
+            }
+            B rp = select(series, p, B(1.) - q);
+            B rq = select(series, B(1.) - p, q);
+            auto invalid = a <= B(0.) || x < B(0.);
+            rp = select(invalid, nan<B>(), rp);
+            rq = select(invalid, nan<B>(), rq);
+#ifndef XSIMD_NO_INFINITIES
+            auto inf_result = (x == infinity<B>()) && (a < infinity<B>()) && (a > B(0.));
+            rp = select(inf_result, B(1.), rp);
+            rq = select(inf_result, B(0.), rq);
+#endif
+            return std::make_pair(rp, rq);
+        }
+
+        // Continued fraction of the incomplete beta function, modified Lentz algorithm
+        template <class B>
+        inline B ibeta_fraction(const B& a, const B& b, const B& x)
+        {
+            using value_type = typename B::value_type;
+            const B eps = B(std::numeric_limits<value_type>::epsilon());
+            B qab = a + b;
+            B qap = a + B(1.);
+            B qam = a - B(1.);
+            B c = B(1.);
+            B d = B(1.) / lentz_floor(fnma(qab, x / qap, B(1.)));
+            B h = d;
+            auto active = x == x;
+            for (std::size_t n = 1; n < special_function_max_iterations && any(active); ++n)
+            {
+                B m = B(value_type(n));
+                B m2 = m + m;
+                B aa = m * (b - m) * x / ((qam + m2) * (a + m2));
+                d = B(1.) / lentz_floor(fma(aa, d, B(1.)));
+                c = lentz_floor(B(1.) + aa / c);
+                h *= d * c;
+                aa = -(a + m) * (qab + m) * x / ((a + m2) * (qap + m2));
+                d = B(1.) / lentz_floor(fma(aa, d, B(1.)));
+                c = lentz_floor(B(1.) + aa / c);
+                B del = d * c;
+                h *= del;
+                active = active && (abs(del - B(1.)) >= eps);
+            }
+            return h;
+        }
+
+        /*
+         * Regularized incomplete beta function I_x(a, b), from the continued
+         * fraction of I_x(a, b) for x < (a + 1) / (a + b + 2) and of
+         * I_{1 - x}(b, a) = 1 - I_x(a, b) otherwise, where it converges fast.
+         */
+        template <class B>
+        inline B ibeta_impl(const B& a, const B& b, const B& x)
+        {
+            B y = B(1.) - x;
+            B lbt = lgamma(a + b) - lgamma(a) - lgamma(b) + fma(a, log(x), b * log1p(-x));
+            B bt = exp(lbt);
+            auto swap = x >= (a + B(1.)) / (a + b + B(2.));
+            B sa = select(swap, b, a);
+            B sb = select(swap, a, b);
+            B sx = select(swap, y, x);
+            B r = bt * ibeta_fraction(sa, sb, sx) / sa;
+            r = select(swap, B(1.) - r, r);
+            r = select(x == B(0.), B(0.), r);
+            r = select(x == B(1.), B(1.), r);
+            auto invalid = a <= B(0.) || b <= B(0.) || x < B(0.) || x > B(1.);
+            return select(invalid, nan<B>(), r);
+        }
+    }
+
+    template <class T, std::size_t N>
+    inline batch<T, N> gamma_p(const batch<T, N>& a, const batch<T, N>& x)
+    {
+        return detail::gamma_pq_impl(a, x).first;
+    }
+
+    template <class T, std::size_t N>
+    inline batch<T, N> gamma_q(const batch<T, N>& a, const batch<T, N>& x)
+    {
+        return detail::gamma_pq_impl(a, x).second;
+    }
+
+    template <class T, std::size_t N>
+    inline batch<T, N> ibeta(const batch<T, N>& a, const batch<T, N>& b, const batch<T, N>& x)
+    {
+        return detail::ibeta_impl(a, b, x);
+    }
 }
 
 #endif
@@ -9,6 +9,11 @@
 #ifndef XSIMD_HORNER_HPP
 #define XSIMD_HORNER_HPP
 
+#include <array>
+#include <cstddef>
+#include <type_traits>
+
+#include "../config/xsimd_config.hpp"
 #include "../types/xsimd_types_include.hpp"
 
 namespace xsimd
@@ -87,6 +92,226 @@ namespace xsimd
     {
         return fma(x, horner1<T, c1, args...>(x), detail::coef<T, c0>());
     }
+
+    /**********
+     * estrin *
+     **********/
+
+    /*
+     * Estrin scheme: coefficients are combined pairwise with the argument,
+     * then the resulting coefficients are combined pairwise with the squared
+     * argument, and so on:
+     *
+     *     c0 + c1 x + c2 x^2 + c3 x^3 = (c0 + c1 x) + x^2 (c2 + c3 x)
+     *
+     * This needs a few more operations than the Horner scheme, but the
+     * dependency chain is only log2(degree) fma long instead of degree fma.
+     */
+
+    namespace detail
+    {
+        template <class T, std::size_t N, std::size_t I = 0, bool = (2 * I + 1 < N)>
+        struct estrin_pairs
+        {
+            static inline void run(const std::array<T, N>& c, std::array<T, (N + 1) / 2>& res, const T& x) noexcept
+            {
+                res[I] = fma(x, c[2 * I + 1], c[2 * I]);
+                estrin_pairs<T, N, I + 1>::run(c, res, x);
+            }
+        };
+
+        template <class T, std::size_t N, std::size_t I>
+        struct estrin_pairs<T, N, I, false>
+        {
+            static inline void run(const std::array<T, N>& c, std::array<T, (N + 1) / 2>& res, const T&) noexcept
+            {
+                carry(c, res, std::integral_constant<bool, N % 2 == 1>());
+            }
+
+        private:
+
+            // odd number of coefficients: the last one goes to the next level unchanged
+            static inline void carry(const std::array<T, N>& c, std::array<T, (N + 1) / 2>& res, std::true_type) noexcept
+            {
+                res[I] = c[N - 1];
+            }
+
+            static inline void carry(const std::array<T, N>&, std::array<T, (N + 1) / 2>&, std::false_type) noexcept
+            {
+            }
+        };
+
+        template <class T, std::size_t N>
+        struct estrin_reduction
+        {
+            static inline T run(const std::array<T, N>& c, const T& x) noexcept
+            {
+                std::array<T, (N + 1) / 2> res;
+                estrin_pairs<T, N>::run(c, res, x);
+                return estrin_reduction<T, (N + 1) / 2>::run(res, x * x);
+            }
+        };
+
+        template <class T>
+        struct estrin_reduction<T, 1>
+        {
+            static inline T run(const std::array<T, 1>& c, const T&) noexcept
+            {
+                return c[0];
+            }
+        };
+
+        // Horner scheme on the coefficients c[I], c[I + S], c[I + 2S], ...
+        template <class T, std::size_t N, std::size_t I, std::size_t S, bool = (I + S < N)>
+        struct strided_horner
+        {
+            static inline T run(const std::array<T, N>& c, const T& x) noexcept
+            {
+                return fma(x, strided_horner<T, N, I + S, S>::run(c, x), c[I]);
+            }
+        };
+
+        template <class T, std::size_t N, std::size_t I, std::size_t S>
+        struct strided_horner<T, N, I, S, false>
+        {
+            static inline T run(const std::array<T, N>& c, const T&) noexcept
+            {
+                return c[I];
+            }
+        };
+    }
+
+    template <class T>
+    inline T estrin(const T&) noexcept
+    {
+        return T(0.);
+    }
+
+    template <class T, uint64_t c0, uint64_t... args>
+    inline T estrin(const T& x) noexcept
+    {
+        std::array<T, sizeof...(args) + 1> c = {{detail::coef<T, c0>(), detail::coef<T, args>()...}};
+        return detail::estrin_reduction<T, sizeof...(args) + 1>::run(c, x);
+    }
+
+    /***********
+     * estrin1 *
+     ***********/
+
+    // Same as estrin with an implicit leading coefficient equal to 1, as horner1
+
+    template <class T, uint64_t... args>
+    inline T estrin1(const T& x) noexcept
+    {
+        std::array<T, sizeof...(args) + 1> c = {{detail::coef<T, args>()..., T(1.)}};
+        return detail::estrin_reduction<T, sizeof...(args) + 1>::run(c, x);
+    }
+
+    /**************
+     * polynomial *
+     **************/
+
+    /*
+     * Evaluates a polynomial with the scheme giving the lowest latency for its
+     * degree on the current instruction set: Horner for low degrees, second
+     * order Horner (even and odd parts evaluated in x^2) for medium degrees,
+     * Estrin for high degrees. Thresholds are given by XSIMD_HORNER_MAX_DEGREE
+     * and XSIMD_ESTRIN_MIN_DEGREE (see xsimd_config.hpp).
+     */
+
+    namespace detail
+    {
+        struct horner_scheme_tag {};
+        struct horner2_scheme_tag {};
+        struct estrin_scheme_tag {};
+
+        // the second order Horner scheme reads an odd part, which a constant
+        // does not have: constants must always take the Horner scheme
+        static_assert(XSIMD_HORNER_MAX_DEGREE >= 0, "XSIMD_HORNER_MAX_DEGREE must not be negative");
+        static_assert(XSIMD_ESTRIN_MIN_DEGREE >= 0, "XSIMD_ESTRIN_MIN_DEGREE must not be negative");
+
+        template <std::size_t N>
+        using polynomial_scheme_t = typename std::conditional<(N <= XSIMD_HORNER_MAX_DEGREE + 1),
+                                                              horner_scheme_tag,
+                                                              typename std::conditional<(N < XSIMD_ESTRIN_MIN_DEGREE + 1),
+                                                                                        horner2_scheme_tag,
+                                                                                        estrin_scheme_tag>::type>::type;
+
+        template <class T, std::size_t N>
+        inline T polynomial_eval(const std::array<T, N>& c, const T& x, horner_scheme_tag) noexcept
+        {
+            return strided_horner<T, N, 0, 1>::run(c, x);
+        }
+
+        template <class T, std::size_t N>
+        inline T polynomial_eval(const std::array<T, N>& c, const T& x, horner2_scheme_tag) noexcept
+        {
+            T x2 = x * x;
+            return fma(x, strided_horner<T, N, 1, 2>::run(c, x2), strided_horner<T, N, 0, 2>::run(c, x2));
+        }
+
+        template <class T, std::size_t N>
+        inline T polynomial_eval(const std::array<T, N>& c, const T& x, estrin_scheme_tag) noexcept
+        {
+            return estrin_reduction<T, N>::run(c, x);
+        }
+    }
+
+    template <class T>
+    inline T polynomial(const T&) noexcept
+    {
+        return T(0.);
+    }
+
+    template <class T, uint64_t c0, uint64_t... args>
+    inline T polynomial(const T& x) noexcept
+    {
+        constexpr std::size_t size = sizeof...(args) + 1;
+        std::array<T, size> c = {{detail::coef<T, c0>(), detail::coef<T, args>()...}};
+        return detail::polynomial_eval(c, x, detail::polynomial_scheme_t<size>());
+    }
+
+    /***************
+     * polynomial1 *
+     ***************/
+
+    // Same as polynomial with an implicit leading coefficient equal to 1, as horner1
+
+    template <class T, uint64_t... args>
+    inline T polynomial1(const T& x) noexcept
+    {
+        constexpr std::size_t size = sizeof...(args) + 1;
+        std::array<T, size> c = {{detail::coef<T, args>()..., T(1.)}};
+        return detail::polynomial_eval(c, x, detail::polynomial_scheme_t<size>());
+    }
+
+    /*************
+     * chebyshev *
+     *************/
+
+    /*
+     * Evaluates c0 T0(x) + c1 T1(x) + ... + cn Tn(x), where Tk are the Chebyshev
+     * polynomials of the first kind, with the Clenshaw recurrence. For x in
+     * [-1, 1], the rounding error is bounded by the sum of the magnitudes of
+     * the coefficients, even when the expansion changes sign; the monomial
+     * form of an oscillating function suffers from cancellation instead.
+     */
+
+    template <class T, uint64_t c0, uint64_t... args>
+    inline T chebyshev(const T& x) noexcept
+    {
+        constexpr std::size_t size = sizeof...(args) + 1;
+        std::array<T, size> c = {{detail::coef<T, c0>(), detail::coef<T, args>()...}};
+        T x2 = x + x;
+        T b1(0.), b2(0.);
+        for (std::size_t k = size - 1; k != 0; --k)
+        {
+            T b = fma(x2, b1, c[k] - b2);
+            b2 = b1;
+            b1 = b;
+        }
+        return fma(x, b1, c[0] - b2);
+    }
 }
 
 #endif
@@ -9,7 +9,10 @@
 #ifndef XSIMD_MATH_HPP
 #define XSIMD_MATH_HPP
 
+#include "xsimd_activation.hpp"
 #include "xsimd_basic_math.hpp"
+#include "xsimd_bessel.hpp"
+#include "xsimd_bit_manipulation.hpp"
 #include "xsimd_error.hpp"
 #include "xsimd_exponential.hpp"
 #include "xsimd_fp_manipulation.hpp"
@@ -65,6 +65,7 @@ namespace xsimd
     XSIMD_DEFINE_CONSTANT_HEX(logpi, 0x3f928682, 0x3ff250d048e7a1bd)
     XSIMD_DEFINE_CONSTANT_HEX(logsqrt2pi, 0x3f6b3f8e, 0x3fed67f1c864beb5)
     XSIMD_DEFINE_CONSTANT(maxflint, 16777216.0f, 9007199254740992.0)
+    XSIMD_DEFINE_CONSTANT(maxgamma, 35.0400963f, 171.62437695630271)
     XSIMD_DEFINE_CONSTANT(maxlog, 88.3762626647949f, 709.78271289338400)
     XSIMD_DEFINE_CONSTANT(maxlog2, 127.0f, 1023.)
     XSIMD_DEFINE_CONSTANT(maxlog10, 38.23080825805664f, 308.2547155599167)
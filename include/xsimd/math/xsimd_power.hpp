@@ -9,6 +9,8 @@
 #ifndef XSIMD_POWER_HPP
 #define XSIMD_POWER_HPP
 
+#include <type_traits>
+
 #include "xsimd_basic_math.hpp"
 #include "xsimd_exponential.hpp"
 #include "xsimd_fp_manipulation.hpp"
@@ -30,6 +32,28 @@ namespace xsimd
     template <class T, std::size_t N>
     batch<T, N> pow(const batch<T, N>& x, const batch<T, N>& y);
 
+    /**
+     * Computes the value of the batch \c x raised to the integer
+     * power \c n, using repeated squaring.
+     * @param x batch of floating point values.
+     * @param n integral exponent, common to all the elements of \c x.
+     * @return \c x raised to the power \c n.
+     */
+    template <class T, std::size_t N, class I>
+    typename std::enable_if<std::is_integral<I>::value && !std::is_same<I, bool>::value, batch<T, N>>::type
+    pow(const batch<T, N>& x, I n);
+
+    /**
+     * Computes the value of the batch \c x raised to the power \c E,
+     * known at compile time. The multiplications are unrolled following
+     * the binary addition chain of \c E.
+     * @tparam E integral exponent.
+     * @param x batch of floating point values.
+     * @return \c x raised to the power \c E.
+     */
+    template <int E, class T, std::size_t N>
+    batch<T, N> pow(const batch<T, N>& x);
+
     /**
      * Computes the cubic root of the batch \c x.
      * @param x batch of floating point values.
@@ -52,6 +76,256 @@ namespace xsimd
      * pow implementation *
      **********************/
 
+    namespace detail
+    {
+        /*
+         * pow_kernel computes exp(y * log(a)) for positive normal a. log(a) is
+         * evaluated as an unevaluated sum hi + lo carrying about twice the
+         * working precision, the product y * (hi + lo) keeps the rounding error
+         * of y * hi (recovered with fma) and this error term is fed into the
+         * argument reduction of exp. This avoids the loss of accuracy of the
+         * naive formula when |y * log(a)| is large.
+         *
+         * The range reductions are the ones of log_kernel and exp_reduction.
+         */
+
+        template <class B, class T = typename B::value_type>
+        struct pow_kernel;
+
+        // log(1 + f) + k * log(2) = 2 * s + 2/3 * s^3 + s^5 * Q(s^2) + k * log(2),
+        // where s = f / (2 + f). 2 * s and the s^3 term are computed with their
+        // rounding errors, the result is returned as hi + lo.
+        template <class B>
+        inline B log_ext_finalize(const B& f, const B& dk, B& lo)
+        {
+            using kernel = pow_kernel<B>;
+            B u = B(2.) + f;
+            B u_lo = (B(2.) - u) + f;
+            B s = f / u;
+            B s_lo = (fnma(s, u, f) - s * u_lo) / u;
+            B z = s * s;
+            B z_lo = fma(B(2.) * s, s_lo, fms(s, s, z));
+            B sz = s * z;
+            B sz_lo = fma(s_lo, z, fma(s, z_lo, fms(s, z, sz)));
+            B t = kernel::two_third_hi() * sz;
+            B t_lo = fma(kernel::two_third_lo(), sz, fma(kernel::two_third_hi(), sz_lo, fms(kernel::two_third_hi(), sz, t)));
+            B kh = dk * log_2hi<B>();
+            B hi = kh + (s + s);
+            B hi_lo = (kh - hi) + (s + s);
+            B r = hi + t;
+            hi_lo += (hi - r) + t;
+            lo = hi_lo + fma(sz * z, kernel::log_poly(z), fma(B(2.), s_lo, fma(dk, log_2lo<B>(), t_lo)));
+            hi = r + lo;
+            lo -= hi - r;
+            return hi;
+        }
+
+        template <class B>
+        struct pow_kernel<B, float>
+        {
+            static inline B log_ext(const B& a, B& lo)
+            {
+                using i_type = as_integer_t<B>;
+                i_type ix = bitwise_cast<i_type>(a);
+                ix += 0x3f800000 - 0x3f3504f3;
+                i_type k = (ix >> 23) - 0x7f;
+                ix = (ix & i_type(0x007fffff)) + 0x3f3504f3;
+                B f = bitwise_cast<B>(ix) - B(1.);
+                return log_ext_finalize(f, to_float(k), lo);
+            }
+
+            static inline B log_poly(const B& z)
+            {
+                return polynomial<B,
+                                  0x3ecccccd,  // 2/5
+                                  0x3e924925,  // 2/7
+                                  0x3e638e39,  // 2/9
+                                  0x3e3a2e8c,  // 2/11
+                                  0x3e1d89d9  // 2/13
+                                  >(z);
+            }
+
+            static inline B two_third_hi()
+            {
+                return detail::coef<B, 0x3f2aaaab>();
+            }
+
+            static inline B two_third_lo()
+            {
+                return detail::coef<B, 0xb2aaaaab>();
+            }
+
+            static inline B exp_ext(const B& a, const B& a_lo)
+            {
+                using reducer_t = exp_reduction<B, exp_tag>;
+                B x;
+                B k = reducer_t::reduce(a, x);
+                x = reducer_t::approx(x + a_lo);
+                return ldexp(x, to_int(k));
+            }
+        };
+
+        template <class B>
+        struct pow_kernel<B, double>
+        {
+            static inline B log_ext(const B& a, B& lo)
+            {
+                using i_type = as_integer_t<B>;
+                B x = a;
+                i_type hx = bitwise_cast<i_type>(x) >> 32;
+                hx += 0x3ff00000 - 0x3fe6a09e;
+                i_type k = (hx >> 20) - 0x3ff;
+                B dk = to_float(k);
+                hx = (hx & i_type(0x000fffff)) + 0x3fe6a09e;
+                x = bitwise_cast<B>(hx << 32 | (i_type(0xffffffff) & bitwise_cast<i_type>(x)));
+                return log_ext_finalize(x - B(1.), dk, lo);
+            }
+
+            static inline B log_poly(const B& z)
+            {
+                return polynomial<B,
+                                  0x3fd999999999999aull,  // 2/5
+                                  0x3fd2492492492492ull,  // 2/7
+                                  0x3fcc71c71c71c71cull,  // 2/9
+                                  0x3fc745d1745d1746ull,  // 2/11
+                                  0x3fc3b13b13b13b14ull,  // 2/13
+                                  0x3fc1111111111111ull,  // 2/15
+                                  0x3fbe1e1e1e1e1e1eull,  // 2/17
+                                  0x3fbaf286bca1af28ull,  // 2/19
+                                  0x3fb8618618618618ull,  // 2/21
+                                  0x3fb642c8590b2164ull  // 2/23
+                                  >(z);
+            }
+
+            static inline B two_third_hi()
+            {
+                return detail::coef<B, 0x3fe5555555555555ull>();
+            }
+
+            static inline B two_third_lo()
+            {
+                return detail::coef<B, 0x3c85555555555555ull>();
+            }
+
+            static inline B exp_ext(const B& a, const B& a_lo)
+            {
+                using reducer_t = exp_reduction<B, exp_tag>;
+                B hi, lo, x;
+                B k = reducer_t::reduce(a, hi, lo, x);
+                lo -= a_lo;
+                x = hi - lo;
+                B c = reducer_t::approx(x);
+                c = reducer_t::finalize(x, c, hi, lo);
+                return ldexp(c, to_int(k));
+            }
+        };
+
+        template <class B>
+        inline B pow_ext(const B& a, const B& y)
+        {
+            using kernel = pow_kernel<B>;
+            B lo;
+            B hi = kernel::log_ext(a, lo);
+            B p = y * hi;
+            B p_lo = fma(y, lo, fms(y, hi, p));
+            B z = kernel::exp_ext(p, p_lo);
+            z = select(p <= minlog<B>(), B(0.), z);
+            return select(p >= maxlog<B>(), infinity<B>(), z);
+        }
+
+        // binary addition chain: x^(2k) = (x^k)^2, x^(2k+1) = x * x^(2k);
+        // the exponent is unsigned so that the magnitude of INT_MIN fits
+        template <unsigned E, bool = (E % 2 == 0)>
+        struct ipow_kernel
+        {
+            template <class B>
+            static inline B compute(const B& x)
+            {
+                return x * ipow_kernel<E - 1>::compute(x);
+            }
+        };
+
+        template <unsigned E>
+        struct ipow_kernel<E, true>
+        {
+            template <class B>
+            static inline B compute(const B& x)
+            {
+                B h = ipow_kernel<E / 2>::compute(x);
+                return h * h;
+            }
+        };
+
+        template <>
+        struct ipow_kernel<0, true>
+        {
+            template <class B>
+            static inline B compute(const B&)
+            {
+                return B(1.);
+            }
+        };
+
+        template <>
+        struct ipow_kernel<1, false>
+        {
+            template <class B>
+            static inline B compute(const B& x)
+            {
+                return x;
+            }
+        };
+
+        template <class B, class U>
+        inline B ipow_chain(const B& x, U e)
+        {
+            B base = x;
+            B res(1.);
+            while (e)
+            {
+                if (e & 1)
+                {
+                    res *= base;
+                }
+                base *= base;
+                e >>= 1;
+            }
+            return res;
+        }
+
+        // 1 / x^m is 0 or inf when x^m overflows or is subnormal although
+        // x^-m may be representable, those lanes split the exponent so that
+        // only the final product rounds to a subnormal or huge number
+        template <class T, std::size_t N>
+        inline batch_bool<T, N> ipow_inverse_lost(const batch<T, N>& x, const batch<T, N>& p)
+        {
+            using b_type = batch<T, N>;
+            return isfinite(x) && (x != b_type(0.)) && !(abs(p) >= smallestposval<b_type>() && isfinite(p));
+        }
+
+        template <int E, class B>
+        inline B ipow(const B& x, std::false_type)
+        {
+            return ipow_kernel<static_cast<unsigned>(E)>::compute(x);
+        }
+
+        template <int E, class B>
+        inline B ipow(const B& x, std::true_type)
+        {
+            // -E computed in the unsigned type, it overflows int for INT_MIN
+            constexpr unsigned m = 0u - static_cast<unsigned>(E);
+            B p = ipow_kernel<m>::compute(x);
+            B res = B(1.) / p;
+            auto lost = ipow_inverse_lost(x, p);
+            if (any(lost))
+            {
+                B split = (B(1.) / ipow_kernel<m - m / 2>::compute(x)) * (B(1.) / ipow_kernel<m / 2>::compute(x));
+                res = select(lost, split, res);
+            }
+            return res;
+        }
+    }
+
     /* origin: boost/simd/arch/common/simd/function/pow.hpp*/
     /*
      * ====================================================
@@ -66,13 +340,47 @@ namespace xsimd
     inline batch<T, N> pow(const batch<T, N>& x, const batch<T, N>& y)
     {
         using b_type = batch<T, N>;
+        b_type ax = abs(x);
         auto negx = x < b_type(0.);
-        b_type z = exp(y * log(abs(x)));
+        auto special = !(ax >= smallestposval<b_type>()) || !isfinite(ax) || !isfinite(y);
+        b_type z = detail::pow_ext(select(special, b_type(1.), ax), y);
+        if (any(special))
+        {
+            z = select(special, exp(y * log(ax)), z);
+        }
         z = select(is_odd(y) && negx, -z, z);
         auto invalid = negx && !(is_flint(y) || isinf(y));
         return select(invalid, nan<b_type>(), z);
     }
 
+    template <class T, std::size_t N, class I>
+    inline typename std::enable_if<std::is_integral<I>::value && !std::is_same<I, bool>::value, batch<T, N>>::type
+    pow(const batch<T, N>& x, I n)
+    {
+        using b_type = batch<T, N>;
+        using u_type = typename std::make_unsigned<I>::type;
+        u_type e = n < 0 ? u_type(0) - u_type(n) : u_type(n);
+        b_type p = detail::ipow_chain(x, e);
+        if (n >= 0)
+        {
+            return p;
+        }
+        b_type res = b_type(1.) / p;
+        auto lost = detail::ipow_inverse_lost(x, p);
+        if (any(lost))
+        {
+            b_type split = (b_type(1.) / detail::ipow_chain(x, e - e / 2)) * (b_type(1.) / detail::ipow_chain(x, e / 2));
+            res = select(lost, split, res);
+        }
+        return res;
+    }
+
+    template <int E, class T, std::size_t N>
+    inline batch<T, N> pow(const batch<T, N>& x)
+    {
+        return detail::ipow<E>(x, std::integral_constant<bool, (E < 0)>());
+    }
+
     /***********************
      * cbrt implementation *
      ***********************/
@@ -10,6 +10,8 @@
 #define XSIMD_ROUNDING_HPP
 
 #include <cmath>
+#include <cstdint>
+#include <limits>
 
 #include "xsimd_fp_sign.hpp"
 #include "xsimd_numerical_constant.hpp"
@@ -74,6 +76,51 @@ namespace xsimd
     template <class T, std::size_t N>
     batch<T, N> rint(const batch<T, N>& x);
 
+    // The conversions to_int_nearest, to_int_floor and to_int_ceil round
+    // in a single step where the instruction set allows it; like to_int,
+    // they are undefined for values out of the range of the integer type.
+    // to_int_nearest uses the current rounding mode on SSE and AVX.
+
+    /**
+     * Converts the scalars in \c x to integers, rounding toward zero. Values
+     * out of the range of the integer type are clamped to its lowest or largest
+     * value, NaN is converted to 0.
+     * @param x batch of floating point values.
+     * @return the batch of saturated integer values.
+     */
+    template <class T, std::size_t N>
+    batch<as_integer_t<T>, N> to_int_sat(const batch<T, N>& x);
+
+    /**
+     * Converts the scalars in \c x to the nearest integers, rounding halfway
+     * cases to even. Values out of the range of the integer type are clamped
+     * to its lowest or largest value, NaN is converted to 0.
+     * @param x batch of floating point values.
+     * @return the batch of saturated integer values.
+     */
+    template <class T, std::size_t N>
+    batch<as_integer_t<T>, N> to_int_nearest_sat(const batch<T, N>& x);
+
+    /**
+     * Converts the scalars in \c x to the largest integers not greater than
+     * them. Values out of the range of the integer type are clamped to its
+     * lowest or largest value, NaN is converted to 0.
+     * @param x batch of floating point values.
+     * @return the batch of saturated integer values.
+     */
+    template <class T, std::size_t N>
+    batch<as_integer_t<T>, N> to_int_floor_sat(const batch<T, N>& x);
+
+    /**
+     * Converts the scalars in \c x to the smallest integers not less than
+     * them. Values out of the range of the integer type are clamped to its
+     * lowest or largest value, NaN is converted to 0.
+     * @param x batch of floating point values.
+     * @return the batch of saturated integer values.
+     */
+    template <class T, std::size_t N>
+    batch<as_integer_t<T>, N> to_int_ceil_sat(const batch<T, N>& x);
+
     /**********************
      * SSE implementation *
      **********************/
@@ -426,6 +473,156 @@ namespace xsimd
     {
         return nearbyint(x);
     }
+
+    /*****************************************
+     * saturating conversions implementation *
+     *****************************************/
+
+    namespace detail
+    {
+        struct trunc_conversion
+        {
+            template <class B>
+            static inline as_integer_t<B> convert(const B& x)
+            {
+                return to_int(x);
+            }
+
+            template <class B>
+            static inline B round(const B& x)
+            {
+                return trunc(x);
+            }
+        };
+
+        struct nearest_conversion
+        {
+            template <class B>
+            static inline as_integer_t<B> convert(const B& x)
+            {
+                return to_int_nearest(x);
+            }
+
+            template <class B>
+            static inline B round(const B& x)
+            {
+                return nearbyint(x);
+            }
+        };
+
+        struct floor_conversion
+        {
+            template <class B>
+            static inline as_integer_t<B> convert(const B& x)
+            {
+                return to_int_floor(x);
+            }
+
+            template <class B>
+            static inline B round(const B& x)
+            {
+                return floor(x);
+            }
+        };
+
+        struct ceil_conversion
+        {
+            template <class B>
+            static inline as_integer_t<B> convert(const B& x)
+            {
+                return to_int_ceil(x);
+            }
+
+            template <class B>
+            static inline B round(const B& x)
+            {
+                return ceil(x);
+            }
+        };
+
+        template <class B, class T = typename B::value_type>
+        struct saturated_conversion;
+
+        template <class B>
+        struct saturated_conversion<B, float>
+        {
+            using i_type = as_integer_t<B>;
+
+            template <class C>
+            static inline i_type convert(const B& x)
+            {
+                // -2^31 and the largest float below 2^31
+                B c = min(max(x, B(-2147483648.f)), B(2147483520.f));
+                i_type r = C::convert(select(isnan(x), B(0.f), c));
+                return select(bool_cast(x >= B(2147483648.f)), i_type(std::numeric_limits<int32_t>::max()), r);
+            }
+        };
+
+        template <class B>
+        struct saturated_conversion<B, double>
+        {
+            using i_type = as_integer_t<B>;
+
+            template <class C>
+            static inline i_type convert(const B& x)
+            {
+                // -2^63 and the largest double below 2^63
+                B c = min(max(x, B(-9223372036854775808.)), B(9223372036854774784.));
+                c = select(isnan(x), B(0.), c);
+                i_type r;
+                // the conversion of some instruction sets is limited to the
+                // range of int32
+                if (all(abs(c) < B(2147483647.)))
+                {
+                    r = C::convert(c);
+                }
+                else
+                {
+                    r = integral_to_int64(C::round(c));
+                }
+                return select(bool_cast(x >= B(9223372036854775808.)), i_type(std::numeric_limits<int64_t>::max()), r);
+            }
+
+        private:
+
+            // Exact conversion of integral values: both halves of the split
+            // x = hi * 2^32 + lo are converted by adding 1.5 * 2^52, that
+            // moves them to the low bits of the mantissa
+            static inline i_type integral_to_int64(const B& x)
+            {
+                B hi = floor(x * B(2.3283064365386963e-10));
+                B lo = x - hi * B(4294967296.);
+                B magic(6755399441055744.);
+                i_type ihi = bitwise_cast<i_type>(hi + magic) - bitwise_cast<i_type>(magic);
+                i_type ilo = bitwise_cast<i_type>(lo + magic) - bitwise_cast<i_type>(magic);
+                return (ihi << 32) + ilo;
+            }
+        };
+    }
+
+    template <class T, std::size_t N>
+    inline batch<as_integer_t<T>, N> to_int_sat(const batch<T, N>& x)
+    {
+        return detail::saturated_conversion<batch<T, N>>::template convert<detail::trunc_conversion>(x);
+    }
+
+    template <class T, std::size_t N>
+    inline batch<as_integer_t<T>, N> to_int_nearest_sat(const batch<T, N>& x)
+    {
+        return detail::saturated_conversion<batch<T, N>>::template convert<detail::nearest_conversion>(x);
+    }
+
+    template <class T, std::size_t N>
+    inline batch<as_integer_t<T>, N> to_int_floor_sat(const batch<T, N>& x)
+    {
+        return detail::saturated_conversion<batch<T, N>>::template convert<detail::floor_conversion>(x);
+    }
+
+    template <class T, std::size_t N>
+    inline batch<as_integer_t<T>, N> to_int_ceil_sat(const batch<T, N>& x)
+    {
+        return detail::saturated_conversion<batch<T, N>>::template convert<detail::ceil_conversion>(x);
+    }
 }
 
 #endif
@@ -10,6 +10,7 @@
 #define XSIMD_TRIGO_REDUCTION_HPP
 
 #include <array>
+#include <cmath>
 #include <limits>
 
 #include "xsimd_horner.hpp"
@@ -169,6 +170,9 @@ namespace xsimd
         struct trigo_pi_tag
         {
         };
+        struct trigo_degree_tag
+        {
+        };
 
         template <class B, class Tag = trigo_radian_tag>
         struct trigo_reducer
@@ -248,9 +252,41 @@ namespace xsimd
         {
             static inline B reduce(const B& x, B& xr)
             {
-                B xi = nearbyint(x * B(2.));
-                B x2 = x - xi * B(0.5);
-                xr = x2 * pi<B>();
+                // above 2^(nmb + 1), x is an even integer; x - x gives
+                // NaN for infinities
+                auto big = x >= B(2.) * twotonmb<B>();
+                B xs = select(big, B(0.), x);
+                B xi = nearbyint(xs * B(2.));
+                B x2 = xs - xi * B(0.5);
+                xr = select(big, x - x, x2 * pi<B>());
+                return quadrant(xi);
+            }
+        };
+
+        // x - 90 * xi is exact, multiples of 90 degrees give exact results.
+        // Above 2^(nmb + 1), x is an integer whose quotient by 90 does not
+        // fit in the mantissa (nor in the int32 of the float quadrant): it
+        // is first reduced modulo 360 with fmod, which is exact
+        template <class B>
+        struct trigo_reducer<B, trigo_degree_tag>
+        {
+            static inline B reduce(const B& x, B& xr)
+            {
+                B xs = x;
+                if (any(x >= B(2.) * twotonmb<B>()))
+                {
+                    static constexpr std::size_t size = B::size;
+                    using value_type = typename B::value_type;
+                    alignas(B) std::array<value_type, size> tmp;
+                    for (std::size_t i = 0; i < size; ++i)
+                    {
+                        tmp[i] = std::fmod(x[i], value_type(360.));
+                    }
+                    xs.load_aligned(&tmp[0]);
+                }
+                B xi = nearbyint(xs * B(1. / 90.));
+                B x2 = fnma(xi, B(90.), xs);
+                xr = x2 * B(0.0174532925199432957692369076848861271);
                 return quadrant(xi);
             }
         };
@@ -9,6 +9,8 @@
 #ifndef XSIMD_TRIGONOMETRIC_HPP
 #define XSIMD_TRIGONOMETRIC_HPP
 
+#include <utility>
+
 #include "xsimd_fp_sign.hpp"
 #include "xsimd_invtrigo.hpp"
 #include "xsimd_trigo_reduction.hpp"
@@ -40,6 +42,57 @@ namespace xsimd
     template <class T, std::size_t N>
     batch<T, N> tan(const batch<T, N>& x);
 
+    /**
+     * Computes the sine of the batch \c x multiplied by pi. The argument
+     * reduction is exact, integer values of \c x give an exact zero.
+     * @param x batch of floating point values.
+     * @return the sine of pi times \c x.
+     */
+    template <class T, std::size_t N>
+    batch<T, N> sinpi(const batch<T, N>& x);
+
+    /**
+     * Computes the cosine of the batch \c x multiplied by pi. The argument
+     * reduction is exact, half-integer values of \c x give an exact zero.
+     * @param x batch of floating point values.
+     * @return the cosine of pi times \c x.
+     */
+    template <class T, std::size_t N>
+    batch<T, N> cospi(const batch<T, N>& x);
+
+    /**
+     * Computes the tangent of the batch \c x multiplied by pi.
+     * @param x batch of floating point values.
+     * @return the tangent of pi times \c x.
+     */
+    template <class T, std::size_t N>
+    batch<T, N> tanpi(const batch<T, N>& x);
+
+    /**
+     * Computes the sine and the cosine of the batch \c x multiplied by pi,
+     * sharing the argument reduction.
+     * @param x batch of floating point values.
+     * @return a pair containing the sine and the cosine of pi times \c x.
+     */
+    template <class T, std::size_t N>
+    std::pair<batch<T, N>, batch<T, N>> sincospi(const batch<T, N>& x);
+
+    /**
+     * Computes the sine of the batch \c x expressed in degrees.
+     * @param x batch of floating point values.
+     * @return the sine of \c x degrees.
+     */
+    template <class T, std::size_t N>
+    batch<T, N> sind(const batch<T, N>& x);
+
+    /**
+     * Computes the cosine of the batch \c x expressed in degrees.
+     * @param x batch of floating point values.
+     * @return the cosine of \c x degrees.
+     */
+    template <class T, std::size_t N>
+    batch<T, N> cosd(const batch<T, N>& x);
+
     /**
      * Computes the arc sine of the batch \c x.
      * @param x batch of floating point values.
@@ -102,12 +155,12 @@ namespace xsimd
             return z1 ^ sign_bit;
         }
 
-        template <class B>
-        inline B cos_impl(const B& a)
+        template <class B, class Tag = trigo_radian_tag>
+        inline B cos_impl(const B& a, Tag = Tag())
         {
             const B x = abs(a);
             B xr = nan<B>();
-            const B n = trigo_reducer<B>::reduce(x, xr);
+            const B n = trigo_reducer<B, Tag>::reduce(x, xr);
             auto tmp = select(n >= B(2.), B(1.), B(0.));
             auto swap_bit = fma(B(-2.), tmp, n);
             auto sign_bit = select((swap_bit ^ tmp) != B(0.), signmask<B>(), B(0.));
@@ -118,18 +171,37 @@ namespace xsimd
             return z1 ^ sign_bit;
         }
 
-        template <class B>
-        inline B tan_impl(const B& a)
+        template <class B, class Tag = trigo_radian_tag>
+        inline B tan_impl(const B& a, Tag = Tag())
         {
             const B x = abs(a);
             B xr = nan<B>();
-            const B n = trigo_reducer<B>::reduce(x, xr);
+            const B n = trigo_reducer<B, Tag>::reduce(x, xr);
             auto tmp = select(n >= B(2.), B(1.), B(0.));
             auto swap_bit = fma(B(-2.), tmp, n);
             auto test = (swap_bit == B(0.));
             const B y = trigo_evaluation<B>::tan_eval(xr, test);
             return y ^ bitofsign(a);
         }
+
+        template <class B, class Tag = trigo_radian_tag>
+        inline std::pair<B, B> sincos_impl(const B& a, Tag = Tag())
+        {
+            const B x = abs(a);
+            B xr = nan<B>();
+            const B n = trigo_reducer<B, Tag>::reduce(x, xr);
+            auto tmp = select(n >= B(2.), B(1.), B(0.));
+            auto swap_bit = fma(B(-2.), tmp, n);
+            auto test = (swap_bit == B(0.));
+            const B z = xr * xr;
+            const B se = trigo_evaluation<B>::sin_eval(z, xr);
+            const B ce = trigo_evaluation<B>::cos_eval(z);
+            auto sin_sign_bit = bitofsign(a) ^ select(tmp != B(0.), signmask<B>(), B(0.));
+            auto cos_sign_bit = select((swap_bit ^ tmp) != B(0.), signmask<B>(), B(0.));
+            const B s = select(test, se, ce) ^ sin_sign_bit;
+            const B c = select(test, ce, se) ^ cos_sign_bit;
+            return std::make_pair(s, c);
+        }
     }
 
     template <class T, std::size_t N>
@@ -150,6 +222,42 @@ namespace xsimd
         return detail::tan_impl(x);
     }
 
+    template <class T, std::size_t N>
+    inline batch<T, N> sinpi(const batch<T, N>& x)
+    {
+        return detail::sin_impl(x, detail::trigo_pi_tag());
+    }
+
+    template <class T, std::size_t N>
+    inline batch<T, N> cospi(const batch<T, N>& x)
+    {
+        return detail::cos_impl(x, detail::trigo_pi_tag());
+    }
+
+    template <class T, std::size_t N>
+    inline batch<T, N> tanpi(const batch<T, N>& x)
+    {
+        return detail::tan_impl(x, detail::trigo_pi_tag());
+    }
+
+    template <class T, std::size_t N>
+    inline std::pair<batch<T, N>, batch<T, N>> sincospi(const batch<T, N>& x)
+    {
+        return detail::sincos_impl(x, detail::trigo_pi_tag());
+    }
+
+    template <class T, std::size_t N>
+    inline batch<T, N> sind(const batch<T, N>& x)
+    {
+        return detail::sin_impl(x, detail::trigo_degree_tag());
+    }
+
+    template <class T, std::size_t N>
+    inline batch<T, N> cosd(const batch<T, N>& x)
+    {
+        return detail::cos_impl(x, detail::trigo_degree_tag());
+    }
+
     template <class T, std::size_t N>
     inline batch<T, N> asin(const batch<T, N>& x)
     {
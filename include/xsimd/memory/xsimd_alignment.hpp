@@ -9,6 +9,8 @@
 #ifndef XSIMD_ALIGNMENT_HPP
 #define XSIMD_ALIGNMENT_HPP
 
+#include <cstddef>
+
 #include "../config/xsimd_align.hpp"
 #include "xsimd_aligned_allocator.hpp"
 
@@ -51,6 +53,17 @@ namespace xsimd
     template <class A>
     using allocator_alignment_t = typename allocator_alignment<A>::type;
 
+    namespace detail
+    {
+        // alignment of the buffers allocated by the algorithms, also
+        // defined when no instruction set is available
+#ifdef XSIMD_DEFAULT_ALIGNMENT
+        constexpr std::size_t default_alignment = XSIMD_DEFAULT_ALIGNMENT;
+#else
+        constexpr std::size_t default_alignment = 16;
+#endif
+    }
+
     /***********************
      * container alignment *
      ***********************/
@@ -0,0 +1,114 @@
+/***************************************************************************
+* Copyright (c) 2016, Johan Mabille and Sylvain Corlay                     *
+*                                                                          *
+* Distributed under the terms of the BSD 3-Clause License.                 *
+*                                                                          *
+* The full license is in the file LICENSE, distributed with this software. *
+****************************************************************************/
+
+#ifndef XSIMD_GATHER_HPP
+#define XSIMD_GATHER_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "../types/xsimd_traits.hpp"
+
+namespace xsimd
+{
+    /**
+     * @ingroup data_transfer
+     * Loads the elements of the memory array \c src at the indices
+     * \c index into a batch: the i-th scalar of the result is
+     * src[index[i]]. Uses the gather instructions of AVX2 and AVX512 for
+     * 32 bits indices into float and int32 arrays, and 64 bits indices
+     * into double and int64 arrays; goes through memory otherwise.
+     * @param src the pointer to the memory array.
+     * @param index the batch of indices, non negative.
+     * @return the batch of gathered values.
+     */
+    template <class T, std::size_t N, class I>
+    batch<T, N> gather(const T* src, const batch<I, N>& index);
+
+#if XSIMD_X86_INSTR_SET >= XSIMD_X86_AVX2_VERSION
+    inline batch<float, 4> gather(const float* src, const batch<int32_t, 4>& index)
+    {
+        return _mm_i32gather_ps(src, index, 4);
+    }
+
+    inline batch<double, 2> gather(const double* src, const batch<int64_t, 2>& index)
+    {
+        return _mm_i64gather_pd(src, index, 8);
+    }
+
+    inline batch<int32_t, 4> gather(const int32_t* src, const batch<int32_t, 4>& index)
+    {
+        return _mm_i32gather_epi32(reinterpret_cast<const int*>(src), index, 4);
+    }
+
+    inline batch<int64_t, 2> gather(const int64_t* src, const batch<int64_t, 2>& index)
+    {
+        return _mm_i64gather_epi64(reinterpret_cast<const long long*>(src), index, 8);
+    }
+
+    inline batch<float, 8> gather(const float* src, const batch<int32_t, 8>& index)
+    {
+        return _mm256_i32gather_ps(src, index, 4);
+    }
+
+    inline batch<double, 4> gather(const double* src, const batch<int64_t, 4>& index)
+    {
+        return _mm256_i64gather_pd(src, index, 8);
+    }
+
+    inline batch<int32_t, 8> gather(const int32_t* src, const batch<int32_t, 8>& index)
+    {
+        return _mm256_i32gather_epi32(reinterpret_cast<const int*>(src), index, 4);
+    }
+
+    inline batch<int64_t, 4> gather(const int64_t* src, const batch<int64_t, 4>& index)
+    {
+        return _mm256_i64gather_epi64(reinterpret_cast<const long long*>(src), index, 8);
+    }
+#endif
+
+#if XSIMD_X86_INSTR_SET >= XSIMD_X86_AVX512_VERSION
+    inline batch<float, 16> gather(const float* src, const batch<int32_t, 16>& index)
+    {
+        return _mm512_i32gather_ps(index, src, 4);
+    }
+
+    inline batch<double, 8> gather(const double* src, const batch<int64_t, 8>& index)
+    {
+        return _mm512_i64gather_pd(index, src, 8);
+    }
+
+    inline batch<int32_t, 16> gather(const int32_t* src, const batch<int32_t, 16>& index)
+    {
+        return _mm512_i32gather_epi32(index, src, 4);
+    }
+
+    inline batch<int64_t, 8> gather(const int64_t* src, const batch<int64_t, 8>& index)
+    {
+        return _mm512_i64gather_epi64(index, src, 8);
+    }
+#endif
+
+    template <class T, std::size_t N, class I>
+    inline batch<T, N> gather(const T* src, const batch<I, N>& index)
+    {
+        alignas(batch<I, N>) std::array<I, N> indices;
+        alignas(batch<T, N>) std::array<T, N> values;
+        index.store_aligned(indices.data());
+        for (std::size_t i = 0; i < N; ++i)
+        {
+            values[i] = src[indices[i]];
+        }
+        batch<T, N> res;
+        res.load_aligned(values.data());
+        return res;
+    }
+}
+
+#endif
@@ -0,0 +1,319 @@
+/***************************************************************************
+* Copyright (c) 2016, Johan Mabille and Sylvain Corlay                     *
+*                                                                          *
+* Distributed under the terms of the BSD 3-Clause License.                 *
+*                                                                          *
+* The full license is in the file LICENSE, distributed with this software. *
+****************************************************************************/
+
+#ifndef XSIMD_DISTRIBUTION_HPP
+#define XSIMD_DISTRIBUTION_HPP
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+
+#include "xsimd_random_engine.hpp"
+
+#if defined(XSIMD_BATCH_INT32_SIZE) && defined(XSIMD_BATCH_INT64_SIZE)
+
+namespace xsimd
+{
+    /**
+     * @class simd_distribution
+     * @brief Base class of the random distributions
+     *
+     * Distributions return batches of random values from a generator
+     * returning batches of 64 random bits per lane, such as philox4x32
+     * or xoshiro256plus.
+     *
+     * @tparam D the derived distribution.
+     * @tparam T the floating point type of the values.
+     */
+    template <class D, class T>
+    class simd_distribution
+    {
+    public:
+
+        using value_type = T;
+        using batch_type = simd_type<T>;
+
+        template <class E>
+        void fill(E& engine, T* res, std::size_t n);
+
+    protected:
+
+        simd_distribution() = default;
+        ~simd_distribution() = default;
+
+        simd_distribution(const simd_distribution&) = default;
+        simd_distribution& operator=(const simd_distribution&) = default;
+
+    private:
+
+        D& derived_cast() noexcept;
+    };
+
+    /**
+     * @class uniform_distribution
+     * @brief Uniform distribution on [a, b)
+     */
+    template <class T>
+    class uniform_distribution : public simd_distribution<uniform_distribution<T>, T>
+    {
+    public:
+
+        using batch_type = simd_type<T>;
+
+        explicit uniform_distribution(T a = T(0), T b = T(1));
+
+        template <class E>
+        batch_type operator()(E& engine);
+
+    private:
+
+        T m_a;
+        T m_b;
+        // the largest value below b, which the rounded results are
+        // clamped to
+        T m_last;
+    };
+
+    /**
+     * @class normal_distribution
+     * @brief Normal distribution
+     *
+     * Values are generated by pairs of batches with the Box-Muller
+     * transform, the second batch of a pair is returned by the next call.
+     */
+    template <class T>
+    class normal_distribution : public simd_distribution<normal_distribution<T>, T>
+    {
+    public:
+
+        using batch_type = simd_type<T>;
+
+        explicit normal_distribution(T mean = T(0), T stddev = T(1));
+
+        void reset();
+
+        template <class E>
+        batch_type operator()(E& engine);
+
+    private:
+
+        T m_mean;
+        T m_stddev;
+        batch_type m_cache;
+        bool m_has_cache;
+    };
+
+    /**
+     * @class exponential_distribution
+     * @brief Exponential distribution
+     */
+    template <class T>
+    class exponential_distribution : public simd_distribution<exponential_distribution<T>, T>
+    {
+    public:
+
+        using batch_type = simd_type<T>;
+
+        explicit exponential_distribution(T lambda = T(1));
+
+        template <class E>
+        batch_type operator()(E& engine);
+
+    private:
+
+        T m_lambda;
+    };
+
+    /*************************
+     * unit uniform kernels *
+     *************************/
+
+    namespace detail
+    {
+        // Uniform values in [0, 1): the highest bits of each 64-bit lane for
+        // a double, of each 32-bit half of a lane for a float, become the
+        // mantissa of a number in [1, 2)
+        template <class T>
+        struct unit_uniform_kernel;
+
+        template <>
+        struct unit_uniform_kernel<float>
+        {
+            template <class E>
+            static inline simd_type<float> run(E& engine)
+            {
+                using i_type = simd_type<int32_t>;
+                using b_type = simd_type<float>;
+                i_type bits = bitwise_cast<i_type>(engine());
+                i_type m = detail::logical_shift_right(bits, 9) | i_type(0x3f800000);
+                return bitwise_cast<b_type>(m) - b_type(1.f);
+            }
+        };
+
+        template <>
+        struct unit_uniform_kernel<double>
+        {
+            template <class E>
+            static inline simd_type<double> run(E& engine)
+            {
+                using i_type = simd_type<int64_t>;
+                using b_type = simd_type<double>;
+                i_type bits = engine();
+                i_type m = detail::logical_shift_right(bits, 12) | i_type(0x3ff0000000000000ll);
+                return bitwise_cast<b_type>(m) - b_type(1.);
+            }
+        };
+
+        template <class T, class E>
+        inline simd_type<T> unit_uniform(E& engine)
+        {
+            return unit_uniform_kernel<T>::run(engine);
+        }
+    }
+
+    /************************************
+     * simd_distribution implementation *
+     ************************************/
+
+    /**
+     * Fills the array \c res with \c n random values.
+     * @param engine the generator.
+     * @param res pointer to the output array.
+     * @param n number of values to generate.
+     */
+    template <class D, class T>
+    template <class E>
+    inline void simd_distribution<D, T>::fill(E& engine, T* res, std::size_t n)
+    {
+        constexpr std::size_t size = simd_traits<T>::size;
+        std::size_t vec_size = n - n % size;
+        D& d = derived_cast();
+        for (std::size_t i = 0; i < vec_size; i += size)
+        {
+            d(engine).store_unaligned(res + i);
+        }
+        if (vec_size != n)
+        {
+            alignas(batch_type) std::array<T, size> tmp;
+            d(engine).store_aligned(tmp.data());
+            std::copy(tmp.begin(), tmp.begin() + (n - vec_size), res + vec_size);
+        }
+    }
+
+    template <class D, class T>
+    inline D& simd_distribution<D, T>::derived_cast() noexcept
+    {
+        return *static_cast<D*>(this);
+    }
+
+    /***************************************
+     * uniform_distribution implementation *
+     ***************************************/
+
+    /**
+     * Builds a uniform distribution on [a, b).
+     * @param a the lower bound.
+     * @param b the upper bound.
+     */
+    template <class T>
+    inline uniform_distribution<T>::uniform_distribution(T a, T b)
+        : m_a(a), m_b(b), m_last(std::nextafter(b, a))
+    {
+    }
+
+    /**
+     * Returns a batch of random values.
+     * @param engine the generator.
+     */
+    template <class T>
+    template <class E>
+    inline auto uniform_distribution<T>::operator()(E& engine) -> batch_type
+    {
+        // u * (b - a) + a may round up to b although u < 1
+        batch_type r = fma(detail::unit_uniform<T>(engine), batch_type(m_b - m_a), batch_type(m_a));
+        return select(r < batch_type(m_b), r, batch_type(m_last));
+    }
+
+    /**************************************
+     * normal_distribution implementation *
+     **************************************/
+
+    /**
+     * Builds a normal distribution.
+     * @param mean the mean of the distribution.
+     * @param stddev the standard deviation of the distribution.
+     */
+    template <class T>
+    inline normal_distribution<T>::normal_distribution(T mean, T stddev)
+        : m_mean(mean), m_stddev(stddev), m_cache(T(0)), m_has_cache(false)
+    {
+    }
+
+    /**
+     * Discards the cached batch, so that the next values only depend
+     * on the next results of the generator.
+     */
+    template <class T>
+    inline void normal_distribution<T>::reset()
+    {
+        m_has_cache = false;
+    }
+
+    /**
+     * Returns a batch of random values.
+     * @param engine the generator.
+     */
+    template <class T>
+    template <class E>
+    inline auto normal_distribution<T>::operator()(E& engine) -> batch_type
+    {
+        if (m_has_cache)
+        {
+            m_has_cache = false;
+            return m_cache;
+        }
+        // 1 - u lies in (0, 1], so that the logarithm is finite
+        batch_type u1 = batch_type(T(1)) - detail::unit_uniform<T>(engine);
+        batch_type u2 = detail::unit_uniform<T>(engine);
+        batch_type r = sqrt(batch_type(T(-2)) * log(u1)) * batch_type(m_stddev);
+        auto sc = sincospi(u2 + u2);
+        m_cache = fma(r, sc.first, batch_type(m_mean));
+        m_has_cache = true;
+        return fma(r, sc.second, batch_type(m_mean));
+    }
+
+    /*******************************************
+     * exponential_distribution implementation *
+     *******************************************/
+
+    /**
+     * Builds an exponential distribution.
+     * @param lambda the rate of the distribution.
+     */
+    template <class T>
+    inline exponential_distribution<T>::exponential_distribution(T lambda)
+        : m_lambda(lambda)
+    {
+    }
+
+    /**
+     * Returns a batch of random values.
+     * @param engine the generator.
+     */
+    template <class T>
+    template <class E>
+    inline auto exponential_distribution<T>::operator()(E& engine) -> batch_type
+    {
+        return -log1p(-detail::unit_uniform<T>(engine)) / batch_type(m_lambda);
+    }
+}
+
+#endif
+
+#endif
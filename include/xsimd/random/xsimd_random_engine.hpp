@@ -0,0 +1,446 @@
+/***************************************************************************
+* Copyright (c) 2016, Johan Mabille and Sylvain Corlay                     *
+*                                                                          *
+* Distributed under the terms of the BSD 3-Clause License.                 *
+*                                                                          *
+* The full license is in the file LICENSE, distributed with this software. *
+****************************************************************************/
+
+#ifndef XSIMD_RANDOM_ENGINE_HPP
+#define XSIMD_RANDOM_ENGINE_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "../math/xsimd_bit_manipulation.hpp"
+#include "../xsimd.hpp"
+
+#if defined(XSIMD_BATCH_INT32_SIZE) && defined(XSIMD_BATCH_INT64_SIZE)
+
+namespace xsimd
+{
+    /**
+     * @class philox4x32
+     * @brief Counter-based Philox4x32-10 generator
+     *
+     * Each lane of the generator computes an independent Philox block,
+     * the lanes of a call use consecutive block counters. The state is
+     * a 64-bit key (the seed), a 64-bit stream identifier and a 64-bit
+     * block counter, so that generators with different streams never
+     * overlap and any position of a stream can be reached in constant
+     * time.
+     *
+     * Each call returns a batch of 64 random bits per lane.
+     */
+    class philox4x32
+    {
+    public:
+
+        using result_type = simd_type<int64_t>;
+
+        explicit philox4x32(uint64_t seed = 0, uint64_t stream = 0);
+
+        void seed(uint64_t seed, uint64_t stream = 0);
+        void set_counter(uint64_t block);
+        void discard(uint64_t n);
+
+        result_type operator()();
+
+    private:
+
+        using word_type = simd_type<int32_t>;
+        static constexpr std::size_t size = simd_traits<int32_t>::size;
+
+        void generate();
+
+        uint32_t m_key[2];
+        uint32_t m_stream[2];
+        uint64_t m_counter;
+        word_type m_buffer[4];
+        std::size_t m_index;
+    };
+
+    /**
+     * @class xoshiro256plus
+     * @brief Vectorized xoshiro256+ generator
+     *
+     * Each lane runs its own xoshiro256+ sequence. Lane \c i starts
+     * \c i jumps of 2^128 steps after lane 0, which is seeded with
+     * splitmix64, so that the lanes never overlap.
+     *
+     * Each call returns a batch of 64 random bits per lane. The lowest
+     * bits of xoshiro256+ have a low linear complexity; the distributions
+     * drop them: a double is made of the 52 highest bits of a lane, and
+     * a float of the 23 highest bits of one of its 32-bit halves, so the
+     * lowest 9 bits are never used.
+     */
+    class xoshiro256plus
+    {
+    public:
+
+        using result_type = simd_type<int64_t>;
+
+        explicit xoshiro256plus(uint64_t seed = 0);
+
+        void seed(uint64_t seed);
+        void jump();
+        void long_jump();
+
+        result_type operator()();
+
+    private:
+
+        static constexpr std::size_t size = simd_traits<int64_t>::size;
+        using lane_states = std::array<std::array<uint64_t, 4>, size>;
+
+        void store_states(lane_states& states) const;
+        void load_states(const lane_states& states);
+
+        result_type m_state[4];
+    };
+
+    /******************
+     * philox kernels *
+     ******************/
+
+    namespace detail
+    {
+        // High and low halves of the 64-bit product of the unsigned 32-bit
+        // lanes of a by b, computed from 16-bit halves
+        template <class B>
+        inline void mulhilo32(const B& a, uint32_t b, B& hi, B& lo)
+        {
+            const B mask(0xffff);
+            const B bl(static_cast<int32_t>(b & 0xffff));
+            const B bh(static_cast<int32_t>(b >> 16));
+            B al = a & mask;
+            B ah = logical_shift_right(a, 16);
+            B ll = al * bl;
+            B lh = al * bh;
+            B hl = ah * bl;
+            B mid = logical_shift_right(ll, 16) + (lh & mask) + (hl & mask);
+            hi = ah * bh + logical_shift_right(lh, 16) + logical_shift_right(hl, 16) + logical_shift_right(mid, 16);
+            lo = a * B(static_cast<int32_t>(b));
+        }
+
+        template <class T, std::size_t N>
+        inline std::array<T, N> make_iota()
+        {
+            std::array<T, N> res;
+            for (std::size_t i = 0; i < N; ++i)
+            {
+                res[i] = static_cast<T>(i);
+            }
+            return res;
+        }
+
+        template <class B>
+        inline void philox4x32_10(B (&ctr)[4], uint32_t k0, uint32_t k1)
+        {
+            for (std::size_t r = 0; r < 10; ++r)
+            {
+                B hi0, lo0, hi1, lo1;
+                mulhilo32(ctr[0], 0xD2511F53u, hi0, lo0);
+                mulhilo32(ctr[2], 0xCD9E8D57u, hi1, lo1);
+                B c0 = hi1 ^ ctr[1] ^ B(static_cast<int32_t>(k0));
+                B c2 = hi0 ^ ctr[3] ^ B(static_cast<int32_t>(k1));
+                ctr[0] = c0;
+                ctr[1] = lo1;
+                ctr[2] = c2;
+                ctr[3] = lo0;
+                k0 += 0x9E3779B9u;
+                k1 += 0xBB67AE85u;
+            }
+        }
+    }
+
+    /*****************************
+     * philox4x32 implementation *
+     *****************************/
+
+    /**
+     * Builds a generator.
+     * @param seed the key of the generator.
+     * @param stream the stream identifier.
+     */
+    inline philox4x32::philox4x32(uint64_t seed, uint64_t stream)
+    {
+        this->seed(seed, stream);
+    }
+
+    /**
+     * Resets the key and the stream of the generator, and restarts it
+     * from the first block.
+     * @param seed the key of the generator.
+     * @param stream the stream identifier.
+     */
+    inline void philox4x32::seed(uint64_t seed, uint64_t stream)
+    {
+        m_key[0] = static_cast<uint32_t>(seed);
+        m_key[1] = static_cast<uint32_t>(seed >> 32);
+        m_stream[0] = static_cast<uint32_t>(stream);
+        m_stream[1] = static_cast<uint32_t>(stream >> 32);
+        set_counter(0);
+    }
+
+    /**
+     * Sets the counter of the block computed by the first lane of the
+     * next call.
+     * @param block the block counter.
+     */
+    inline void philox4x32::set_counter(uint64_t block)
+    {
+        m_counter = block;
+        m_index = 4;
+    }
+
+    /**
+     * Advances the generator by \c n calls in constant time.
+     * @param n the number of results to skip.
+     */
+    inline void philox4x32::discard(uint64_t n)
+    {
+        uint64_t remaining = 4 - m_index;
+        if (n < remaining)
+        {
+            m_index += static_cast<std::size_t>(n);
+            return;
+        }
+        n -= remaining;
+        m_counter += (n / 4) * size;
+        m_index = 4;
+        if (n % 4 != 0)
+        {
+            generate();
+            m_index = static_cast<std::size_t>(n % 4);
+        }
+    }
+
+    /**
+     * Returns the next batch of random bits.
+     */
+    inline auto philox4x32::operator()() -> result_type
+    {
+        if (m_index == 4)
+        {
+            generate();
+        }
+        return bitwise_cast<result_type>(m_buffer[m_index++]);
+    }
+
+    inline void philox4x32::generate()
+    {
+        uint32_t lo = static_cast<uint32_t>(m_counter);
+        uint32_t hi = static_cast<uint32_t>(m_counter >> 32);
+        if (lo <= uint32_t(-1) - uint32_t(size - 1))
+        {
+            alignas(word_type) static const std::array<int32_t, size> iota = detail::make_iota<int32_t, size>();
+            m_buffer[0] = word_type(static_cast<int32_t>(lo)) + word_type(iota.data(), aligned_mode());
+            m_buffer[1] = word_type(static_cast<int32_t>(hi));
+        }
+        else
+        {
+            // the high word of the counter differs between lanes
+            alignas(word_type) std::array<int32_t, size> clo, chi;
+            for (std::size_t i = 0; i < size; ++i)
+            {
+                uint64_t c = m_counter + i;
+                clo[i] = static_cast<int32_t>(static_cast<uint32_t>(c));
+                chi[i] = static_cast<int32_t>(static_cast<uint32_t>(c >> 32));
+            }
+            m_buffer[0].load_aligned(clo.data());
+            m_buffer[1].load_aligned(chi.data());
+        }
+        m_buffer[2] = word_type(static_cast<int32_t>(m_stream[0]));
+        m_buffer[3] = word_type(static_cast<int32_t>(m_stream[1]));
+        detail::philox4x32_10(m_buffer, m_key[0], m_key[1]);
+        m_counter += size;
+        m_index = 0;
+    }
+
+    /********************
+     * xoshiro kernels *
+     ********************/
+
+    namespace detail
+    {
+        /* origin: http://prng.di.unimi.it/xoshiro256plus.c */
+        /*
+         * ====================================================
+         * Written in 2018 by David Blackman and Sebastiano Vigna
+         *
+         * To the extent possible under law, the author has dedicated
+         * all copyright and related and neighboring rights to this
+         * software to the public domain worldwide.
+         * ====================================================
+         */
+
+        inline uint64_t splitmix64(uint64_t& x)
+        {
+            uint64_t z = (x += 0x9E3779B97F4A7C15ull);
+            z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+            z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+            return z ^ (z >> 31);
+        }
+
+        template <class B>
+        inline B rotl64(const B& x, int32_t k)
+        {
+            return (x << k) | logical_shift_right(x, 64 - k);
+        }
+
+        template <class B>
+        inline B xoshiro256plus_next(B (&s)[4])
+        {
+            B result = s[0] + s[3];
+            B t = s[1] << 17;
+            s[2] ^= s[0];
+            s[3] ^= s[1];
+            s[1] ^= s[2];
+            s[0] ^= s[3];
+            s[2] ^= t;
+            s[3] = rotl64(s[3], 45);
+            return result;
+        }
+
+        inline void xoshiro256_jump(std::array<uint64_t, 4>& s, const uint64_t (&table)[4])
+        {
+            uint64_t j[4] = { 0, 0, 0, 0 };
+            uint64_t st[4] = { s[0], s[1], s[2], s[3] };
+            for (std::size_t i = 0; i < 4; ++i)
+            {
+                for (int b = 0; b < 64; ++b)
+                {
+                    if (table[i] & (uint64_t(1) << b))
+                    {
+                        j[0] ^= st[0];
+                        j[1] ^= st[1];
+                        j[2] ^= st[2];
+                        j[3] ^= st[3];
+                    }
+                    uint64_t t = st[1] << 17;
+                    st[2] ^= st[0];
+                    st[3] ^= st[1];
+                    st[1] ^= st[2];
+                    st[0] ^= st[3];
+                    st[2] ^= t;
+                    st[3] = (st[3] << 45) | (st[3] >> 19);
+                }
+            }
+            s = { { j[0], j[1], j[2], j[3] } };
+        }
+
+        // 2^128 steps
+        constexpr uint64_t xoshiro256_jump_table[4] = { 0x180ec6d33cfd0abaull, 0xd5a61266f0c9392cull,
+                                                        0xa9582618e03fc9aaull, 0x39abdc4529b1661cull };
+        // 2^192 steps
+        constexpr uint64_t xoshiro256_long_jump_table[4] = { 0x76e15d3efefdcbbfull, 0xc5004e441c522fb3ull,
+                                                             0x77710069854ee241ull, 0x39109bb02acbe635ull };
+    }
+
+    /*********************************
+     * xoshiro256plus implementation *
+     *********************************/
+
+    /**
+     * Builds a generator.
+     * @param seed the seed of the generator.
+     */
+    inline xoshiro256plus::xoshiro256plus(uint64_t seed)
+    {
+        this->seed(seed);
+    }
+
+    /**
+     * Reseeds the generator.
+     * @param seed the seed of the generator.
+     */
+    inline void xoshiro256plus::seed(uint64_t seed)
+    {
+        lane_states states;
+        for (std::size_t k = 0; k < 4; ++k)
+        {
+            states[0][k] = detail::splitmix64(seed);
+        }
+        for (std::size_t i = 1; i < size; ++i)
+        {
+            states[i] = states[i - 1];
+            detail::xoshiro256_jump(states[i], detail::xoshiro256_jump_table);
+        }
+        load_states(states);
+    }
+
+    /**
+     * Advances each lane by <tt>2^128 * size</tt> steps, that is moves the
+     * generator to the next group of non-overlapping lane sequences. This
+     * can be used to build generators for parallel computations.
+     */
+    inline void xoshiro256plus::jump()
+    {
+        lane_states states;
+        store_states(states);
+        for (std::size_t i = 0; i < size; ++i)
+        {
+            for (std::size_t j = 0; j < size; ++j)
+            {
+                detail::xoshiro256_jump(states[i], detail::xoshiro256_jump_table);
+            }
+        }
+        load_states(states);
+    }
+
+    /**
+     * Advances each lane by 2^192 steps. This can be used to build
+     * generators for distributed computations, each of which can then
+     * call jump to build generators for parallel computations.
+     */
+    inline void xoshiro256plus::long_jump()
+    {
+        lane_states states;
+        store_states(states);
+        for (std::size_t i = 0; i < size; ++i)
+        {
+            detail::xoshiro256_jump(states[i], detail::xoshiro256_long_jump_table);
+        }
+        load_states(states);
+    }
+
+    /**
+     * Returns the next batch of random bits.
+     */
+    inline auto xoshiro256plus::operator()() -> result_type
+    {
+        return detail::xoshiro256plus_next(m_state);
+    }
+
+    inline void xoshiro256plus::store_states(lane_states& states) const
+    {
+        alignas(result_type) std::array<int64_t, size> tmp;
+        for (std::size_t k = 0; k < 4; ++k)
+        {
+            m_state[k].store_aligned(tmp.data());
+            for (std::size_t i = 0; i < size; ++i)
+            {
+                states[i][k] = static_cast<uint64_t>(tmp[i]);
+            }
+        }
+    }
+
+    inline void xoshiro256plus::load_states(const lane_states& states)
+    {
+        alignas(result_type) std::array<int64_t, size> tmp;
+        for (std::size_t k = 0; k < 4; ++k)
+        {
+            for (std::size_t i = 0; i < size; ++i)
+            {
+                tmp[i] = static_cast<int64_t>(states[i][k]);
+            }
+            m_state[k].load_aligned(tmp.data());
+        }
+    }
+}
+
+#endif
+
+#endif
@@ -126,6 +126,13 @@ namespace xsimd
     }                                                                                              \
 
 
+#define AVX512_BOOL_TO_BITMASK(T, N)                                                               \
+    inline uint64_t to_bitmask(const batch_bool<T, N>& rhs)                                        \
+    {                                                                                              \
+        using mt = typename mask_type<N>::type;                                                    \
+        return static_cast<uint64_t>(mt(rhs));                                                     \
+    }                                                                                              \
+
 #define GENERATE_AVX512_BOOL_OPS(T, N)                                 \
     AVX512_BOOL_OPERATOR(T, N, operator==, (~mt(lhs)) ^ mt(rhs));      \
     AVX512_BOOL_OPERATOR(T, N, operator!=, mt(lhs) ^ mt(rhs));         \
@@ -136,6 +143,7 @@ namespace xsimd
     AVX512_BOOL_UNARY_OPERATOR(T, N, operator~, ~mt(rhs));             \
     AVX512_BOOL_UNARY_OPERATOR(T, N, all, mt(rhs) == mt(-1));          \
     AVX512_BOOL_UNARY_OPERATOR(T, N, any, mt(rhs) != mt(0));           \
+    AVX512_BOOL_TO_BITMASK(T, N);                                      \
 
 }
 
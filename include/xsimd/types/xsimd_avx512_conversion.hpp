@@ -22,7 +22,14 @@ namespace xsimd
      ************************/
 
     batch<int32_t, 16> to_int(const batch<float, 16>& x);
-    batch<int64_t, 8> to_int(const batch<double, 16>& x);
+    batch<int64_t, 8> to_int(const batch<double, 8>& x);
+
+    batch<int32_t, 16> to_int_nearest(const batch<float, 16>& x);
+    batch<int64_t, 8> to_int_nearest(const batch<double, 8>& x);
+    batch<int32_t, 16> to_int_floor(const batch<float, 16>& x);
+    batch<int64_t, 8> to_int_floor(const batch<double, 8>& x);
+    batch<int32_t, 16> to_int_ceil(const batch<float, 16>& x);
+    batch<int64_t, 8> to_int_ceil(const batch<double, 8>& x);
 
     batch<float, 16> to_float(const batch<int32_t, 16>& x);
     batch<double, 8> to_float(const batch<int64_t, 8>& x);
@@ -50,6 +57,38 @@ namespace xsimd
         return _mm512_cvtepi32_epi64(_mm512_cvttpd_epi32(x));
     }
 
+    // The rounding mode is embedded in the conversion instruction
+
+    inline batch<int32_t, 16> to_int_nearest(const batch<float, 16>& x)
+    {
+        return _mm512_cvt_roundps_epi32(x, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+    }
+
+    inline batch<int64_t, 8> to_int_nearest(const batch<double, 8>& x)
+    {
+        return _mm512_cvt_roundpd_epi64(x, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+    }
+
+    inline batch<int32_t, 16> to_int_floor(const batch<float, 16>& x)
+    {
+        return _mm512_cvt_roundps_epi32(x, _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC);
+    }
+
+    inline batch<int64_t, 8> to_int_floor(const batch<double, 8>& x)
+    {
+        return _mm512_cvt_roundpd_epi64(x, _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC);
+    }
+
+    inline batch<int32_t, 16> to_int_ceil(const batch<float, 16>& x)
+    {
+        return _mm512_cvt_roundps_epi32(x, _MM_FROUND_TO_POS_INF | _MM_FROUND_NO_EXC);
+    }
+
+    inline batch<int64_t, 8> to_int_ceil(const batch<double, 8>& x)
+    {
+        return _mm512_cvt_roundpd_epi64(x, _MM_FROUND_TO_POS_INF | _MM_FROUND_NO_EXC);
+    }
+
     inline batch<float, 16> to_float(const batch<int32_t, 16>& x)
     {
         return _mm512_cvtepi32_ps(x);
@@ -120,6 +159,10 @@ namespace xsimd
                                  double, 8,
                                  _mm512_castsi512_pd)
 
+    XSIMD_BITWISE_CAST_INTRINSIC(int32_t, 16,
+                                 int64_t, 8,
+                                 __m512i)
+
     XSIMD_BITWISE_CAST_INTRINSIC(int64_t, 8,
                                  float, 16,
                                  _mm512_castsi512_ps)
@@ -127,6 +170,10 @@ namespace xsimd
     XSIMD_BITWISE_CAST_INTRINSIC(int64_t, 8,
                                  double, 8,
                                  _mm512_castsi512_pd)
+
+    XSIMD_BITWISE_CAST_INTRINSIC(int64_t, 8,
+                                 int32_t, 16,
+                                 __m512i)
 }
 
 #endif
@@ -335,7 +335,7 @@ namespace xsimd
 
     inline batch_bool<double, 8> operator!=(const batch<double, 8>& lhs, const batch<double, 8>& rhs)
     {
-        return _mm512_cmp_pd_mask(lhs, rhs, _CMP_NEQ_OQ);
+        return _mm512_cmp_pd_mask(lhs, rhs, _CMP_NEQ_UQ);
     }
 
     inline batch_bool<double, 8> operator<(const batch<double, 8>& lhs, const batch<double, 8>& rhs)
@@ -174,7 +174,7 @@ namespace xsimd
     }
 
     inline batch<float, 16>::batch(const float* src, unaligned_mode)
-        : m_value(_mm512_load_ps(src))
+        : m_value(_mm512_loadu_ps(src))
     {
     }
 
@@ -363,7 +363,7 @@ namespace xsimd
 
     inline batch_bool<float, 16> operator!=(const batch<float, 16>& lhs, const batch<float, 16>& rhs)
     {
-        return _mm512_cmp_ps_mask(lhs, rhs, _CMP_NEQ_OQ);
+        return _mm512_cmp_ps_mask(lhs, rhs, _CMP_NEQ_UQ);
     }
 
     inline batch_bool<float, 16> operator<(const batch<float, 16>& lhs, const batch<float, 16>& rhs)
@@ -469,63 +469,59 @@ namespace xsimd
 
     inline batch<float, 16> haddp(const batch<float, 16>* row)
     {
-
-    // The following folds over the vector once:
-    // tmp1 = [a0..8, b0..8]
-    // tmp2 = [a8..f, b8..f]
-    #define XSIMD_AVX512_HADDP_STEP1(I, a, b)                                                  \
-        batch<float, 16> res ## I;                                                             \
-        {                                                                                      \
-            auto tmp1 = _mm512_shuffle_f32x4(a, b, _MM_SHUFFLE(1, 0, 1, 0));                   \
-            auto tmp2 = _mm512_shuffle_f32x4(a, b, _MM_SHUFFLE(3, 2, 3, 2));                   \
-            res ## I = tmp1 + tmp2;                                                            \
-        }                                                                                      \
-
-        XSIMD_AVX512_HADDP_STEP1(1, row[ 0], row[ 4]);
-        XSIMD_AVX512_HADDP_STEP1(2, row[ 2], row[ 6]);
-        XSIMD_AVX512_HADDP_STEP1(3, row[ 1], row[ 5]);
-        XSIMD_AVX512_HADDP_STEP1(4, row[ 3], row[ 7]);
-        XSIMD_AVX512_HADDP_STEP1(5, row[ 8], row[12]);
-        XSIMD_AVX512_HADDP_STEP1(6, row[10], row[14]);
-        XSIMD_AVX512_HADDP_STEP1(7, row[ 9], row[13]);
-        XSIMD_AVX512_HADDP_STEP1(8, row[11], row[15]);
+    // The rows are paired so that the lane 4 * i + j of the last step
+    // holds the sum of the row 4 * i + j.
+
+    // The following folds two rows once:
+    // res = [a0..7 + a8..f, b0..7 + b8..f]
+    #define XSIMD_AVX512_HADDP_STEP1(I, a, b)                                \
+        batch<float, 16> res ## I;                                           \
+        {                                                                    \
+            auto tmp1 = _mm512_shuffle_f32x4(a, b, _MM_SHUFFLE(1, 0, 1, 0)); \
+            auto tmp2 = _mm512_shuffle_f32x4(a, b, _MM_SHUFFLE(3, 2, 3, 2)); \
+            res ## I = batch<float, 16>(tmp1) + batch<float, 16>(tmp2);      \
+        }                                                                    \
+
+        XSIMD_AVX512_HADDP_STEP1(0, row[ 0], row[ 4]);
+        XSIMD_AVX512_HADDP_STEP1(1, row[ 8], row[12]);
+        XSIMD_AVX512_HADDP_STEP1(2, row[ 1], row[ 5]);
+        XSIMD_AVX512_HADDP_STEP1(3, row[ 9], row[13]);
+        XSIMD_AVX512_HADDP_STEP1(4, row[ 2], row[ 6]);
+        XSIMD_AVX512_HADDP_STEP1(5, row[10], row[14]);
+        XSIMD_AVX512_HADDP_STEP1(6, row[ 3], row[ 7]);
+        XSIMD_AVX512_HADDP_STEP1(7, row[11], row[15]);
 
     #undef XSIMD_AVX512_HADDP_STEP1
 
-    // The following flds the code and shuffles so that hadd_ps produces the correct result
-    // tmp1 = [a0..4,  a8..12,  b0..4,  b8..12] (same for tmp3)
-    // tmp2 = [a5..8, a12..16, b5..8, b12..16]  (same for tmp4)
-    // tmp5 = [r1[0], r1[2], r2[0], r2[2], r1[4], r1[6] ...
-    #define XSIMD_AVX512_HADDP_STEP2(I, a, b, c, d)                                             \
-        batch<float, 8> halfx ## I;                                                             \
-        {                                                                                       \
-            batch<float, 16> tmp1 = _mm512_shuffle_f32x4(a, b, _MM_SHUFFLE(2, 0, 2, 0));        \
-            batch<float, 16> tmp2 = _mm512_shuffle_f32x4(a, b, _MM_SHUFFLE(3, 1, 3, 1));        \
-                                                                                                \
-            batch<float, 16> resx1 = tmp1 + tmp2;                                               \
-                                                                                                \
-            batch<float, 16> tmp3 = _mm512_shuffle_f32x4(c, d, _MM_SHUFFLE(2, 0, 2, 0));        \
-            batch<float, 16> tmp4 = _mm512_shuffle_f32x4(c, d, _MM_SHUFFLE(3, 1, 3, 1));        \
-                                                                                                \
-            batch<float, 16> resx2 = tmp3 + tmp4;                                               \
-                                                                                                \
-            batch<float, 16> tmp5 = _mm512_shuffle_ps(resx1, resx2, 0b00000000);                \
-            batch<float, 16> tmp6 = _mm512_shuffle_ps(resx1, resx2, 0b11111111);                \
-                                                                                                \
-            batch<float, 16> resx3 = tmp5 + tmp6;                                               \
-                                                                                                \
-            halfx ## I  = _mm256_hadd_ps(_mm512_extractf32x8_ps(resx3, 0),                      \
-                                         _mm512_extractf32x8_ps(resx3, 1));                     \
-        }                                                                                       \
-
-        XSIMD_AVX512_HADDP_STEP2(0, res1, res2, res3, res4);
-        XSIMD_AVX512_HADDP_STEP2(1, res5, res6, res7, res8);
+    // The following folds four rows once more, each 128 bits lane of the
+    // result holds 4 partial sums of one row:
+    // res = [a0..3 + a4..7, b0..3 + b4..7, c0..3 + c4..7, d0..3 + d4..7]
+    #define XSIMD_AVX512_HADDP_STEP2(I, a, b)                                \
+        batch<float, 16> resx ## I;                                          \
+        {                                                                    \
+            auto tmp1 = _mm512_shuffle_f32x4(a, b, _MM_SHUFFLE(2, 0, 2, 0)); \
+            auto tmp2 = _mm512_shuffle_f32x4(a, b, _MM_SHUFFLE(3, 1, 3, 1)); \
+            resx ## I = batch<float, 16>(tmp1) + batch<float, 16>(tmp2);     \
+        }                                                                    \
+
+        XSIMD_AVX512_HADDP_STEP2(0, res0, res1);
+        XSIMD_AVX512_HADDP_STEP2(1, res2, res3);
+        XSIMD_AVX512_HADDP_STEP2(2, res4, res5);
+        XSIMD_AVX512_HADDP_STEP2(3, res6, res7);
 
     #undef XSIMD_AVX512_HADDP_STEP2
 
-        auto concat = _mm512_castps256_ps512(halfx0);
-        concat = _mm512_insertf32x8(concat, halfx1, 1);
-        return concat;
+    // The following reduces the 4 partial sums of each 128 bits lane,
+    // as _mm_hadd_ps twice would do
+        batch<float, 16> tmp1 = _mm512_shuffle_ps(resx0, resx1, _MM_SHUFFLE(1, 0, 1, 0));
+        batch<float, 16> tmp2 = _mm512_shuffle_ps(resx0, resx1, _MM_SHUFFLE(3, 2, 3, 2));
+        batch<float, 16> resy0 = tmp1 + tmp2;
+        batch<float, 16> tmp3 = _mm512_shuffle_ps(resx2, resx3, _MM_SHUFFLE(1, 0, 1, 0));
+        batch<float, 16> tmp4 = _mm512_shuffle_ps(resx2, resx3, _MM_SHUFFLE(3, 2, 3, 2));
+        batch<float, 16> resy1 = tmp3 + tmp4;
+        batch<float, 16> tmp5 = _mm512_shuffle_ps(resy0, resy1, _MM_SHUFFLE(2, 0, 2, 0));
+        batch<float, 16> tmp6 = _mm512_shuffle_ps(resy0, resy1, _MM_SHUFFLE(3, 1, 3, 1));
+        return tmp5 + tmp6;
     }
 
     inline batch<float, 16> select(const batch_bool<float, 16>& cond, const batch<float, 16>& a, const batch<float, 16>& b)
@@ -539,4 +535,4 @@ namespace xsimd
     }
 }
 
-#endif
\ No newline at end of file
+#endif
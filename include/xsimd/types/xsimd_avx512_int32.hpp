@@ -321,8 +321,8 @@ namespace xsimd
     {
         __m256i tmp1 = _mm512_extracti32x8_epi32(m_value, 0);
         __m256i tmp2 = _mm512_extracti32x8_epi32(m_value, 1);
-        _mm512_store_pd(dst, _mm512_cvtepi32_pd(tmp1));
-        _mm512_store_pd(dst + 8 , _mm512_cvtepi32_pd(tmp2));
+        _mm512_storeu_pd(dst, _mm512_cvtepi32_pd(tmp1));
+        _mm512_storeu_pd(dst + 8 , _mm512_cvtepi32_pd(tmp2));
     }
 
     inline int32_t batch<int32_t, 16>::operator[](std::size_t index) const
@@ -359,22 +359,22 @@ namespace xsimd
 
     inline batch_bool<int32_t, 16> operator==(const batch<int32_t, 16>& lhs, const batch<int32_t, 16>& rhs)
     {
-        return _mm512_cmp_epu32_mask(lhs, rhs, _MM_CMPINT_EQ);
+        return _mm512_cmp_epi32_mask(lhs, rhs, _MM_CMPINT_EQ);
     }
 
     inline batch_bool<int32_t, 16> operator!=(const batch<int32_t, 16>& lhs, const batch<int32_t, 16>& rhs)
     {
-        return _mm512_cmp_epu32_mask(lhs, rhs, _MM_CMPINT_NE);
+        return _mm512_cmp_epi32_mask(lhs, rhs, _MM_CMPINT_NE);
     }
 
     inline batch_bool<int32_t, 16> operator<(const batch<int32_t, 16>& lhs, const batch<int32_t, 16>& rhs)
     {
-        return _mm512_cmp_epu32_mask(lhs, rhs, _MM_CMPINT_LT);
+        return _mm512_cmp_epi32_mask(lhs, rhs, _MM_CMPINT_LT);
     }
 
     inline batch_bool<int32_t, 16> operator<=(const batch<int32_t, 16>& lhs, const batch<int32_t, 16>& rhs)
     {
-        return _mm512_cmp_epu32_mask(lhs, rhs, _MM_CMPINT_LE);
+        return _mm512_cmp_epi32_mask(lhs, rhs, _MM_CMPINT_LE);
     }
 
     inline batch<int32_t, 16> operator&(const batch<int32_t, 16>& lhs, const batch<int32_t, 16>& rhs)
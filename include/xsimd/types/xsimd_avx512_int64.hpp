@@ -245,7 +245,7 @@ namespace xsimd
 
     inline void batch<int64_t, 8>::store_unaligned(int32_t* dst) const
     {
-        _mm256_store_si256((__m256i*)dst, _mm512_cvtepi64_epi32(m_value));
+        _mm256_storeu_si256((__m256i*)dst, _mm512_cvtepi64_epi32(m_value));
     }
 
     inline void batch<int64_t, 8>::store_aligned(int64_t* dst) const
@@ -255,8 +255,7 @@ namespace xsimd
 
     inline void batch<int64_t, 8>::store_unaligned(int64_t* dst) const
     {
-        // TODO check if differnt instructions available
-        _mm512_store_si512(dst, m_value);
+        _mm512_storeu_si512(dst, m_value);
     }
 
     inline void batch<int64_t, 8>::store_aligned(float* dst) const
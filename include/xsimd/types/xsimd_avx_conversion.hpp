@@ -24,6 +24,13 @@ namespace xsimd
     batch<int32_t, 8> to_int(const batch<float, 8>& x);
     batch<int64_t, 4> to_int(const batch<double, 4>& x);
 
+    batch<int32_t, 8> to_int_nearest(const batch<float, 8>& x);
+    batch<int64_t, 4> to_int_nearest(const batch<double, 4>& x);
+    batch<int32_t, 8> to_int_floor(const batch<float, 8>& x);
+    batch<int64_t, 4> to_int_floor(const batch<double, 4>& x);
+    batch<int32_t, 8> to_int_ceil(const batch<float, 8>& x);
+    batch<int64_t, 4> to_int_ceil(const batch<double, 4>& x);
+
     batch<float, 8> to_float(const batch<int32_t, 8>& x);
     batch<double, 4> to_float(const batch<int64_t, 4>& x);
 
@@ -40,6 +47,23 @@ namespace xsimd
      * conversion functions implementation *
      ***************************************/
 
+    namespace detail
+    {
+        // sign extends the four int32 of x
+        inline __m256i avx_cvtepi32_epi64(__m128i x)
+        {
+#if XSIMD_X86_INSTR_SET >= XSIMD_X86_AVX2_VERSION
+            return _mm256_cvtepi32_epi64(x);
+#else
+            using batch_int = batch<int32_t, 4>;
+            __m128i res_low = _mm_unpacklo_epi32(x, batch_int(x) < batch_int(0));
+            __m128i res_high = _mm_unpackhi_epi32(x, batch_int(x) < batch_int(0));
+            __m256i result = _mm256_castsi128_si256(res_low);
+            return _mm256_insertf128_si256(result, res_high, 1);
+#endif
+        }
+    }
+
     inline batch<int32_t, 8> to_int(const batch<float, 8>& x)
     {
         return _mm256_cvttps_epi32(x);
@@ -47,16 +71,37 @@ namespace xsimd
 
     inline batch<int64_t, 4> to_int(const batch<double, 4>& x)
     {
-#if XSIMD_X86_INSTR_SET >= XSIMD_X86_AVX2_VERSION
-        return _mm256_cvtepi32_epi64(_mm256_cvttpd_epi32(x));
-#else
-        using batch_int = batch<int32_t, 4>;
-        __m128i tmp = _mm256_cvttpd_epi32(x);
-        __m128i res_low = _mm_unpacklo_epi32(tmp, batch_int(tmp) < batch_int(0));
-        __m128i res_high = _mm_unpackhi_epi32(tmp, batch_int(tmp) < batch_int(0));
-        __m256i result = _mm256_castsi128_si256(res_low);
-        return _mm256_insertf128_si256(result, res_high, 1);
-#endif
+        return detail::avx_cvtepi32_epi64(_mm256_cvttpd_epi32(x));
+    }
+
+    inline batch<int32_t, 8> to_int_nearest(const batch<float, 8>& x)
+    {
+        return _mm256_cvtps_epi32(x);
+    }
+
+    inline batch<int64_t, 4> to_int_nearest(const batch<double, 4>& x)
+    {
+        return detail::avx_cvtepi32_epi64(_mm256_cvtpd_epi32(x));
+    }
+
+    inline batch<int32_t, 8> to_int_floor(const batch<float, 8>& x)
+    {
+        return _mm256_cvttps_epi32(_mm256_round_ps(x, _MM_FROUND_FLOOR));
+    }
+
+    inline batch<int64_t, 4> to_int_floor(const batch<double, 4>& x)
+    {
+        return detail::avx_cvtepi32_epi64(_mm256_cvttpd_epi32(_mm256_round_pd(x, _MM_FROUND_FLOOR)));
+    }
+
+    inline batch<int32_t, 8> to_int_ceil(const batch<float, 8>& x)
+    {
+        return _mm256_cvttps_epi32(_mm256_round_ps(x, _MM_FROUND_CEIL));
+    }
+
+    inline batch<int64_t, 4> to_int_ceil(const batch<double, 4>& x)
+    {
+        return detail::avx_cvtepi32_epi64(_mm256_cvttpd_epi32(_mm256_round_pd(x, _MM_FROUND_CEIL)));
     }
 
     inline batch<float, 8> to_float(const batch<int32_t, 8>& x)
@@ -132,6 +177,10 @@ namespace xsimd
                                  double, 4,
                                  _mm256_castsi256_pd)
 
+    XSIMD_BITWISE_CAST_INTRINSIC(int32_t, 8,
+                                 int64_t, 4,
+                                 __m256i)
+
     XSIMD_BITWISE_CAST_INTRINSIC(int64_t, 4,
                                  float, 8,
                                  _mm256_castsi256_ps)
@@ -139,6 +188,10 @@ namespace xsimd
     XSIMD_BITWISE_CAST_INTRINSIC(int64_t, 4,
                                  double, 4,
                                  _mm256_castsi256_pd)
+
+    XSIMD_BITWISE_CAST_INTRINSIC(int64_t, 4,
+                                 int32_t, 8,
+                                 __m256i)
 }
 
 #endif
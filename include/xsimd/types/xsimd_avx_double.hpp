@@ -59,6 +59,7 @@ namespace xsimd
 
     bool all(const batch_bool<double, 4>& rhs);
     bool any(const batch_bool<double, 4>& rhs);
+    uint64_t to_bitmask(const batch_bool<double, 4>& rhs);
 
     /********************
      * batch<double, 4> *
@@ -228,12 +229,12 @@ namespace xsimd
 
     inline batch_bool<double, 4> operator==(const batch_bool<double, 4>& lhs, const batch_bool<double, 4>& rhs)
     {
-        return _mm256_cmp_pd(lhs, rhs, _CMP_EQ_OQ);
+        return _mm256_cmp_pd(_mm256_xor_pd(lhs, rhs), _mm256_setzero_pd(), _CMP_EQ_OQ);
     }
 
     inline batch_bool<double, 4> operator!=(const batch_bool<double, 4>& lhs, const batch_bool<double, 4>& rhs)
     {
-        return _mm256_cmp_pd(lhs, rhs, _CMP_NEQ_OQ);
+        return _mm256_xor_pd(lhs, rhs);
     }
 
     inline bool all(const batch_bool<double, 4>& rhs)
@@ -246,6 +247,11 @@ namespace xsimd
         return !_mm256_testz_pd(rhs, rhs);
     }
 
+    inline uint64_t to_bitmask(const batch_bool<double, 4>& rhs)
+    {
+        return static_cast<uint64_t>(_mm256_movemask_pd(rhs));
+    }
+
     /***********************************
      * batch<double, 4> implementation *
      ***********************************/
@@ -431,7 +437,7 @@ namespace xsimd
 
     inline batch_bool<double, 4> operator!=(const batch<double, 4>& lhs, const batch<double, 4>& rhs)
     {
-        return _mm256_cmp_pd(lhs, rhs, _CMP_NEQ_OQ);
+        return _mm256_cmp_pd(lhs, rhs, _CMP_NEQ_UQ);
     }
 
     inline batch_bool<double, 4> operator<(const batch<double, 4>& lhs, const batch<double, 4>& rhs)
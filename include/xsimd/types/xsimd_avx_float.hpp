@@ -59,6 +59,7 @@ namespace xsimd
 
     bool all(const batch_bool<float, 8>& rhs);
     bool any(const batch_bool<float, 8>& rhs);
+    uint64_t to_bitmask(const batch_bool<float, 8>& rhs);
 
     /*******************
      * batch<float, 8> *
@@ -230,12 +231,12 @@ namespace xsimd
 
     inline batch_bool<float, 8> operator==(const batch_bool<float, 8>& lhs, const batch_bool<float, 8>& rhs)
     {
-        return _mm256_cmp_ps(lhs, rhs, _CMP_EQ_OQ);
+        return _mm256_cmp_ps(_mm256_xor_ps(lhs, rhs), _mm256_setzero_ps(), _CMP_EQ_OQ);
     }
 
     inline batch_bool<float, 8> operator!=(const batch_bool<float, 8>& lhs, const batch_bool<float, 8>& rhs)
     {
-        return _mm256_cmp_ps(lhs, rhs, _CMP_NEQ_OQ);
+        return _mm256_xor_ps(lhs, rhs);
     }
 
     inline bool all(const batch_bool<float, 8>& rhs)
@@ -248,6 +249,11 @@ namespace xsimd
         return !_mm256_testz_ps(rhs, rhs);
     }
 
+    inline uint64_t to_bitmask(const batch_bool<float, 8>& rhs)
+    {
+        return static_cast<uint64_t>(_mm256_movemask_ps(rhs));
+    }
+
     /**********************************
      * batch<float, 8> implementation *
      **********************************/
@@ -457,7 +463,7 @@ namespace xsimd
 
     inline batch_bool<float, 8> operator!=(const batch<float, 8>& lhs, const batch<float, 8>& rhs)
     {
-        return _mm256_cmp_ps(lhs, rhs, _CMP_NEQ_OQ);
+        return _mm256_cmp_ps(lhs, rhs, _CMP_NEQ_UQ);
     }
 
     inline batch_bool<float, 8> operator<(const batch<float, 8>& lhs, const batch<float, 8>& rhs)
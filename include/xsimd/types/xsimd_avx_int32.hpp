@@ -12,6 +12,7 @@
 #include <cstdint>
 
 #include "xsimd_base.hpp"
+#include "xsimd_sse_int32.hpp"
 
 namespace xsimd
 {
@@ -60,6 +61,7 @@ namespace xsimd
 
     bool all(const batch_bool<int32_t, 8>& rhs);
     bool any(const batch_bool<int32_t, 8>& rhs);
+    uint64_t to_bitmask(const batch_bool<int32_t, 8>& rhs);
 
     /*********************
      * batch<int32_t, 8> *
@@ -154,6 +156,8 @@ namespace xsimd
 
     batch<int32_t, 8> operator<<(const batch<int32_t, 8>& lhs, int32_t rhs);
     batch<int32_t, 8> operator>>(const batch<int32_t, 8>& lhs, int32_t rhs);
+    batch<int32_t, 8> operator<<(const batch<int32_t, 8>& lhs, const batch<int32_t, 8>& rhs);
+    batch<int32_t, 8> operator>>(const batch<int32_t, 8>& lhs, const batch<int32_t, 8>& rhs);
 
     /*****************************************
      * batch_bool<int32_t, 8> implementation *
@@ -286,6 +290,11 @@ namespace xsimd
         return !_mm256_testz_si256(rhs, rhs);
     }
 
+    inline uint64_t to_bitmask(const batch_bool<int32_t, 8>& rhs)
+    {
+        return static_cast<uint64_t>(_mm256_movemask_ps(_mm256_castsi256_ps(rhs)));
+    }
+
     /************************************
      * batch<int32_t, 8> implementation *
      ************************************/
@@ -681,6 +690,24 @@ namespace xsimd
         __m128i res_low = _mm_srli_epi32(lhs_low, rhs);
         __m128i res_high = _mm_srli_epi32(lhs_high, rhs);
         XSIMD_RETURN_MERGED_SSE(res_low, res_high);
+#endif
+    }
+
+    inline batch<int32_t, 8> operator<<(const batch<int32_t, 8>& lhs, const batch<int32_t, 8>& rhs)
+    {
+#if XSIMD_X86_INSTR_SET >= XSIMD_X86_AVX2_VERSION
+        return _mm256_sllv_epi32(lhs, rhs);
+#else
+        XSIMD_APPLY_SSE_FUNCTION(detail::sllv_epi32_sse2, lhs, rhs);
+#endif
+    }
+
+    inline batch<int32_t, 8> operator>>(const batch<int32_t, 8>& lhs, const batch<int32_t, 8>& rhs)
+    {
+#if XSIMD_X86_INSTR_SET >= XSIMD_X86_AVX2_VERSION
+        return _mm256_srlv_epi32(lhs, rhs);
+#else
+        XSIMD_APPLY_SSE_FUNCTION(detail::srlv_epi32_sse2, lhs, rhs);
 #endif
     }
 }
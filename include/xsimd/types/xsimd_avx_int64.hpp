@@ -12,6 +12,7 @@
 #include <cstdint>
 
 #include "xsimd_base.hpp"
+#include "xsimd_sse_int64.hpp"
 
 namespace xsimd
 {
@@ -60,6 +61,7 @@ namespace xsimd
 
     bool all(const batch_bool<int64_t, 4>& rhs);
     bool any(const batch_bool<int64_t, 4>& rhs);
+    uint64_t to_bitmask(const batch_bool<int64_t, 4>& rhs);
 
     /*********************
      * batch<int64_t, 4> *
@@ -155,6 +157,8 @@ namespace xsimd
 
     batch<int64_t, 4> operator<<(const batch<int64_t, 4>& lhs, int32_t rhs);
     batch<int64_t, 4> operator>>(const batch<int64_t, 4>& lhs, int32_t rhs);
+    batch<int64_t, 4> operator<<(const batch<int64_t, 4>& lhs, const batch<int64_t, 4>& rhs);
+    batch<int64_t, 4> operator>>(const batch<int64_t, 4>& lhs, const batch<int64_t, 4>& rhs);
 
     /*****************************************
      * batch_bool<int64_t, 4> implementation *
@@ -287,6 +291,11 @@ namespace xsimd
         return !_mm256_testz_si256(rhs, rhs);
     }
 
+    inline uint64_t to_bitmask(const batch_bool<int64_t, 4>& rhs)
+    {
+        return static_cast<uint64_t>(_mm256_movemask_pd(_mm256_castsi256_pd(rhs)));
+    }
+
     /************************************
      * batch<int64_t, 4> implementation *
      ************************************/
@@ -497,10 +506,16 @@ namespace xsimd
 
     inline batch<int64_t, 4> operator*(const batch<int64_t, 4>& lhs, const batch<int64_t, 4>& rhs)
     {
-        alignas(32) int64_t slhs[4], srhs[4];
-        lhs.store_aligned(slhs);
-        rhs.store_aligned(srhs);
-        return batch<int64_t, 4>(slhs[0] * srhs[0], slhs[1] * srhs[1], slhs[2] * srhs[2], slhs[3] * srhs[3]);
+#if defined(__AVX512DQ__) && defined(__AVX512VL__)
+        return _mm256_mullo_epi64(lhs, rhs);
+#elif XSIMD_X86_INSTR_SET >= XSIMD_X86_AVX2_VERSION
+        __m256i lo = _mm256_mul_epu32(lhs, rhs);
+        __m256i cross = _mm256_add_epi64(_mm256_mul_epu32(_mm256_srli_epi64(lhs, 32), rhs),
+                                         _mm256_mul_epu32(lhs, _mm256_srli_epi64(rhs, 32)));
+        return _mm256_add_epi64(lo, _mm256_slli_epi64(cross, 32));
+#else
+        XSIMD_APPLY_SSE_FUNCTION(detail::mullo_epi64_sse2, lhs, rhs);
+#endif
     }
 
     inline batch<int64_t, 4> operator/(const batch<int64_t, 4>& lhs, const batch<int64_t, 4>& rhs)
@@ -709,6 +724,24 @@ namespace xsimd
         __m128i res_low = _mm_srli_epi64(lhs_low, rhs);
         __m128i res_high = _mm_srli_epi64(lhs_high, rhs);
         XSIMD_RETURN_MERGED_SSE(res_low, res_high);
+#endif
+    }
+
+    inline batch<int64_t, 4> operator<<(const batch<int64_t, 4>& lhs, const batch<int64_t, 4>& rhs)
+    {
+#if XSIMD_X86_INSTR_SET >= XSIMD_X86_AVX2_VERSION
+        return _mm256_sllv_epi64(lhs, rhs);
+#else
+        XSIMD_APPLY_SSE_FUNCTION(detail::sllv_epi64_sse2, lhs, rhs);
+#endif
+    }
+
+    inline batch<int64_t, 4> operator>>(const batch<int64_t, 4>& lhs, const batch<int64_t, 4>& rhs)
+    {
+#if XSIMD_X86_INSTR_SET >= XSIMD_X86_AVX2_VERSION
+        return _mm256_srlv_epi64(lhs, rhs);
+#else
+        XSIMD_APPLY_SSE_FUNCTION(detail::srlv_epi64_sse2, lhs, rhs);
 #endif
     }
 }
@@ -10,6 +10,7 @@
 #define XSIMD_BASE_HPP
 
 #include <cstddef>
+#include <cstdint>
 #include <ostream>
 
 #include "../memory/xsimd_alignment.hpp"
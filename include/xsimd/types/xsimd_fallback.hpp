@@ -88,6 +88,8 @@ namespace xsimd
     bool all(const batch_bool<T, N>& rhs);
     template <typename T, std::size_t N>
     bool any(const batch_bool<T, N>& rhs);
+    template <typename T, std::size_t N>
+    uint64_t to_bitmask(const batch_bool<T, N>& rhs);
 
     /***************
      * batch<T, N> *
@@ -244,6 +246,19 @@ namespace xsimd
     template <std::size_t N>
     batch<int64_t, N> to_int(const batch<double, N>& x);
 
+    template <std::size_t N>
+    batch<int32_t, N> to_int_nearest(const batch<float, N>& x);
+    template <std::size_t N>
+    batch<int64_t, N> to_int_nearest(const batch<double, N>& x);
+    template <std::size_t N>
+    batch<int32_t, N> to_int_floor(const batch<float, N>& x);
+    template <std::size_t N>
+    batch<int64_t, N> to_int_floor(const batch<double, N>& x);
+    template <std::size_t N>
+    batch<int32_t, N> to_int_ceil(const batch<float, N>& x);
+    template <std::size_t N>
+    batch<int64_t, N> to_int_ceil(const batch<double, N>& x);
+
     template <std::size_t N>
     batch<float, N> to_float(const batch<int32_t, N>& x);
     template <std::size_t N>
@@ -316,6 +331,13 @@ namespace xsimd
     }  \
     return result;
 
+#define XSIMD_FALLBACK_BATCH_ROUNDED_CAST(T_OUT, FUNCTION, X)  \
+    batch<T_OUT, N> result;  \
+    for(std::size_t i = 0; i < N; ++i) {  \
+        result[i] = static_cast<T_OUT>(FUNCTION(X[i]));  \
+    }  \
+    return result;
+
 // NOTE: Casting between batch_bools of the same size is actually trivial!
 #define XSIMD_FALLBACK_BOOL_CAST(T_OUT, X)  \
     return batch_bool<T_OUT, N>(static_cast<std::array<bool, N>>(X));
@@ -433,6 +455,16 @@ namespace xsimd
         return false;
     }
 
+    template <typename T, std::size_t N>
+    inline uint64_t to_bitmask(const batch_bool<T, N>& rhs)
+    {
+        uint64_t res = 0;
+        for(std::size_t i = 0; i < N; ++i) {
+            res |= uint64_t(rhs[i]) << i;
+        }
+        return res;
+    }
+
     /**********************************
      * batch<T, N> implementation *
      **********************************/
@@ -832,6 +864,42 @@ namespace xsimd
         XSIMD_FALLBACK_BATCH_STATIC_CAST(int64_t, x)
     }
 
+    template <std::size_t N>
+    inline batch<int32_t, N> to_int_nearest(const batch<float, N>& x)
+    {
+        XSIMD_FALLBACK_BATCH_ROUNDED_CAST(int32_t, std::nearbyint, x)
+    }
+
+    template <std::size_t N>
+    inline batch<int64_t, N> to_int_nearest(const batch<double, N>& x)
+    {
+        XSIMD_FALLBACK_BATCH_ROUNDED_CAST(int64_t, std::nearbyint, x)
+    }
+
+    template <std::size_t N>
+    inline batch<int32_t, N> to_int_floor(const batch<float, N>& x)
+    {
+        XSIMD_FALLBACK_BATCH_ROUNDED_CAST(int32_t, std::floor, x)
+    }
+
+    template <std::size_t N>
+    inline batch<int64_t, N> to_int_floor(const batch<double, N>& x)
+    {
+        XSIMD_FALLBACK_BATCH_ROUNDED_CAST(int64_t, std::floor, x)
+    }
+
+    template <std::size_t N>
+    inline batch<int32_t, N> to_int_ceil(const batch<float, N>& x)
+    {
+        XSIMD_FALLBACK_BATCH_ROUNDED_CAST(int32_t, std::ceil, x)
+    }
+
+    template <std::size_t N>
+    inline batch<int64_t, N> to_int_ceil(const batch<double, N>& x)
+    {
+        XSIMD_FALLBACK_BATCH_ROUNDED_CAST(int64_t, std::ceil, x)
+    }
+
     template <std::size_t N>
     inline batch<float, N> to_float(const batch<int32_t, N>& x)
     {
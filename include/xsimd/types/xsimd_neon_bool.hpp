@@ -108,6 +108,9 @@ namespace xsimd
     template <class T>
     bool any(const batch_bool<T, 4>& rhs);
 
+    template <class T>
+    uint64_t to_bitmask(const batch_bool<T, 4>& rhs);
+
     /**
      * Implementation of batch_bool
      */
@@ -228,6 +231,15 @@ namespace xsimd
         return vget_lane_u32(vpmax_u32(tmp, tmp), 0);
     }
 
+    template <class T>
+    inline uint64_t to_bitmask(const batch_bool<T, 4>& rhs)
+    {
+        const uint32_t weights[4] = { 1, 2, 4, 8 };
+        uint32x4_t bits = vandq_u32(rhs, vld1q_u32(weights));
+        uint32x2_t tmp = vadd_u32(vget_low_u32(bits), vget_high_u32(bits));
+        return vget_lane_u32(vpadd_u32(tmp, tmp), 0);
+    }
+
     template <class T>
     struct simd_batch_traits<batch_bool<T, 2>>
     {
@@ -285,6 +297,9 @@ namespace xsimd
     template <class T>
     bool any(const batch_bool<T, 2>& rhs);
 
+    template <class T>
+    uint64_t to_bitmask(const batch_bool<T, 2>& rhs);
+
     /**
      * Implementation of batch_bool
      */
@@ -396,5 +411,12 @@ namespace xsimd
         return bool(vget_lane_u64(tmp, 0));
     }
 
+    template <class T>
+    inline uint64_t to_bitmask(const batch_bool<T, 2>& rhs)
+    {
+        uint64x2_t bits = rhs;
+        return (vgetq_lane_u64(bits, 0) & 1) | ((vgetq_lane_u64(bits, 1) & 1) << 1);
+    }
+
 }
 #endif
@@ -25,10 +25,16 @@ namespace xsimd
      ************************/
 
     batch<int32_t, 4> to_int(const batch<float, 4>& x);
+    batch<int32_t, 4> to_int_nearest(const batch<float, 4>& x);
+    batch<int32_t, 4> to_int_floor(const batch<float, 4>& x);
+    batch<int32_t, 4> to_int_ceil(const batch<float, 4>& x);
     batch<float, 4> to_float(const batch<int32_t, 4>& x);
 
 #if XSIMD_ARM_INSTR_SET >= XSIMD_ARM8_64_NEON_VERSION
     batch<int64_t, 2> to_int(const batch<double, 2>& x);
+    batch<int64_t, 2> to_int_nearest(const batch<double, 2>& x);
+    batch<int64_t, 2> to_int_floor(const batch<double, 2>& x);
+    batch<int64_t, 2> to_int_ceil(const batch<double, 2>& x);
     batch<double, 2> to_float(const batch<int64_t, 2>& x);
 #endif
 
@@ -53,6 +59,51 @@ namespace xsimd
         return vcvtq_s32_f32(x);
     }
 
+#if XSIMD_ARM_INSTR_SET >= XSIMD_ARM8_32_NEON_VERSION
+    inline batch<int32_t, 4> to_int_nearest(const batch<float, 4>& x)
+    {
+        return vcvtnq_s32_f32(x);
+    }
+
+    inline batch<int32_t, 4> to_int_floor(const batch<float, 4>& x)
+    {
+        return vcvtmq_s32_f32(x);
+    }
+
+    inline batch<int32_t, 4> to_int_ceil(const batch<float, 4>& x)
+    {
+        return vcvtpq_s32_f32(x);
+    }
+#else
+    inline batch<int32_t, 4> to_int_nearest(const batch<float, 4>& x)
+    {
+        // adding and subtracting 2^23 with the sign of x rounds to the
+        // nearest integer, larger values already are integers
+        uint32x4_t sign = vandq_u32(vreinterpretq_u32_f32(x), vdupq_n_u32(0x80000000));
+        float32x4_t c = vreinterpretq_f32_u32(vorrq_u32(sign, vdupq_n_u32(0x4b000000)));
+        float32x4_t r = vsubq_f32(vaddq_f32(x, c), c);
+        uint32x4_t small = vcltq_f32(vabsq_f32(x), vdupq_n_f32(8388608.f));
+        return vcvtq_s32_f32(vbslq_f32(small, r, x));
+    }
+
+    // The truncated value is corrected by the comparison mask, -1 where
+    // it is on the wrong side of x
+
+    inline batch<int32_t, 4> to_int_floor(const batch<float, 4>& x)
+    {
+        int32x4_t i = vcvtq_s32_f32(x);
+        uint32x4_t above = vcgtq_f32(vcvtq_f32_s32(i), x);
+        return vaddq_s32(i, vreinterpretq_s32_u32(above));
+    }
+
+    inline batch<int32_t, 4> to_int_ceil(const batch<float, 4>& x)
+    {
+        int32x4_t i = vcvtq_s32_f32(x);
+        uint32x4_t below = vcltq_f32(vcvtq_f32_s32(i), x);
+        return vsubq_s32(i, vreinterpretq_s32_u32(below));
+    }
+#endif
+
     inline batch<float, 4> to_float(const batch<int32_t, 4>& x)
     {
         return vcvtq_f32_s32(x);
@@ -64,6 +115,21 @@ namespace xsimd
         return vcvtq_s64_f64(x);
     }
 
+    inline batch<int64_t, 2> to_int_nearest(const batch<double, 2>& x)
+    {
+        return vcvtnq_s64_f64(x);
+    }
+
+    inline batch<int64_t, 2> to_int_floor(const batch<double, 2>& x)
+    {
+        return vcvtmq_s64_f64(x);
+    }
+
+    inline batch<int64_t, 2> to_int_ceil(const batch<double, 2>& x)
+    {
+        return vcvtpq_s64_f64(x);
+    }
+
     inline batch<double, 2> to_float(const batch<int64_t, 2>& x)
     {
         return vcvtq_f64_s64(x);
@@ -116,6 +182,14 @@ namespace xsimd
                                  float, 4,
                                  vreinterpretq_f32_s64)
 
+    XSIMD_BITWISE_CAST_INTRINSIC(int32_t, 4,
+                                 int64_t, 2,
+                                 vreinterpretq_s64_s32)
+
+    XSIMD_BITWISE_CAST_INTRINSIC(int64_t, 2,
+                                 int32_t, 4,
+                                 vreinterpretq_s32_s64)
+
 #if XSIMD_ARM_INSTR_SET >= XSIMD_ARM8_64_NEON_VERSION
     XSIMD_BITWISE_CAST_INTRINSIC(double, 2,
                                  float, 4,
@@ -381,6 +381,11 @@ namespace xsimd
         return vshlq_s32(lhs, rhs);
     }
 
+    inline batch<int32_t, 4> operator>>(const batch<int32_t, 4>& lhs, const batch<int32_t, 4>& rhs)
+    {
+        return vshlq_s32(lhs, vnegq_s32(rhs));
+    }
+
     inline batch_bool<int32_t, 4> operator==(const batch<int32_t, 4>& lhs, const batch<int32_t, 4>& rhs)
     {
         return vceqq_s32(lhs, rhs);
@@ -390,6 +390,11 @@ namespace xsimd
         return vshlq_s64(lhs, rhs);
     }
 
+    inline batch<int64_t, 2> operator>>(const batch<int64_t, 2>& lhs, const batch<int64_t, 2>& rhs)
+    {
+        return vshlq_s64(lhs, vsubq_s64(vdupq_n_s64(0), rhs));
+    }
+
     inline batch_bool<int64_t, 2> operator==(const batch<int64_t, 2>& lhs, const batch<int64_t, 2>& rhs)
     {
     #if XSIMD_ARM_INSTR_SET >= XSIMD_ARM8_64_NEON_VERSION
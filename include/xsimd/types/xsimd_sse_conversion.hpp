@@ -24,6 +24,13 @@ namespace xsimd
     batch<int32_t, 4> to_int(const batch<float, 4>& x);
     batch<int64_t, 2> to_int(const batch<double, 2>& x);
 
+    batch<int32_t, 4> to_int_nearest(const batch<float, 4>& x);
+    batch<int64_t, 2> to_int_nearest(const batch<double, 2>& x);
+    batch<int32_t, 4> to_int_floor(const batch<float, 4>& x);
+    batch<int64_t, 2> to_int_floor(const batch<double, 2>& x);
+    batch<int32_t, 4> to_int_ceil(const batch<float, 4>& x);
+    batch<int64_t, 2> to_int_ceil(const batch<double, 2>& x);
+
     batch<float, 4> to_float(const batch<int32_t, 4>& x);
     batch<double, 2> to_float(const batch<int64_t, 2>& x);
 
@@ -40,6 +47,19 @@ namespace xsimd
      * conversion functions implementation *
      ***************************************/
 
+    namespace detail
+    {
+        // sign extends the two lower int32 of x
+        inline __m128i sse_cvtepi32_epi64(__m128i x)
+        {
+#if XSIMD_X86_INSTR_SET >= XSIMD_X86_SSE4_1_VERSION
+            return _mm_cvtepi32_epi64(x);
+#else
+            return _mm_unpacklo_epi32(x, _mm_cmplt_epi32(x, _mm_setzero_si128()));
+#endif
+        }
+    }
+
     inline batch<int32_t, 4> to_int(const batch<float, 4>& x)
     {
         return _mm_cvttps_epi32(x);
@@ -47,11 +67,74 @@ namespace xsimd
 
     inline batch<int64_t, 2> to_int(const batch<double, 2>& x)
     {
-        using batch_int = batch<int64_t, 2>;
-        __m128i tmp = _mm_cvttpd_epi32(x);
-        return _mm_unpacklo_epi32(tmp, batch_int(tmp) < batch_int(int64_t(0)));
+        return detail::sse_cvtepi32_epi64(_mm_cvttpd_epi32(x));
+    }
+
+    inline batch<int32_t, 4> to_int_nearest(const batch<float, 4>& x)
+    {
+        return _mm_cvtps_epi32(x);
+    }
+
+    inline batch<int64_t, 2> to_int_nearest(const batch<double, 2>& x)
+    {
+        return detail::sse_cvtepi32_epi64(_mm_cvtpd_epi32(x));
+    }
+
+#if XSIMD_X86_INSTR_SET >= XSIMD_X86_SSE4_1_VERSION
+    inline batch<int32_t, 4> to_int_floor(const batch<float, 4>& x)
+    {
+        return _mm_cvttps_epi32(_mm_floor_ps(x));
+    }
+
+    inline batch<int64_t, 2> to_int_floor(const batch<double, 2>& x)
+    {
+        return detail::sse_cvtepi32_epi64(_mm_cvttpd_epi32(_mm_floor_pd(x)));
+    }
+
+    inline batch<int32_t, 4> to_int_ceil(const batch<float, 4>& x)
+    {
+        return _mm_cvttps_epi32(_mm_ceil_ps(x));
+    }
+
+    inline batch<int64_t, 2> to_int_ceil(const batch<double, 2>& x)
+    {
+        return detail::sse_cvtepi32_epi64(_mm_cvttpd_epi32(_mm_ceil_pd(x)));
+    }
+#else
+    // The nearest integer is corrected by the comparison mask, -1 where
+    // it is on the wrong side of x
+
+    inline batch<int32_t, 4> to_int_floor(const batch<float, 4>& x)
+    {
+        __m128i i = _mm_cvtps_epi32(x);
+        __m128 above = _mm_cmpgt_ps(_mm_cvtepi32_ps(i), x);
+        return _mm_add_epi32(i, _mm_castps_si128(above));
+    }
+
+    inline batch<int64_t, 2> to_int_floor(const batch<double, 2>& x)
+    {
+        __m128i i = _mm_cvtpd_epi32(x);
+        __m128i above = _mm_castpd_si128(_mm_cmpgt_pd(_mm_cvtepi32_pd(i), x));
+        above = _mm_shuffle_epi32(above, _MM_SHUFFLE(3, 1, 2, 0));
+        return detail::sse_cvtepi32_epi64(_mm_add_epi32(i, above));
+    }
+
+    inline batch<int32_t, 4> to_int_ceil(const batch<float, 4>& x)
+    {
+        __m128i i = _mm_cvtps_epi32(x);
+        __m128 below = _mm_cmplt_ps(_mm_cvtepi32_ps(i), x);
+        return _mm_sub_epi32(i, _mm_castps_si128(below));
     }
 
+    inline batch<int64_t, 2> to_int_ceil(const batch<double, 2>& x)
+    {
+        __m128i i = _mm_cvtpd_epi32(x);
+        __m128i below = _mm_castpd_si128(_mm_cmplt_pd(_mm_cvtepi32_pd(i), x));
+        below = _mm_shuffle_epi32(below, _MM_SHUFFLE(3, 1, 2, 0));
+        return detail::sse_cvtepi32_epi64(_mm_sub_epi32(i, below));
+    }
+#endif
+
     inline batch<float, 4> to_float(const batch<int32_t, 4>& x)
     {
         return _mm_cvtepi32_ps(x);
@@ -122,6 +205,10 @@ namespace xsimd
                                  double, 2,
                                  _mm_castsi128_pd)
 
+    XSIMD_BITWISE_CAST_INTRINSIC(int32_t, 4,
+                                 int64_t, 2,
+                                 __m128i)
+
     XSIMD_BITWISE_CAST_INTRINSIC(int64_t, 2,
                                  float, 4,
                                  _mm_castsi128_ps)
@@ -129,6 +216,10 @@ namespace xsimd
     XSIMD_BITWISE_CAST_INTRINSIC(int64_t, 2,
                                  double, 2,
                                  _mm_castsi128_pd)
+
+    XSIMD_BITWISE_CAST_INTRINSIC(int64_t, 2,
+                                 int32_t, 4,
+                                 __m128i)
 }
 
 #endif
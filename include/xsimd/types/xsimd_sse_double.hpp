@@ -58,6 +58,7 @@ namespace xsimd
 
     bool all(const batch_bool<double, 2>& rhs);
     bool any(const batch_bool<double, 2>& rhs);
+    uint64_t to_bitmask(const batch_bool<double, 2>& rhs);
 
     /********************
      * batch<double, 2> *
@@ -225,12 +226,12 @@ namespace xsimd
 
     inline batch_bool<double, 2> operator==(const batch_bool<double, 2>& lhs, const batch_bool<double, 2>& rhs)
     {
-        return _mm_cmpeq_pd(lhs, rhs);
+        return _mm_cmpeq_pd(_mm_xor_pd(lhs, rhs), _mm_setzero_pd());
     }
 
     inline batch_bool<double, 2> operator!=(const batch_bool<double, 2>& lhs, const batch_bool<double, 2>& rhs)
     {
-        return _mm_cmpneq_pd(lhs, rhs);
+        return _mm_xor_pd(lhs, rhs);
     }
 
     inline bool all(const batch_bool<double, 2>& rhs)
@@ -243,6 +244,11 @@ namespace xsimd
         return _mm_movemask_pd(rhs) != 0;
     }
 
+    inline uint64_t to_bitmask(const batch_bool<double, 2>& rhs)
+    {
+        return static_cast<uint64_t>(_mm_movemask_pd(rhs));
+    }
+
     /***********************************
      * batch<double, 2> implementation *
      ***********************************/
@@ -58,6 +58,7 @@ namespace xsimd
 
     bool all(const batch_bool<float, 4>& rhs);
     bool any(const batch_bool<float, 4>& rhs);
+    uint64_t to_bitmask(const batch_bool<float, 4>& rhs);
 
     /*******************
      * batch<float, 4> *
@@ -225,12 +226,12 @@ namespace xsimd
 
     inline batch_bool<float, 4> operator==(const batch_bool<float, 4>& lhs, const batch_bool<float, 4>& rhs)
     {
-        return _mm_cmpeq_ps(lhs, rhs);
+        return _mm_cmpeq_ps(_mm_xor_ps(lhs, rhs), _mm_setzero_ps());
     }
 
     inline batch_bool<float, 4> operator!=(const batch_bool<float, 4>& lhs, const batch_bool<float, 4>& rhs)
     {
-        return _mm_cmpneq_ps(lhs, rhs);
+        return _mm_xor_ps(lhs, rhs);
     }
 
     inline bool all(const batch_bool<float, 4>& rhs)
@@ -243,6 +244,11 @@ namespace xsimd
         return _mm_movemask_ps(rhs) != 0;
     }
 
+    inline uint64_t to_bitmask(const batch_bool<float, 4>& rhs)
+    {
+        return static_cast<uint64_t>(_mm_movemask_ps(rhs));
+    }
+
     /**********************************
      * batch<float, 4> implementation *
      **********************************/
@@ -60,6 +60,7 @@ namespace xsimd
 
     bool all(const batch_bool<int32_t, 4>& rhs);
     bool any(const batch_bool<int32_t, 4>& rhs);
+    uint64_t to_bitmask(const batch_bool<int32_t, 4>& rhs);
 
     /*********************
      * batch<int32_t, 4> *
@@ -154,6 +155,46 @@ namespace xsimd
 
     batch<int32_t, 4> operator<<(const batch<int32_t, 4>& lhs, int32_t rhs);
     batch<int32_t, 4> operator>>(const batch<int32_t, 4>& lhs, int32_t rhs);
+    batch<int32_t, 4> operator<<(const batch<int32_t, 4>& lhs, const batch<int32_t, 4>& rhs);
+    batch<int32_t, 4> operator>>(const batch<int32_t, 4>& lhs, const batch<int32_t, 4>& rhs);
+
+    /********************
+     * helper functions *
+     ********************/
+
+    namespace detail
+    {
+        // SSE2 only shifts all the lanes by the same count: shift the whole
+        // register once per lane count and keep the lane that used it
+        inline __m128i shift_lane_count_epi32(__m128i rhs, int lane)
+        {
+            __m128i count = lane < 2 ? rhs : _mm_unpackhi_epi64(rhs, rhs);
+            return lane % 2 == 0 ? _mm_srli_epi64(_mm_slli_epi64(count, 32), 32) : _mm_srli_epi64(count, 32);
+        }
+
+        inline __m128i shift_merge_lanes_epi32(__m128i r0, __m128i r1, __m128i r2, __m128i r3)
+        {
+            __m128i lo = _mm_shuffle_epi32(_mm_unpacklo_epi32(r0, r1), _MM_SHUFFLE(3, 3, 3, 0));
+            __m128i hi = _mm_shuffle_epi32(_mm_unpackhi_epi32(r2, r3), _MM_SHUFFLE(3, 3, 3, 0));
+            return _mm_unpacklo_epi64(lo, hi);
+        }
+
+        inline __m128i sllv_epi32_sse2(__m128i lhs, __m128i rhs)
+        {
+            return shift_merge_lanes_epi32(_mm_sll_epi32(lhs, shift_lane_count_epi32(rhs, 0)),
+                                           _mm_sll_epi32(lhs, shift_lane_count_epi32(rhs, 1)),
+                                           _mm_sll_epi32(lhs, shift_lane_count_epi32(rhs, 2)),
+                                           _mm_sll_epi32(lhs, shift_lane_count_epi32(rhs, 3)));
+        }
+
+        inline __m128i srlv_epi32_sse2(__m128i lhs, __m128i rhs)
+        {
+            return shift_merge_lanes_epi32(_mm_srl_epi32(lhs, shift_lane_count_epi32(rhs, 0)),
+                                           _mm_srl_epi32(lhs, shift_lane_count_epi32(rhs, 1)),
+                                           _mm_srl_epi32(lhs, shift_lane_count_epi32(rhs, 2)),
+                                           _mm_srl_epi32(lhs, shift_lane_count_epi32(rhs, 3)));
+        }
+    }
 
     /*****************************************
      * batch_bool<int32_t, 4> implementation *
@@ -245,6 +286,11 @@ namespace xsimd
 #endif
     }
 
+    inline uint64_t to_bitmask(const batch_bool<int32_t, 4>& rhs)
+    {
+        return static_cast<uint64_t>(_mm_movemask_ps(_mm_castsi128_ps(rhs)));
+    }
+
     /************************************
      * batch<int32_t, 4> implementation *
      ************************************/
@@ -571,6 +617,24 @@ namespace xsimd
     {
         return _mm_srli_epi32(lhs, rhs);
     }
+
+    inline batch<int32_t, 4> operator<<(const batch<int32_t, 4>& lhs, const batch<int32_t, 4>& rhs)
+    {
+#if XSIMD_X86_INSTR_SET >= XSIMD_X86_AVX2_VERSION
+        return _mm_sllv_epi32(lhs, rhs);
+#else
+        return detail::sllv_epi32_sse2(lhs, rhs);
+#endif
+    }
+
+    inline batch<int32_t, 4> operator>>(const batch<int32_t, 4>& lhs, const batch<int32_t, 4>& rhs)
+    {
+#if XSIMD_X86_INSTR_SET >= XSIMD_X86_AVX2_VERSION
+        return _mm_srlv_epi32(lhs, rhs);
+#else
+        return detail::srlv_epi32_sse2(lhs, rhs);
+#endif
+    }
 }
 
 #endif
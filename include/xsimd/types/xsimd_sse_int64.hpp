@@ -60,6 +60,7 @@ namespace xsimd
 
     bool all(const batch_bool<int64_t, 2>& rhs);
     bool any(const batch_bool<int64_t, 2>& rhs);
+    uint64_t to_bitmask(const batch_bool<int64_t, 2>& rhs);
 
     /*********************
      * batch<int64_t, 2> *
@@ -154,6 +155,8 @@ namespace xsimd
 
     batch<int64_t, 2> operator<<(const batch<int64_t, 2>& lhs, int32_t rhs);
     batch<int64_t, 2> operator>>(const batch<int64_t, 2>& lhs, int32_t rhs);
+    batch<int64_t, 2> operator<<(const batch<int64_t, 2>& lhs, const batch<int64_t, 2>& rhs);
+    batch<int64_t, 2> operator>>(const batch<int64_t, 2>& lhs, const batch<int64_t, 2>& rhs);
 
     /********************
      * helper functions *
@@ -169,6 +172,31 @@ namespace xsimd
             __m128i tmp4 = _mm_srai_epi32(tmp3, 31);
             return _mm_shuffle_epi32(tmp4, 0xF5);
         }
+
+        // low 64 bits of the product, from three 32 x 32 -> 64 bits
+        // multiplications: lo(a) * lo(b) + ((hi(a) * lo(b) + lo(a) * hi(b)) << 32)
+        inline __m128i mullo_epi64_sse2(__m128i lhs, __m128i rhs)
+        {
+            __m128i lo = _mm_mul_epu32(lhs, rhs);
+            __m128i cross = _mm_add_epi64(_mm_mul_epu32(_mm_srli_epi64(lhs, 32), rhs),
+                                          _mm_mul_epu32(lhs, _mm_srli_epi64(rhs, 32)));
+            return _mm_add_epi64(lo, _mm_slli_epi64(cross, 32));
+        }
+
+        // one shift per lane count, the low lane is taken from the first one
+        inline __m128i sllv_epi64_sse2(__m128i lhs, __m128i rhs)
+        {
+            __m128i lo = _mm_sll_epi64(lhs, rhs);
+            __m128i hi = _mm_sll_epi64(lhs, _mm_unpackhi_epi64(rhs, rhs));
+            return _mm_castpd_si128(_mm_move_sd(_mm_castsi128_pd(hi), _mm_castsi128_pd(lo)));
+        }
+
+        inline __m128i srlv_epi64_sse2(__m128i lhs, __m128i rhs)
+        {
+            __m128i lo = _mm_srl_epi64(lhs, rhs);
+            __m128i hi = _mm_srl_epi64(lhs, _mm_unpackhi_epi64(rhs, rhs));
+            return _mm_castpd_si128(_mm_move_sd(_mm_castsi128_pd(hi), _mm_castsi128_pd(lo)));
+        }
     }
 
     /*****************************************
@@ -265,6 +293,11 @@ namespace xsimd
 #endif
     }
 
+    inline uint64_t to_bitmask(const batch_bool<int64_t, 2>& rhs)
+    {
+        return static_cast<uint64_t>(_mm_movemask_pd(_mm_castsi128_pd(rhs)));
+    }
+
     /************************************
      * batch<int64_t, 2> implementation *
      ************************************/
@@ -441,10 +474,11 @@ namespace xsimd
 
     inline batch<int64_t, 2> operator*(const batch<int64_t, 2>& lhs, const batch<int64_t, 2>& rhs)
     {
-        alignas(16) int64_t slhs[2], srhs[2];
-        lhs.store_aligned(slhs);
-        rhs.store_aligned(srhs);
-        return batch<int64_t, 2>(slhs[0] * srhs[0], slhs[1] * srhs[1]);
+#if defined(__AVX512DQ__) && defined(__AVX512VL__)
+        return _mm_mullo_epi64(lhs, rhs);
+#else
+        return detail::mullo_epi64_sse2(lhs, rhs);
+#endif
     }
 
     inline batch<int64_t, 2> operator/(const batch<int64_t, 2>& lhs, const batch<int64_t, 2>& rhs)
@@ -586,6 +620,24 @@ namespace xsimd
     {
         return _mm_srli_epi64(lhs, rhs);
     }
+
+    inline batch<int64_t, 2> operator<<(const batch<int64_t, 2>& lhs, const batch<int64_t, 2>& rhs)
+    {
+#if XSIMD_X86_INSTR_SET >= XSIMD_X86_AVX2_VERSION
+        return _mm_sllv_epi64(lhs, rhs);
+#else
+        return detail::sllv_epi64_sse2(lhs, rhs);
+#endif
+    }
+
+    inline batch<int64_t, 2> operator>>(const batch<int64_t, 2>& lhs, const batch<int64_t, 2>& rhs)
+    {
+#if XSIMD_X86_INSTR_SET >= XSIMD_X86_AVX2_VERSION
+        return _mm_srlv_epi64(lhs, rhs);
+#else
+        return detail::srlv_epi64_sse2(lhs, rhs);
+#endif
+    }
 }
 
 #endif
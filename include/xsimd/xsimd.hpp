@@ -11,7 +11,9 @@
 
 #include "memory/xsimd_alignment.hpp"
 #include "config/xsimd_config.hpp"
+#include "config/xsimd_denormal.hpp"
 #include "types/xsimd_traits.hpp"
+#include "memory/xsimd_gather.hpp"
 #include "math/xsimd_math.hpp"
 
 namespace xsimd
@@ -0,0 +1,258 @@
+/***************************************************************************
+* Copyright (c) 2016, Johan Mabille and Sylvain Corlay                     *
+*                                                                          *
+* Distributed under the terms of the BSD 3-Clause License.                 *
+*                                                                          *
+* The full license is in the file LICENSE, distributed with this software. *
+****************************************************************************/
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "xsimd/algorithms/xsimd_softmax.hpp"
+#include "xsimd/math/xsimd_activation.hpp"
+#include "xsimd/memory/xsimd_aligned_allocator.hpp"
+#include "xsimd/types/xsimd_types_include.hpp"
+#include "xsimd_activation_test.hpp"
+
+namespace xsimd
+{
+    template <class T, size_t N, size_t A>
+    bool test_activation(std::ostream& out, const std::string& name)
+    {
+        simd_activation_tester<T, N, A> tester(name);
+        return test_simd_activation(out, tester);
+    }
+}
+
+#if XSIMD_X86_INSTR_SET >= XSIMD_X86_SSE2_VERSION
+TEST(xsimd, sse_float_activation)
+{
+    std::ofstream out("log/sse_float_activation.log", std::ios_base::out);
+    bool res = xsimd::test_activation<float, 4, 16>(out, "sse float");
+    EXPECT_TRUE(res);
+}
+
+TEST(xsimd, sse_double_activation)
+{
+    std::ofstream out("log/sse_double_activation.log", std::ios_base::out);
+    bool res = xsimd::test_activation<double, 2, 16>(out, "sse double");
+    EXPECT_TRUE(res);
+}
+#endif
+
+#if XSIMD_X86_INSTR_SET >= XSIMD_X86_AVX_VERSION
+TEST(xsimd, avx_float_activation)
+{
+    std::ofstream out("log/avx_float_activation.log", std::ios_base::out);
+    bool res = xsimd::test_activation<float, 8, 32>(out, "avx float");
+    EXPECT_TRUE(res);
+}
+
+TEST(xsimd, avx_double_activation)
+{
+    std::ofstream out("log/avx_double_activation.log", std::ios_base::out);
+    bool res = xsimd::test_activation<double, 4, 32>(out, "avx double");
+    EXPECT_TRUE(res);
+}
+#endif
+
+#if XSIMD_X86_INSTR_SET >= XSIMD_X86_AVX512_VERSION
+TEST(xsimd, avx512_float_activation)
+{
+    std::ofstream out("log/avx512_float_activation.log", std::ios_base::out);
+    bool res = xsimd::test_activation<float, 16, 64>(out, "avx512 float");
+    EXPECT_TRUE(res);
+}
+
+TEST(xsimd, avx512_double_activation)
+{
+    std::ofstream out("log/avx512_double_activation.log", std::ios_base::out);
+    bool res = xsimd::test_activation<double, 8, 64>(out, "avx512 double");
+    EXPECT_TRUE(res);
+}
+#endif
+
+#if XSIMD_ARM_INSTR_SET >= XSIMD_ARM7_NEON_VERSION
+TEST(xsimd, neon_float_activation)
+{
+    std::ofstream out("log/neon_float_activation.log", std::ios_base::out);
+    bool res = xsimd::test_activation<float, 4, 16>(out, "neon float");
+    EXPECT_TRUE(res);
+}
+#endif
+#if XSIMD_ARM_INSTR_SET >= XSIMD_ARM8_64_NEON_VERSION
+TEST(xsimd, neon_double_activation)
+{
+    std::ofstream out("log/neon_double_activation.log", std::ios_base::out);
+    bool res = xsimd::test_activation<double, 2, 32>(out, "neon double");
+    EXPECT_TRUE(res);
+}
+#endif
+
+#if defined(XSIMD_ENABLE_FALLBACK)
+TEST(xsimd, fallback_float_activation)
+{
+    std::ofstream out("log/fallback_float_activation.log", std::ios_base::out);
+    bool res = xsimd::test_activation<float, 7, 32>(out, "fallback float");
+    EXPECT_TRUE(res);
+}
+
+TEST(xsimd, fallback_double_activation)
+{
+    std::ofstream out("log/fallback_double_activation.log", std::ios_base::out);
+    bool res = xsimd::test_activation<double, 3, 32>(out, "fallback double");
+    EXPECT_TRUE(res);
+}
+#endif
+
+namespace xsimd
+{
+    template <class T>
+    void check_fast_activation()
+    {
+        using b_type = simd_type<T>;
+        constexpr std::size_t size = simd_traits<T>::size;
+        const T tol = T(3e-6);
+        fast_approx_tag fast;
+        for (T start = T(-10); start < T(10); start += T(0.01) * size)
+        {
+            std::vector<T> in(size);
+            for (std::size_t i = 0; i < size; ++i)
+            {
+                in[i] = start + T(0.01) * i;
+            }
+            b_type x = load_unaligned(&in[0]);
+            b_type ref[] = { sigmoid(x), log_sigmoid(x), softplus(x), silu(x), gelu(x) };
+            b_type res[] = { sigmoid(x, fast), log_sigmoid(x, fast), softplus(x, fast), silu(x, fast), gelu(x, fast) };
+            for (std::size_t f = 0; f < 5; ++f)
+            {
+                for (std::size_t i = 0; i < size; ++i)
+                {
+                    EXPECT_NEAR(res[f][i], ref[f][i], tol * std::abs(ref[f][i]) + tol * tol) << "function " << f << ", x = " << in[i];
+                }
+            }
+        }
+    }
+
+    TEST(xsimd, fast_activation)
+    {
+        check_fast_activation<float>();
+        check_fast_activation<double>();
+    }
+
+    template <class T>
+    void check_softmax(std::size_t n, T scale)
+    {
+        std::vector<T> in(n), res(n), ref(n);
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            in[i] = scale * std::sin(T(0.37) * i) + T(i % 7);
+        }
+        T m = *std::max_element(in.begin(), in.end());
+        long double sum = 0;
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            sum += std::exp(static_cast<long double>(in[i] - m));
+        }
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            ref[i] = static_cast<T>(std::exp(static_cast<long double>(in[i] - m)) / sum);
+        }
+        T lse = static_cast<T>(m + std::log(sum));
+        const T tol = 64 * std::numeric_limits<T>::epsilon();
+
+        EXPECT_NEAR(log_sum_exp(in.data(), n), lse, tol * std::abs(lse)) << "n = " << n;
+        EXPECT_NEAR(log_sum_exp(in.data(), n, fast_approx_tag()), lse, T(1e-5) * std::abs(lse)) << "n = " << n;
+
+        softmax(in.data(), n, res.data());
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            EXPECT_NEAR(res[i], ref[i], tol * ref[i] + 4 * std::numeric_limits<T>::min()) << "n = " << n << ", i = " << i;
+        }
+
+        softmax(in.data(), n, res.data(), fast_approx_tag());
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            EXPECT_NEAR(res[i], ref[i], T(1e-5) * ref[i] + 4 * std::numeric_limits<T>::min()) << "n = " << n << ", i = " << i;
+        }
+    }
+
+    TEST(xsimd, softmax)
+    {
+        std::size_t sizes[] = { 1, 3, 16, 37, 64, 1000, 1025 };
+        for (std::size_t n : sizes)
+        {
+            check_softmax<float>(n, 5.f);
+            check_softmax<float>(n, 200.f);
+            check_softmax<double>(n, 5.);
+            check_softmax<double>(n, 1000.);
+        }
+    }
+
+    TEST(xsimd, log_sum_exp_infinities)
+    {
+        const double inf = std::numeric_limits<double>::infinity();
+        std::vector<double> in(37, -inf);
+        EXPECT_EQ(log_sum_exp(in.data(), in.size()), -inf);
+        in[20] = 0.;
+        EXPECT_DOUBLE_EQ(log_sum_exp(in.data(), in.size()), 0.);
+        in[3] = inf;
+        EXPECT_EQ(log_sum_exp(in.data(), in.size()), inf);
+    }
+
+    template <class T>
+    void check_softmax_special(std::size_t n)
+    {
+        const T inf = std::numeric_limits<T>::infinity();
+        std::vector<T> in(n, -inf), res(n);
+        softmax(in.data(), n, res.data());
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            EXPECT_EQ(res[i], T(1) / T(n)) << "n = " << n << ", i = " << i;
+        }
+        softmax(in.data(), n, res.data(), fast_approx_tag());
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            EXPECT_EQ(res[i], T(1) / T(n)) << "n = " << n << ", i = " << i;
+        }
+
+        // a single NaN, in the vectorized part or in the tail
+        for (std::size_t k : { std::size_t(0), n / 2, n - 1 })
+        {
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                in[i] = T(i % 5);
+            }
+            in[k] = std::numeric_limits<T>::quiet_NaN();
+            EXPECT_TRUE(std::isnan(log_sum_exp(in.data(), n))) << "n = " << n << ", k = " << k;
+            EXPECT_TRUE(std::isnan(log_sum_exp(in.data(), n, fast_approx_tag()))) << "n = " << n << ", k = " << k;
+            softmax(in.data(), n, res.data());
+            EXPECT_TRUE(std::all_of(res.begin(), res.end(), [](T v) { return std::isnan(v); })) << "n = " << n << ", k = " << k;
+            softmax(in.data(), n, res.data(), fast_approx_tag());
+            EXPECT_TRUE(std::all_of(res.begin(), res.end(), [](T v) { return std::isnan(v); })) << "n = " << n << ", k = " << k;
+            // NaN among -inf
+            std::fill(in.begin(), in.end(), -inf);
+            in[k] = std::numeric_limits<T>::quiet_NaN();
+            EXPECT_TRUE(std::isnan(log_sum_exp(in.data(), n))) << "n = " << n << ", k = " << k;
+            softmax(in.data(), n, res.data());
+            EXPECT_TRUE(std::isnan(res[0])) << "n = " << n << ", k = " << k;
+        }
+    }
+
+    TEST(xsimd, softmax_special_values)
+    {
+        std::size_t sizes[] = { 1, 3, 16, 37, 1025 };
+        for (std::size_t n : sizes)
+        {
+            check_softmax_special<float>(n);
+            check_softmax_special<double>(n);
+        }
+    }
+}
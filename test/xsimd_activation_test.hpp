@@ -0,0 +1,163 @@
+/***************************************************************************
+* Copyright (c) 2016, Johan Mabille and Sylvain Corlay                     *
+*                                                                          *
+* Distributed under the terms of the BSD 3-Clause License.                 *
+*                                                                          *
+* The full license is in the file LICENSE, distributed with this software. *
+****************************************************************************/
+
+#ifndef XSIMD_ACTIVATION_TEST_HPP
+#define XSIMD_ACTIVATION_TEST_HPP
+
+#include "xsimd_test_utils.hpp"
+#include "xsimd_tester.hpp"
+
+namespace xsimd
+{
+
+    template <class T, std::size_t N, std::size_t A>
+    struct simd_activation_tester : simd_tester<T, N, A>
+    {
+        using base_type = simd_tester<T, N, A>;
+        using vector_type = typename base_type::vector_type;
+        using value_type = typename base_type::value_type;
+        using res_type = typename base_type::res_type;
+
+        std::string name;
+
+        res_type input;
+        res_type sigmoid_res;
+        res_type log_sigmoid_res;
+        res_type softplus_res;
+        res_type silu_res;
+        res_type gelu_input;
+        res_type gelu_res;
+        res_type gelu_tanh_res;
+
+        simd_activation_tester(const std::string& n);
+    };
+
+    template <class T, std::size_t N, std::size_t A>
+    simd_activation_tester<T, N, A>::simd_activation_tester(const std::string& n)
+        : name(n)
+    {
+        using ref_type = long double;
+        size_t nb_input = N * 10000;
+        input.resize(nb_input);
+        sigmoid_res.resize(nb_input);
+        log_sigmoid_res.resize(nb_input);
+        softplus_res.resize(nb_input);
+        silu_res.resize(nb_input);
+        gelu_input.resize(nb_input);
+        gelu_res.resize(nb_input);
+        gelu_tanh_res.resize(nb_input);
+        for (size_t i = 0; i < nb_input; ++i)
+        {
+            input[i] = value_type(-20) + i * value_type(40) / nb_input;
+            ref_type x = input[i];
+            ref_type sig = 1 / (1 + std::exp(-x));
+            ref_type sp = x > 0 ? x + std::log1p(std::exp(-x)) : std::log1p(std::exp(x));
+            ref_type u = ref_type(0.797884560802865355879892119868763737) * (x + ref_type(0.044715) * x * x * x);
+            sigmoid_res[i] = value_type(sig);
+            log_sigmoid_res[i] = value_type(x < 0 ? x - std::log1p(std::exp(x)) : -std::log1p(std::exp(-x)));
+            softplus_res[i] = value_type(sp);
+            silu_res[i] = value_type(x * sig);
+            // restricted to the range where erfc is accurate
+            gelu_input[i] = value_type(-3) + i * value_type(6) / nb_input;
+            ref_type g = gelu_input[i];
+            gelu_res[i] = value_type(ref_type(0.5) * g * std::erfc(-g / std::sqrt(ref_type(2))));
+            gelu_tanh_res[i] = value_type(x / (1 + std::exp(-2 * u)));
+        }
+    }
+
+    template <class T>
+    bool test_simd_activation(std::ostream& out, T& tester)
+    {
+        using tester_type = T;
+        using vector_type = typename tester_type::vector_type;
+        using res_type = typename tester_type::res_type;
+
+        vector_type input;
+        vector_type vres;
+        res_type res(tester.input.size());
+
+        bool success = true;
+        bool tmp_success = true;
+
+        std::string val_type = value_type_name<vector_type>();
+        std::string shift = std::string(val_type.size(), '-');
+        std::string name = tester.name;
+        std::string name_shift = std::string(name.size(), '-');
+        std::string dash(8, '-');
+        std::string space(8, ' ');
+
+        out << dash << name_shift << '-' << shift << dash << std::endl;
+        out << space << name << " " << val_type << std::endl;
+        out << dash << name_shift << '-' << shift << dash << std::endl
+            << std::endl;
+
+        std::string topic = "sigmoid     : ";
+        for (size_t i = 0; i < tester.input.size(); i += tester.size)
+        {
+            detail::load_vec(input, tester.input, i);
+            vres = sigmoid(input);
+            detail::store_vec(vres, res, i);
+        }
+        tmp_success = check_almost_equal(topic, res, tester.sigmoid_res, out);
+        success = success && tmp_success;
+
+        topic = "log_sigmoid : ";
+        for (size_t i = 0; i < tester.input.size(); i += tester.size)
+        {
+            detail::load_vec(input, tester.input, i);
+            vres = log_sigmoid(input);
+            detail::store_vec(vres, res, i);
+        }
+        tmp_success = check_almost_equal(topic, res, tester.log_sigmoid_res, out);
+        success = success && tmp_success;
+
+        topic = "softplus    : ";
+        for (size_t i = 0; i < tester.input.size(); i += tester.size)
+        {
+            detail::load_vec(input, tester.input, i);
+            vres = softplus(input);
+            detail::store_vec(vres, res, i);
+        }
+        tmp_success = check_almost_equal(topic, res, tester.softplus_res, out);
+        success = success && tmp_success;
+
+        topic = "silu        : ";
+        for (size_t i = 0; i < tester.input.size(); i += tester.size)
+        {
+            detail::load_vec(input, tester.input, i);
+            vres = silu(input);
+            detail::store_vec(vres, res, i);
+        }
+        tmp_success = check_almost_equal(topic, res, tester.silu_res, out);
+        success = success && tmp_success;
+
+        topic = "gelu        : ";
+        for (size_t i = 0; i < tester.input.size(); i += tester.size)
+        {
+            detail::load_vec(input, tester.gelu_input, i);
+            vres = gelu(input);
+            detail::store_vec(vres, res, i);
+        }
+        tmp_success = check_almost_equal(topic, res, tester.gelu_res, out);
+        success = success && tmp_success;
+
+        topic = "gelu_tanh   : ";
+        for (size_t i = 0; i < tester.input.size(); i += tester.size)
+        {
+            detail::load_vec(input, tester.input, i);
+            vres = gelu_tanh(input);
+            detail::store_vec(vres, res, i);
+        }
+        tmp_success = check_almost_equal(topic, res, tester.gelu_tanh_res, out);
+        success = success && tmp_success;
+
+        return success;
+    }
+}
+
+#endif
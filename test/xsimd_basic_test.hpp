@@ -11,6 +11,7 @@
 
 #include <numeric>
 #include <limits>
+#include <random>
 
 #include "xsimd_test_utils.hpp"
 #include "xsimd_tester.hpp"
@@ -69,6 +70,8 @@ namespace xsimd
         res_type fnms_res;
         res_type sqrt_res;
         value_type hadd_res;
+        res_type haddp_input;
+        res_type haddp_res;
 
         simd_basic_tester(const std::string& name);
     };
@@ -162,6 +165,22 @@ namespace xsimd
             mix_lhs_rhs[2 * i] = lhs[2 * i];
             mix_lhs_rhs[2 * i + 1] = rhs[2 * i + 1];
         }
+
+        // random rows, so that a wrong pairing of rows and lanes in haddp
+        // cannot be hidden by a regular pattern
+        std::mt19937 generator(42);
+        std::uniform_real_distribution<value_type> distribution(value_type(0.5), value_type(2.));
+        haddp_input.resize(N * N);
+        haddp_res.resize(N);
+        for (size_t i = 0; i < N; ++i)
+        {
+            haddp_res[i] = value_type(0);
+            for (size_t j = 0; j < N; ++j)
+            {
+                haddp_input[i * N + j] = distribution(generator);
+                haddp_res[i] += haddp_input[i * N + j];
+            }
+        }
     }
 
     template <class T, std::size_t N, std::size_t A>
@@ -376,25 +395,25 @@ namespace xsimd
     }
 
     template <class I, std::size_t N, class S>
-    bool test_simd_bool(const batch<I, N>& /*empty*/, S& /*stream*/)
+    bool test_simd_bool(const batch<I, N>& /*empty*/, S& stream)
     {
         bool success = true;
-        // auto bool_g = get_bool<typename simd_batch_traits<batch<I, N>>::batch_bool_type>{};
-        // success = success && all(bool_g.half != bool_g.ihalf);
-        // if (!success)
-        //     stream  << "test_simd_bool != failed.";
-        // success = success && all(bool_g.half == !bool_g.ihalf);
-        // if (!success)
-        //     stream  << "test_simd_bool ! failed.";
-        // success = success && all(bool_g.half == ~bool_g.ihalf);
-        // if (!success)
-        //     stream  << "test_simd_bool ~ failed.";
-        // success = success && all((bool_g.half | bool_g.ihalf) == bool_g.all_true);
-        // if (!success)
-        //     stream  << "test_simd_bool | failed.";
-        // success = success && all((bool_g.half & bool_g.ihalf) == bool_g.all_false);
-        // if (!success)
-        //     stream  << "test_simd_bool & failed.";
+        auto bool_g = get_bool<typename simd_batch_traits<batch<I, N>>::batch_bool_type>{};
+        success = success && all(bool_g.half != bool_g.ihalf);
+        if (!success)
+            stream  << "test_simd_bool != failed.";
+        success = success && all(bool_g.half == !bool_g.ihalf);
+        if (!success)
+            stream  << "test_simd_bool ! failed.";
+        success = success && all(bool_g.half == ~bool_g.ihalf);
+        if (!success)
+            stream  << "test_simd_bool ~ failed.";
+        success = success && all((bool_g.half | bool_g.ihalf) == bool_g.all_true);
+        if (!success)
+            stream  << "test_simd_bool | failed.";
+        success = success && all((bool_g.half & bool_g.ihalf) == bool_g.all_false);
+        if (!success)
+            stream  << "test_simd_bool & failed.";
         return success;
     }
 
@@ -665,6 +684,17 @@ namespace xsimd
         tmp_success = check_almost_equal(topic, sres, tester.hadd_res, out);
         success = success && tmp_success;
 
+        topic = "haddp(simd*)             : ";
+        vector_type haddp_rows[tester_type::size];
+        for (size_t i = 0; i < tester_type::size; ++i)
+        {
+            detail::load_vec(haddp_rows[i], tester.haddp_input, i * tester_type::size);
+        }
+        vres = haddp(haddp_rows);
+        detail::store_vec(vres, res);
+        tmp_success = check_almost_equal(topic, res, tester.haddp_res, out);
+        success = success && tmp_success;
+
         topic = "any                      : ";
         auto any_check_false = (lhs != lhs);
         bool any_res_false = any(any_check_false);
@@ -1029,6 +1059,10 @@ namespace xsimd
         int32_vector fnegres;
         int64_vector dposres;
         int64_vector dnegres;
+        int32_vector fposceilres;
+        int32_vector fnegfloorres;
+        int64_vector dposceilres;
+        int64_vector dnegfloorres;
         float_vector i32posres;
         float_vector i32negres;
         double_vector i64posres;
@@ -1042,6 +1076,7 @@ namespace xsimd
         : name(n), i32pos(2), i32neg(-3), i64pos(2), i64neg(-3),
           fpos(float(7.4)), fneg(float(-6.2)), dpos(double(5.4)), dneg(double(-1.2)),
           fposres(2 * N, 7), fnegres(2 * N, -6), dposres(N, 5), dnegres(N, -1),
+          fposceilres(2 * N, 8), fnegfloorres(2 * N, -7), dposceilres(N, 6), dnegfloorres(N, -2),
           i32posres(2 * N, float(2)), i32negres(2 * N, float(-3)),
           i64posres(N, double(2)), i64negres(N, double(-3))
     {
@@ -1109,6 +1144,78 @@ namespace xsimd
         tmp_success = check_almost_equal(topic, dvres, tester.dnegres, out);
         success = success && tmp_success;
 
+        topic = "positive float  -> int32 nearest : ";
+        fbres = to_int_nearest(tester.fpos);
+        detail::store_vec(fbres, fvres);
+        tmp_success = check_almost_equal(topic, fvres, tester.fposres, out);
+        success = success && tmp_success;
+
+        topic = "negative float  -> int32 nearest : ";
+        fbres = to_int_nearest(tester.fneg);
+        detail::store_vec(fbres, fvres);
+        tmp_success = check_almost_equal(topic, fvres, tester.fnegres, out);
+        success = success && tmp_success;
+
+        topic = "positive double -> int64 nearest : ";
+        dbres = to_int_nearest(tester.dpos);
+        detail::store_vec(dbres, dvres);
+        tmp_success = check_almost_equal(topic, dvres, tester.dposres, out);
+        success = success && tmp_success;
+
+        topic = "negative double -> int64 nearest : ";
+        dbres = to_int_nearest(tester.dneg);
+        detail::store_vec(dbres, dvres);
+        tmp_success = check_almost_equal(topic, dvres, tester.dnegres, out);
+        success = success && tmp_success;
+
+        topic = "positive float  -> int32 floor   : ";
+        fbres = to_int_floor(tester.fpos);
+        detail::store_vec(fbres, fvres);
+        tmp_success = check_almost_equal(topic, fvres, tester.fposres, out);
+        success = success && tmp_success;
+
+        topic = "negative float  -> int32 floor   : ";
+        fbres = to_int_floor(tester.fneg);
+        detail::store_vec(fbres, fvres);
+        tmp_success = check_almost_equal(topic, fvres, tester.fnegfloorres, out);
+        success = success && tmp_success;
+
+        topic = "positive double -> int64 floor   : ";
+        dbres = to_int_floor(tester.dpos);
+        detail::store_vec(dbres, dvres);
+        tmp_success = check_almost_equal(topic, dvres, tester.dposres, out);
+        success = success && tmp_success;
+
+        topic = "negative double -> int64 floor   : ";
+        dbres = to_int_floor(tester.dneg);
+        detail::store_vec(dbres, dvres);
+        tmp_success = check_almost_equal(topic, dvres, tester.dnegfloorres, out);
+        success = success && tmp_success;
+
+        topic = "positive float  -> int32 ceil    : ";
+        fbres = to_int_ceil(tester.fpos);
+        detail::store_vec(fbres, fvres);
+        tmp_success = check_almost_equal(topic, fvres, tester.fposceilres, out);
+        success = success && tmp_success;
+
+        topic = "negative float  -> int32 ceil    : ";
+        fbres = to_int_ceil(tester.fneg);
+        detail::store_vec(fbres, fvres);
+        tmp_success = check_almost_equal(topic, fvres, tester.fnegres, out);
+        success = success && tmp_success;
+
+        topic = "positive double -> int64 ceil    : ";
+        dbres = to_int_ceil(tester.dpos);
+        detail::store_vec(dbres, dvres);
+        tmp_success = check_almost_equal(topic, dvres, tester.dposceilres, out);
+        success = success && tmp_success;
+
+        topic = "negative double -> int64 ceil    : ";
+        dbres = to_int_ceil(tester.dneg);
+        detail::store_vec(dbres, dvres);
+        tmp_success = check_almost_equal(topic, dvres, tester.dnegres, out);
+        success = success && tmp_success;
+
         topic = "positive int32  -> float  : ";
         i32bres = to_float(tester.i32pos);
         detail::store_vec(i32bres, i32vres);
@@ -0,0 +1,132 @@
+/***************************************************************************
+* Copyright (c) 2016, Johan Mabille and Sylvain Corlay                     *
+*                                                                          *
+* Distributed under the terms of the BSD 3-Clause License.                 *
+*                                                                          *
+* The full license is in the file LICENSE, distributed with this software. *
+****************************************************************************/
+
+#include <cmath>
+#include <fstream>
+#include <iostream>
+#include <limits>
+
+#include "gtest/gtest.h"
+
+#include "xsimd/math/xsimd_bessel.hpp"
+#include "xsimd/memory/xsimd_aligned_allocator.hpp"
+#include "xsimd/types/xsimd_traits.hpp"
+#include "xsimd/types/xsimd_types_include.hpp"
+#include "xsimd_bessel_test.hpp"
+
+namespace xsimd
+{
+    template <class T, size_t N, size_t A>
+    bool test_bessel(std::ostream& out, const std::string& name)
+    {
+        simd_bessel_tester<T, N, A> tester(name);
+        return test_simd_bessel(out, tester);
+    }
+}
+
+#if XSIMD_X86_INSTR_SET >= XSIMD_X86_SSE2_VERSION
+TEST(xsimd, sse_float_bessel)
+{
+    std::ofstream out("log/sse_float_bessel.log", std::ios_base::out);
+    bool res = xsimd::test_bessel<float, 4, 16>(out, "sse float");
+    EXPECT_TRUE(res);
+}
+
+TEST(xsimd, sse_double_bessel)
+{
+    std::ofstream out("log/sse_double_bessel.log", std::ios_base::out);
+    bool res = xsimd::test_bessel<double, 2, 16>(out, "sse double");
+    EXPECT_TRUE(res);
+}
+#endif
+
+#if XSIMD_X86_INSTR_SET >= XSIMD_X86_AVX_VERSION
+TEST(xsimd, avx_float_bessel)
+{
+    std::ofstream out("log/avx_float_bessel.log", std::ios_base::out);
+    bool res = xsimd::test_bessel<float, 8, 32>(out, "avx float");
+    EXPECT_TRUE(res);
+}
+
+TEST(xsimd, avx_double_bessel)
+{
+    std::ofstream out("log/avx_double_bessel.log", std::ios_base::out);
+    bool res = xsimd::test_bessel<double, 4, 32>(out, "avx double");
+    EXPECT_TRUE(res);
+}
+#endif
+
+#if XSIMD_X86_INSTR_SET >= XSIMD_X86_AVX512_VERSION
+TEST(xsimd, avx512_float_bessel)
+{
+    std::ofstream out("log/avx512_float_bessel.log", std::ios_base::out);
+    bool res = xsimd::test_bessel<float, 16, 64>(out, "avx512 float");
+    EXPECT_TRUE(res);
+}
+
+TEST(xsimd, avx512_double_bessel)
+{
+    std::ofstream out("log/avx512_double_bessel.log", std::ios_base::out);
+    bool res = xsimd::test_bessel<double, 8, 64>(out, "avx512 double");
+    EXPECT_TRUE(res);
+}
+#endif
+
+#if XSIMD_ARM_INSTR_SET >= XSIMD_ARM7_NEON_VERSION
+TEST(xsimd, neon_float_bessel)
+{
+    std::ofstream out("log/neon_float_bessel.log", std::ios_base::out);
+    bool res = xsimd::test_bessel<float, 4, 16>(out, "neon float");
+    EXPECT_TRUE(res);
+}
+#endif
+#if XSIMD_ARM_INSTR_SET >= XSIMD_ARM8_64_NEON_VERSION
+TEST(xsimd, neon_double_bessel)
+{
+    std::ofstream out("log/neon_double_bessel.log", std::ios_base::out);
+    bool res = xsimd::test_bessel<double, 2, 32>(out, "neon double");
+    EXPECT_TRUE(res);
+}
+#endif
+
+#if defined(XSIMD_ENABLE_FALLBACK)
+TEST(xsimd, fallback_float_bessel)
+{
+    std::ofstream out("log/fallback_float_bessel.log", std::ios_base::out);
+    bool res = xsimd::test_bessel<float, 7, 32>(out, "fallback float");
+    EXPECT_TRUE(res);
+}
+
+TEST(xsimd, fallback_double_bessel)
+{
+    std::ofstream out("log/fallback_double_bessel.log", std::ios_base::out);
+    bool res = xsimd::test_bessel<double, 3, 32>(out, "fallback double");
+    EXPECT_TRUE(res);
+}
+#endif
+
+TEST(xsimd, bessel_special_values)
+{
+    using b_type = xsimd::simd_type<double>;
+    b_type zero(0.), inf = xsimd::infinity<b_type>();
+    EXPECT_DOUBLE_EQ(xsimd::j0(zero)[0], 1.);
+    EXPECT_EQ(xsimd::j1(zero)[0], 0.);
+    EXPECT_DOUBLE_EQ(xsimd::i0e(zero)[0], 1.);
+    EXPECT_EQ(xsimd::y0(zero)[0], -std::numeric_limits<double>::infinity());
+    EXPECT_EQ(xsimd::y1(zero)[0], -std::numeric_limits<double>::infinity());
+    EXPECT_TRUE(std::isnan(xsimd::y0(b_type(-1.))[0]));
+    EXPECT_TRUE(std::isnan(xsimd::y1(b_type(-1.))[0]));
+    EXPECT_EQ(xsimd::j0(inf)[0], 0.);
+    EXPECT_EQ(xsimd::j1(-inf)[0], 0.);
+    EXPECT_EQ(xsimd::y0(inf)[0], 0.);
+    EXPECT_EQ(xsimd::y1(inf)[0], 0.);
+    EXPECT_EQ(xsimd::i0e(inf)[0], 0.);
+    // large arguments are reduced exactly
+    EXPECT_NEAR(xsimd::j0(b_type(1e6))[0], ::j0l(1e6), 1e-18);
+    EXPECT_NEAR(xsimd::y1(b_type(1e6))[0], ::y1l(1e6), 1e-18);
+}
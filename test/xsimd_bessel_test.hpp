@@ -0,0 +1,176 @@
+/***************************************************************************
+* Copyright (c) 2016, Johan Mabille and Sylvain Corlay                     *
+*                                                                          *
+* Distributed under the terms of the BSD 3-Clause License.                 *
+*                                                                          *
+* The full license is in the file LICENSE, distributed with this software. *
+****************************************************************************/
+
+#ifndef XSIMD_BESSEL_TEST_HPP
+#define XSIMD_BESSEL_TEST_HPP
+
+#include <cmath>
+
+#include "xsimd_test_utils.hpp"
+#include "xsimd_tester.hpp"
+
+namespace xsimd
+{
+
+    template <class T, std::size_t N, std::size_t A>
+    struct simd_bessel_tester : simd_tester<T, N, A>
+    {
+        using base_type = simd_tester<T, N, A>;
+        using vector_type = typename base_type::vector_type;
+        using value_type = typename base_type::value_type;
+        using res_type = typename base_type::res_type;
+
+        std::string name;
+
+        res_type input;
+        res_type j0_res;
+        res_type j1_res;
+        res_type i0e_res;
+        res_type positive_input;
+        res_type y0_res;
+        res_type y1_res;
+
+        simd_bessel_tester(const std::string& n);
+    };
+
+    namespace detail
+    {
+        // Power series for |x| <= 40, asymptotic expansion beyond
+        inline long double i0e_reference(long double x)
+        {
+            const long double pi = 3.141592653589793238462643383279502884L;
+            x = std::abs(x);
+            if (x <= 40.L)
+            {
+                long double z = x * x / 4.L;
+                long double term = 1.L;
+                long double sum = 1.L;
+                for (int k = 1; term > sum * 1e-21L; ++k)
+                {
+                    term *= z / (static_cast<long double>(k) * k);
+                    sum += term;
+                }
+                return std::exp(-x) * sum;
+            }
+            long double term = 1.L;
+            long double sum = 1.L;
+            for (int k = 1; k < 30; ++k)
+            {
+                term *= (2 * k - 1) * (2 * k - 1) / (8.L * k * x);
+                sum += term;
+            }
+            return sum / std::sqrt(2.L * pi * x);
+        }
+    }
+
+    template <class T, std::size_t N, std::size_t A>
+    simd_bessel_tester<T, N, A>::simd_bessel_tester(const std::string& n)
+        : name(n)
+    {
+        size_t nb_input = N * 10000;
+        input.resize(nb_input);
+        j0_res.resize(nb_input);
+        j1_res.resize(nb_input);
+        i0e_res.resize(nb_input);
+        positive_input.resize(nb_input);
+        y0_res.resize(nb_input);
+        y1_res.resize(nb_input);
+        for (size_t i = 0; i < nb_input; ++i)
+        {
+            input[i] = value_type(-25) + i * value_type(50) / nb_input;
+            j0_res[i] = value_type(::j0l(input[i]));
+            j1_res[i] = value_type(::j1l(input[i]));
+            i0e_res[i] = value_type(detail::i0e_reference(input[i]));
+            positive_input[i] = value_type(0.01) + i * value_type(25) / nb_input;
+            y0_res[i] = value_type(::y0l(positive_input[i]));
+            y1_res[i] = value_type(::y1l(positive_input[i]));
+        }
+    }
+
+    template <class T>
+    bool test_simd_bessel(std::ostream& out, T& tester)
+    {
+        using tester_type = T;
+        using vector_type = typename tester_type::vector_type;
+        using value_type = typename tester_type::value_type;
+        using res_type = typename tester_type::res_type;
+
+        vector_type input;
+        vector_type vres;
+        res_type res(tester.input.size());
+
+        bool success = true;
+        bool tmp_success = true;
+
+        std::string val_type = value_type_name<vector_type>();
+        std::string shift = std::string(val_type.size(), '-');
+        std::string name = tester.name;
+        std::string name_shift = std::string(name.size(), '-');
+        std::string dash(8, '-');
+        std::string space(8, ' ');
+
+        out << dash << name_shift << '-' << shift << dash << std::endl;
+        out << space << name << " " << val_type << std::endl;
+        out << dash << name_shift << '-' << shift << dash << std::endl
+            << std::endl;
+
+        std::string topic = "j0  : ";
+        for (size_t i = 0; i < tester.input.size(); i += tester.size)
+        {
+            detail::load_vec(input, tester.input, i);
+            vres = j0(input);
+            detail::store_vec(vres, res, i);
+        }
+        tmp_success = check_almost_equal(topic, res, tester.j0_res, out);
+        success = success && tmp_success;
+
+        topic = "j1  : ";
+        for (size_t i = 0; i < tester.input.size(); i += tester.size)
+        {
+            detail::load_vec(input, tester.input, i);
+            vres = j1(input);
+            detail::store_vec(vres, res, i);
+        }
+        tmp_success = check_almost_equal(topic, res, tester.j1_res, out);
+        success = success && tmp_success;
+
+        topic = "y0  : ";
+        for (size_t i = 0; i < tester.positive_input.size(); i += tester.size)
+        {
+            detail::load_vec(input, tester.positive_input, i);
+            vres = y0(input);
+            detail::store_vec(vres, res, i);
+        }
+        tmp_success = check_almost_equal(topic, res, tester.y0_res, out);
+        success = success && tmp_success;
+
+        topic = "y1  : ";
+        for (size_t i = 0; i < tester.positive_input.size(); i += tester.size)
+        {
+            detail::load_vec(input, tester.positive_input, i);
+            vres = y1(input);
+            detail::store_vec(vres, res, i);
+        }
+        tmp_success = check_almost_equal(topic, res, tester.y1_res, out);
+        success = success && tmp_success;
+
+        topic = "i0e : ";
+        for (size_t i = 0; i < tester.input.size(); i += tester.size)
+        {
+            detail::load_vec(input, tester.input, i);
+            vres = i0e(input);
+            detail::store_vec(vres, res, i);
+        }
+        tmp_success = check_almost_equal(topic, res, tester.i0e_res, out);
+        success = success && tmp_success;
+
+        return success;
+    }
+}
+
+#endif
@@ -0,0 +1,189 @@
+/***************************************************************************
+* Copyright (c) 2016, Johan Mabille and Sylvain Corlay                     *
+*                                                                          *
+* Distributed under the terms of the BSD 3-Clause License.                 *
+*                                                                          *
+* The full license is in the file LICENSE, distributed with this software. *
+****************************************************************************/
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <random>
+#include <type_traits>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "xsimd/algorithms/xsimd_biquad.hpp"
+
+namespace xsimd
+{
+    namespace
+    {
+        // a stable section: its poles r * exp(+-i * theta) are inside the
+        // unit circle
+        template <class T>
+        biquad_coefficients<T> random_section(std::mt19937& generator)
+        {
+            std::uniform_real_distribution<double> distribution(-1., 1.);
+            double r = 0.6 + 0.2 * distribution(generator);
+            double theta = 3. * distribution(generator);
+            biquad_coefficients<T> res;
+            res.b0 = static_cast<T>(distribution(generator));
+            res.b1 = static_cast<T>(distribution(generator));
+            res.b2 = static_cast<T>(distribution(generator));
+            res.a1 = static_cast<T>(-2. * r * std::cos(theta));
+            res.a2 = static_cast<T>(r * r);
+            return res;
+        }
+
+        // direct form I, channel by channel
+        template <class T>
+        std::vector<T> reference_cascade(const biquad_cascade<T>& filter, const std::vector<T>& x)
+        {
+            std::size_t num_channels = filter.num_channels();
+            std::size_t num_frames = num_channels == 0 ? 0 : x.size() / num_channels;
+            std::vector<T> y(x.size());
+            for (std::size_t c = 0; c < num_channels; ++c)
+            {
+                std::vector<double> u(num_frames);
+                for (std::size_t t = 0; t < num_frames; ++t)
+                {
+                    u[t] = static_cast<double>(x[t * num_channels + c]);
+                }
+                for (std::size_t s = 0; s < filter.num_sections(); ++s)
+                {
+                    biquad_coefficients<T> k = filter.section(c, s);
+                    double x1 = 0., x2 = 0., y1 = 0., y2 = 0.;
+                    for (std::size_t t = 0; t < num_frames; ++t)
+                    {
+                        double v = k.b0 * u[t] + k.b1 * x1 + k.b2 * x2 - k.a1 * y1 - k.a2 * y2;
+                        x2 = x1;
+                        x1 = u[t];
+                        y2 = y1;
+                        y1 = v;
+                        u[t] = v;
+                    }
+                }
+                for (std::size_t t = 0; t < num_frames; ++t)
+                {
+                    y[t * num_channels + c] = static_cast<T>(u[t]);
+                }
+            }
+            return y;
+        }
+
+        template <class T>
+        void check_biquad_cascade(std::size_t num_channels, std::size_t num_sections, bool flush_denormals)
+        {
+            std::mt19937 generator(static_cast<unsigned>(num_channels * 10 + num_sections));
+            biquad_cascade<T> filter(num_channels, num_sections, flush_denormals);
+            EXPECT_EQ(filter.num_channels(), num_channels);
+            EXPECT_EQ(filter.num_sections(), num_sections);
+            EXPECT_EQ(filter.flush_denormals(), flush_denormals);
+            for (std::size_t c = 0; c < num_channels; ++c)
+            {
+                for (std::size_t s = 0; s < num_sections; ++s)
+                {
+                    // the last channel keeps its pass-through sections
+                    if (c + 1 < num_channels || c == 0)
+                    {
+                        filter.set_section(c, s, random_section<T>(generator));
+                    }
+                }
+            }
+
+            std::size_t num_frames = 700;
+            std::uniform_real_distribution<T> distribution(T(-1), T(1));
+            std::vector<T> x(num_frames * num_channels);
+            for (T& v : x)
+            {
+                v = distribution(generator);
+            }
+            std::vector<T> ref = reference_cascade(filter, x);
+            T tolerance = std::is_same<T, float>::value ? T(1e-3) : T(1e-10);
+
+            // the frames are processed in blocks of various sizes
+            std::vector<T> y(x.size(), T(-7));
+            std::size_t sizes[] = { 1, 63, 0, 200, 3, 433 };
+            std::size_t pos = 0;
+            for (std::size_t b = 0; pos < num_frames; ++b)
+            {
+                std::size_t block = std::min(sizes[b % 6], num_frames - pos);
+                filter.process(block, x.data() + pos * num_channels, y.data() + pos * num_channels);
+                pos += block;
+            }
+            for (std::size_t i = 0; i < x.size(); ++i)
+            {
+                EXPECT_NEAR(y[i], ref[i], tolerance * std::max(T(1), std::abs(ref[i])))
+                    << "channels = " << num_channels << ", sections = " << num_sections << ", i = " << i;
+            }
+
+            // in place, after a reset
+            filter.reset();
+            y = x;
+            filter.process(num_frames, y.data(), y.data());
+            for (std::size_t i = 0; i < x.size(); ++i)
+            {
+                EXPECT_NEAR(y[i], ref[i], tolerance * std::max(T(1), std::abs(ref[i])))
+                    << "channels = " << num_channels << ", sections = " << num_sections << ", i = " << i;
+            }
+        }
+
+        // the impulse response of a decaying section goes through the
+        // denormal range
+        template <class T>
+        void check_biquad_denormals()
+        {
+            std::size_t num_channels = 5;
+            biquad_cascade<T> filter(num_channels, 1);
+            biquad_coefficients<T> k;
+            k.a1 = T(-0.5);
+            for (std::size_t c = 0; c < num_channels; ++c)
+            {
+                filter.set_section(c, 0, k);
+            }
+            std::size_t num_frames = 1200;
+            std::vector<T> x(num_frames * num_channels, T(0));
+            std::fill(x.begin(), x.begin() + num_channels, T(1));
+            filter.process(num_frames, x.data(), x.data());
+            for (std::size_t i = 0; i < x.size(); ++i)
+            {
+                EXPECT_NE(std::fpclassify(x[i]), FP_SUBNORMAL) << "i = " << i;
+            }
+            EXPECT_EQ(x.back(), T(0));
+        }
+    }
+
+    TEST(xsimd, biquad_cascade)
+    {
+        for (std::size_t num_channels : { 1, 3, 4, 8, 17, 33, 100 })
+        {
+            for (std::size_t num_sections : { 0, 1, 2, 5 })
+            {
+                check_biquad_cascade<float>(num_channels, num_sections, true);
+                check_biquad_cascade<double>(num_channels, num_sections, true);
+            }
+        }
+        check_biquad_cascade<float>(40, 3, false);
+        check_biquad_cascade<double>(40, 3, false);
+
+        // the default sections pass the input through
+        biquad_cascade<float> identity(3, 2);
+        std::vector<float> x = { 1.f, 2.f, 3.f, 4.f, 5.f, 6.f };
+        std::vector<float> y(x.size());
+        identity.process(2, x.data(), y.data());
+        EXPECT_EQ(y, x);
+    }
+
+    TEST(xsimd, biquad_cascade_denormals)
+    {
+        if (denormal_guard::is_supported())
+        {
+            check_biquad_denormals<float>();
+            check_biquad_denormals<double>();
+        }
+    }
+}
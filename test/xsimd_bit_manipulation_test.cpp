@@ -0,0 +1,198 @@
+/***************************************************************************
+* Copyright (c) 2016, Johan Mabille and Sylvain Corlay                     *
+*                                                                          *
+* Distributed under the terms of the BSD 3-Clause License.                 *
+*                                                                          *
+* The full license is in the file LICENSE, distributed with this software. *
+****************************************************************************/
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <type_traits>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "xsimd/xsimd.hpp"
+
+namespace xsimd
+{
+    namespace
+    {
+        template <class T>
+        using unsigned_t = typename std::make_unsigned<T>::type;
+
+        template <class T>
+        T popcount_reference(T x)
+        {
+            unsigned_t<T> u = static_cast<unsigned_t<T>>(x);
+            T res = 0;
+            for (; u != 0; u >>= 1)
+            {
+                res += T(u & 1u);
+            }
+            return res;
+        }
+
+        template <class T>
+        T countl_zero_reference(T x)
+        {
+            constexpr int width = std::numeric_limits<unsigned_t<T>>::digits;
+            unsigned_t<T> u = static_cast<unsigned_t<T>>(x);
+            T res = 0;
+            for (int i = width - 1; i >= 0 && ((u >> i) & 1u) == 0; --i)
+            {
+                ++res;
+            }
+            return res;
+        }
+
+        template <class T>
+        T countr_zero_reference(T x)
+        {
+            constexpr int width = std::numeric_limits<unsigned_t<T>>::digits;
+            unsigned_t<T> u = static_cast<unsigned_t<T>>(x);
+            T res = 0;
+            for (int i = 0; i < width && ((u >> i) & 1u) == 0; ++i)
+            {
+                ++res;
+            }
+            return res;
+        }
+
+        template <class T>
+        T byteswap_reference(T x)
+        {
+            unsigned_t<T> u = static_cast<unsigned_t<T>>(x);
+            unsigned_t<T> res = 0;
+            for (std::size_t i = 0; i < sizeof(T); ++i)
+            {
+                res = static_cast<unsigned_t<T>>((res << 8) | (u & 0xffu));
+                u >>= 8;
+            }
+            return static_cast<T>(res);
+        }
+
+        template <class T>
+        std::vector<T> bit_manipulation_inputs()
+        {
+            std::vector<T> res = { T(0), T(-1), T(1), T(2), T(3),
+                                   std::numeric_limits<T>::min(), std::numeric_limits<T>::max(),
+                                   T(0x12345678), T(-0x12345678) };
+            for (std::size_t i = 0; i < sizeof(T) * 8; ++i)
+            {
+                T p = static_cast<T>(unsigned_t<T>(1) << i);
+                res.push_back(p);
+                res.push_back(static_cast<T>(p - 1));
+                res.push_back(static_cast<T>(~p));
+            }
+            std::mt19937_64 generator(42);
+            for (std::size_t i = 0; i < 1000; ++i)
+            {
+                // random values with random numbers of leading and trailing zeros
+                unsigned_t<T> u = static_cast<unsigned_t<T>>(generator());
+                u >>= generator() % (sizeof(T) * 8);
+                u <<= generator() % (sizeof(T) * 8);
+                res.push_back(static_cast<T>(u));
+            }
+            return res;
+        }
+
+        template <class B>
+        void check_bit_manipulation()
+        {
+            using T = typename B::value_type;
+            constexpr std::size_t size = B::size;
+            std::vector<T> input = bit_manipulation_inputs<T>();
+            for (std::size_t i = 0; i + size <= input.size(); i += size)
+            {
+                B x;
+                x.load_unaligned(&input[i]);
+                B pc = popcount(x), lz = countl_zero(x), tz = countr_zero(x), bs = byteswap(x);
+                for (std::size_t j = 0; j < size; ++j)
+                {
+                    T v = input[i + j];
+                    EXPECT_EQ(pc[j], popcount_reference(v)) << "popcount(" << v << ")";
+                    EXPECT_EQ(lz[j], countl_zero_reference(v)) << "countl_zero(" << v << ")";
+                    EXPECT_EQ(tz[j], countr_zero_reference(v)) << "countr_zero(" << v << ")";
+                    EXPECT_EQ(bs[j], byteswap_reference(v)) << "byteswap(" << v << ")";
+                }
+            }
+        }
+
+        // the right shift is logical on x86 and arithmetic elsewhere, the
+        // shift by a batch agrees with the shift by a scalar on every
+        // architecture, including for negative scalars
+        template <class B>
+        void check_variable_shift()
+        {
+            using T = typename B::value_type;
+            constexpr std::size_t size = B::size;
+            constexpr T width = T(sizeof(T) * 8);
+            std::vector<T> input = bit_manipulation_inputs<T>();
+            std::size_t negative = 0;
+            for (std::size_t i = 0; i + size <= input.size(); i += size)
+            {
+                std::vector<T> counts(size);
+                for (std::size_t j = 0; j < size; ++j)
+                {
+                    counts[j] = static_cast<T>((i / size * 7 + j * 13) % width);
+                }
+                B x, c;
+                x.load_unaligned(&input[i]);
+                c.load_unaligned(counts.data());
+                B sl = x << c, sr = x >> c;
+                for (std::size_t j = 0; j < size; ++j)
+                {
+                    unsigned_t<T> u = static_cast<unsigned_t<T>>(input[i + j]);
+                    EXPECT_EQ(sl[j], static_cast<T>(u << counts[j])) << input[i + j] << " << " << counts[j];
+                    EXPECT_EQ(sr[j], (x >> int32_t(counts[j]))[j]) << input[i + j] << " >> " << counts[j];
+                    negative += input[i + j] < 0 && counts[j] != 0 ? 1 : 0;
+                }
+            }
+            EXPECT_GT(negative, std::size_t(0));
+        }
+    }
+}
+
+TEST(xsimd, bit_manipulation)
+{
+#if XSIMD_X86_INSTR_SET >= XSIMD_X86_SSE2_VERSION || XSIMD_ARM_INSTR_SET >= XSIMD_ARM7_NEON_VERSION
+    xsimd::check_bit_manipulation<xsimd::batch<int32_t, 4>>();
+    xsimd::check_bit_manipulation<xsimd::batch<int64_t, 2>>();
+#endif
+#if XSIMD_X86_INSTR_SET >= XSIMD_X86_AVX_VERSION
+    xsimd::check_bit_manipulation<xsimd::batch<int32_t, 8>>();
+    xsimd::check_bit_manipulation<xsimd::batch<int64_t, 4>>();
+#endif
+#if XSIMD_X86_INSTR_SET >= XSIMD_X86_AVX512_VERSION
+    xsimd::check_bit_manipulation<xsimd::batch<int32_t, 16>>();
+    xsimd::check_bit_manipulation<xsimd::batch<int64_t, 8>>();
+#endif
+#if defined(XSIMD_ENABLE_FALLBACK)
+    xsimd::check_bit_manipulation<xsimd::batch<int32_t, 7>>();
+    xsimd::check_bit_manipulation<xsimd::batch<int64_t, 3>>();
+#endif
+}
+
+TEST(xsimd, variable_shift)
+{
+#if XSIMD_X86_INSTR_SET >= XSIMD_X86_SSE2_VERSION || XSIMD_ARM_INSTR_SET >= XSIMD_ARM7_NEON_VERSION
+    xsimd::check_variable_shift<xsimd::batch<int32_t, 4>>();
+    xsimd::check_variable_shift<xsimd::batch<int64_t, 2>>();
+#endif
+#if XSIMD_X86_INSTR_SET >= XSIMD_X86_AVX_VERSION
+    xsimd::check_variable_shift<xsimd::batch<int32_t, 8>>();
+    xsimd::check_variable_shift<xsimd::batch<int64_t, 4>>();
+#endif
+#if XSIMD_X86_INSTR_SET >= XSIMD_X86_AVX512_VERSION
+    xsimd::check_variable_shift<xsimd::batch<int32_t, 16>>();
+    xsimd::check_variable_shift<xsimd::batch<int64_t, 8>>();
+#endif
+#if defined(XSIMD_ENABLE_FALLBACK)
+    xsimd::check_variable_shift<xsimd::batch<int32_t, 7>>();
+    xsimd::check_variable_shift<xsimd::batch<int64_t, 3>>();
+#endif
+}
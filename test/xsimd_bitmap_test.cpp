@@ -0,0 +1,179 @@
+/***************************************************************************
+* Copyright (c) 2016, Johan Mabille and Sylvain Corlay                     *
+*                                                                          *
+* Distributed under the terms of the BSD 3-Clause License.                 *
+*                                                                          *
+* The full license is in the file LICENSE, distributed with this software. *
+****************************************************************************/
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "xsimd/algorithms/xsimd_bitmap.hpp"
+
+namespace xsimd
+{
+    namespace
+    {
+        bool bitmap_bit(const std::vector<uint64_t>& bitmap, std::size_t i)
+        {
+            return ((bitmap[i / 64] >> (i % 64)) & 1) != 0;
+        }
+
+        template <class T>
+        bool compare_ref(T x, compare_op op, T v)
+        {
+            switch (op)
+            {
+            case compare_op::equal:
+                return x == v;
+            case compare_op::not_equal:
+                return x != v;
+            case compare_op::less:
+                return x < v;
+            case compare_op::less_equal:
+                return x <= v;
+            case compare_op::greater:
+                return x > v;
+            default:
+                return x >= v;
+            }
+        }
+
+        // the bits past n of the last word must be cleared
+        void check_tail(const std::vector<uint64_t>& bitmap, std::size_t n)
+        {
+            if (n % 64 != 0)
+            {
+                EXPECT_EQ(bitmap.back() >> (n % 64), uint64_t(0)) << "n = " << n;
+            }
+        }
+
+        template <class T>
+        std::vector<T> bitmap_column(std::size_t n)
+        {
+            std::mt19937_64 generator(5);
+            std::vector<T> res(n);
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                res[i] = static_cast<T>(static_cast<int>(generator() % 41) - 20);
+            }
+            if (n > 3 && std::numeric_limits<T>::has_quiet_NaN)
+            {
+                res[3] = std::numeric_limits<T>::quiet_NaN();
+                res[n - 1] = std::numeric_limits<T>::quiet_NaN();
+            }
+            return res;
+        }
+
+        template <class T>
+        void check_bitmap_predicates(std::size_t n)
+        {
+            const compare_op ops[] = { compare_op::equal, compare_op::not_equal, compare_op::less,
+                                       compare_op::less_equal, compare_op::greater, compare_op::greater_equal };
+            std::vector<T> column = bitmap_column<T>(n);
+            std::vector<uint64_t> bitmap((n + 63) / 64);
+            for (compare_op op : ops)
+            {
+                for (T value : { T(-21), T(-3), T(0), T(7), T(20) })
+                {
+                    std::fill(bitmap.begin(), bitmap.end(), ~uint64_t(0));
+                    std::size_t count = bitmap_compare(column.data(), n, op, value, bitmap.data());
+                    std::size_t ref_count = 0;
+                    for (std::size_t i = 0; i < n; ++i)
+                    {
+                        bool ref = compare_ref(column[i], op, value);
+                        ref_count += ref;
+                        EXPECT_EQ(bitmap_bit(bitmap, i), ref) << "n = " << n << ", i = " << i << ", op = " << int(op);
+                    }
+                    EXPECT_EQ(count, ref_count) << "n = " << n << ", op = " << int(op);
+                    check_tail(bitmap, n);
+                }
+            }
+
+            std::fill(bitmap.begin(), bitmap.end(), ~uint64_t(0));
+            std::size_t count = bitmap_between(column.data(), n, T(-5), T(5), bitmap.data());
+            std::size_t ref_count = 0;
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                bool ref = T(-5) <= column[i] && column[i] <= T(5);
+                ref_count += ref;
+                EXPECT_EQ(bitmap_bit(bitmap, i), ref) << "n = " << n << ", i = " << i;
+            }
+            EXPECT_EQ(count, ref_count) << "n = " << n;
+            check_tail(bitmap, n);
+        }
+    }
+
+    TEST(xsimd, bitmap_predicates)
+    {
+        for (std::size_t n : { 0, 1, 5, 63, 64, 65, 200, 1000, 4099 })
+        {
+            check_bitmap_predicates<int32_t>(n);
+            check_bitmap_predicates<int64_t>(n);
+            check_bitmap_predicates<float>(n);
+            check_bitmap_predicates<double>(n);
+        }
+
+        // extreme values
+        std::vector<int64_t> column = { std::numeric_limits<int64_t>::min(), -1, 0, 1, std::numeric_limits<int64_t>::max() };
+        uint64_t bitmap = 0;
+        EXPECT_EQ(bitmap_compare(column.data(), column.size(), compare_op::less, int64_t(0), &bitmap), std::size_t(2));
+        EXPECT_EQ(bitmap, uint64_t(0x3));
+        EXPECT_EQ(bitmap_compare(column.data(), column.size(), compare_op::greater, std::numeric_limits<int64_t>::min(), &bitmap), std::size_t(4));
+        EXPECT_EQ(bitmap, uint64_t(0x1e));
+    }
+
+    TEST(xsimd, bitmap_operations)
+    {
+        std::mt19937_64 generator(7);
+        for (std::size_t n : { 0, 1, 63, 64, 65, 300, 1000, 4099 })
+        {
+            std::size_t num_words = (n + 63) / 64;
+            std::vector<uint64_t> lhs(num_words), rhs(num_words);
+            for (std::size_t w = 0; w < num_words; ++w)
+            {
+                // dense, sparse, empty and full words
+                lhs[w] = w % 4 == 2 ? 0 : (w % 4 == 3 ? ~uint64_t(0) : generator());
+                rhs[w] = w % 2 == 0 ? generator() : generator() & generator() & generator();
+            }
+            std::vector<uint64_t> res_and(num_words), res_or(num_words), res_andnot(num_words);
+            bitmap_and(lhs.data(), rhs.data(), n, res_and.data());
+            bitmap_or(lhs.data(), rhs.data(), n, res_or.data());
+            bitmap_andnot(lhs.data(), rhs.data(), n, res_andnot.data());
+            check_tail(res_and, n);
+            check_tail(res_or, n);
+            check_tail(res_andnot, n);
+
+            std::size_t ref_count = 0;
+            std::vector<uint32_t> ref_indices;
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                bool l = bitmap_bit(lhs, i), r = bitmap_bit(rhs, i);
+                EXPECT_EQ(bitmap_bit(res_and, i), l && r) << "n = " << n << ", i = " << i;
+                EXPECT_EQ(bitmap_bit(res_or, i), l || r) << "n = " << n << ", i = " << i;
+                EXPECT_EQ(bitmap_bit(res_andnot, i), l && !r) << "n = " << n << ", i = " << i;
+                if (l)
+                {
+                    ++ref_count;
+                    ref_indices.push_back(static_cast<uint32_t>(i));
+                }
+            }
+            // the bits of lhs past n are set, they must be ignored
+            EXPECT_EQ(bitmap_popcount(lhs.data(), n), ref_count) << "n = " << n;
+            std::vector<uint32_t> indices(ref_count);
+            EXPECT_EQ(bitmap_to_indices(lhs.data(), n, indices.data()), ref_count) << "n = " << n;
+            EXPECT_EQ(indices, ref_indices) << "n = " << n;
+
+            // in place
+            bitmap_and(lhs.data(), rhs.data(), n, lhs.data());
+            EXPECT_EQ(lhs, res_and) << "n = " << n;
+        }
+    }
+}
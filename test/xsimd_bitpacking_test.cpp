@@ -0,0 +1,223 @@
+/***************************************************************************
+* Copyright (c) 2016, Johan Mabille and Sylvain Corlay                     *
+*                                                                          *
+* Distributed under the terms of the BSD 3-Clause License.                 *
+*                                                                          *
+* The full license is in the file LICENSE, distributed with this software. *
+****************************************************************************/
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <type_traits>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "xsimd/algorithms/xsimd_bitpacking.hpp"
+
+namespace xsimd
+{
+    namespace
+    {
+        template <class T>
+        using unsigned_t = typename std::make_unsigned<T>::type;
+
+        template <class T>
+        T low_bits(unsigned_t<T> x, std::size_t bits)
+        {
+            return static_cast<T>(bits >= 8 * sizeof(T) ? x : x & ((unsigned_t<T>(1) << bits) - 1));
+        }
+
+        // reads value i of a block from the definition of the format
+        template <class T>
+        T read_packed_block(const T* block, std::size_t i, std::size_t bits)
+        {
+            constexpr std::size_t word_bits = 8 * sizeof(T), lanes = 64 / sizeof(T);
+            std::size_t lane = i % lanes, pos = (i / lanes) * bits;
+            unsigned_t<T> res = 0;
+            for (std::size_t k = 0; k < bits; ++k, ++pos)
+            {
+                unsigned_t<T> word = static_cast<unsigned_t<T>>(block[(pos / word_bits) * lanes + lane]);
+                res |= ((word >> (pos % word_bits)) & 1) << k;
+            }
+            return static_cast<T>(res);
+        }
+
+        template <class T>
+        void check_bitpacking(std::size_t n, std::size_t bits)
+        {
+            std::mt19937_64 generator(static_cast<unsigned>(n * 100 + bits));
+            std::vector<T> values(n);
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                values[i] = static_cast<T>(generator());
+            }
+            std::size_t size = bitpacked_size<T>(n, bits);
+            std::vector<T> packed(size + 1, T(-1));
+            bitpack(values.data(), n, bits, packed.data());
+            EXPECT_EQ(packed[size], T(-1)) << "n = " << n << ", bits = " << bits;
+
+            constexpr std::size_t block_size = 512;
+            for (std::size_t i = 0; i < n - n % block_size; ++i)
+            {
+                const T* block = packed.data() + (i / block_size) * (64 / sizeof(T)) * bits;
+                EXPECT_EQ(read_packed_block(block, i % block_size, bits), low_bits<T>(static_cast<unsigned_t<T>>(values[i]), bits))
+                    << "n = " << n << ", bits = " << bits << ", i = " << i;
+            }
+
+            std::vector<T> unpacked(n + 1, T(7));
+            bitunpack(packed.data(), n, bits, unpacked.data());
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                EXPECT_EQ(unpacked[i], low_bits<T>(static_cast<unsigned_t<T>>(values[i]), bits))
+                    << "n = " << n << ", bits = " << bits << ", i = " << i;
+            }
+            EXPECT_EQ(unpacked[n], T(7));
+        }
+    }
+
+    TEST(xsimd, bitpacking)
+    {
+        for (std::size_t n : { 0, 1, 17, 511, 512, 1024, 1500 })
+        {
+            for (std::size_t bits = 0; bits <= 32; ++bits)
+            {
+                check_bitpacking<int32_t>(n, bits);
+            }
+            for (std::size_t bits = 0; bits <= 64; ++bits)
+            {
+                check_bitpacking<int64_t>(n, bits);
+            }
+        }
+        EXPECT_EQ(bitpacked_size<int32_t>(1024 + 3, 5), std::size_t(2 * 16 * 5 + 1));
+        EXPECT_EQ(bitpacked_size<int64_t>(512 + 13, 5), std::size_t(8 * 5 + 2));
+
+        std::vector<int32_t> values = { 3, 0, 17, 2 };
+        EXPECT_EQ(bitpack_width(values.data(), values.size()), std::size_t(5));
+        EXPECT_EQ(bitpack_width(values.data(), 2), std::size_t(2));
+        values[1] = -1;
+        EXPECT_EQ(bitpack_width(values.data(), values.size()), std::size_t(32));
+        values.assign(100, 0);
+        EXPECT_EQ(bitpack_width(values.data(), values.size()), std::size_t(0));
+    }
+
+    namespace
+    {
+        template <class T>
+        void check_frame_of_reference(std::size_t n)
+        {
+            std::mt19937_64 generator(static_cast<unsigned>(n));
+            std::vector<T> values(n);
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                values[i] = static_cast<T>(1000000 + static_cast<T>(generator() % 5000));
+            }
+            if (n > 10)
+            {
+                values[n / 2] = T(999000);
+            }
+            std::vector<T> offsets(n);
+            T base = for_encode(values.data(), n, offsets.data());
+            T ref_base = n == 0 ? T(0) : *std::min_element(values.begin(), values.end());
+            EXPECT_EQ(base, ref_base) << "n = " << n;
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                EXPECT_EQ(offsets[i], values[i] - ref_base) << "n = " << n << ", i = " << i;
+            }
+            std::vector<T> decoded(n);
+            for_decode(offsets.data(), n, base, decoded.data());
+            EXPECT_EQ(decoded, values) << "n = " << n;
+
+            // in place, with offsets wrapping around
+            std::vector<T> wide = { std::numeric_limits<T>::max(), std::numeric_limits<T>::min(), T(0) };
+            std::vector<T> copy(wide);
+            base = for_encode(copy.data(), copy.size(), copy.data());
+            EXPECT_EQ(base, std::numeric_limits<T>::min());
+            EXPECT_EQ(copy[0], T(-1));
+            for_decode(copy.data(), copy.size(), base, copy.data());
+            EXPECT_EQ(copy, wide);
+        }
+
+        template <class T>
+        void check_delta(std::size_t n)
+        {
+            std::mt19937_64 generator(static_cast<unsigned>(n));
+            std::vector<T> values(n);
+            unsigned_t<T> acc = 0;
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                // increasing, with a few wrap arounds
+                acc += i % 97 == 5 ? ~unsigned_t<T>(0) / 3 : static_cast<unsigned_t<T>>(generator() % 1000);
+                values[i] = static_cast<T>(acc);
+            }
+            const T initial = T(42);
+            std::vector<T> deltas(n);
+            delta_encode(values.data(), n, deltas.data(), initial);
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                unsigned_t<T> prev = static_cast<unsigned_t<T>>(i == 0 ? initial : values[i - 1]);
+                EXPECT_EQ(deltas[i], static_cast<T>(static_cast<unsigned_t<T>>(values[i]) - prev)) << "n = " << n << ", i = " << i;
+            }
+            std::vector<T> decoded(n);
+            delta_decode(deltas.data(), n, decoded.data(), initial);
+            EXPECT_EQ(decoded, values) << "n = " << n;
+
+            std::vector<T> in_place(values);
+            delta_encode(in_place.data(), n, in_place.data(), initial);
+            EXPECT_EQ(in_place, deltas) << "n = " << n;
+            delta_decode(in_place.data(), n, in_place.data(), initial);
+            EXPECT_EQ(in_place, values) << "n = " << n;
+        }
+    }
+
+    namespace
+    {
+        // a constant column has zero offsets, packed on 0 bits into no word
+        template <class T>
+        void check_constant_column(std::size_t n)
+        {
+            std::vector<T> values(n, T(123456));
+            std::vector<T> offsets(n);
+            T base = for_encode(values.data(), n, offsets.data());
+            std::size_t bits = bitpack_width(offsets.data(), n);
+            EXPECT_EQ(bits, std::size_t(0)) << "n = " << n;
+            std::vector<T> packed(bitpacked_size<T>(n, bits));
+            EXPECT_TRUE(packed.empty()) << "n = " << n;
+            bitpack(offsets.data(), n, bits, packed.data());
+            std::vector<T> decoded(n, T(-1));
+            bitunpack(packed.data(), n, bits, decoded.data());
+            for_decode(decoded.data(), n, base, decoded.data());
+            EXPECT_EQ(decoded, values) << "n = " << n;
+        }
+    }
+
+    TEST(xsimd, bitpacking_constant_column)
+    {
+        for (std::size_t n : { 1, 17, 512, 600, 2000 })
+        {
+            check_constant_column<int32_t>(n);
+            check_constant_column<int64_t>(n);
+        }
+    }
+
+    TEST(xsimd, frame_of_reference)
+    {
+        for (std::size_t n : { 0, 1, 3, 16, 17, 100, 1000 })
+        {
+            check_frame_of_reference<int32_t>(n);
+            check_frame_of_reference<int64_t>(n);
+        }
+    }
+
+    TEST(xsimd, delta_coding)
+    {
+        for (std::size_t n : { 0, 1, 2, 3, 16, 17, 100, 1000 })
+        {
+            check_delta<int32_t>(n);
+            check_delta<int64_t>(n);
+        }
+    }
+}
@@ -0,0 +1,159 @@
+/***************************************************************************
+* Copyright (c) 2016, Johan Mabille and Sylvain Corlay                     *
+*                                                                          *
+* Distributed under the terms of the BSD 3-Clause License.                 *
+*                                                                          *
+* The full license is in the file LICENSE, distributed with this software. *
+****************************************************************************/
+
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "xsimd/algorithms/xsimd_blas.hpp"
+#include "xsimd/memory/xsimd_aligned_allocator.hpp"
+
+namespace xsimd
+{
+    namespace
+    {
+        template <class T>
+        using blas_vector = std::vector<T, aligned_allocator<T, XSIMD_DEFAULT_ALIGNMENT>>;
+
+        template <class T>
+        void check_blas(std::size_t n)
+        {
+            std::mt19937_64 generator(n);
+            std::uniform_real_distribution<T> distribution(T(-2), T(2));
+            blas_vector<T> x(n), y(n);
+            std::vector<T> ux(n), uy(n);
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                x[i] = ux[i] = distribution(generator);
+                y[i] = uy[i] = distribution(generator);
+            }
+            // the sums are accumulated in a different order
+            T tolerance = T(8) * std::numeric_limits<T>::epsilon() * static_cast<T>(n + 1);
+
+            T ref_dot = T(0), ref_asum = T(0), ref_sq = T(0);
+            std::size_t ref_iamax = 0;
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                ref_dot += x[i] * y[i];
+                ref_asum += std::abs(x[i]);
+                ref_sq += x[i] * x[i];
+                ref_iamax = std::abs(x[i]) > std::abs(x[ref_iamax]) ? i : ref_iamax;
+            }
+            EXPECT_NEAR(dot(x, y), ref_dot, tolerance * T(4)) << "n = " << n;
+            EXPECT_NEAR(dot(n, ux.data(), uy.data()), ref_dot, tolerance * T(4)) << "n = " << n;
+            EXPECT_NEAR(dot(x, uy), ref_dot, tolerance * T(4)) << "n = " << n;
+            EXPECT_NEAR(asum(x), ref_asum, tolerance * ref_asum) << "n = " << n;
+            EXPECT_NEAR(asum(n, ux.data()), ref_asum, tolerance * ref_asum) << "n = " << n;
+            EXPECT_NEAR(nrm2(x), std::sqrt(ref_sq), tolerance * std::sqrt(ref_sq)) << "n = " << n;
+            EXPECT_NEAR(nrm2(n, ux.data()), std::sqrt(ref_sq), tolerance * std::sqrt(ref_sq)) << "n = " << n;
+            EXPECT_EQ(iamax(x), ref_iamax) << "n = " << n;
+            EXPECT_EQ(iamax(n, ux.data()), ref_iamax) << "n = " << n;
+
+            // the updates are exact but for the fused rounding
+            T alpha = T(0.75);
+            std::vector<T> ref_y(n);
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                ref_y[i] = y[i] + alpha * x[i];
+            }
+            axpy(alpha, x, y);
+            axpy(n, alpha, ux.data(), uy.data());
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                EXPECT_NEAR(y[i], ref_y[i], T(4) * std::numeric_limits<T>::epsilon()) << "n = " << n << ", i = " << i;
+                EXPECT_EQ(uy[i], y[i]) << "n = " << n << ", i = " << i;
+            }
+            std::vector<T> ref_x(x.begin(), x.end());
+            scal(T(-0.5), x);
+            scal(n, T(-0.5), ux.data());
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                EXPECT_EQ(x[i], ref_x[i] * T(-0.5)) << "n = " << n << ", i = " << i;
+                EXPECT_EQ(ux[i], x[i]) << "n = " << n << ", i = " << i;
+            }
+        }
+
+        template <class T>
+        void check_nrm2_range()
+        {
+            const T big = std::numeric_limits<T>::max() / T(16);
+            const T small = std::numeric_limits<T>::denorm_min() * T(1024);
+            for (std::size_t n : { 1, 3, 17, 100 })
+            {
+                std::vector<T> x(n, big);
+                T ref = big * std::sqrt(static_cast<T>(n));
+                EXPECT_NEAR(nrm2(n, x.data()) / ref, T(1), T(n) * std::numeric_limits<T>::epsilon()) << "n = " << n;
+                x.assign(n, small);
+                ref = small * std::sqrt(static_cast<T>(n));
+                EXPECT_NEAR(nrm2(n, x.data()) / ref, T(1), T(n) * std::numeric_limits<T>::epsilon()) << "n = " << n;
+                x.assign(n, T(0));
+                EXPECT_EQ(nrm2(n, x.data()), T(0));
+                x[n / 2] = -std::numeric_limits<T>::infinity();
+                EXPECT_EQ(nrm2(n, x.data()), std::numeric_limits<T>::infinity());
+                x[n - 1] = std::numeric_limits<T>::quiet_NaN();
+                EXPECT_TRUE(std::isnan(nrm2(n, x.data())));
+            }
+            // 3-4-5 triangles at both ends of the range
+            T x[] = { T(3) * big / T(5), T(-4) * big / T(5) };
+            EXPECT_NEAR(nrm2(2, x) / big, T(1), T(4) * std::numeric_limits<T>::epsilon());
+            T y[] = { T(3) * small, T(-4) * small };
+            EXPECT_NEAR(nrm2(2, y) / (T(5) * small), T(1), T(4) * std::numeric_limits<T>::epsilon());
+            // the rescaling is exact, so is the norm of a single element
+            const T single[] = { std::numeric_limits<T>::max(), -std::numeric_limits<T>::max() / T(1.7),
+                                 big * T(1.3), std::numeric_limits<T>::denorm_min() * T(3),
+                                 -std::numeric_limits<T>::min() / T(1.9) };
+            for (T v : single)
+            {
+                EXPECT_EQ(nrm2(1, &v), std::abs(v)) << v;
+            }
+        }
+
+        template <class T>
+        void check_iamax_positions()
+        {
+            for (std::size_t n : { 1, 5, 8, 31, 64, 1000, 1029 })
+            {
+                for (std::size_t k = 0; k < n; k += 1 + k / 3)
+                {
+                    std::vector<T> x(n, T(1));
+                    x[k] = T(-3);
+                    // a tie after the first maximum, and a NaN
+                    x[(k + n / 2) % n] = (k + n / 2) % n > k ? T(3) : T(2);
+                    x[(k + 1) % n] = (k + 1) % n != k ? std::numeric_limits<T>::quiet_NaN() : x[k];
+                    EXPECT_EQ(iamax(n, x.data()), k) << "n = " << n << ", k = " << k;
+                }
+            }
+            EXPECT_EQ(iamax(0, static_cast<const T*>(nullptr)), std::size_t(0));
+        }
+    }
+
+    TEST(xsimd, blas_level1)
+    {
+        for (std::size_t n : { 0, 1, 2, 3, 4, 7, 8, 15, 16, 17, 31, 32, 33, 64, 100, 1000, 1023 })
+        {
+            check_blas<float>(n);
+            check_blas<double>(n);
+        }
+    }
+
+    TEST(xsimd, blas_nrm2_range)
+    {
+        check_nrm2_range<float>();
+        check_nrm2_range<double>();
+    }
+
+    TEST(xsimd, blas_iamax)
+    {
+        check_iamax_positions<float>();
+        check_iamax_positions<double>();
+    }
+}
@@ -0,0 +1,94 @@
+/***************************************************************************
+* Copyright (c) 2016, Johan Mabille and Sylvain Corlay                     *
+*                                                                          *
+* Distributed under the terms of the BSD 3-Clause License.                 *
+*                                                                          *
+* The full license is in the file LICENSE, distributed with this software. *
+****************************************************************************/
+
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <unordered_set>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "xsimd/algorithms/xsimd_bloom_filter.hpp"
+
+namespace xsimd
+{
+    namespace
+    {
+        template <class K>
+        void check_bloom_filter(std::size_t n)
+        {
+            split_block_bloom_filter<K> filter(n);
+            std::mt19937_64 generator(5);
+            std::vector<K> keys(n);
+            std::unordered_set<K> key_set;
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                keys[i] = static_cast<K>(i % 2 == 0 ? generator() : i);
+                key_set.insert(keys[i]);
+            }
+            // half of the keys one by one, the other half at once
+            for (std::size_t i = 0; i < n / 2; ++i)
+            {
+                filter.insert(keys[i]);
+            }
+            filter.insert_many(keys.data() + n / 2, n - n / 2);
+
+            std::vector<K> queries(keys);
+            std::size_t num_absent = 0;
+            while (num_absent < 10000)
+            {
+                K key = static_cast<K>(generator());
+                if (key_set.count(key) == 0)
+                {
+                    queries.push_back(key);
+                    ++num_absent;
+                }
+            }
+            std::vector<uint64_t> bitmap((queries.size() + 63) / 64, ~uint64_t(0));
+            std::size_t count = filter.contains_many(queries.data(), queries.size(), bitmap.data());
+
+            std::size_t ref_count = 0, false_positives = 0;
+            for (std::size_t i = 0; i < queries.size(); ++i)
+            {
+                bool bit = ((bitmap[i / 64] >> (i % 64)) & 1) != 0;
+                EXPECT_EQ(bit, filter.contains(queries[i])) << "query " << i;
+                ref_count += bit;
+                if (i < n)
+                {
+                    // no false negative
+                    EXPECT_TRUE(bit) << "key " << keys[i];
+                }
+                else
+                {
+                    false_positives += bit;
+                }
+            }
+            EXPECT_EQ(count, ref_count);
+            if (queries.size() % 64 != 0)
+            {
+                EXPECT_EQ(bitmap.back() >> (queries.size() % 64), uint64_t(0));
+            }
+            // 10 bits per key: about 1% with 256 bits blocks, a bit more
+            // with the 128 bits blocks of SSE and NEON
+            EXPECT_LT(false_positives, num_absent * 4 / 100);
+
+            filter.clear();
+            EXPECT_EQ(filter.contains_many(queries.data(), queries.size(), bitmap.data()), std::size_t(0));
+        }
+    }
+}
+
+TEST(xsimd, bloom_filter)
+{
+    xsimd::check_bloom_filter<int32_t>(1);
+    xsimd::check_bloom_filter<int32_t>(1000);
+    xsimd::check_bloom_filter<int32_t>(20000);
+    xsimd::check_bloom_filter<int64_t>(63);
+    xsimd::check_bloom_filter<int64_t>(20000);
+}
@@ -0,0 +1,248 @@
+/***************************************************************************
+* Copyright (c) 2016, Johan Mabille and Sylvain Corlay                     *
+*                                                                          *
+* Distributed under the terms of the BSD 3-Clause License.                 *
+*                                                                          *
+* The full license is in the file LICENSE, distributed with this software. *
+****************************************************************************/
+
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "xsimd/xsimd.hpp"
+#include "xsimd/math/xsimd_bessel.hpp"
+
+namespace xsimd
+{
+    namespace
+    {
+        template <class T>
+        T flushed_product(T a, T b)
+        {
+            volatile T va = a;
+            volatile T vb = b;
+            return va * vb;
+        }
+
+        template <class T>
+        T flushed_batch_product(T a, T b)
+        {
+            using b_type = simd_type<T>;
+            volatile T va = a;
+            volatile T vb = b;
+            b_type res = b_type(T(va)) * b_type(T(vb));
+            return res[0];
+        }
+
+        template <class T>
+        bool is_denormal(T x)
+        {
+            return std::fpclassify(x) == FP_SUBNORMAL;
+        }
+
+        // inputs spanning the whole normal range of both signs, and the
+        // neighbourhood of the integers for the periodic and special functions
+        template <class T>
+        std::vector<T> denormal_test_inputs()
+        {
+            std::vector<T> res;
+            T emin = T(std::numeric_limits<T>::min_exponent - 1);
+            T emax = T(std::numeric_limits<T>::max_exponent - 1);
+            for (T e = emin; e <= emax; e += T(0.25))
+            {
+                T x = std::ldexp(T(1.1), int(std::floor(e))) * std::exp2(e - std::floor(e));
+                res.push_back(x);
+                res.push_back(-x);
+            }
+            for (int i = -200; i <= 200; ++i)
+            {
+                res.push_back(T(i) * T(0.5) + T(0.1));
+            }
+            constexpr std::size_t size = simd_traits<T>::size;
+            res.resize(res.size() + (size - res.size() % size) % size, T(1));
+            return res;
+        }
+
+        template <class F, class T>
+        void check_denormal_guard(F f, const std::string& name)
+        {
+            constexpr std::size_t size = simd_traits<T>::size;
+            std::vector<T> input = denormal_test_inputs<T>();
+            std::vector<T> ref(input.size()), res(input.size());
+            for (std::size_t i = 0; i < input.size(); i += size)
+            {
+                f(load_unaligned(&input[i])).store_unaligned(&ref[i]);
+            }
+            {
+                denormal_guard guard;
+                for (std::size_t i = 0; i < input.size(); i += size)
+                {
+                    f(load_unaligned(&input[i])).store_unaligned(&res[i]);
+                }
+            }
+            std::size_t diff = 0;
+            for (std::size_t i = 0; i < input.size(); ++i)
+            {
+                if (is_denormal(ref[i]))
+                {
+                    // flushed result
+                    EXPECT_EQ(res[i], T(0)) << name << "(" << input[i] << ")";
+                }
+                else if (!(std::isnan(ref[i]) && std::isnan(res[i])) && ref[i] != res[i])
+                {
+                    if (++diff <= 4)
+                    {
+                        ADD_FAILURE() << name << "(" << input[i] << ") = " << ref[i] << ", with FTZ/DAZ: " << res[i];
+                    }
+                }
+            }
+            EXPECT_EQ(diff, std::size_t(0)) << name;
+        }
+
+#define DEFINE_DENORMAL_FUNCTOR(NAME)                       \
+        struct NAME##_fn                                    \
+        {                                                   \
+            template <class B>                              \
+            B operator()(const B& x) const                  \
+            {                                               \
+                return NAME(x);                             \
+            }                                               \
+        }
+
+        DEFINE_DENORMAL_FUNCTOR(exp);
+        DEFINE_DENORMAL_FUNCTOR(exp2);
+        DEFINE_DENORMAL_FUNCTOR(expm1);
+        DEFINE_DENORMAL_FUNCTOR(log);
+        DEFINE_DENORMAL_FUNCTOR(log2);
+        DEFINE_DENORMAL_FUNCTOR(log10);
+        DEFINE_DENORMAL_FUNCTOR(log1p);
+        DEFINE_DENORMAL_FUNCTOR(sqrt);
+        DEFINE_DENORMAL_FUNCTOR(cbrt);
+        DEFINE_DENORMAL_FUNCTOR(sin);
+        DEFINE_DENORMAL_FUNCTOR(cos);
+        DEFINE_DENORMAL_FUNCTOR(tan);
+        DEFINE_DENORMAL_FUNCTOR(asin);
+        DEFINE_DENORMAL_FUNCTOR(acos);
+        DEFINE_DENORMAL_FUNCTOR(atan);
+        DEFINE_DENORMAL_FUNCTOR(sinh);
+        DEFINE_DENORMAL_FUNCTOR(cosh);
+        DEFINE_DENORMAL_FUNCTOR(tanh);
+        DEFINE_DENORMAL_FUNCTOR(asinh);
+        DEFINE_DENORMAL_FUNCTOR(atanh);
+        DEFINE_DENORMAL_FUNCTOR(erf);
+        DEFINE_DENORMAL_FUNCTOR(erfc);
+        DEFINE_DENORMAL_FUNCTOR(tgamma);
+        DEFINE_DENORMAL_FUNCTOR(lgamma);
+        DEFINE_DENORMAL_FUNCTOR(sigmoid);
+        DEFINE_DENORMAL_FUNCTOR(j0);
+        DEFINE_DENORMAL_FUNCTOR(j1);
+        DEFINE_DENORMAL_FUNCTOR(y0);
+        DEFINE_DENORMAL_FUNCTOR(i0e);
+
+#undef DEFINE_DENORMAL_FUNCTOR
+
+        struct pow_fn
+        {
+            template <class B>
+            B operator()(const B& x) const
+            {
+                return pow(abs(x), B(0.75));
+            }
+        };
+
+        struct atan2_fn
+        {
+            template <class B>
+            B operator()(const B& x) const
+            {
+                return atan2(x, B(3.));
+            }
+        };
+
+        template <class T>
+        void check_denormal_guard_math()
+        {
+            check_denormal_guard<exp_fn, T>(exp_fn(), "exp");
+            check_denormal_guard<exp2_fn, T>(exp2_fn(), "exp2");
+            check_denormal_guard<expm1_fn, T>(expm1_fn(), "expm1");
+            check_denormal_guard<log_fn, T>(log_fn(), "log");
+            check_denormal_guard<log2_fn, T>(log2_fn(), "log2");
+            check_denormal_guard<log10_fn, T>(log10_fn(), "log10");
+            check_denormal_guard<log1p_fn, T>(log1p_fn(), "log1p");
+            check_denormal_guard<sqrt_fn, T>(sqrt_fn(), "sqrt");
+            check_denormal_guard<cbrt_fn, T>(cbrt_fn(), "cbrt");
+            check_denormal_guard<pow_fn, T>(pow_fn(), "pow");
+            check_denormal_guard<sin_fn, T>(sin_fn(), "sin");
+            check_denormal_guard<cos_fn, T>(cos_fn(), "cos");
+            check_denormal_guard<tan_fn, T>(tan_fn(), "tan");
+            check_denormal_guard<asin_fn, T>(asin_fn(), "asin");
+            check_denormal_guard<acos_fn, T>(acos_fn(), "acos");
+            check_denormal_guard<atan_fn, T>(atan_fn(), "atan");
+            check_denormal_guard<atan2_fn, T>(atan2_fn(), "atan2");
+            check_denormal_guard<sinh_fn, T>(sinh_fn(), "sinh");
+            check_denormal_guard<cosh_fn, T>(cosh_fn(), "cosh");
+            check_denormal_guard<tanh_fn, T>(tanh_fn(), "tanh");
+            check_denormal_guard<asinh_fn, T>(asinh_fn(), "asinh");
+            check_denormal_guard<atanh_fn, T>(atanh_fn(), "atanh");
+            check_denormal_guard<erf_fn, T>(erf_fn(), "erf");
+            check_denormal_guard<erfc_fn, T>(erfc_fn(), "erfc");
+            check_denormal_guard<tgamma_fn, T>(tgamma_fn(), "tgamma");
+            check_denormal_guard<lgamma_fn, T>(lgamma_fn(), "lgamma");
+            check_denormal_guard<sigmoid_fn, T>(sigmoid_fn(), "sigmoid");
+            check_denormal_guard<j0_fn, T>(j0_fn(), "j0");
+            check_denormal_guard<j1_fn, T>(j1_fn(), "j1");
+            check_denormal_guard<y0_fn, T>(y0_fn(), "y0");
+            check_denormal_guard<i0e_fn, T>(i0e_fn(), "i0e");
+        }
+    }
+
+    TEST(xsimd, denormal_guard_scope)
+    {
+        if (!denormal_guard::is_supported())
+        {
+            return;
+        }
+        float fmin = std::numeric_limits<float>::min();
+        double dmin = std::numeric_limits<double>::min();
+        EXPECT_TRUE(is_denormal(flushed_product(fmin, 0.5f)));
+        {
+            denormal_guard guard;
+            EXPECT_EQ(flushed_product(fmin, 0.5f), 0.f);
+            EXPECT_EQ(flushed_product(dmin, 0.5), 0.);
+            {
+                denormal_guard inner;
+                EXPECT_EQ(flushed_product(fmin, 0.5f), 0.f);
+            }
+            // the inner guard restores the mode of the outer one
+            EXPECT_EQ(flushed_product(fmin, 0.5f), 0.f);
+            EXPECT_EQ(flushed_batch_product(fmin, 0.5f), 0.f);
+            EXPECT_EQ(flushed_batch_product(dmin, 0.5), 0.);
+        }
+        EXPECT_TRUE(is_denormal(flushed_product(fmin, 0.5f)));
+        EXPECT_TRUE(is_denormal(flushed_product(dmin, 0.5)));
+    }
+
+    TEST(xsimd, denormal_guard_inputs)
+    {
+        if (!denormal_guard::is_supported())
+        {
+            return;
+        }
+        float fden = std::numeric_limits<float>::denorm_min();
+        denormal_guard guard;
+        // denormal inputs are read as zero, even if the result is normal
+        EXPECT_EQ(flushed_product(fden, 1e30f), 0.f);
+        EXPECT_EQ(flushed_batch_product(fden, 1e30f), 0.f);
+    }
+
+    TEST(xsimd, denormal_guard_math)
+    {
+        check_denormal_guard_math<float>();
+        check_denormal_guard_math<double>();
+    }
+}
@@ -0,0 +1,176 @@
+/***************************************************************************
+* Copyright (c) 2016, Johan Mabille and Sylvain Corlay                     *
+*                                                                          *
+* Distributed under the terms of the BSD 3-Clause License.                 *
+*                                                                          *
+* The full license is in the file LICENSE, distributed with this software. *
+****************************************************************************/
+
+#include <cctype>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "xsimd/algorithms/xsimd_encoding.hpp"
+
+namespace xsimd
+{
+    namespace
+    {
+        std::string encode_string(const std::string& s, base64_alphabet alphabet = base64_alphabet::standard, bool padding = true)
+        {
+            std::string res(base64_encoded_size(s.size(), padding), '?');
+            std::size_t size = base64_encode(reinterpret_cast<const uint8_t*>(s.data()), s.size(), &res[0], alphabet, padding);
+            EXPECT_EQ(size, res.size());
+            return res;
+        }
+
+        bool decode_string(const std::string& s, std::string& res, base64_alphabet alphabet = base64_alphabet::standard)
+        {
+            std::vector<uint8_t> buffer(base64_max_decoded_size(s.size()));
+            std::size_t size = 0;
+            bool valid = base64_decode(s.data(), s.size(), buffer.data(), size, alphabet);
+            res.assign(buffer.begin(), buffer.begin() + static_cast<std::ptrdiff_t>(valid ? size : 0));
+            return valid;
+        }
+
+        std::string base64_reference(const std::vector<uint8_t>& data, const char* alphabet, bool padding)
+        {
+            std::string res;
+            uint32_t acc = 0;
+            std::size_t bits = 0;
+            for (uint8_t x : data)
+            {
+                acc = (acc << 8) | x;
+                bits += 8;
+                while (bits >= 6)
+                {
+                    bits -= 6;
+                    res += alphabet[(acc >> bits) & 0x3f];
+                }
+            }
+            if (bits != 0)
+            {
+                res += alphabet[(acc << (6 - bits)) & 0x3f];
+            }
+            while (padding && res.size() % 4 != 0)
+            {
+                res += '=';
+            }
+            return res;
+        }
+    }
+
+    TEST(xsimd, base64)
+    {
+        // RFC 4648 test vectors
+        const char* vectors[][2] = { { "", "" }, { "f", "Zg==" }, { "fo", "Zm8=" }, { "foo", "Zm9v" },
+                                     { "foob", "Zm9vYg==" }, { "fooba", "Zm9vYmE=" }, { "foobar", "Zm9vYmFy" } };
+        for (const auto& v : vectors)
+        {
+            EXPECT_EQ(encode_string(v[0]), v[1]);
+            std::string decoded;
+            EXPECT_TRUE(decode_string(v[1], decoded)) << v[1];
+            EXPECT_EQ(decoded, v[0]);
+        }
+        EXPECT_EQ(encode_string("fo", base64_alphabet::standard, false), "Zm8");
+        EXPECT_EQ(base64_encoded_size(5, false), std::size_t(7));
+
+        const char* standard = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+        const char* url = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-_";
+        std::mt19937_64 generator(19);
+        for (std::size_t n : { 1, 2, 3, 11, 12, 13, 24, 47, 48, 49, 95, 96, 100, 1000, 1001, 1002 })
+        {
+            std::vector<uint8_t> data(n);
+            for (uint8_t& x : data)
+            {
+                x = static_cast<uint8_t>(generator());
+            }
+            std::string s(data.begin(), data.end());
+            for (bool padding : { true, false })
+            {
+                std::string encoded = encode_string(s, base64_alphabet::standard, padding);
+                EXPECT_EQ(encoded, base64_reference(data, standard, padding)) << "n = " << n;
+                std::string encoded_url = encode_string(s, base64_alphabet::url, padding);
+                EXPECT_EQ(encoded_url, base64_reference(data, url, padding)) << "n = " << n;
+
+                std::string decoded;
+                EXPECT_TRUE(decode_string(encoded, decoded)) << "n = " << n;
+                EXPECT_EQ(decoded, s) << "n = " << n;
+                EXPECT_TRUE(decode_string(encoded_url, decoded, base64_alphabet::url)) << "n = " << n;
+                EXPECT_EQ(decoded, s) << "n = " << n;
+            }
+
+            // invalid characters at every position
+            std::string encoded = encode_string(s);
+            std::string decoded;
+            std::size_t data_size = base64_encoded_size(n, false);
+            for (std::size_t i = 0; i < data_size; ++i)
+            {
+                std::string corrupted = encoded;
+                corrupted[i] = "-_ =\n\x80*"[i % 7];
+                EXPECT_FALSE(decode_string(corrupted, decoded)) << "n = " << n << ", i = " << i;
+                corrupted[i] = "+/"[i % 2];
+                if (i + 1 < data_size || n % 3 == 0)
+                {
+                    EXPECT_TRUE(decode_string(corrupted, decoded)) << "n = " << n << ", i = " << i;
+                }
+                EXPECT_EQ(decode_string(corrupted, decoded, base64_alphabet::url), false) << "n = " << n << ", i = " << i;
+            }
+        }
+
+        // lengths and unused bits
+        std::string decoded;
+        EXPECT_FALSE(decode_string("Zm9vY", decoded));
+        EXPECT_FALSE(decode_string("Zm9vY===", decoded));
+        EXPECT_FALSE(decode_string("Zh==", decoded));
+        EXPECT_FALSE(decode_string("Zm9=", decoded));
+        EXPECT_TRUE(decode_string("Zm8", decoded));
+        EXPECT_EQ(decoded, "fo");
+    }
+
+    TEST(xsimd, hex)
+    {
+        std::mt19937_64 generator(23);
+        for (std::size_t n : { 0, 1, 15, 16, 17, 31, 32, 33, 64, 100, 1000 })
+        {
+            std::vector<uint8_t> data(n);
+            std::string ref;
+            for (uint8_t& x : data)
+            {
+                x = static_cast<uint8_t>(generator());
+                ref += "0123456789abcdef"[x >> 4];
+                ref += "0123456789abcdef"[x & 0x0f];
+            }
+            std::string encoded(2 * n + 1, '?');
+            hex_encode(data.data(), n, &encoded[0]);
+            EXPECT_EQ(encoded[2 * n], '?');
+            encoded.resize(2 * n);
+            EXPECT_EQ(encoded, ref) << "n = " << n;
+
+            std::vector<uint8_t> decoded(n + 1, 7);
+            EXPECT_TRUE(hex_decode(encoded.data(), encoded.size(), decoded.data())) << "n = " << n;
+            EXPECT_EQ(decoded[n], 7);
+            decoded.resize(n);
+            EXPECT_EQ(decoded, data) << "n = " << n;
+
+            for (std::size_t i = 0; i < 2 * n; ++i)
+            {
+                std::string upper = encoded;
+                upper[i] = static_cast<char>(std::toupper(upper[i]));
+                decoded.assign(n, 0);
+                EXPECT_TRUE(hex_decode(upper.data(), upper.size(), decoded.data())) << "n = " << n << ", i = " << i;
+                EXPECT_EQ(decoded, data) << "n = " << n << ", i = " << i;
+                std::string corrupted = encoded;
+                corrupted[i] = "g/:@G`\x80 "[i % 8];
+                EXPECT_FALSE(hex_decode(corrupted.data(), corrupted.size(), decoded.data())) << "n = " << n << ", i = " << i;
+            }
+        }
+        uint8_t x;
+        EXPECT_FALSE(hex_decode("abc", 3, &x));
+    }
+}
@@ -6,14 +6,18 @@
 * The full license is in the file LICENSE, distributed with this software. *
 ****************************************************************************/
 
+#include <cmath>
 #include <fstream>
 #include <iostream>
+#include <limits>
+#include <vector>
 
 #include "gtest/gtest.h"
 
 #include "xsimd/math/xsimd_error.hpp"
 #include "xsimd/math/xsimd_gamma.hpp"
 #include "xsimd/memory/xsimd_aligned_allocator.hpp"
+#include "xsimd/types/xsimd_traits.hpp"
 #include "xsimd/types/xsimd_types_include.hpp"
 #include "xsimd_error_gamma_test.hpp"
 
@@ -106,4 +110,72 @@ TEST(xsimd, fallback_double_error_gamma)
     bool res = xsimd::test_error_gamma<double, 3, 32>(out, "fallback double");
     EXPECT_TRUE(res);
 }
-#endif
\ No newline at end of file
+#endif
+
+TEST(xsimd, incomplete_gamma_beta_identities)
+{
+    using b_type = xsimd::simd_type<double>;
+    const double pi = 3.141592653589793238462643383279502884;
+    for (double x : { 1e-3, 0.1, 0.37, 0.5, 0.81, 0.999 })
+    {
+        b_type bx(x);
+        // P(1, x) = 1 - exp(-x), Q(1/2, x) = erfc(sqrt(x))
+        EXPECT_NEAR(xsimd::gamma_p(b_type(1.), bx)[0], -std::expm1(-x), 1e-15);
+        EXPECT_NEAR(xsimd::gamma_q(b_type(0.5), bx * b_type(20.))[0], std::erfc(std::sqrt(20. * x)), 1e-15);
+        // I_x(1, b) = 1 - (1 - x)^b, I_x(a, 1) = x^a, I_x(1/2, 1/2) = 2 / pi * asin(sqrt(x))
+        EXPECT_NEAR(xsimd::ibeta(b_type(1.), b_type(2.75), bx)[0], 1. - std::pow(1. - x, 2.75), 1e-15);
+        EXPECT_NEAR(xsimd::ibeta(b_type(3.5), b_type(1.), bx)[0], std::pow(x, 3.5), 1e-15);
+        EXPECT_NEAR(xsimd::ibeta(b_type(0.5), b_type(0.5), bx)[0], 2. / pi * std::asin(std::sqrt(x)), 1e-15);
+        // I_x(a, b) = 1 - I_{1 - x}(b, a)
+        EXPECT_NEAR(xsimd::ibeta(b_type(2.5), b_type(7.25), bx)[0], 1. - xsimd::ibeta(b_type(7.25), b_type(2.5), b_type(1.) - bx)[0], 1e-15);
+    }
+
+    b_type zero(0.), one(1.);
+    EXPECT_EQ(xsimd::gamma_p(one, zero)[0], 0.);
+    EXPECT_EQ(xsimd::gamma_q(one, zero)[0], 1.);
+    EXPECT_EQ(xsimd::gamma_p(one, xsimd::infinity<b_type>())[0], 1.);
+    EXPECT_EQ(xsimd::gamma_q(one, xsimd::infinity<b_type>())[0], 0.);
+    EXPECT_TRUE(std::isnan(xsimd::gamma_p(-one, one)[0]));
+    EXPECT_TRUE(std::isnan(xsimd::gamma_q(one, -one)[0]));
+    EXPECT_EQ(xsimd::ibeta(one, one, zero)[0], 0.);
+    EXPECT_EQ(xsimd::ibeta(one, one, one)[0], 1.);
+    EXPECT_TRUE(std::isnan(xsimd::ibeta(one, one, b_type(1.5))[0]));
+    EXPECT_TRUE(std::isnan(xsimd::ibeta(zero, one, b_type(0.5))[0]));
+
+    EXPECT_EQ(xsimd::digamma(zero)[0], -std::numeric_limits<double>::infinity());
+    EXPECT_TRUE(std::isnan(xsimd::digamma(b_type(-2.))[0]));
+    EXPECT_EQ(xsimd::digamma(xsimd::infinity<b_type>())[0], std::numeric_limits<double>::infinity());
+    // digamma(1) = -euler gamma
+    EXPECT_NEAR(xsimd::digamma(one)[0], -0.577215664901532860606512090082402431, 1e-16);
+}
+
+TEST(xsimd, gamma_large_arguments)
+{
+    using f_type = xsimd::simd_type<float>;
+    using d_type = xsimd::simd_type<double>;
+    // the recurrences used to end after a steps, or never
+    EXPECT_EQ(xsimd::tgamma(f_type(1e30f))[0], std::numeric_limits<float>::infinity());
+    EXPECT_EQ(xsimd::tgamma(d_type(1e300))[0], std::numeric_limits<double>::infinity());
+    EXPECT_EQ(xsimd::tgamma(d_type(200.))[0], std::numeric_limits<double>::infinity());
+
+    constexpr std::size_t size = xsimd::simd_traits<double>::size;
+    std::vector<double> x(size);
+    for (std::size_t i = 0; i < size; ++i)
+    {
+        x[i] = i % 2 ? 3.5 : -1.5e300;
+    }
+    d_type bx;
+    bx.load_unaligned(x.data());
+    d_type res = xsimd::lgamma(bx);
+    for (std::size_t i = 0; i < size; ++i)
+    {
+        if (i % 2)
+        {
+            EXPECT_NEAR(res[i], std::lgamma(3.5), 1e-15);
+        }
+        else
+        {
+            EXPECT_TRUE(std::isnan(res[i]));
+        }
+    }
+}
@@ -28,16 +28,104 @@ namespace xsimd
         res_type input;
         res_type erf_res;
         res_type erfc_res;
+        res_type erfinv_input;
+        res_type erfinv_res;
+        res_type erfcinv_input;
+        res_type erfcinv_res;
+        res_type quantile_input;
+        res_type quantile_res;
         res_type gamma_input;
         res_type tgamma_res;
         res_type lgamma_res;
         res_type gamma_neg_input;
         res_type tgamma_neg_res;
         res_type lgamma_neg_res;
+        res_type digamma_input;
+        res_type digamma_res;
+        res_type digamma_neg_input;
+        res_type digamma_neg_res;
+        res_type incomplete_a_input;
+        res_type incomplete_b_input;
+        res_type incomplete_x_input;
+        res_type gamma_p_res;
+        res_type gamma_q_res;
+        res_type beta_a_input;
+        res_type beta_x_input;
+        res_type ibeta_res;
 
         simd_error_gamma_tester(const std::string& n);
     };
 
+    namespace detail
+    {
+        // Standard normal quantile of p <= 1/2: Abramowitz and Stegun 26.2.23
+        // refined by Newton iterations in long double
+        inline long double normal_quantile_reference(long double p)
+        {
+            const long double sqrt2 = 1.414213562373095048801688724209698079L;
+            const long double sqrt2pi = 2.506628274631000502415765284811045253L;
+            if (p > 0.5L)
+            {
+                return -normal_quantile_reference(1.L - p);
+            }
+            long double t = std::sqrt(-2.L * std::log(p));
+            long double z = -t + (2.515517L + t * (0.802853L + t * 0.010328L)) /
+                (1.L + t * (1.432788L + t * (0.189269L + t * 0.001308L)));
+            for (int i = 0; i < 4; ++i)
+            {
+                long double f = 0.5L * std::erfc(-z / sqrt2) - p;
+                z -= f * sqrt2pi * std::exp(0.5L * z * z);
+            }
+            return z;
+        }
+
+        // Recurrence up to x >= 20, then asymptotic expansion
+        inline long double digamma_reference(long double x)
+        {
+            const long double pi = 3.141592653589793238462643383279502884L;
+            if (x < 0.L)
+            {
+                return digamma_reference(1.L - x) - pi * std::cos(pi * x) / std::sin(pi * x);
+            }
+            long double acc = 0.L;
+            while (x < 20.L)
+            {
+                acc -= 1.L / x;
+                x += 1.L;
+            }
+            long double z = 1.L / (x * x);
+            long double s = z * (1.L / 12.L - z * (1.L / 120.L - z * (1.L / 252.L - z * (1.L / 240.L - z * (1.L / 132.L)))));
+            return acc + std::log(x) - 0.5L / x - s;
+        }
+
+        // Series of the regularized lower incomplete gamma function
+        inline long double gamma_p_reference(long double a, long double x)
+        {
+            long double term = 1.L / a;
+            long double sum = term;
+            for (long double ap = a + 1.L; term > sum * 1e-21L; ap += 1.L)
+            {
+                term *= x / ap;
+                sum += term;
+            }
+            return sum * std::exp(a * std::log(x) - x - std::lgamma(a));
+        }
+
+        // For integer a and b, I_x(a, b) is the probability of at least a
+        // successes in a + b - 1 Bernoulli trials of probability x
+        inline long double ibeta_reference(int a, int b, long double x)
+        {
+            int n = a + b - 1;
+            long double sum = 0.L;
+            for (int j = a; j <= n; ++j)
+            {
+                long double c = std::exp(std::lgamma(n + 1.L) - std::lgamma(j + 1.L) - std::lgamma(n - j + 1.L));
+                sum += c * std::pow(x, j) * std::pow(1.L - x, n - j);
+            }
+            return sum;
+        }
+    }
+
     template <class T, std::size_t N, std::size_t A>
     simd_error_gamma_tester<T, N, A>::simd_error_gamma_tester(const std::string& n)
         : name(n)
@@ -46,23 +134,64 @@ namespace xsimd
         input.resize(nb_input);
         erf_res.resize(nb_input);
         erfc_res.resize(nb_input);
+        erfinv_input.resize(nb_input);
+        erfinv_res.resize(nb_input);
+        erfcinv_input.resize(nb_input);
+        erfcinv_res.resize(nb_input);
+        quantile_input.resize(nb_input);
+        quantile_res.resize(nb_input);
         gamma_input.resize(nb_input);
         tgamma_res.resize(nb_input);
         lgamma_res.resize(nb_input);
         gamma_neg_input.resize(nb_input);
         tgamma_neg_res.resize(nb_input);
         lgamma_neg_res.resize(nb_input);
+        digamma_input.resize(nb_input);
+        digamma_res.resize(nb_input);
+        digamma_neg_input.resize(nb_input);
+        digamma_neg_res.resize(nb_input);
+        incomplete_a_input.resize(nb_input);
+        incomplete_b_input.resize(nb_input);
+        incomplete_x_input.resize(nb_input);
+        gamma_p_res.resize(nb_input);
+        gamma_q_res.resize(nb_input);
+        beta_a_input.resize(nb_input);
+        beta_x_input.resize(nb_input);
+        ibeta_res.resize(nb_input);
         for (size_t i = 0; i < nb_input; ++i)
         {
             input[i] = value_type(-1.5) + i * value_type(3) / nb_input;
             erf_res[i] = std::erf(input[i]);
             erfc_res[i] = std::erfc(input[i]);
+            const long double invsqrt2 = 0.707106781186547524400844362104849039L;
+            erfinv_input[i] = value_type(-1) + (i + value_type(0.5)) * value_type(2) / nb_input;
+            erfinv_res[i] = value_type(invsqrt2 * detail::normal_quantile_reference(0.5L + 0.5L * erfinv_input[i]));
+            erfcinv_input[i] = (i + value_type(0.5)) * value_type(2) / nb_input;
+            erfcinv_res[i] = value_type(-invsqrt2 * detail::normal_quantile_reference(0.5L * erfcinv_input[i]));
+            // log-spaced probabilities down to the smallest normal number
+            quantile_input[i] = std::exp(std::log(std::numeric_limits<value_type>::min()) * (i + 1) / nb_input);
+            quantile_res[i] = value_type(detail::normal_quantile_reference(quantile_input[i]));
             gamma_input[i] = value_type(0.5) + i * value_type(3) / nb_input;
             tgamma_res[i] = std::tgamma(gamma_input[i]);
             lgamma_res[i] = std::lgamma(gamma_input[i]);
             gamma_neg_input[i] = value_type(-3.99) + i * value_type(0.9) / nb_input;
             tgamma_neg_res[i] = std::tgamma(gamma_neg_input[i]);
             lgamma_neg_res[i] = std::lgamma(gamma_neg_input[i]);
+            digamma_input[i] = value_type(0.01) + i * value_type(20) / nb_input;
+            digamma_res[i] = value_type(detail::digamma_reference(digamma_input[i]));
+            // between the pole at -1 and the negative root closest to 0
+            digamma_neg_input[i] = value_type(-0.95) + i * value_type(0.4) / nb_input;
+            digamma_neg_res[i] = value_type(detail::digamma_reference(digamma_neg_input[i]));
+            // neighbouring lanes get different parameters
+            incomplete_a_input[i] = value_type(0.25) + value_type(0.5) * (i % 37);
+            incomplete_b_input[i] = value_type(1 + (i / 9) % 7);
+            incomplete_x_input[i] = (i + value_type(0.5)) * value_type(30) / nb_input;
+            long double p = detail::gamma_p_reference(incomplete_a_input[i], incomplete_x_input[i]);
+            gamma_p_res[i] = value_type(p);
+            gamma_q_res[i] = value_type(1.L - p);
+            beta_a_input[i] = value_type(1 + i % 9);
+            beta_x_input[i] = (i + value_type(0.5)) / nb_input;
+            ibeta_res[i] = value_type(detail::ibeta_reference(1 + i % 9, 1 + (i / 9) % 7, beta_x_input[i]));
         }
     }
 
@@ -113,6 +242,36 @@ namespace xsimd
         tmp_success = check_almost_equal(topic, res, tester.erfc_res, out);
         success = success && tmp_success;
 
+        topic = "erfinv                  : ";
+        for (size_t i = 0; i < tester.erfinv_input.size(); i += tester.size)
+        {
+            detail::load_vec(input, tester.erfinv_input, i);
+            vres = erfinv(input);
+            detail::store_vec(vres, res, i);
+        }
+        tmp_success = check_almost_equal(topic, res, tester.erfinv_res, out);
+        success = success && tmp_success;
+
+        topic = "erfcinv                 : ";
+        for (size_t i = 0; i < tester.erfcinv_input.size(); i += tester.size)
+        {
+            detail::load_vec(input, tester.erfcinv_input, i);
+            vres = erfcinv(input);
+            detail::store_vec(vres, res, i);
+        }
+        tmp_success = check_almost_equal(topic, res, tester.erfcinv_res, out);
+        success = success && tmp_success;
+
+        topic = "normal_quantile         : ";
+        for (size_t i = 0; i < tester.quantile_input.size(); i += tester.size)
+        {
+            detail::load_vec(input, tester.quantile_input, i);
+            vres = normal_quantile(input);
+            detail::store_vec(vres, res, i);
+        }
+        tmp_success = check_almost_equal(topic, res, tester.quantile_res, out);
+        success = success && tmp_success;
+
         topic = "tgamma                  : ";
         for (size_t i = 0; i < tester.gamma_input.size(); i += tester.size)
         {
@@ -154,6 +313,63 @@ namespace xsimd
         tmp_success = check_almost_equal(topic, res, tester.lgamma_neg_res, out);
         success = success && tmp_success;
 #endif
+
+        topic = "digamma                 : ";
+        for (size_t i = 0; i < tester.digamma_input.size(); i += tester.size)
+        {
+            detail::load_vec(input, tester.digamma_input, i);
+            vres = digamma(input);
+            detail::store_vec(vres, res, i);
+        }
+        tmp_success = check_almost_equal(topic, res, tester.digamma_res, out);
+        success = success && tmp_success;
+
+        topic = "digamma (negative input): ";
+        for (size_t i = 0; i < tester.digamma_neg_input.size(); i += tester.size)
+        {
+            detail::load_vec(input, tester.digamma_neg_input, i);
+            vres = digamma(input);
+            detail::store_vec(vres, res, i);
+        }
+        tmp_success = check_almost_equal(topic, res, tester.digamma_neg_res, out);
+        success = success && tmp_success;
+
+        vector_type a_input;
+        vector_type b_input;
+
+        topic = "gamma_p                 : ";
+        for (size_t i = 0; i < tester.incomplete_x_input.size(); i += tester.size)
+        {
+            detail::load_vec(a_input, tester.incomplete_a_input, i);
+            detail::load_vec(input, tester.incomplete_x_input, i);
+            vres = gamma_p(a_input, input);
+            detail::store_vec(vres, res, i);
+        }
+        tmp_success = check_almost_equal(topic, res, tester.gamma_p_res, out);
+        success = success && tmp_success;
+
+        topic = "gamma_q                 : ";
+        for (size_t i = 0; i < tester.incomplete_x_input.size(); i += tester.size)
+        {
+            detail::load_vec(a_input, tester.incomplete_a_input, i);
+            detail::load_vec(input, tester.incomplete_x_input, i);
+            vres = gamma_q(a_input, input);
+            detail::store_vec(vres, res, i);
+        }
+        tmp_success = check_almost_equal(topic, res, tester.gamma_q_res, out);
+        success = success && tmp_success;
+
+        topic = "ibeta                   : ";
+        for (size_t i = 0; i < tester.beta_x_input.size(); i += tester.size)
+        {
+            detail::load_vec(a_input, tester.beta_a_input, i);
+            detail::load_vec(b_input, tester.incomplete_b_input, i);
+            detail::load_vec(input, tester.beta_x_input, i);
+            vres = ibeta(a_input, b_input, input);
+            detail::store_vec(vres, res, i);
+        }
+        tmp_success = check_almost_equal(topic, res, tester.ibeta_res, out);
+        success = success && tmp_success;
         return success;
     }
 }
@@ -0,0 +1,196 @@
+/***************************************************************************
+* Copyright (c) 2016, Johan Mabille and Sylvain Corlay                     *
+*                                                                          *
+* Distributed under the terms of the BSD 3-Clause License.                 *
+*                                                                          *
+* The full license is in the file LICENSE, distributed with this software. *
+****************************************************************************/
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "xsimd/algorithms/xsimd_fir.hpp"
+
+namespace xsimd
+{
+    namespace
+    {
+        template <class T>
+        std::vector<T> random_samples(std::size_t n, unsigned seed)
+        {
+            std::mt19937 generator(seed);
+            std::uniform_real_distribution<T> distribution(T(-1), T(1));
+            std::vector<T> res(n);
+            for (T& x : res)
+            {
+                x = distribution(generator);
+            }
+            return res;
+        }
+
+        // y[i] = h[0] * u[i] + ... + h[k - 1] * u[i - k + 1], where u is x
+        // with factor - 1 zeros inserted after each sample
+        template <class T>
+        std::vector<T> reference_filter(const std::vector<T>& h, const std::vector<T>& x, std::size_t factor)
+        {
+            std::vector<T> y(x.size() * factor);
+            for (std::size_t i = 0; i < y.size(); ++i)
+            {
+                double res = 0.;
+                for (std::size_t j = 0; j < h.size() && j <= i; ++j)
+                {
+                    res += (i - j) % factor == 0 ? static_cast<double>(h[j]) * static_cast<double>(x[(i - j) / factor]) : 0.;
+                }
+                y[i] = static_cast<T>(res);
+            }
+            return y;
+        }
+
+        // the stream is processed in blocks of various sizes
+        template <class F, class T>
+        std::size_t process_blocks(F& filter, const std::vector<T>& x, std::vector<T>& y)
+        {
+            std::size_t sizes[] = { 1, 7, 0, 64, 3, 5000, 31 };
+            std::size_t pos = 0, res = 0;
+            for (std::size_t b = 0; pos < x.size(); ++b)
+            {
+                std::size_t block = std::min(sizes[b % 7], x.size() - pos);
+                res += filter.process(block, x.data() + pos, y.data() + res);
+                pos += block;
+            }
+            return res;
+        }
+
+        template <class T>
+        struct interpolator_adaptor
+        {
+            fir_interpolator<T>& filter;
+
+            std::size_t process(std::size_t n, const T* in, T* out)
+            {
+                filter.process(n, in, out);
+                return n * filter.factor();
+            }
+        };
+
+        template <class T>
+        struct filter_adaptor
+        {
+            fir_filter<T>& filter;
+
+            std::size_t process(std::size_t n, const T* in, T* out)
+            {
+                filter.process(n, in, out);
+                return n;
+            }
+        };
+
+        template <class T>
+        T fir_tolerance(std::size_t num_taps)
+        {
+            return T(4) * std::numeric_limits<T>::epsilon() * static_cast<T>(num_taps + 1);
+        }
+
+        template <class T>
+        void check_fir_filter(std::size_t num_taps)
+        {
+            std::vector<T> h = random_samples<T>(num_taps, static_cast<unsigned>(num_taps));
+            std::vector<T> x = random_samples<T>(6000, 3);
+            std::vector<T> ref = reference_filter(h, x, 1);
+            fir_filter<T> filter(h.data(), num_taps);
+            filter_adaptor<T> adaptor{ filter };
+            std::vector<T> y(x.size());
+            EXPECT_EQ(process_blocks(adaptor, x, y), x.size());
+            for (std::size_t i = 0; i < x.size(); ++i)
+            {
+                EXPECT_NEAR(y[i], ref[i], fir_tolerance<T>(num_taps)) << "taps = " << num_taps << ", i = " << i;
+            }
+
+            // in place, after a reset
+            filter.reset();
+            y = x;
+            filter.process(y.size(), y.data(), y.data());
+            for (std::size_t i = 0; i < x.size(); ++i)
+            {
+                EXPECT_NEAR(y[i], ref[i], fir_tolerance<T>(num_taps)) << "taps = " << num_taps << ", i = " << i;
+            }
+        }
+
+        template <class T>
+        void check_fir_decimator(std::size_t num_taps, std::size_t factor)
+        {
+            std::vector<T> h = random_samples<T>(num_taps, static_cast<unsigned>(num_taps));
+            std::vector<T> x = random_samples<T>(6000, 5);
+            std::vector<T> ref = reference_filter(h, x, 1);
+            fir_decimator<T> decimator(h.data(), num_taps, factor);
+            std::vector<T> y(x.size() / factor + 8);
+            std::size_t count = process_blocks(decimator, x, y);
+            ASSERT_EQ(count, (x.size() + factor - 1) / factor);
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                EXPECT_NEAR(y[i], ref[i * factor], fir_tolerance<T>(num_taps)) << "taps = " << num_taps << ", factor = " << factor << ", i = " << i;
+            }
+        }
+
+        template <class T>
+        void check_fir_interpolator(std::size_t num_taps, std::size_t factor)
+        {
+            std::vector<T> h = random_samples<T>(num_taps, static_cast<unsigned>(num_taps));
+            std::vector<T> x = random_samples<T>(3000, 7);
+            std::vector<T> ref = reference_filter(h, x, factor);
+            fir_interpolator<T> interpolator(h.data(), num_taps, factor);
+            interpolator_adaptor<T> adaptor{ interpolator };
+            std::vector<T> y(x.size() * factor);
+            EXPECT_EQ(process_blocks(adaptor, x, y), y.size());
+            for (std::size_t i = 0; i < y.size(); ++i)
+            {
+                EXPECT_NEAR(y[i], ref[i], fir_tolerance<T>(num_taps)) << "taps = " << num_taps << ", factor = " << factor << ", i = " << i;
+            }
+        }
+    }
+
+    TEST(xsimd, fir_filter)
+    {
+        for (std::size_t num_taps : { 1, 2, 5, 8, 16, 17, 33, 100, 257 })
+        {
+            check_fir_filter<float>(num_taps);
+            check_fir_filter<double>(num_taps);
+        }
+
+        // a filter without coefficients outputs zeros
+        fir_filter<float> empty(nullptr, 0);
+        std::vector<float> x(100, 1.f);
+        empty.process(x.size(), x.data(), x.data());
+        EXPECT_EQ(x, std::vector<float>(100, 0.f));
+    }
+
+    TEST(xsimd, fir_decimator)
+    {
+        for (std::size_t num_taps : { 1, 7, 16, 31, 64, 129 })
+        {
+            for (std::size_t factor : { 1, 2, 3, 8 })
+            {
+                check_fir_decimator<float>(num_taps, factor);
+                check_fir_decimator<double>(num_taps, factor);
+            }
+        }
+    }
+
+    TEST(xsimd, fir_interpolator)
+    {
+        for (std::size_t num_taps : { 1, 7, 16, 31, 64, 129 })
+        {
+            for (std::size_t factor : { 1, 2, 5 })
+            {
+                check_fir_interpolator<float>(num_taps, factor);
+                check_fir_interpolator<double>(num_taps, factor);
+            }
+        }
+    }
+}
@@ -0,0 +1,116 @@
+/***************************************************************************
+* Copyright (c) 2016, Johan Mabille and Sylvain Corlay                     *
+*                                                                          *
+* Distributed under the terms of the BSD 3-Clause License.                 *
+*                                                                          *
+* The full license is in the file LICENSE, distributed with this software. *
+****************************************************************************/
+
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "xsimd/algorithms/xsimd_gemm.hpp"
+
+namespace xsimd
+{
+    namespace
+    {
+        // element (i, j) of a matrix with leading dimension ld
+        inline std::size_t matrix_index(matrix_layout layout, std::size_t i, std::size_t j, std::size_t ld)
+        {
+            return layout == matrix_layout::row_major ? i * ld + j : j * ld + i;
+        }
+
+        template <class T>
+        void check_gemm(matrix_layout layout, std::size_t m, std::size_t n, std::size_t k, T alpha, T beta,
+                        std::size_t num_threads)
+        {
+            bool row_major = layout == matrix_layout::row_major;
+            // leading dimensions larger than the matrices
+            std::size_t lda = (row_major ? k : m) + 3, ldb = (row_major ? n : k) + 1, ldc = (row_major ? n : m) + 2;
+            std::mt19937_64 generator(m * 10007 + n * 101 + k);
+            std::uniform_real_distribution<T> distribution(T(-1), T(1));
+            std::vector<T> a(lda * (row_major ? m : k) + 1), b(ldb * (row_major ? k : n) + 1);
+            std::vector<T> c(ldc * (row_major ? m : n) + 1, std::numeric_limits<T>::quiet_NaN());
+            for (T& x : a)
+            {
+                x = distribution(generator);
+            }
+            for (T& x : b)
+            {
+                x = distribution(generator);
+            }
+            if (beta != T(0))
+            {
+                for (T& x : c)
+                {
+                    x = distribution(generator);
+                }
+            }
+            std::vector<T> ref = c;
+            for (std::size_t i = 0; i < m; ++i)
+            {
+                for (std::size_t j = 0; j < n; ++j)
+                {
+                    double s = 0.;
+                    for (std::size_t p = 0; p < k; ++p)
+                    {
+                        s += double(a[matrix_index(layout, i, p, lda)]) * double(b[matrix_index(layout, p, j, ldb)]);
+                    }
+                    T& r = ref[matrix_index(layout, i, j, ldc)];
+                    r = static_cast<T>(double(alpha) * s + (beta == T(0) ? 0. : double(beta) * double(r)));
+                }
+            }
+
+            gemm(layout, m, n, k, alpha, a.data(), lda, b.data(), ldb, beta, c.data(), ldc, num_threads);
+            T tolerance = T(4) * std::numeric_limits<T>::epsilon() * static_cast<T>(k + 2);
+            for (std::size_t i = 0; i < c.size(); ++i)
+            {
+                // the padding between rows or columns is left untouched
+                if (std::isnan(ref[i]))
+                {
+                    EXPECT_TRUE(std::isnan(c[i])) << "m = " << m << ", n = " << n << ", k = " << k << ", i = " << i;
+                }
+                else
+                {
+                    EXPECT_NEAR(c[i], ref[i], tolerance) << "m = " << m << ", n = " << n << ", k = " << k << ", i = " << i;
+                }
+            }
+        }
+
+        template <class T>
+        void check_gemm_sizes()
+        {
+            const matrix_layout layouts[] = { matrix_layout::row_major, matrix_layout::column_major };
+            for (matrix_layout layout : layouts)
+            {
+                // edges of the tiles and of the cache blocks
+                const std::size_t sizes[][3] = { { 1, 1, 1 }, { 3, 5, 7 }, { 17, 33, 9 }, { 64, 64, 64 }, { 30, 100, 300 },
+                                                 { 200, 70, 257 }, { 5, 300, 2 }, { 0, 4, 4 }, { 4, 0, 4 }, { 4, 4, 0 } };
+                for (const auto& s : sizes)
+                {
+                    check_gemm<T>(layout, s[0], s[1], s[2], T(1), T(0), 1);
+                    check_gemm<T>(layout, s[0], s[1], s[2], T(-0.5), T(2), 1);
+                }
+                check_gemm<T>(layout, 50, 40, 30, T(0), T(0.5), 1);
+                check_gemm<T>(layout, 150, 37, 20, T(1.5), T(1), 3);
+                check_gemm<T>(layout, 13, 150, 20, T(1), T(0), 4);
+            }
+        }
+    }
+
+    TEST(xsimd, gemm_float)
+    {
+        check_gemm_sizes<float>();
+    }
+
+    TEST(xsimd, gemm_double)
+    {
+        check_gemm_sizes<double>();
+    }
+}
@@ -0,0 +1,141 @@
+/***************************************************************************
+* Copyright (c) 2016, Johan Mabille and Sylvain Corlay                     *
+*                                                                          *
+* Distributed under the terms of the BSD 3-Clause License.                 *
+*                                                                          *
+* The full license is in the file LICENSE, distributed with this software. *
+****************************************************************************/
+
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <stdexcept>
+#include <unordered_map>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "xsimd/algorithms/xsimd_hash_table.hpp"
+
+namespace xsimd
+{
+    namespace
+    {
+        template <class B>
+        void check_to_bitmask()
+        {
+            using T = typename B::value_type;
+            constexpr std::size_t size = B::size;
+            std::vector<T> lhs(size), rhs(size);
+            for (uint64_t pattern = 0; pattern < (uint64_t(1) << size); pattern += 1 + pattern / 7)
+            {
+                for (std::size_t i = 0; i < size; ++i)
+                {
+                    lhs[i] = T(i);
+                    rhs[i] = ((pattern >> i) & 1) ? T(i) : T(i + 1);
+                }
+                B x, y;
+                x.load_unaligned(lhs.data());
+                y.load_unaligned(rhs.data());
+                EXPECT_EQ(to_bitmask(x == y), pattern);
+            }
+        }
+
+        template <class K>
+        void check_flat_hash_map(std::size_t n)
+        {
+            flat_hash_map<K, int64_t> map;
+            std::unordered_map<K, int64_t> ref;
+            std::mt19937_64 generator(11);
+            std::vector<K> keys;
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                // small keys collide in the hash table groups
+                K key = static_cast<K>(i % 2 == 0 ? generator() : generator() % (2 * n));
+                if (key == map.empty_key())
+                {
+                    continue;
+                }
+                int64_t value = static_cast<int64_t>(i);
+                EXPECT_EQ(map.insert(key, value), ref.insert({ key, value }).second);
+                keys.push_back(key);
+            }
+            EXPECT_EQ(map.size(), ref.size());
+            EXPECT_LE(map.size(), map.capacity());
+            for (const auto& kv : ref)
+            {
+                const int64_t* v = map.find(kv.first);
+                ASSERT_NE(v, nullptr);
+                EXPECT_EQ(*v, kv.second);
+            }
+            // absent keys, including the empty key
+            std::vector<K> queries(keys);
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                queries.push_back(static_cast<K>(generator()));
+            }
+            queries.push_back(map.empty_key());
+            std::vector<int64_t> values(queries.size());
+            std::size_t count = map.find(queries.data(), queries.size(), values.data(), int64_t(-1));
+            std::size_t ref_count = 0;
+            for (std::size_t i = 0; i < queries.size(); ++i)
+            {
+                auto it = ref.find(queries[i]);
+                int64_t expected = it == ref.end() ? int64_t(-1) : it->second;
+                ref_count += it != ref.end();
+                EXPECT_EQ(values[i], expected);
+                EXPECT_EQ(map.contains(queries[i]), it != ref.end());
+            }
+            EXPECT_EQ(count, ref_count);
+
+            map[keys[0]] = 42;
+            EXPECT_EQ(*map.find(keys[0]), 42);
+            std::size_t size = map.size();
+            EXPECT_EQ(map[static_cast<K>(n + 12345)], 0);
+            EXPECT_EQ(map.size(), size + (ref.count(static_cast<K>(n + 12345)) == 0));
+
+            // the empty key is rejected in every build
+            size = map.size();
+            EXPECT_FALSE(map.insert(map.empty_key(), 1));
+            EXPECT_THROW(map[map.empty_key()], std::invalid_argument);
+            EXPECT_EQ(map.size(), size);
+            EXPECT_FALSE(map.contains(map.empty_key()));
+        }
+    }
+}
+
+TEST(xsimd, to_bitmask)
+{
+#if XSIMD_X86_INSTR_SET >= XSIMD_X86_SSE2_VERSION || XSIMD_ARM_INSTR_SET >= XSIMD_ARM7_NEON_VERSION
+    xsimd::check_to_bitmask<xsimd::batch<float, 4>>();
+    xsimd::check_to_bitmask<xsimd::batch<int32_t, 4>>();
+    xsimd::check_to_bitmask<xsimd::batch<int64_t, 2>>();
+#endif
+#if XSIMD_X86_INSTR_SET >= XSIMD_X86_SSE2_VERSION || XSIMD_ARM_INSTR_SET >= XSIMD_ARM8_64_NEON_VERSION
+    xsimd::check_to_bitmask<xsimd::batch<double, 2>>();
+#endif
+#if XSIMD_X86_INSTR_SET >= XSIMD_X86_AVX_VERSION
+    xsimd::check_to_bitmask<xsimd::batch<float, 8>>();
+    xsimd::check_to_bitmask<xsimd::batch<double, 4>>();
+    xsimd::check_to_bitmask<xsimd::batch<int32_t, 8>>();
+    xsimd::check_to_bitmask<xsimd::batch<int64_t, 4>>();
+#endif
+#if XSIMD_X86_INSTR_SET >= XSIMD_X86_AVX512_VERSION
+    xsimd::check_to_bitmask<xsimd::batch<float, 16>>();
+    xsimd::check_to_bitmask<xsimd::batch<double, 8>>();
+    xsimd::check_to_bitmask<xsimd::batch<int32_t, 16>>();
+    xsimd::check_to_bitmask<xsimd::batch<int64_t, 8>>();
+#endif
+#if defined(XSIMD_ENABLE_FALLBACK)
+    xsimd::check_to_bitmask<xsimd::batch<float, 7>>();
+    xsimd::check_to_bitmask<xsimd::batch<int64_t, 3>>();
+#endif
+}
+
+TEST(xsimd, flat_hash_map)
+{
+    xsimd::check_flat_hash_map<int32_t>(10);
+    xsimd::check_flat_hash_map<int32_t>(5000);
+    xsimd::check_flat_hash_map<int64_t>(3);
+    xsimd::check_flat_hash_map<int64_t>(5000);
+}
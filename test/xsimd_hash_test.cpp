@@ -0,0 +1,197 @@
+/***************************************************************************
+* Copyright (c) 2016, Johan Mabille and Sylvain Corlay                     *
+*                                                                          *
+* Distributed under the terms of the BSD 3-Clause License.                 *
+*                                                                          *
+* The full license is in the file LICENSE, distributed with this software. *
+****************************************************************************/
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <type_traits>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "xsimd/algorithms/xsimd_hash.hpp"
+
+namespace xsimd
+{
+    namespace
+    {
+        uint32_t multiply_xorshift_reference(uint32_t x)
+        {
+            x = (x ^ (x >> 16)) * 0x045d9f3bu;
+            x = (x ^ (x >> 16)) * 0x045d9f3bu;
+            return x ^ (x >> 16);
+        }
+
+        uint64_t multiply_xorshift_reference(uint64_t x)
+        {
+            x = (x ^ (x >> 32)) * 0xd6e8feb86659fd93ull;
+            x = (x ^ (x >> 32)) * 0xd6e8feb86659fd93ull;
+            return x ^ (x >> 32);
+        }
+
+        uint32_t fmix_reference(uint32_t h)
+        {
+            h ^= h >> 16;
+            h *= 0x85ebca6bu;
+            h ^= h >> 13;
+            h *= 0xc2b2ae35u;
+            h ^= h >> 16;
+            return h;
+        }
+
+        uint64_t fmix_reference(uint64_t k)
+        {
+            k ^= k >> 33;
+            k *= 0xff51afd7ed558ccdull;
+            k ^= k >> 33;
+            k *= 0xc4ceb9fe1a85ec53ull;
+            k ^= k >> 33;
+            return k;
+        }
+
+        // byte by byte, least significant byte first
+        template <class U>
+        uint32_t crc32c_reference(uint32_t crc, U x)
+        {
+            for (std::size_t i = 0; i < sizeof(U); ++i)
+            {
+                crc ^= static_cast<uint32_t>((x >> (8 * i)) & 0xffu);
+                for (int k = 0; k < 8; ++k)
+                {
+                    crc = (crc >> 1) ^ (0x82f63b78u & (0u - (crc & 1u)));
+                }
+            }
+            return crc;
+        }
+
+        template <class T>
+        std::vector<T> hash_inputs()
+        {
+            std::vector<T> res = { T(0), T(1), T(-1), T(42), std::numeric_limits<T>::min(), std::numeric_limits<T>::max() };
+            std::mt19937_64 generator(7);
+            for (std::size_t i = 0; i < 1024; ++i)
+            {
+                res.push_back(static_cast<T>(generator()));
+            }
+            return res;
+        }
+
+        template <class B>
+        void check_hash()
+        {
+            using T = typename B::value_type;
+            using U = typename std::make_unsigned<T>::type;
+            constexpr std::size_t size = B::size;
+            std::vector<T> input = hash_inputs<T>();
+            const uint32_t seed = 0x9e3779b9u;
+            for (std::size_t i = 0; i + size <= input.size(); i += size)
+            {
+                B x, y;
+                x.load_unaligned(&input[i]);
+                y.load_unaligned(&input[input.size() - size - i]);
+                B mxs = multiply_xorshift_hash(x), fm = murmur3_fmix(x), crc = crc32c_hash(x, seed), prod = x * y;
+                for (std::size_t j = 0; j < size; ++j)
+                {
+                    U v = static_cast<U>(input[i + j]);
+                    U w = static_cast<U>(input[input.size() - size - i + j]);
+                    EXPECT_EQ(static_cast<U>(mxs[j]), multiply_xorshift_reference(v)) << "multiply_xorshift_hash(" << v << ")";
+                    EXPECT_EQ(static_cast<U>(fm[j]), fmix_reference(v)) << "murmur3_fmix(" << v << ")";
+                    EXPECT_EQ(static_cast<U>(crc[j]), U(crc32c_reference(seed, v))) << "crc32c_hash(" << v << ")";
+                    EXPECT_EQ(static_cast<U>(prod[j]), U(v * w)) << v << " * " << w;
+                }
+            }
+        }
+
+        template <class T>
+        void check_hash_partition(std::size_t n, std::size_t num_partitions)
+        {
+            std::vector<T> keys = hash_inputs<T>();
+            keys.resize(n, T(3));
+            std::vector<T> ids(n), out_keys(n);
+            std::vector<std::size_t> offsets(num_partitions + 1);
+            hash_partition_ids(keys.data(), n, num_partitions, ids.data());
+            hash_partition(keys.data(), n, num_partitions, offsets.data(), out_keys.data());
+
+            std::vector<std::size_t> histogram(num_partitions, 0);
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                ASSERT_GE(ids[i], T(0));
+                ASSERT_LT(static_cast<std::size_t>(ids[i]), num_partitions);
+                ++histogram[static_cast<std::size_t>(ids[i])];
+            }
+            EXPECT_EQ(offsets[0], std::size_t(0));
+            EXPECT_EQ(offsets[num_partitions], n);
+            std::vector<std::size_t> cursor(offsets.begin(), offsets.end() - 1);
+            for (std::size_t p = 0; p < num_partitions; ++p)
+            {
+                EXPECT_EQ(offsets[p + 1] - offsets[p], histogram[p]) << "partition " << p;
+            }
+            // stable: the keys of each partition keep their input order
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                std::size_t p = static_cast<std::size_t>(ids[i]);
+                EXPECT_EQ(out_keys[cursor[p]++], keys[i]);
+            }
+        }
+    }
+}
+
+TEST(xsimd, crc32c_reference)
+{
+    // CRC32C("123456789") with the usual initial and final inversions
+    uint32_t crc = ~0u;
+    crc = xsimd::crc32c_reference(crc, uint64_t(0x3837363534333231ull));
+    crc = xsimd::crc32c_reference(crc, uint8_t('9'));
+    EXPECT_EQ(~crc, 0xe3069283u);
+}
+
+TEST(xsimd, hash)
+{
+#if XSIMD_X86_INSTR_SET >= XSIMD_X86_SSE2_VERSION || XSIMD_ARM_INSTR_SET >= XSIMD_ARM7_NEON_VERSION
+    xsimd::check_hash<xsimd::batch<int32_t, 4>>();
+    xsimd::check_hash<xsimd::batch<int64_t, 2>>();
+#endif
+#if XSIMD_X86_INSTR_SET >= XSIMD_X86_AVX_VERSION
+    xsimd::check_hash<xsimd::batch<int32_t, 8>>();
+    xsimd::check_hash<xsimd::batch<int64_t, 4>>();
+#endif
+#if XSIMD_X86_INSTR_SET >= XSIMD_X86_AVX512_VERSION
+    xsimd::check_hash<xsimd::batch<int32_t, 16>>();
+    xsimd::check_hash<xsimd::batch<int64_t, 8>>();
+#endif
+#if defined(XSIMD_ENABLE_FALLBACK)
+    xsimd::check_hash<xsimd::batch<int32_t, 7>>();
+    xsimd::check_hash<xsimd::batch<int64_t, 3>>();
+#endif
+}
+
+TEST(xsimd, hash_partition)
+{
+    xsimd::check_hash_partition<int32_t>(1000, 16);
+    xsimd::check_hash_partition<int32_t>(1023, 7);
+    xsimd::check_hash_partition<int32_t>(3, 65536);
+    xsimd::check_hash_partition<int64_t>(1001, 1);
+    xsimd::check_hash_partition<int64_t>(1030, 100);
+    xsimd::check_hash_partition<int64_t>(0, 4);
+}
+
+#ifdef NDEBUG
+// with 0 partitions, nothing is written; debug builds assert instead
+TEST(xsimd, hash_partition_none)
+{
+    std::vector<int32_t> keys = { 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+    std::vector<int32_t> ids(keys.size(), -1), out_keys(keys.size(), -1);
+    std::vector<std::size_t> offsets(1, 42);
+    xsimd::hash_partition_ids(keys.data(), keys.size(), 0, ids.data());
+    xsimd::hash_partition(keys.data(), keys.size(), 0, offsets.data(), out_keys.data());
+    EXPECT_EQ(ids, std::vector<int32_t>(keys.size(), -1));
+    EXPECT_EQ(out_keys, std::vector<int32_t>(keys.size(), -1));
+    EXPECT_EQ(offsets[0], std::size_t(42));
+}
+#endif
@@ -0,0 +1,155 @@
+/***************************************************************************
+* Copyright (c) 2016, Johan Mabille and Sylvain Corlay                     *
+*                                                                          *
+* Distributed under the terms of the BSD 3-Clause License.                 *
+*                                                                          *
+* The full license is in the file LICENSE, distributed with this software. *
+****************************************************************************/
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <random>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "xsimd/algorithms/xsimd_histogram.hpp"
+
+namespace xsimd
+{
+    namespace
+    {
+        template <class T>
+        std::vector<std::size_t> uniform_histogram_reference(const std::vector<T>& values, std::size_t bins, T lo, T hi)
+        {
+            std::vector<std::size_t> res(bins, 0);
+            for (T x : values)
+            {
+                if (x >= lo && x <= hi)
+                {
+                    T fi = std::floor((x - lo) * (T(bins) / (hi - lo)));
+                    ++res[std::min(static_cast<std::size_t>(fi), bins - 1)];
+                }
+            }
+            return res;
+        }
+
+        std::vector<std::size_t> uniform_histogram_reference(const std::vector<int32_t>& values, std::size_t bins, int32_t lo, int32_t hi)
+        {
+            std::vector<std::size_t> res(bins, 0);
+            uint64_t range = static_cast<uint64_t>(int64_t(hi) - int64_t(lo)) + 1;
+            for (int32_t x : values)
+            {
+                if (x >= lo && x <= hi)
+                {
+                    ++res[static_cast<std::size_t>(static_cast<uint64_t>(int64_t(x) - int64_t(lo)) * bins / range)];
+                }
+            }
+            return res;
+        }
+
+        template <class T>
+        std::vector<std::size_t> edges_histogram_reference(const std::vector<T>& values, const std::vector<T>& edges)
+        {
+            std::vector<std::size_t> res(edges.size() - 1, 0);
+            for (T x : values)
+            {
+                if (x >= edges.front() && x <= edges.back())
+                {
+                    std::size_t k = static_cast<std::size_t>(std::upper_bound(edges.begin(), edges.end(), x) - edges.begin()) - 1;
+                    ++res[std::min(k, edges.size() - 2)];
+                }
+            }
+            return res;
+        }
+
+        template <class T>
+        std::vector<T> histogram_values(std::size_t n, T lo, T hi)
+        {
+            std::mt19937_64 generator(17);
+            std::vector<T> res;
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                // a margin out of [lo, hi] on both sides
+                double u = double(generator() % 1200001) / 1000000. - 0.1;
+                res.push_back(static_cast<T>(double(lo) + u * (double(hi) - double(lo))));
+            }
+            res.push_back(lo);
+            res.push_back(hi);
+            // runs of equal values
+            res.insert(res.end(), 100, res[0]);
+            return res;
+        }
+
+        template <class T>
+        void check_histogram(std::size_t bins, T lo, T hi)
+        {
+            std::vector<T> values = histogram_values<T>(10007, lo, hi);
+            std::vector<std::size_t> counts(bins, 42);
+            std::size_t total = histogram(values.data(), values.size(), bins, lo, hi, counts.data());
+            std::vector<std::size_t> expected = uniform_histogram_reference(values, bins, lo, hi);
+            EXPECT_EQ(counts, expected) << bins << " bins over [" << lo << ", " << hi << "]";
+            EXPECT_EQ(total, std::accumulate(expected.begin(), expected.end(), std::size_t(0)));
+
+            // every value of the uniform bins edges
+            std::vector<T> edges;
+            for (std::size_t k = 0; k <= bins; ++k)
+            {
+                edges.push_back(static_cast<T>(double(lo) + double(k) * (double(hi) - double(lo)) / double(bins)));
+            }
+            edges.erase(std::unique(edges.begin(), edges.end()), edges.end());
+            if (edges.size() >= 2)
+            {
+                std::vector<T> edge_values(values);
+                edge_values.insert(edge_values.end(), edges.begin(), edges.end());
+                counts.assign(edges.size() - 1, 42);
+                total = histogram(edge_values.data(), edge_values.size(), edges.data(), edges.size(), counts.data());
+                expected = edges_histogram_reference(edge_values, edges);
+                EXPECT_EQ(counts, expected) << edges.size() << " edges over [" << lo << ", " << hi << "]";
+                EXPECT_EQ(total, std::accumulate(expected.begin(), expected.end(), std::size_t(0)));
+            }
+        }
+    }
+}
+
+TEST(xsimd, histogram)
+{
+    const std::size_t bin_counts[] = { 1, 2, 3, 7, 16, 100, 1000 };
+    for (std::size_t bins : bin_counts)
+    {
+        xsimd::check_histogram<float>(bins, -1.5f, 3.25f);
+        xsimd::check_histogram<double>(bins, 0., 1e6);
+        xsimd::check_histogram<int32_t>(bins, -20, 1000);
+        xsimd::check_histogram<int32_t>(bins, std::numeric_limits<int32_t>::min(), std::numeric_limits<int32_t>::max());
+    }
+    // one bin per value
+    xsimd::check_histogram<int32_t>(256, 0, 255);
+    xsimd::check_histogram<int32_t>(1 << 22, -(1 << 30), 1 << 30);
+}
+
+TEST(xsimd, histogram_nan)
+{
+    std::vector<float> values = { 0.5f, std::numeric_limits<float>::quiet_NaN(), 1.5f, -std::numeric_limits<float>::infinity(),
+                                  std::numeric_limits<float>::infinity(), 2.f, 2.5f, 0.f, 1.f };
+    std::vector<std::size_t> counts(4);
+    EXPECT_EQ(xsimd::histogram(values.data(), values.size(), std::size_t(4), 0.f, 2.f, counts.data()), std::size_t(5));
+    EXPECT_EQ(counts, (std::vector<std::size_t>{ 1, 1, 1, 2 }));
+    std::vector<float> edges = { 0.f, 1.f, 1.25f, 2.f };
+    counts.assign(3, 0);
+    EXPECT_EQ(xsimd::histogram(values.data(), values.size(), edges.data(), edges.size(), counts.data()), std::size_t(5));
+    EXPECT_EQ(counts, (std::vector<std::size_t>{ 2, 1, 2 }));
+}
+
+TEST(xsimd, histogram_no_bin)
+{
+    std::vector<float> values = { 0.5f, 1.5f, 2.f };
+    std::vector<std::size_t> counts(1, 7);
+    EXPECT_EQ(xsimd::histogram(values.data(), values.size(), std::size_t(0), 0.f, 2.f, counts.data()), std::size_t(0));
+    EXPECT_EQ(xsimd::histogram(values.data(), values.size(), values.data(), std::size_t(1), counts.data()), std::size_t(0));
+    EXPECT_EQ(xsimd::histogram(values.data(), values.size(), values.data(), std::size_t(0), counts.data()), std::size_t(0));
+    EXPECT_EQ(counts[0], std::size_t(7));
+}
@@ -0,0 +1,165 @@
+/***************************************************************************
+* Copyright (c) 2016, Johan Mabille and Sylvain Corlay                     *
+*                                                                          *
+* Distributed under the terms of the BSD 3-Clause License.                 *
+*                                                                          *
+* The full license is in the file LICENSE, distributed with this software. *
+****************************************************************************/
+
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "xsimd/algorithms/xsimd_lut_interpolator.hpp"
+
+namespace xsimd
+{
+    namespace
+    {
+        // piecewise linear interpolation of table, in double precision
+        template <class T>
+        double lut_reference(const std::vector<T>& table, double x_min, double x_max, bool clamp, double x)
+        {
+            std::size_t size = table.size();
+            double u = (x - x_min) * double(size - 1) / (x_max - x_min);
+            if (clamp)
+            {
+                u = std::min(std::max(u, 0.), double(size - 1));
+            }
+            double fi = std::min(std::max(std::floor(u), 0.), double(size - 2));
+            std::size_t i = static_cast<std::size_t>(fi);
+            return double(table[i]) + (u - fi) * (double(table[i + 1]) - double(table[i]));
+        }
+
+        template <class B>
+        void check_lut_interpolator(std::size_t size, bool clamp)
+        {
+            using T = typename B::value_type;
+            constexpr std::size_t bsize = B::size;
+            const T x_min = T(-2.5), x_max = T(4);
+            std::vector<T> table(size);
+            for (std::size_t i = 0; i < size; ++i)
+            {
+                table[i] = T(std::sin(0.7 * double(i)) * 10.);
+            }
+            lut_interpolator<T> lut(table.data(), size, x_min, x_max, clamp);
+
+            // nodes, points in between and out of the domain
+            std::vector<T> x;
+            for (std::size_t i = 0; i < 40 * size; ++i)
+            {
+                x.push_back(T(-4. + 9. * double(i) / double(40 * size)));
+            }
+            for (std::size_t i = 0; i < size; ++i)
+            {
+                x.push_back(T(x_min + (x_max - x_min) * T(i) / T(size - 1)));
+            }
+            x.push_back(x_min);
+            x.push_back(x_max);
+            while (x.size() % bsize != 0)
+            {
+                x.push_back(T(0));
+            }
+
+            std::vector<T> res(x.size());
+            lut(x.data(), x.size(), res.data());
+            // the rounding error of the position is amplified by the slopes
+            const double tolerance = 100. * double(std::numeric_limits<T>::epsilon()) * double(size + 10);
+            for (std::size_t i = 0; i < x.size(); i += bsize)
+            {
+                B bx, bres;
+                bx.load_unaligned(&x[i]);
+                bres = lut(bx);
+                for (std::size_t j = 0; j < bsize; ++j)
+                {
+                    double expected = lut_reference(table, x_min, x_max, clamp, double(x[i + j]));
+                    EXPECT_NEAR(double(bres[j]), expected, tolerance) << "size " << size << ", x = " << x[i + j];
+                    EXPECT_NEAR(double(res[i + j]), expected, tolerance) << "size " << size << ", x = " << x[i + j];
+                    EXPECT_NEAR(double(lut(x[i + j])), expected, tolerance) << "size " << size << ", x = " << x[i + j];
+                }
+            }
+
+            B nan(std::numeric_limits<T>::quiet_NaN());
+            EXPECT_TRUE(all(isnan(lut(nan))));
+            EXPECT_TRUE(std::isnan(lut(std::numeric_limits<T>::quiet_NaN())));
+        }
+
+        template <class B>
+        void check_lut_interpolator()
+        {
+            // sizes around the permute limits of every instruction set
+            const std::size_t sizes[] = { 2, 3, 4, 5, 8, 9, 16, 17, 32, 33, 1000 };
+            for (std::size_t size : sizes)
+            {
+                check_lut_interpolator<B>(size, true);
+                check_lut_interpolator<B>(size, false);
+            }
+        }
+
+        // fewer than two values give a constant table
+        template <class B>
+        void check_lut_interpolator_constant()
+        {
+            using T = typename B::value_type;
+            const T value = T(3.5);
+            lut_interpolator<T> one(&value, 1, T(-1), T(1), false);
+            lut_interpolator<T> none(&value, 0, T(-1), T(1), true);
+            EXPECT_EQ(one.size(), std::size_t(2));
+            const T x[] = { T(-100), T(-1), T(0), T(0.3), T(1), T(100) };
+            for (T v : x)
+            {
+                EXPECT_EQ(one(v), value) << "x = " << v;
+                EXPECT_EQ(none(v), T(0)) << "x = " << v;
+                EXPECT_TRUE(all(one(B(v)) == B(value))) << "x = " << v;
+                EXPECT_TRUE(all(none(B(v)) == B(T(0)))) << "x = " << v;
+            }
+        }
+    }
+}
+
+TEST(xsimd, lut_interpolator)
+{
+#if XSIMD_X86_INSTR_SET >= XSIMD_X86_SSE2_VERSION || XSIMD_ARM_INSTR_SET >= XSIMD_ARM7_NEON_VERSION
+    xsimd::check_lut_interpolator<xsimd::batch<float, 4>>();
+#endif
+#if XSIMD_X86_INSTR_SET >= XSIMD_X86_SSE2_VERSION || XSIMD_ARM_INSTR_SET >= XSIMD_ARM8_64_NEON_VERSION
+    xsimd::check_lut_interpolator<xsimd::batch<double, 2>>();
+#endif
+#if XSIMD_X86_INSTR_SET >= XSIMD_X86_AVX_VERSION
+    xsimd::check_lut_interpolator<xsimd::batch<float, 8>>();
+    xsimd::check_lut_interpolator<xsimd::batch<double, 4>>();
+#endif
+#if XSIMD_X86_INSTR_SET >= XSIMD_X86_AVX512_VERSION
+    xsimd::check_lut_interpolator<xsimd::batch<float, 16>>();
+    xsimd::check_lut_interpolator<xsimd::batch<double, 8>>();
+#endif
+#if defined(XSIMD_ENABLE_FALLBACK)
+    xsimd::check_lut_interpolator<xsimd::batch<float, 7>>();
+    xsimd::check_lut_interpolator<xsimd::batch<double, 3>>();
+#endif
+}
+
+TEST(xsimd, lut_interpolator_constant)
+{
+#if XSIMD_X86_INSTR_SET >= XSIMD_X86_SSE2_VERSION || XSIMD_ARM_INSTR_SET >= XSIMD_ARM7_NEON_VERSION
+    xsimd::check_lut_interpolator_constant<xsimd::batch<float, 4>>();
+#endif
+#if XSIMD_X86_INSTR_SET >= XSIMD_X86_SSE2_VERSION || XSIMD_ARM_INSTR_SET >= XSIMD_ARM8_64_NEON_VERSION
+    xsimd::check_lut_interpolator_constant<xsimd::batch<double, 2>>();
+#endif
+#if XSIMD_X86_INSTR_SET >= XSIMD_X86_AVX_VERSION
+    xsimd::check_lut_interpolator_constant<xsimd::batch<float, 8>>();
+    xsimd::check_lut_interpolator_constant<xsimd::batch<double, 4>>();
+#endif
+#if XSIMD_X86_INSTR_SET >= XSIMD_X86_AVX512_VERSION
+    xsimd::check_lut_interpolator_constant<xsimd::batch<float, 16>>();
+    xsimd::check_lut_interpolator_constant<xsimd::batch<double, 8>>();
+#endif
+#if defined(XSIMD_ENABLE_FALLBACK)
+    xsimd::check_lut_interpolator_constant<xsimd::batch<float, 7>>();
+    xsimd::check_lut_interpolator_constant<xsimd::batch<double, 3>>();
+#endif
+}
@@ -0,0 +1,163 @@
+/***************************************************************************
+* Copyright (c) 2016, Johan Mabille and Sylvain Corlay                     *
+*                                                                          *
+* Distributed under the terms of the BSD 3-Clause License.                 *
+*                                                                          *
+* The full license is in the file LICENSE, distributed with this software. *
+****************************************************************************/
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "xsimd/algorithms/xsimd_parse.hpp"
+#include "xsimd/memory/xsimd_aligned_allocator.hpp"
+
+namespace xsimd
+{
+    namespace
+    {
+        template <class T>
+        using parse_vector = std::vector<T, aligned_allocator<T, XSIMD_DEFAULT_ALIGNMENT>>;
+
+        template <class T>
+        bool parse_string(const std::string& s, char delimiter, parse_vector<T>& res)
+        {
+            res.clear();
+            return parse_numbers(s.data(), s.size(), delimiter, res);
+        }
+
+        template <class T>
+        void check_integers(std::size_t n)
+        {
+            std::mt19937_64 generator(static_cast<unsigned>(n));
+            std::vector<T> values(n);
+            std::string text;
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                // all the lengths, and the bounds
+                uint64_t r = generator();
+                std::size_t digits = 1 + r % std::numeric_limits<T>::digits10;
+                T x = static_cast<T>(static_cast<int64_t>(generator() >> (64 - 3 * digits - 1)) * ((r >> 32) % 2 == 0 ? 1 : -1));
+                x = i % 50 == 7 ? std::numeric_limits<T>::max() : (i % 50 == 8 ? std::numeric_limits<T>::min() : x);
+                values[i] = x;
+                std::string field = std::to_string(x);
+                field.insert(x < 0 ? 1 : 0, i % 13 == 5 ? "000" : "");
+                text += (i % 11 == 3 && x >= 0 ? "+" : "") + field;
+                text += i + 1 < n || n % 2 == 0 ? "," : "";
+            }
+            parse_vector<T> res;
+            EXPECT_TRUE(parse_string(text, ',', res)) << "n = " << n;
+            EXPECT_EQ(std::vector<T>(res.begin(), res.end()), values) << "n = " << n;
+        }
+
+        void check_doubles(const std::vector<std::string>& fields, char delimiter)
+        {
+            std::string text;
+            for (const std::string& field : fields)
+            {
+                text += field;
+                text += delimiter;
+            }
+            parse_vector<double> res;
+            EXPECT_TRUE(parse_string(text, delimiter, res));
+            ASSERT_EQ(res.size(), fields.size());
+            for (std::size_t i = 0; i < fields.size(); ++i)
+            {
+                double ref = std::strtod(fields[i].c_str(), nullptr);
+                EXPECT_TRUE(res[i] == ref && std::signbit(res[i]) == std::signbit(ref)) << fields[i] << " " << res[i];
+            }
+        }
+    }
+
+    TEST(xsimd, parse_integers)
+    {
+        for (std::size_t n : { 0, 1, 2, 5, 20, 100, 1000 })
+        {
+            check_integers<int32_t>(n);
+            check_integers<int64_t>(n);
+        }
+
+        parse_vector<int32_t> res32;
+        EXPECT_TRUE(parse_string("-0\n+7\n00000000000000000000000012\n", '\n', res32));
+        EXPECT_EQ(res32.size(), std::size_t(3));
+        EXPECT_EQ(res32[2], 12);
+        EXPECT_TRUE(parse_string("", ',', res32));
+        EXPECT_TRUE(res32.empty());
+
+        const char* invalid[] = { ",", "1,,2", "1,2,,", "2147483648", "-2147483649", "12a", "1.5", "-", "+",
+                                  "1 ", " 1", "1-2", "--1", "99999999999", "1,2,x" };
+        for (const char* s : invalid)
+        {
+            EXPECT_FALSE(parse_string(s, ',', res32)) << s;
+        }
+        EXPECT_FALSE(parse_string("1,2,x", ',', res32));
+        EXPECT_EQ(res32.size(), std::size_t(2));
+
+        parse_vector<int64_t> res64;
+        EXPECT_TRUE(parse_string("-9223372036854775808;9223372036854775807", ';', res64));
+        EXPECT_EQ(res64[0], std::numeric_limits<int64_t>::min());
+        EXPECT_EQ(res64[1], std::numeric_limits<int64_t>::max());
+        EXPECT_FALSE(parse_string("9223372036854775808", ';', res64));
+        EXPECT_FALSE(parse_string("-9223372036854775809", ';', res64));
+        EXPECT_FALSE(parse_string("12345678901234567890", ';', res64));
+
+        // a long field spanning several blocks, and an invalid character in a later block
+        std::string text = std::string(100, '0') + "42," + std::string(70, '1');
+        EXPECT_FALSE(parse_string(text, ',', res64));
+        text = std::string(100, '0') + "42," + std::string(70, '0') + "x1";
+        EXPECT_FALSE(parse_string(text, ',', res64));
+        text = std::string(100, '0') + "42," + std::string(70, '0') + "1";
+        EXPECT_TRUE(parse_string(text, ',', res64));
+        EXPECT_EQ(res64.size(), std::size_t(2));
+    }
+
+    TEST(xsimd, parse_doubles)
+    {
+        check_doubles({ "0", "-0", "1", "-1.5", "3.14159", ".5", "5.", "+2.5e3", "1e22", "1e23", "1E-22", "-0.0",
+                        "123456789012345678", "9007199254740993", "12345678901234567890123", "0.1", "0.30000000000000004",
+                        "1.7976931348623157e308", "1e308", "1e309", "-1e400", "4.9e-324", "2.4703282292062328e-324",
+                        "2.4703282292062327e-324", "2.2250738585072011e-308", "1e-400", "0000000000000000000000.0001",
+                        "0.000000000000000000000000000000001234", "123.456e-7", "7e+0", "1.00000000000000011102230246251565404236316680908203125",
+                        "1.00000000000000011102230246251565404236316680908203124", "100000000000000000000000000000000000001e-38" },
+                      ',');
+
+        // random doubles printed with 17 digits, and random short decimals
+        std::mt19937_64 generator(31);
+        std::vector<std::string> fields;
+        char buffer[64];
+        for (std::size_t i = 0; i < 2000; ++i)
+        {
+            double x;
+            uint64_t bits = generator();
+            std::memcpy(&x, &bits, sizeof(x));
+            if (std::isfinite(x))
+            {
+                std::snprintf(buffer, sizeof(buffer), "%.17g", x);
+                fields.push_back(buffer);
+            }
+            std::snprintf(buffer, sizeof(buffer), "%.*f", static_cast<int>(generator() % 9),
+                          static_cast<double>(static_cast<int64_t>(generator() % 2000000) - 1000000) / 1000.);
+            fields.push_back(buffer);
+            std::snprintf(buffer, sizeof(buffer), "%.*e", static_cast<int>(generator() % 20), std::ldexp(static_cast<double>(generator() % 1000000), static_cast<int>(generator() % 200) - 100));
+            fields.push_back(buffer);
+        }
+        check_doubles(fields, '\n');
+
+        parse_vector<double> res;
+        const char* invalid[] = { ".", "e5", "1e", "1e+", "1.2.3", "1e5e5", "--1", "+-1", "inf", "nan", "0x10", "1,,2", " 1", "1 " };
+        for (const char* s : invalid)
+        {
+            EXPECT_FALSE(parse_string(s, ',', res)) << s;
+        }
+    }
+}
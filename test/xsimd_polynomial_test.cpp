@@ -0,0 +1,154 @@
+/***************************************************************************
+* Copyright (c) 2016, Johan Mabille and Sylvain Corlay                     *
+*                                                                          *
+* Distributed under the terms of the BSD 3-Clause License.                 *
+*                                                                          *
+* The full license is in the file LICENSE, distributed with this software. *
+****************************************************************************/
+
+#include <cstddef>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "xsimd/xsimd.hpp"
+
+namespace xsimd
+{
+    // Coefficients are 1, 2, ..., 10 and inputs are small dyadic numbers so
+    // that the reference value can be computed exactly. Inputs other than
+    // -1, 0 and 1 are needed to catch a wrong ordering of the coefficients.
+    template <class B>
+    struct polynomial_tester
+    {
+        using value_type = typename B::value_type;
+        static constexpr std::size_t size = B::size;
+        static constexpr std::size_t nb_values = 8;
+
+        std::vector<value_type> input;
+
+        polynomial_tester()
+            : input(((nb_values + size - 1) / size) * size)
+        {
+            const value_type values[nb_values] = { value_type(-1), value_type(0), value_type(1), value_type(2),
+                                                   value_type(0.5), value_type(3), value_type(-2), value_type(-0.5) };
+            for (std::size_t i = 0; i < input.size(); ++i)
+            {
+                input[i] = values[i % nb_values];
+            }
+        }
+
+        static value_type reference(value_type x, std::size_t nb_coefs, bool leading_one)
+        {
+            value_type res = leading_one ? value_type(1) : value_type(nb_coefs);
+            std::size_t nb = leading_one ? nb_coefs : nb_coefs - 1;
+            for (std::size_t i = nb; i > 0; --i)
+            {
+                res = res * x + value_type(i);
+            }
+            return res;
+        }
+    };
+
+    template <class B, class F>
+    void check_polynomial(F f, std::size_t nb_coefs, bool leading_one = false)
+    {
+        polynomial_tester<B> t;
+        for (std::size_t i = 0; i < t.input.size(); i += B::size)
+        {
+            B res = f(load_unaligned(&t.input[i]));
+            for (std::size_t j = 0; j < B::size; ++j)
+            {
+                EXPECT_EQ(res[j], t.reference(t.input[i + j], nb_coefs, leading_one))
+                    << "degree " << nb_coefs - 1 << ", x = " << t.input[i + j];
+            }
+        }
+    }
+
+    TEST(xsimd, estrin_float)
+    {
+        using batch_type = simd_type<float>;
+        check_polynomial<batch_type>([](const batch_type& x) { return estrin<batch_type, 0x3f800000>(x); }, 1);
+        check_polynomial<batch_type>([](const batch_type& x) { return estrin<batch_type, 0x3f800000, 0x40000000>(x); }, 2);
+        check_polynomial<batch_type>([](const batch_type& x) { return estrin<batch_type, 0x3f800000, 0x40000000, 0x40400000>(x); }, 3);
+        check_polynomial<batch_type>([](const batch_type& x) { return estrin<batch_type, 0x3f800000, 0x40000000, 0x40400000, 0x40800000,
+                                                                             0x40a00000, 0x40c00000, 0x40e00000>(x); }, 7);
+        check_polynomial<batch_type>([](const batch_type& x) { return estrin<batch_type, 0x3f800000, 0x40000000, 0x40400000, 0x40800000,
+                                                                             0x40a00000, 0x40c00000, 0x40e00000, 0x41000000,
+                                                                             0x41100000, 0x41200000>(x); }, 10);
+        check_polynomial<batch_type>([](const batch_type& x) { return estrin1<batch_type, 0x3f800000, 0x40000000, 0x40400000, 0x40800000>(x); }, 4, true);
+    }
+
+    TEST(xsimd, estrin_double)
+    {
+        using batch_type = simd_type<double>;
+        check_polynomial<batch_type>([](const batch_type& x) { return estrin<batch_type, 0x3ff0000000000000ull, 0x4000000000000000ull>(x); }, 2);
+        check_polynomial<batch_type>([](const batch_type& x) { return estrin<batch_type, 0x3ff0000000000000ull, 0x4000000000000000ull, 0x4008000000000000ull,
+                                                                             0x4010000000000000ull, 0x4014000000000000ull>(x); }, 5);
+        check_polynomial<batch_type>([](const batch_type& x) { return estrin<batch_type, 0x3ff0000000000000ull, 0x4000000000000000ull, 0x4008000000000000ull,
+                                                                             0x4010000000000000ull, 0x4014000000000000ull, 0x4018000000000000ull,
+                                                                             0x401c000000000000ull, 0x4020000000000000ull, 0x4022000000000000ull>(x); }, 9);
+        check_polynomial<batch_type>([](const batch_type& x) { return estrin1<batch_type, 0x3ff0000000000000ull, 0x4000000000000000ull, 0x4008000000000000ull,
+                                                                              0x4010000000000000ull, 0x4014000000000000ull>(x); }, 5, true);
+    }
+
+    TEST(xsimd, polynomial_schemes_float)
+    {
+        using batch_type = simd_type<float>;
+        // degrees covering the Horner, second order Horner and Estrin schemes
+        check_polynomial<batch_type>([](const batch_type& x) { return polynomial<batch_type, 0x3f800000>(x); }, 1);
+        check_polynomial<batch_type>([](const batch_type& x) { return polynomial1<batch_type>(x); }, 0, true);
+        check_polynomial<batch_type>([](const batch_type& x) { return polynomial<batch_type, 0x3f800000, 0x40000000, 0x40400000>(x); }, 3);
+        check_polynomial<batch_type>([](const batch_type& x) { return polynomial<batch_type, 0x3f800000, 0x40000000, 0x40400000, 0x40800000,
+                                                                                 0x40a00000, 0x40c00000, 0x40e00000>(x); }, 7);
+        check_polynomial<batch_type>([](const batch_type& x) { return polynomial<batch_type, 0x3f800000, 0x40000000, 0x40400000, 0x40800000,
+                                                                                 0x40a00000, 0x40c00000, 0x40e00000, 0x41000000,
+                                                                                 0x41100000, 0x41200000>(x); }, 10);
+        check_polynomial<batch_type>([](const batch_type& x) { return polynomial1<batch_type, 0x3f800000, 0x40000000, 0x40400000, 0x40800000,
+                                                                                  0x40a00000, 0x40c00000>(x); }, 6, true);
+    }
+
+    TEST(xsimd, polynomial_schemes_double)
+    {
+        using batch_type = simd_type<double>;
+        // degrees covering the Horner, second order Horner and Estrin schemes
+        check_polynomial<batch_type>([](const batch_type& x) { return polynomial<batch_type, 0x3ff0000000000000ull, 0x4000000000000000ull, 0x4008000000000000ull>(x); }, 3);
+        check_polynomial<batch_type>([](const batch_type& x) { return polynomial<batch_type, 0x3ff0000000000000ull, 0x4000000000000000ull, 0x4008000000000000ull,
+                                                                                 0x4010000000000000ull, 0x4014000000000000ull, 0x4018000000000000ull,
+                                                                                 0x401c000000000000ull>(x); }, 7);
+        check_polynomial<batch_type>([](const batch_type& x) { return polynomial<batch_type, 0x3ff0000000000000ull, 0x4000000000000000ull, 0x4008000000000000ull,
+                                                                                 0x4010000000000000ull, 0x4014000000000000ull, 0x4018000000000000ull,
+                                                                                 0x401c000000000000ull, 0x4020000000000000ull, 0x4022000000000000ull,
+                                                                                 0x4024000000000000ull>(x); }, 10);
+        check_polynomial<batch_type>([](const batch_type& x) { return polynomial1<batch_type, 0x3ff0000000000000ull, 0x4000000000000000ull, 0x4008000000000000ull,
+                                                                                  0x4010000000000000ull, 0x4014000000000000ull, 0x4018000000000000ull>(x); }, 6, true);
+    }
+
+    TEST(xsimd, chebyshev)
+    {
+        using batch_type = simd_type<double>;
+        polynomial_tester<batch_type> t;
+        for (std::size_t i = 0; i < t.input.size(); i += batch_type::size)
+        {
+            batch_type x = load_unaligned(&t.input[i]);
+            batch_type res = chebyshev<batch_type, 0x3ff0000000000000ull, 0x4000000000000000ull, 0x4008000000000000ull,
+                                       0x4010000000000000ull, 0x4014000000000000ull>(x);
+            for (std::size_t j = 0; j < batch_type::size; ++j)
+            {
+                // 1 T0 + 2 T1 + ... + 5 T4, with T(k + 1) = 2 x T(k) - T(k - 1)
+                double xi = t.input[i + j];
+                double tk = 1., tk1 = xi, ref = 1. + 2. * xi;
+                for (std::size_t k = 2; k < 5; ++k)
+                {
+                    double tk2 = 2. * xi * tk1 - tk;
+                    ref += double(k + 1) * tk2;
+                    tk = tk1;
+                    tk1 = tk2;
+                }
+                EXPECT_EQ(res[j], ref) << "x = " << xi;
+            }
+        }
+        batch_type constant = chebyshev<batch_type, 0x4008000000000000ull>(batch_type(0.5));
+        EXPECT_EQ(constant[0], 3.);
+    }
+}
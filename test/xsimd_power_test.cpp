@@ -6,13 +6,17 @@
 * The full license is in the file LICENSE, distributed with this software. *
 ****************************************************************************/
 
+#include <cmath>
 #include <fstream>
 #include <iostream>
+#include <limits>
+#include <vector>
 
 #include "gtest/gtest.h"
 
 #include "xsimd/math/xsimd_power.hpp"
 #include "xsimd/memory/xsimd_aligned_allocator.hpp"
+#include "xsimd/types/xsimd_traits.hpp"
 #include "xsimd/types/xsimd_types_include.hpp"
 #include "xsimd_power_test.hpp"
 
@@ -105,4 +109,72 @@ TEST(xsimd, fallback_double_power)
     bool res = xsimd::test_power<double, 3, 32>(out, "fallback double");
     EXPECT_TRUE(res);
 }
-#endif
\ No newline at end of file
+#endif
+
+namespace xsimd
+{
+    // negative integer exponents whose result is subnormal while x^|n|
+    // overflows, or whose result is finite while x^|n| underflows
+    template <class T>
+    void check_ipow_subnormal_result()
+    {
+        using b_type = simd_type<T>;
+        constexpr std::size_t size = simd_traits<T>::size;
+        constexpr int n = std::numeric_limits<T>::min_exponent - 10;
+        std::vector<T> v = { T(2.), T(-2.), T(1.), T(-1.), T(0.5), T(4.), T(2.01), T(-2.02), T(0.55), T(1.5) };
+        v.resize((v.size() + size - 1) / size * size, T(2.));
+        for (std::size_t i = 0; i < v.size(); i += size)
+        {
+            b_type x = b_type(&v[i], unaligned_mode());
+            b_type r = pow(x, n);
+            b_type rc = pow<n>(x);
+            for (std::size_t k = 0; k < size; ++k)
+            {
+                T ref = std::pow(v[i + k], T(n));
+                if (std::isfinite(ref))
+                {
+                    // the addition chain accumulates up to |n| roundings
+                    T tolerance = std::abs(ref) * T(-n) * std::numeric_limits<T>::epsilon() + std::numeric_limits<T>::denorm_min();
+                    EXPECT_NEAR(r[k], ref, tolerance) << "pow(" << v[i + k] << ", " << n << ")";
+                    EXPECT_NEAR(rc[k], ref, tolerance) << "pow<" << n << ">(" << v[i + k] << ")";
+                }
+                else
+                {
+                    EXPECT_EQ(r[k], ref) << "pow(" << v[i + k] << ", " << n << ")";
+                    EXPECT_EQ(rc[k], ref) << "pow<" << n << ">(" << v[i + k] << ")";
+                }
+            }
+        }
+        EXPECT_EQ(pow(b_type(T(2.)), n)[0], std::ldexp(T(1.), n));
+    }
+
+    TEST(xsimd, ipow_subnormal_result)
+    {
+        check_ipow_subnormal_result<float>();
+        check_ipow_subnormal_result<double>();
+    }
+
+    // the magnitude of the minimum exponent overflows its signed type
+    template <class T>
+    void check_ipow_min_exponent()
+    {
+        using b_type = simd_type<T>;
+        constexpr int n = std::numeric_limits<int>::min();
+        const T inf = std::numeric_limits<T>::infinity();
+        const T v[] = { T(1.), T(-1.), T(2.), T(-2.), T(0.5), T(0.) };
+        const T ref[] = { T(1.), T(1.), T(0.), T(0.), inf, inf };
+        for (std::size_t i = 0; i < 6; ++i)
+        {
+            b_type x(v[i]);
+            EXPECT_EQ(pow(x, n)[0], ref[i]) << "pow(" << v[i] << ", " << n << ")";
+            EXPECT_EQ(pow<n>(x)[0], ref[i]) << "pow<" << n << ">(" << v[i] << ")";
+            EXPECT_EQ(pow(x, std::numeric_limits<int64_t>::min())[0], ref[i]) << "pow(" << v[i] << ", INT64_MIN)";
+        }
+    }
+
+    TEST(xsimd, ipow_min_exponent)
+    {
+        check_ipow_min_exponent<float>();
+        check_ipow_min_exponent<double>();
+    }
+}
@@ -27,6 +27,12 @@ namespace xsimd
         res_type lhs;
         res_type rhs;
         res_type pow_res;
+        res_type large_lhs;
+        res_type large_rhs;
+        res_type large_pow_res;
+        res_type ipow_res;
+        res_type ipow_neg_res;
+        res_type ipow5_res;
         res_type cbrt_res;
         res_type hypot_res;
 
@@ -41,6 +47,12 @@ namespace xsimd
         lhs.resize(nb_input);
         rhs.resize(nb_input);
         pow_res.resize(nb_input);
+        large_lhs.resize(nb_input);
+        large_rhs.resize(nb_input);
+        large_pow_res.resize(nb_input);
+        ipow_res.resize(nb_input);
+        ipow_neg_res.resize(nb_input);
+        ipow5_res.resize(nb_input);
         cbrt_res.resize(nb_input);
         hypot_res.resize(nb_input);
         for (size_t i = 0; i < nb_input; ++i)
@@ -48,6 +60,13 @@ namespace xsimd
             lhs[i] = value_type(i) / 4 + value_type(1.2) * std::sqrt(value_type(i + 0.25));
             rhs[i] = value_type(10.2) / (i + 2) + value_type(0.25);
             pow_res[i] = std::pow(lhs[i], rhs[i]);
+            // results close to the overflow threshold
+            large_lhs[i] = value_type(1) + value_type(i) / nb_input;
+            large_rhs[i] = std::log(std::numeric_limits<value_type>::max()) / std::log(value_type(2)) * value_type(i % 97 + 3) / value_type(100);
+            large_pow_res[i] = std::pow(large_lhs[i], large_rhs[i]);
+            ipow_res[i] = std::pow(lhs[i], value_type(3));
+            ipow_neg_res[i] = std::pow(lhs[i], value_type(-2));
+            ipow5_res[i] = std::pow(large_lhs[i], value_type(5));
             cbrt_res[i] = std::cbrt(lhs[i]);
             hypot_res[i] = std::hypot(lhs[i], rhs[i]);
         }
@@ -91,6 +110,47 @@ namespace xsimd
         tmp_success = check_almost_equal(topic, res, tester.pow_res, out);
         success = success && tmp_success;
 
+        topic = "pow (large result)   : ";
+        for (size_t i = 0; i < tester.large_lhs.size(); i += tester.size)
+        {
+            detail::load_vec(lhs, tester.large_lhs, i);
+            detail::load_vec(rhs, tester.large_rhs, i);
+            vres = pow(lhs, rhs);
+            detail::store_vec(vres, res, i);
+        }
+        tmp_success = check_almost_equal(topic, res, tester.large_pow_res, out);
+        success = success && tmp_success;
+
+        topic = "pow(x, 3)            : ";
+        for (size_t i = 0; i < tester.lhs.size(); i += tester.size)
+        {
+            detail::load_vec(lhs, tester.lhs, i);
+            vres = pow(lhs, 3);
+            detail::store_vec(vres, res, i);
+        }
+        tmp_success = check_almost_equal(topic, res, tester.ipow_res, out);
+        success = success && tmp_success;
+
+        topic = "pow(x, -2)           : ";
+        for (size_t i = 0; i < tester.lhs.size(); i += tester.size)
+        {
+            detail::load_vec(lhs, tester.lhs, i);
+            vres = pow(lhs, -2);
+            detail::store_vec(vres, res, i);
+        }
+        tmp_success = check_almost_equal(topic, res, tester.ipow_neg_res, out);
+        success = success && tmp_success;
+
+        topic = "pow<5>(x)            : ";
+        for (size_t i = 0; i < tester.large_lhs.size(); i += tester.size)
+        {
+            detail::load_vec(lhs, tester.large_lhs, i);
+            vres = pow<5>(lhs);
+            detail::store_vec(vres, res, i);
+        }
+        tmp_success = check_almost_equal(topic, res, tester.ipow5_res, out);
+        success = success && tmp_success;
+
         topic = "hypot   : ";
         for (size_t i = 0; i < tester.lhs.size(); i += tester.size)
         {
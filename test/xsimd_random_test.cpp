@@ -0,0 +1,328 @@
+/***************************************************************************
+* Copyright (c) 2016, Johan Mabille and Sylvain Corlay                     *
+*                                                                          *
+* Distributed under the terms of the BSD 3-Clause License.                 *
+*                                                                          *
+* The full license is in the file LICENSE, distributed with this software. *
+****************************************************************************/
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "xsimd/random/xsimd_distribution.hpp"
+
+namespace xsimd
+{
+    namespace
+    {
+        using bits_type = simd_type<int64_t>;
+        constexpr std::size_t bits_size = simd_traits<int64_t>::size;
+
+        // 32-bit words of a batch of random bits, in memory order
+        std::array<uint32_t, 2 * bits_size> words(const bits_type& b)
+        {
+            alignas(bits_type) std::array<int64_t, bits_size> tmp;
+            b.store_aligned(tmp.data());
+            std::array<uint32_t, 2 * bits_size> res;
+            std::memcpy(res.data(), tmp.data(), sizeof(tmp));
+            return res;
+        }
+
+        std::array<uint64_t, bits_size> lanes(const bits_type& b)
+        {
+            alignas(bits_type) std::array<int64_t, bits_size> tmp;
+            b.store_aligned(tmp.data());
+            std::array<uint64_t, bits_size> res;
+            std::memcpy(res.data(), tmp.data(), sizeof(tmp));
+            return res;
+        }
+
+        // first block of the first lane
+        std::array<uint32_t, 4> philox_block(philox4x32& engine)
+        {
+            std::array<uint32_t, 4> res;
+            for (std::size_t i = 0; i < 4; ++i)
+            {
+                res[i] = words(engine())[0];
+            }
+            return res;
+        }
+
+        void reference_philox4x32_10(uint32_t (&ctr)[4], uint32_t k0, uint32_t k1)
+        {
+            for (std::size_t r = 0; r < 10; ++r)
+            {
+                uint64_t p0 = uint64_t(0xD2511F53u) * ctr[0];
+                uint64_t p1 = uint64_t(0xCD9E8D57u) * ctr[2];
+                uint32_t c0 = static_cast<uint32_t>(p1 >> 32) ^ ctr[1] ^ k0;
+                uint32_t c2 = static_cast<uint32_t>(p0 >> 32) ^ ctr[3] ^ k1;
+                ctr[0] = c0;
+                ctr[1] = static_cast<uint32_t>(p1);
+                ctr[2] = c2;
+                ctr[3] = static_cast<uint32_t>(p0);
+                k0 += 0x9E3779B9u;
+                k1 += 0xBB67AE85u;
+            }
+        }
+
+        uint64_t reference_xoshiro256plus(uint64_t (&s)[4])
+        {
+            uint64_t result = s[0] + s[3];
+            uint64_t t = s[1] << 17;
+            s[2] ^= s[0];
+            s[3] ^= s[1];
+            s[1] ^= s[2];
+            s[0] ^= s[3];
+            s[2] ^= t;
+            s[3] = (s[3] << 45) | (s[3] >> 19);
+            return result;
+        }
+    }
+
+    TEST(xsimd, philox4x32_known_answers)
+    {
+        // Random123 known answer tests
+        philox4x32 e0(0, 0);
+        std::array<uint32_t, 4> r0 = { { 0x6627e8d5u, 0xe169c58du, 0xbc57ac4cu, 0x9b00dbd8u } };
+        EXPECT_EQ(philox_block(e0), r0);
+
+        philox4x32 e1(0xffffffffffffffffull, 0xffffffffffffffffull);
+        e1.set_counter(0xffffffffffffffffull);
+        std::array<uint32_t, 4> r1 = { { 0x408f276du, 0x41c83b0eu, 0xa20bc7c6u, 0x6d5451fdu } };
+        EXPECT_EQ(philox_block(e1), r1);
+
+        philox4x32 e2(0x299f31d0a4093822ull, 0x0370734413198a2eull);
+        e2.set_counter(0x85a308d3243f6a88ull);
+        std::array<uint32_t, 4> r2 = { { 0xd16cfe09u, 0x94fdccebu, 0x5001e420u, 0x24126ea1u } };
+        EXPECT_EQ(philox_block(e2), r2);
+    }
+
+    TEST(xsimd, philox4x32_lanes)
+    {
+        // every lane against a scalar reference; half of the words have
+        // their top bit set, which the products of the rounds must handle
+        // as unsigned
+        const uint64_t seed = 0x299f31d0a4093822ull;
+        const uint64_t stream = 0x0370734413198a2eull;
+        for (uint64_t counter : { 0x85a308d3243f6a88ull, 0x00000000fffffffeull })
+        {
+            philox4x32 engine(seed, stream);
+            engine.set_counter(counter);
+            std::array<uint32_t, 2 * bits_size> res[4];
+            for (std::size_t k = 0; k < 4; ++k)
+            {
+                res[k] = words(engine());
+            }
+            std::size_t top_bits = 0;
+            for (std::size_t i = 0; i < 2 * bits_size; ++i)
+            {
+                uint64_t c = counter + i;
+                uint32_t ctr[4] = { static_cast<uint32_t>(c), static_cast<uint32_t>(c >> 32),
+                                    static_cast<uint32_t>(stream), static_cast<uint32_t>(stream >> 32) };
+                reference_philox4x32_10(ctr, static_cast<uint32_t>(seed), static_cast<uint32_t>(seed >> 32));
+                for (std::size_t k = 0; k < 4; ++k)
+                {
+                    EXPECT_EQ(res[k][i], ctr[k]) << "lane " << i << ", word " << k;
+                    top_bits += ctr[k] >> 31;
+                }
+            }
+            EXPECT_GT(top_bits, std::size_t(0));
+        }
+    }
+
+    TEST(xsimd, philox4x32_discard)
+    {
+        for (uint64_t n : { 0u, 1u, 3u, 4u, 7u, 13u, 64u })
+        {
+            philox4x32 e0(42, 3), e1(42, 3);
+            e0();
+            e1();
+            for (uint64_t i = 0; i < n; ++i)
+            {
+                e0();
+            }
+            e1.discard(n);
+            EXPECT_EQ(lanes(e0()), lanes(e1())) << "n = " << n;
+            EXPECT_EQ(lanes(e0()), lanes(e1())) << "n = " << n;
+        }
+    }
+
+    TEST(xsimd, philox4x32_streams)
+    {
+        philox4x32 e0(42, 0), e1(42, 1);
+        EXPECT_NE(lanes(e0()), lanes(e1()));
+    }
+
+    TEST(xsimd, xoshiro256plus_lanes)
+    {
+        uint64_t x = 12345;
+        uint64_t s[4];
+        for (std::size_t k = 0; k < 4; ++k)
+        {
+            s[k] = detail::splitmix64(x);
+        }
+
+        // lane j starts j jumps after lane 0
+        uint64_t ls[bits_size][4];
+        std::array<uint64_t, 4> js = { { s[0], s[1], s[2], s[3] } };
+        for (std::size_t j = 0; j < bits_size; ++j)
+        {
+            std::copy(js.begin(), js.end(), ls[j]);
+            detail::xoshiro256_jump(js, detail::xoshiro256_jump_table);
+        }
+
+        xoshiro256plus engine(12345);
+        std::size_t top_bits = 0;
+        for (std::size_t i = 0; i < 100; ++i)
+        {
+            auto res = lanes(engine());
+            for (std::size_t j = 0; j < bits_size; ++j)
+            {
+                uint64_t expected = reference_xoshiro256plus(ls[j]);
+                EXPECT_EQ(res[j], expected) << "i = " << i << ", lane " << j;
+                top_bits += expected >> 63;
+            }
+            for (std::size_t j = 1; j < bits_size; ++j)
+            {
+                EXPECT_NE(res[j], res[0]);
+            }
+        }
+        EXPECT_GT(top_bits, std::size_t(0));
+
+        xoshiro256plus e0(7), e1(7);
+        e1.jump();
+        EXPECT_NE(lanes(e0()), lanes(e1()));
+        e0.long_jump();
+        EXPECT_NE(lanes(e0()), lanes(e1()));
+    }
+
+    template <class T>
+    struct moments
+    {
+        T min;
+        T max;
+        double mean;
+        double variance;
+    };
+
+    template <class T>
+    moments<T> compute_moments(const std::vector<T>& v)
+    {
+        moments<T> res = { v[0], v[0], 0., 0. };
+        for (T x : v)
+        {
+            res.min = std::min(res.min, x);
+            res.max = std::max(res.max, x);
+            res.mean += x;
+        }
+        res.mean /= v.size();
+        for (T x : v)
+        {
+            res.variance += (x - res.mean) * (x - res.mean);
+        }
+        res.variance /= v.size();
+        return res;
+    }
+
+    template <class T, class E>
+    void check_distributions()
+    {
+        const std::size_t n = 1000003;
+        std::vector<T> v(n);
+        E engine(2024);
+
+        uniform_distribution<T> ud(T(-2), T(3));
+        ud.fill(engine, v.data(), n);
+        moments<T> mu = compute_moments(v);
+        EXPECT_GE(mu.min, T(-2));
+        EXPECT_LT(mu.max, T(3));
+        EXPECT_NEAR(mu.mean, 0.5, 0.01);
+        EXPECT_NEAR(mu.variance, 25. / 12., 0.01);
+
+        normal_distribution<T> nd(T(1), T(2));
+        nd.fill(engine, v.data(), n);
+        moments<T> mn = compute_moments(v);
+        EXPECT_NEAR(mn.mean, 1., 0.01);
+        EXPECT_NEAR(mn.variance, 4., 0.04);
+        std::size_t tail = 0;
+        for (T x : v)
+        {
+            tail += std::abs(x - T(1)) > T(2 * 1.959963984540054) ? 1 : 0;
+        }
+        EXPECT_NEAR(double(tail) / n, 0.05, 0.002);
+
+        exponential_distribution<T> ed(T(4));
+        ed.fill(engine, v.data(), n);
+        moments<T> me = compute_moments(v);
+        EXPECT_GE(me.min, T(0));
+        EXPECT_TRUE(std::isfinite(me.max));
+        EXPECT_NEAR(me.mean, 0.25, 0.002);
+        EXPECT_NEAR(me.variance, 1. / 16., 0.002);
+    }
+
+    TEST(xsimd, random_distributions)
+    {
+        check_distributions<float, philox4x32>();
+        check_distributions<double, philox4x32>();
+        check_distributions<float, xoshiro256plus>();
+        check_distributions<double, xoshiro256plus>();
+    }
+
+    // returns all the bits set, the largest unit uniform value
+    struct ones_engine
+    {
+        using result_type = simd_type<int64_t>;
+
+        result_type operator()()
+        {
+            return result_type(int64_t(-1));
+        }
+    };
+
+    template <class T>
+    void check_uniform_upper_bound(T a, T b)
+    {
+        ones_engine engine;
+        uniform_distribution<T> ud(a, b);
+        simd_type<T> r = ud(engine);
+        for (std::size_t i = 0; i < simd_traits<T>::size; ++i)
+        {
+            EXPECT_LT(r[i], b) << "[" << a << ", " << b << ")";
+            EXPECT_GE(r[i], a) << "[" << a << ", " << b << ")";
+        }
+    }
+
+    TEST(xsimd, random_uniform_upper_bound)
+    {
+        check_uniform_upper_bound<float>(1e8f, 1e8f + 8.f);
+        check_uniform_upper_bound<float>(-2.f, 3.f);
+        check_uniform_upper_bound<double>(1e17, 1e17 + 64.);
+        check_uniform_upper_bound<double>(-2., 3.);
+    }
+
+    TEST(xsimd, random_fill_tail)
+    {
+        using b_type = simd_type<double>;
+        constexpr std::size_t size = simd_traits<double>::size;
+        const std::size_t n = 3 * size + 1;
+        std::vector<double> v(n);
+        philox4x32 e0(5), e1(5);
+        normal_distribution<double> d0, d1;
+        d0.fill(e0, v.data(), n);
+        for (std::size_t i = 0; i < n; i += size)
+        {
+            b_type b = d1(e1);
+            for (std::size_t j = 0; j < size && i + j < n; ++j)
+            {
+                EXPECT_EQ(v[i + j], b[j]);
+            }
+        }
+    }
+}
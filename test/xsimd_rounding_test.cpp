@@ -6,8 +6,12 @@
 * The full license is in the file LICENSE, distributed with this software. *
 ****************************************************************************/
 
+#include <cmath>
+#include <cstdint>
 #include <fstream>
 #include <iostream>
+#include <limits>
+#include <vector>
 
 #include "gtest/gtest.h"
 
@@ -24,6 +28,97 @@ namespace xsimd
         simd_rounding_tester<T, N, A> tester(name);
         return test_simd_rounding(out, tester);
     }
+
+    namespace
+    {
+        // scalar reference of the saturated conversions
+        template <class I, class T, class F>
+        I saturated_reference(T x, F round)
+        {
+            if (std::isnan(x))
+            {
+                return I(0);
+            }
+            T r = round(x);
+            if (r >= -T(std::numeric_limits<I>::min()))
+            {
+                return std::numeric_limits<I>::max();
+            }
+            if (r <= T(std::numeric_limits<I>::min()))
+            {
+                return std::numeric_limits<I>::min();
+            }
+            return static_cast<I>(r);
+        }
+
+        template <class B>
+        void check_rounded_conversions(const std::vector<typename B::value_type>& input)
+        {
+            using T = typename B::value_type;
+            using I = typename as_integer_t<B>::value_type;
+            constexpr std::size_t size = B::size;
+            using round_type = T (*)(T);
+            round_type nearest = std::nearbyint;
+            round_type down = std::floor;
+            round_type up = std::ceil;
+            round_type zero = std::trunc;
+            for (std::size_t i = 0; i + size <= input.size(); i += size)
+            {
+                B x;
+                x.load_unaligned(&input[i]);
+                as_integer_t<B> rn = to_int_nearest_sat(x), rf = to_int_floor_sat(x), rc = to_int_ceil_sat(x), rt = to_int_sat(x);
+                for (std::size_t j = 0; j < size; ++j)
+                {
+                    T v = input[i + j];
+                    EXPECT_EQ(rn[j], saturated_reference<I>(v, nearest)) << "to_int_nearest_sat(" << v << ")";
+                    EXPECT_EQ(rf[j], saturated_reference<I>(v, down)) << "to_int_floor_sat(" << v << ")";
+                    EXPECT_EQ(rc[j], saturated_reference<I>(v, up)) << "to_int_ceil_sat(" << v << ")";
+                    EXPECT_EQ(rt[j], saturated_reference<I>(v, zero)) << "to_int_sat(" << v << ")";
+                }
+                if (all(abs(x) < B(T(1e9))))
+                {
+                    rn = to_int_nearest(x);
+                    rf = to_int_floor(x);
+                    rc = to_int_ceil(x);
+                    for (std::size_t j = 0; j < size; ++j)
+                    {
+                        T v = input[i + j];
+                        EXPECT_EQ(rn[j], static_cast<I>(std::nearbyint(v))) << "to_int_nearest(" << v << ")";
+                        EXPECT_EQ(rf[j], static_cast<I>(std::floor(v))) << "to_int_floor(" << v << ")";
+                        EXPECT_EQ(rc[j], static_cast<I>(std::ceil(v))) << "to_int_ceil(" << v << ")";
+                    }
+                }
+            }
+        }
+
+        template <class T>
+        std::vector<T> rounded_conversion_inputs(std::size_t size, T large)
+        {
+            const T inf = std::numeric_limits<T>::infinity();
+            // in range values, with halfway cases and mixed signs in a batch
+            std::vector<T> res = { T(2.5), T(-2.5), T(3.5), T(-0.5), T(0.5), T(1.7), T(-1.7), T(0.),
+                                   T(-3.2), T(123456.75), T(-98765.25), T(7.), T(-1e8), T(1e8), T(-0.), T(4.5) };
+            // out of range values, each tested in an otherwise in range batch
+            std::vector<T> out = { std::numeric_limits<T>::quiet_NaN(), inf, -inf, large, -large,
+                                   T(2147483648.), T(-2147483648.), T(1e30), T(-1e30), T(3e9), T(-3e9) };
+            for (T v : out)
+            {
+                for (std::size_t j = 0; j < size; ++j)
+                {
+                    res.push_back(j == size / 2 ? v : T(1.5) - T(j));
+                }
+            }
+            return res;
+        }
+
+        template <class B>
+        void check_rounded_conversions()
+        {
+            using T = typename B::value_type;
+            T large = sizeof(T) == 4 ? T(2147483520.) : T(9223372036854774784.);
+            check_rounded_conversions<B>(rounded_conversion_inputs<T>(B::size, large));
+        }
+    }
 }
 
 #if XSIMD_X86_INSTR_SET >= XSIMD_X86_SSE2_VERSION
@@ -105,4 +200,26 @@ TEST(xsimd, fallback_double_rounding)
     bool res = xsimd::test_rounding<double, 3, 32>(out, "fallback double");
     EXPECT_TRUE(res);
 }
-#endif
\ No newline at end of file
+#endif
+
+TEST(xsimd, rounded_conversions)
+{
+#if XSIMD_X86_INSTR_SET >= XSIMD_X86_SSE2_VERSION || XSIMD_ARM_INSTR_SET >= XSIMD_ARM7_NEON_VERSION
+    xsimd::check_rounded_conversions<xsimd::batch<float, 4>>();
+#endif
+#if XSIMD_X86_INSTR_SET >= XSIMD_X86_SSE2_VERSION || XSIMD_ARM_INSTR_SET >= XSIMD_ARM8_64_NEON_VERSION
+    xsimd::check_rounded_conversions<xsimd::batch<double, 2>>();
+#endif
+#if XSIMD_X86_INSTR_SET >= XSIMD_X86_AVX_VERSION
+    xsimd::check_rounded_conversions<xsimd::batch<float, 8>>();
+    xsimd::check_rounded_conversions<xsimd::batch<double, 4>>();
+#endif
+#if XSIMD_X86_INSTR_SET >= XSIMD_X86_AVX512_VERSION
+    xsimd::check_rounded_conversions<xsimd::batch<float, 16>>();
+    xsimd::check_rounded_conversions<xsimd::batch<double, 8>>();
+#endif
+#if defined(XSIMD_ENABLE_FALLBACK)
+    xsimd::check_rounded_conversions<xsimd::batch<float, 7>>();
+    xsimd::check_rounded_conversions<xsimd::batch<double, 3>>();
+#endif
+}
@@ -0,0 +1,200 @@
+/***************************************************************************
+* Copyright (c) 2016, Johan Mabille and Sylvain Corlay                     *
+*                                                                          *
+* Distributed under the terms of the BSD 3-Clause License.                 *
+*                                                                          *
+* The full license is in the file LICENSE, distributed with this software. *
+****************************************************************************/
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "xsimd/algorithms/xsimd_sparse.hpp"
+
+namespace xsimd
+{
+    namespace
+    {
+        // rows of random lengths up to max_length, a fourth of them empty
+        template <class T>
+        csr_matrix<T> random_csr(std::size_t num_rows, std::size_t num_cols, std::size_t max_length, unsigned seed)
+        {
+            std::mt19937 generator(seed);
+            std::uniform_real_distribution<T> distribution(T(-1), T(1));
+            std::vector<std::size_t> offsets(1, 0);
+            std::vector<int32_t> columns;
+            std::vector<T> values;
+            for (std::size_t i = 0; i < num_rows; ++i)
+            {
+                std::size_t length = generator() % 4 == 0 ? 0 : generator() % (max_length + 1);
+                for (std::size_t k = 0; k < length; ++k)
+                {
+                    columns.push_back(static_cast<int32_t>(generator() % num_cols));
+                    values.push_back(distribution(generator));
+                }
+                offsets.push_back(columns.size());
+            }
+            return csr_matrix<T>(num_rows, num_cols, offsets, columns, values);
+        }
+
+        template <class T>
+        std::vector<T> reference_product(const csr_matrix<T>& a, const std::vector<T>& x)
+        {
+            std::vector<T> y(a.num_rows());
+            for (std::size_t i = 0; i < a.num_rows(); ++i)
+            {
+                T res = T(0);
+                for (std::size_t j = a.row_offsets()[i]; j < a.row_offsets()[i + 1]; ++j)
+                {
+                    res += a.values()[j] * x[a.columns()[j]];
+                }
+                y[i] = res;
+            }
+            return y;
+        }
+
+        template <class T>
+        void check_spmv(std::size_t num_rows, std::size_t num_cols, std::size_t max_length)
+        {
+            csr_matrix<T> a = random_csr<T>(num_rows, num_cols, max_length, static_cast<unsigned>(num_rows + max_length));
+            std::mt19937 generator(7);
+            std::uniform_real_distribution<T> distribution(T(-1), T(1));
+            std::vector<T> x(num_cols);
+            for (T& v : x)
+            {
+                v = distribution(generator);
+            }
+            std::vector<T> ref = reference_product(a, x);
+            T tolerance = T(4) * std::numeric_limits<T>::epsilon() * static_cast<T>(max_length + 1);
+
+            for (std::size_t num_threads : { 1, 3 })
+            {
+                std::vector<T> y(num_rows, T(-7));
+                a.multiply(x.data(), y.data(), num_threads);
+                for (std::size_t i = 0; i < num_rows; ++i)
+                {
+                    EXPECT_NEAR(y[i], ref[i], tolerance) << "csr, rows = " << num_rows << ", i = " << i;
+                }
+                for (std::size_t sigma : { 1, 7, 64 })
+                {
+                    sell_matrix<T> s(a, sigma);
+                    EXPECT_EQ(s.num_nonzeros(), a.num_nonzeros());
+                    EXPECT_EQ(s.num_chunks() * sell_matrix<T>::chunk_size >= num_rows, true);
+                    EXPECT_GE(s.storage_size(), a.num_nonzeros());
+                    y.assign(num_rows, T(-7));
+                    s.multiply(x.data(), y.data(), num_threads);
+                    for (std::size_t i = 0; i < num_rows; ++i)
+                    {
+                        EXPECT_NEAR(y[i], ref[i], tolerance) << "sell, sigma = " << sigma << ", rows = " << num_rows << ", i = " << i;
+                    }
+                }
+            }
+        }
+
+        template <class T>
+        void check_spmv_infinity()
+        {
+            // the padding of the short rows must not read the infinity
+            std::vector<std::size_t> offsets = { 0, 3, 4, 4, 5, 6 };
+            std::vector<int32_t> columns = { 0, 1, 2, 2, 0, 1 };
+            std::vector<T> values = { T(1), T(2), T(3), T(4), T(5), T(6) };
+            csr_matrix<T> a(5, 3, offsets, columns, values);
+            std::vector<T> x = { T(1), T(1), std::numeric_limits<T>::infinity() };
+            std::vector<T> ref = { std::numeric_limits<T>::infinity(), std::numeric_limits<T>::infinity(), T(0), T(5), T(6) };
+            std::vector<T> y(5);
+            a.multiply(x.data(), y.data());
+            EXPECT_EQ(y, ref);
+            for (std::size_t sigma : { 1, 4 })
+            {
+                sell_matrix<T> s(a, sigma);
+                std::fill(y.begin(), y.end(), T(-1));
+                s.multiply(x.data(), y.data());
+                EXPECT_EQ(y, ref) << "sigma = " << sigma;
+            }
+        }
+    }
+
+    TEST(xsimd, sparse_spmv)
+    {
+        check_spmv<float>(0, 1, 4);
+        check_spmv<double>(0, 1, 4);
+        for (std::size_t num_rows : { 1, 3, 17, 100, 1000 })
+        {
+            for (std::size_t max_length : { 3, 12, 40 })
+            {
+                check_spmv<float>(num_rows, 300, max_length);
+                check_spmv<double>(num_rows, 300, max_length);
+            }
+        }
+        check_spmv_infinity<float>();
+        check_spmv_infinity<double>();
+    }
+
+    TEST(xsimd, sparse_matrix_market)
+    {
+        std::istringstream general("%%MatrixMarket matrix coordinate real general\n"
+                                   "% a comment\n"
+                                   "%\n"
+                                   "3 4 5\n"
+                                   "3 4 1.5\n"
+                                   "1 1 -2\n"
+                                   "1 3 4e-1\n"
+                                   "3 1 7\n"
+                                   "1 1 1\n");
+        csr_matrix<double> a;
+        ASSERT_TRUE(read_matrix_market(general, a));
+        EXPECT_EQ(a.num_rows(), std::size_t(3));
+        EXPECT_EQ(a.num_cols(), std::size_t(4));
+        EXPECT_EQ(a.num_nonzeros(), std::size_t(4));
+        EXPECT_EQ(std::vector<std::size_t>(a.row_offsets(), a.row_offsets() + 4), (std::vector<std::size_t>{ 0, 2, 2, 4 }));
+        EXPECT_EQ(std::vector<int32_t>(a.columns(), a.columns() + 4), (std::vector<int32_t>{ 0, 2, 0, 3 }));
+        EXPECT_EQ(std::vector<double>(a.values(), a.values() + 4), (std::vector<double>{ -1., 0.4, 7., 1.5 }));
+
+        std::istringstream symmetric("%%MatrixMarket MATRIX Coordinate Integer Symmetric\n"
+                                     "2 2 2\n"
+                                     "1 1 3\n"
+                                     "2 1 5\n");
+        csr_matrix<float> b;
+        ASSERT_TRUE(read_matrix_market(symmetric, b));
+        EXPECT_EQ(b.num_nonzeros(), std::size_t(3));
+        EXPECT_EQ(std::vector<float>(b.values(), b.values() + 3), (std::vector<float>{ 3.f, 5.f, 5.f }));
+
+        std::istringstream skew("%%MatrixMarket matrix coordinate pattern skew-symmetric\n"
+                                "3 3 1\n"
+                                "3 2\n");
+        ASSERT_TRUE(read_matrix_market(skew, b));
+        EXPECT_EQ(std::vector<int32_t>(b.columns(), b.columns() + 2), (std::vector<int32_t>{ 2, 1 }));
+        EXPECT_EQ(std::vector<float>(b.values(), b.values() + 2), (std::vector<float>{ -1.f, 1.f }));
+
+        const char* invalid[] = { "",
+                                  "%%MatrixMarket matrix array real general\n2 2\n1\n2\n3\n4\n",
+                                  "%%MatrixMarket matrix coordinate complex general\n1 1 1\n1 1 1 0\n",
+                                  "%%MatrixMarket matrix coordinate real hermitian\n1 1 1\n1 1 1\n",
+                                  "%%MatrixMarket matrix coordinate real general\n2 2 2\n1 1 1\n",
+                                  "%%MatrixMarket matrix coordinate real general\n2 2 1\n3 1 1\n",
+                                  "%%MatrixMarket matrix coordinate real general\n2 2 1\n0 1 1\n",
+                                  "%%MatrixMarket matrix coordinate real general\n2 2 1\n1 1 x\n",
+                                  "%%MatrixMarket matrix coordinate real symmetric\n3 2 1\n3 1 1\n",
+                                  "%%MatrixMarket matrix coordinate real general\n2 2 18446744073709551615\n1 1 1\n",
+                                  "%%MatrixMarket matrix coordinate real symmetric\n2 2 9223372036854775807\n1 1 1\n",
+                                  "%%MatrixMarket matrix coordinate real general\n18446744073709551615 1 1\n1 1 1\n",
+                                  "%%MatrixMarket matrix coordinate real general\n2147483648 1 1\n1 1 1\n",
+                                  "%%MatrixMarket matrix coordinate real general\n1 2147483648 1\n1 1 1\n",
+                                  "2 2 1\n1 1 1\n" };
+        for (const char* s : invalid)
+        {
+            std::istringstream in(s);
+            EXPECT_FALSE(read_matrix_market(in, b)) << s;
+        }
+        EXPECT_EQ(b.num_nonzeros(), std::size_t(2));
+    }
+}
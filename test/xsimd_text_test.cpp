@@ -0,0 +1,240 @@
+/***************************************************************************
+* Copyright (c) 2016, Johan Mabille and Sylvain Corlay                     *
+*                                                                          *
+* Distributed under the terms of the BSD 3-Clause License.                 *
+*                                                                          *
+* The full license is in the file LICENSE, distributed with this software. *
+****************************************************************************/
+
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "xsimd/algorithms/xsimd_text.hpp"
+
+namespace xsimd
+{
+    namespace
+    {
+        // decodes the sequences one by one, following the table 3-7 of
+        // the Unicode standard
+        bool utf8_reference(const std::string& s)
+        {
+            const uint8_t* p = reinterpret_cast<const uint8_t*>(s.data());
+            std::size_t n = s.size(), i = 0;
+            while (i < n)
+            {
+                uint8_t c = p[i];
+                std::size_t len;
+                uint8_t lo = 0x80, hi = 0xbf;
+                if (c < 0x80)
+                {
+                    len = 1;
+                }
+                else if (c >= 0xc2 && c <= 0xdf)
+                {
+                    len = 2;
+                }
+                else if (c >= 0xe0 && c <= 0xef)
+                {
+                    len = 3;
+                    lo = c == 0xe0 ? 0xa0 : 0x80;
+                    hi = c == 0xed ? 0x9f : 0xbf;
+                }
+                else if (c >= 0xf0 && c <= 0xf4)
+                {
+                    len = 4;
+                    lo = c == 0xf0 ? 0x90 : 0x80;
+                    hi = c == 0xf4 ? 0x8f : 0xbf;
+                }
+                else
+                {
+                    return false;
+                }
+                if (i + len > n)
+                {
+                    return false;
+                }
+                for (std::size_t k = 1; k < len; ++k)
+                {
+                    uint8_t d = p[i + k];
+                    if (d < (k == 1 ? lo : 0x80) || d > (k == 1 ? hi : 0xbf))
+                    {
+                        return false;
+                    }
+                }
+                i += len;
+            }
+            return true;
+        }
+
+        void append_code_point(std::string& s, uint32_t cp)
+        {
+            if (cp < 0x80)
+            {
+                s += static_cast<char>(cp);
+            }
+            else if (cp < 0x800)
+            {
+                s += static_cast<char>(0xc0 | (cp >> 6));
+                s += static_cast<char>(0x80 | (cp & 0x3f));
+            }
+            else if (cp < 0x10000)
+            {
+                s += static_cast<char>(0xe0 | (cp >> 12));
+                s += static_cast<char>(0x80 | ((cp >> 6) & 0x3f));
+                s += static_cast<char>(0x80 | (cp & 0x3f));
+            }
+            else
+            {
+                s += static_cast<char>(0xf0 | (cp >> 18));
+                s += static_cast<char>(0x80 | ((cp >> 12) & 0x3f));
+                s += static_cast<char>(0x80 | ((cp >> 6) & 0x3f));
+                s += static_cast<char>(0x80 | (cp & 0x3f));
+            }
+        }
+
+        std::string random_utf8(std::mt19937_64& generator, std::size_t num_code_points)
+        {
+            std::string res;
+            for (std::size_t i = 0; i < num_code_points; ++i)
+            {
+                uint32_t cp;
+                switch (generator() % 4)
+                {
+                case 0:
+                    cp = static_cast<uint32_t>(generator() % 0x80);
+                    break;
+                case 1:
+                    cp = static_cast<uint32_t>(0x80 + generator() % (0x800 - 0x80));
+                    break;
+                case 2:
+                    cp = static_cast<uint32_t>(0x800 + generator() % (0x10000 - 0x800));
+                    cp = cp >= 0xd800 && cp < 0xe000 ? cp - 0x800 : cp;
+                    break;
+                default:
+                    cp = static_cast<uint32_t>(0x10000 + generator() % (0x110000 - 0x10000));
+                    break;
+                }
+                append_code_point(res, cp);
+            }
+            return res;
+        }
+    }
+
+    TEST(xsimd, utf8_validation)
+    {
+        const std::vector<std::string> valid = {
+            "", "a", "hello, world", "\xc3\xa9t\xc3\xa9", "\xe2\x82\xac", "\xf0\x9f\x98\x80",
+            "\xed\x9f\xbf", "\xee\x80\x80", "\xf4\x8f\xbf\xbf", "\xef\xbf\xbf", std::string(1, '\0')
+        };
+        const std::vector<std::string> invalid = {
+            "\x80", "\xbf", "\xc0\x80", "\xc1\xbf", "\xc3", "\xc3\x28", "\xe0\x80\x80", "\xe0\x9f\xbf",
+            "\xe2\x82", "\xed\xa0\x80", "\xed\xbf\xbf", "\xf0\x80\x80\x80", "\xf0\x8f\xbf\xbf",
+            "\xf4\x90\x80\x80", "\xf5\x80\x80\x80", "\xf8\x88\x80\x80\x80", "\xff", "\xfe",
+            "\xf0\x9f\x98", "\xc3\xa9\xa9", "\xe2\x82\xac\xac"
+        };
+        // the sequences at every offset around the block boundaries
+        for (std::size_t offset : { 0, 1, 13, 14, 15, 16, 29, 30, 31, 32, 61, 62, 63, 64, 65, 127, 200 })
+        {
+            for (const std::string& seq : valid)
+            {
+                std::string s = std::string(offset, 'x') + seq + std::string(offset % 7, 'y');
+                EXPECT_TRUE(is_valid_utf8(s.data(), s.size())) << "offset = " << offset << ", size = " << seq.size();
+                s = std::string(offset, 'x') + seq;
+                EXPECT_TRUE(is_valid_utf8(s.data(), s.size())) << "offset = " << offset << ", size = " << seq.size();
+            }
+            for (const std::string& seq : invalid)
+            {
+                std::string s = std::string(offset, 'x') + seq + std::string(offset % 7, 'y');
+                EXPECT_EQ(is_valid_utf8(s.data(), s.size()), utf8_reference(s)) << "offset = " << offset;
+                EXPECT_FALSE(is_valid_utf8(s.data(), s.size())) << "offset = " << offset << ", byte = " << int(uint8_t(seq[0]));
+                s = std::string(offset, 'x') + seq;
+                EXPECT_FALSE(is_valid_utf8(s.data(), s.size())) << "offset = " << offset << ", byte = " << int(uint8_t(seq[0]));
+            }
+        }
+
+        // random valid strings, and their single byte corruptions
+        std::mt19937_64 generator(11);
+        for (std::size_t num_code_points : { 1, 10, 50, 300, 1000 })
+        {
+            std::string s = random_utf8(generator, num_code_points);
+            EXPECT_TRUE(utf8_reference(s));
+            EXPECT_TRUE(is_valid_utf8(s.data(), s.size())) << "size = " << s.size();
+            for (std::size_t k = 0; k < 200; ++k)
+            {
+                std::string t = s;
+                t[generator() % t.size()] = static_cast<char>(generator());
+                EXPECT_EQ(is_valid_utf8(t.data(), t.size()), utf8_reference(t)) << "size = " << t.size() << ", k = " << k;
+                std::size_t cut = generator() % t.size();
+                EXPECT_EQ(is_valid_utf8(t.data(), cut), utf8_reference(t.substr(0, cut))) << "cut = " << cut;
+            }
+        }
+    }
+
+    TEST(xsimd, is_ascii)
+    {
+        for (std::size_t n : { 0, 1, 15, 16, 17, 63, 64, 65, 127, 128, 129, 300 })
+        {
+            std::string s(n, 'a');
+            EXPECT_TRUE(is_ascii(s.data(), n)) << "n = " << n;
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                s[i] = '\x80';
+                EXPECT_FALSE(is_ascii(s.data(), n)) << "n = " << n << ", i = " << i;
+                s[i] = '\x7f';
+                EXPECT_TRUE(is_ascii(s.data(), n)) << "n = " << n << ", i = " << i;
+                s[i] = 'a';
+            }
+        }
+    }
+
+    TEST(xsimd, char_class_bitmap)
+    {
+        const char_class delimiters(",;\t\n\"");
+        EXPECT_TRUE(delimiters.contains(','));
+        EXPECT_TRUE(delimiters.contains('"'));
+        EXPECT_FALSE(delimiters.contains('a'));
+        EXPECT_FALSE(delimiters.contains('\0'));
+        char_class others("\0\xff\xe9", 3);
+        others.add('\x80');
+        EXPECT_TRUE(others.contains('\0'));
+        EXPECT_TRUE(others.contains('\xe9'));
+        EXPECT_FALSE(others.contains('\x69'));
+        EXPECT_FALSE(others.contains('\xe8'));
+
+        std::mt19937_64 generator(13);
+        for (std::size_t n : { 0, 1, 15, 16, 31, 63, 64, 65, 100, 128, 1000, 4099 })
+        {
+            std::string s(n, ' ');
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                // mostly letters and delimiters, some other bytes
+                uint64_t r = generator();
+                s[i] = r % 3 == 0 ? static_cast<char>(r >> 8) : (r % 3 == 1 ? ",;\t\n\"x"[(r >> 8) % 6] : 'a');
+            }
+            const char_class* classes[] = { &delimiters, &others };
+            for (const char_class* cls : classes)
+            {
+                std::vector<uint64_t> bitmap((n + 63) / 64, ~uint64_t(0));
+                std::size_t count = char_class_bitmap(s.data(), n, *cls, bitmap.data());
+                std::size_t ref_count = 0;
+                for (std::size_t i = 0; i < n; ++i)
+                {
+                    bool ref = cls->contains(s[i]);
+                    ref_count += ref;
+                    EXPECT_EQ(((bitmap[i / 64] >> (i % 64)) & 1) != 0, ref) << "n = " << n << ", i = " << i;
+                }
+                EXPECT_EQ(count, ref_count) << "n = " << n;
+                if (n % 64 != 0)
+                {
+                    EXPECT_EQ(bitmap.back() >> (n % 64), uint64_t(0)) << "n = " << n;
+                }
+            }
+        }
+    }
+}
@@ -6,13 +6,17 @@
 * The full license is in the file LICENSE, distributed with this software. *
 ****************************************************************************/
 
+#include <cmath>
 #include <fstream>
 #include <iostream>
+#include <limits>
+#include <vector>
 
 #include "gtest/gtest.h"
 
 #include "xsimd/math/xsimd_trigonometric.hpp"
 #include "xsimd/memory/xsimd_aligned_allocator.hpp"
+#include "xsimd/types/xsimd_traits.hpp"
 #include "xsimd/types/xsimd_types_include.hpp"
 #include "xsimd_trigonometric_test.hpp"
 
@@ -105,4 +109,73 @@ TEST(xsimd, fallback_double_trigonometric)
     bool res = xsimd::test_trigonometric<double, 3, 32>(out, "fallback double");
     EXPECT_TRUE(res);
 }
-#endif
\ No newline at end of file
+#endif
+
+namespace xsimd
+{
+    template <class T>
+    void check_exact_turns()
+    {
+        using b_type = simd_type<T>;
+        for (int k = -8; k <= 8; ++k)
+        {
+            b_type n = b_type(T(k));
+            EXPECT_EQ(sinpi(n)[0], T(0)) << "sinpi(" << k << ")";
+            EXPECT_EQ(cospi(n + b_type(T(0.5)))[0], T(0)) << "cospi(" << k << ".5)";
+            EXPECT_EQ(cospi(n)[0], k % 2 == 0 ? T(1) : T(-1)) << "cospi(" << k << ")";
+            EXPECT_EQ(sind(n * b_type(T(180)))[0], T(0)) << "sind(" << 180 * k << ")";
+            EXPECT_EQ(cosd(n * b_type(T(180)) + b_type(T(90)))[0], T(0)) << "cosd(" << 180 * k + 90 << ")";
+        }
+        EXPECT_EQ(sinpi(b_type(T(0.5)))[0], T(1));
+        EXPECT_EQ(sind(b_type(T(-90)))[0], T(-1));
+        EXPECT_EQ(sinpi(b_type(std::numeric_limits<T>::max()))[0], T(0));
+        EXPECT_TRUE(std::isnan(sinpi(b_type(std::numeric_limits<T>::infinity()))[0]));
+    }
+
+    TEST(xsimd, trigonometric_exact_turns)
+    {
+        check_exact_turns<float>();
+        check_exact_turns<double>();
+    }
+
+    // arguments above 2^(nmb + 1), where every value is an integer and
+    // the reference reduces exactly with fmod
+    template <class T>
+    void check_large_degrees()
+    {
+        using b_type = simd_type<T>;
+        constexpr std::size_t size = simd_traits<T>::size;
+        const int min_exp = std::numeric_limits<T>::digits;
+        const int max_exp = std::numeric_limits<T>::max_exponent;
+        const T tolerance = 4 * std::numeric_limits<T>::epsilon();
+        std::vector<T> v = { T(1e20), std::numeric_limits<T>::max(), T(3.) * std::ldexp(T(1.), max_exp - 2) };
+        for (int e = min_exp; e < max_exp; ++e)
+        {
+            for (int j = 0; j < 16; ++j)
+            {
+                v.push_back(std::ldexp(T(1.) + T(j * 0.0625) + T(j) * std::numeric_limits<T>::epsilon(), e));
+            }
+        }
+        v.resize((v.size() + size - 1) / size * size, T(1e20));
+        for (std::size_t i = 0; i < v.size(); i += size)
+        {
+            b_type x = b_type(&v[i], unaligned_mode());
+            b_type vs = sind(x);
+            b_type vc = cosd(-x);
+            for (std::size_t k = 0; k < size; ++k)
+            {
+                T s, c;
+                detail::sincos_turn_reference(std::fmod(v[i + k], T(360.)), T(90.), s, c);
+                EXPECT_NEAR(vs[k], s, tolerance) << "sind(" << v[i + k] << ")";
+                EXPECT_NEAR(vc[k], c, tolerance) << "cosd(" << -v[i + k] << ")";
+            }
+        }
+        EXPECT_TRUE(std::isnan(sind(b_type(std::numeric_limits<T>::infinity()))[0]));
+    }
+
+    TEST(xsimd, trigonometric_large_degrees)
+    {
+        check_large_degrees<float>();
+        check_large_degrees<double>();
+    }
+}
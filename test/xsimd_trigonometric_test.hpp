@@ -29,6 +29,13 @@ namespace xsimd
         res_type sin_res;
         res_type cos_res;
         res_type tan_res;
+        res_type pi_input;
+        res_type sinpi_res;
+        res_type cospi_res;
+        res_type tanpi_res;
+        res_type degree_input;
+        res_type sind_res;
+        res_type cosd_res;
         res_type ainput;
         res_type asin_res;
         res_type acos_res;
@@ -40,6 +47,28 @@ namespace xsimd
         simd_trigonometric_tester(const std::string& n);
     };
 
+    namespace detail
+    {
+        // sine and cosine of x * period / 4 quarter turns, reduced exactly
+        // before the conversion to radians
+        template <class T>
+        void sincos_turn_reference(T x, T quarter, T& s, T& c)
+        {
+            using ref_type = long double;
+            const ref_type pi_l = 3.141592653589793238462643383279502884L;
+            ref_type k = std::nearbyint(ref_type(x) / quarter);
+            ref_type r = (ref_type(x) - k * quarter) * (pi_l / 2) / quarter;
+            ref_type sr = std::sin(r);
+            ref_type cr = std::cos(r);
+            long long q = static_cast<long long>(std::fmod(k, ref_type(4)));
+            q = q < 0 ? q + 4 : q;
+            ref_type sv[4] = { sr, cr, -sr, -cr };
+            ref_type cv[4] = { cr, -sr, -cr, sr };
+            s = T(sv[q]);
+            c = T(cv[q]);
+        }
+    }
+
     template <class T, std::size_t N, std::size_t A>
     simd_trigonometric_tester<T, N, A>::simd_trigonometric_tester(const std::string& n)
         : name(n)
@@ -49,6 +78,13 @@ namespace xsimd
         sin_res.resize(nb_input);
         cos_res.resize(nb_input);
         tan_res.resize(nb_input);
+        pi_input.resize(nb_input);
+        sinpi_res.resize(nb_input);
+        cospi_res.resize(nb_input);
+        tanpi_res.resize(nb_input);
+        degree_input.resize(nb_input);
+        sind_res.resize(nb_input);
+        cosd_res.resize(nb_input);
         ainput.resize(nb_input);
         asin_res.resize(nb_input);
         acos_res.resize(nb_input);
@@ -63,6 +99,11 @@ namespace xsimd
             sin_res[i] = std::sin(input[i]);
             cos_res[i] = std::cos(input[i]);
             tan_res[i] = std::tan(input[i]);
+            pi_input[i] = value_type(-5.) + i * value_type(10.1) / nb_input;
+            detail::sincos_turn_reference(pi_input[i], value_type(0.5), sinpi_res[i], cospi_res[i]);
+            tanpi_res[i] = sinpi_res[i] / cospi_res[i];
+            degree_input[i] = value_type(-1000.) + i * value_type(2000.) / nb_input;
+            detail::sincos_turn_reference(degree_input[i], value_type(90.), sind_res[i], cosd_res[i]);
             ainput[i] = value_type(-1.) + value_type(2.) * i / nb_input;
             asin_res[i] = std::asin(ainput[i]);
             acos_res[i] = std::acos(ainput[i]);
@@ -129,6 +170,71 @@ namespace xsimd
         tmp_success = check_almost_equal(topic, res, tester.tan_res, out);
         success = success && tmp_success;
 
+        topic = "sinpi         : ";
+        for (size_t i = 0; i < tester.pi_input.size(); i += tester.size)
+        {
+            detail::load_vec(input, tester.pi_input, i);
+            vres = sinpi(input);
+            detail::store_vec(vres, res, i);
+        }
+        tmp_success = check_almost_equal(topic, res, tester.sinpi_res, out);
+        success = success && tmp_success;
+
+        topic = "cospi         : ";
+        for (size_t i = 0; i < tester.pi_input.size(); i += tester.size)
+        {
+            detail::load_vec(input, tester.pi_input, i);
+            vres = cospi(input);
+            detail::store_vec(vres, res, i);
+        }
+        tmp_success = check_almost_equal(topic, res, tester.cospi_res, out);
+        success = success && tmp_success;
+
+        topic = "tanpi         : ";
+        for (size_t i = 0; i < tester.pi_input.size(); i += tester.size)
+        {
+            detail::load_vec(input, tester.pi_input, i);
+            vres = tanpi(input);
+            detail::store_vec(vres, res, i);
+        }
+        tmp_success = check_almost_equal(topic, res, tester.tanpi_res, out);
+        success = success && tmp_success;
+
+        res_type res2(tester.pi_input.size());
+        for (size_t i = 0; i < tester.pi_input.size(); i += tester.size)
+        {
+            detail::load_vec(input, tester.pi_input, i);
+            auto sc = sincospi(input);
+            detail::store_vec(sc.first, res, i);
+            detail::store_vec(sc.second, res2, i);
+        }
+        topic = "sincospi (sin): ";
+        tmp_success = check_almost_equal(topic, res, tester.sinpi_res, out);
+        success = success && tmp_success;
+        topic = "sincospi (cos): ";
+        tmp_success = check_almost_equal(topic, res2, tester.cospi_res, out);
+        success = success && tmp_success;
+
+        topic = "sind          : ";
+        for (size_t i = 0; i < tester.degree_input.size(); i += tester.size)
+        {
+            detail::load_vec(input, tester.degree_input, i);
+            vres = sind(input);
+            detail::store_vec(vres, res, i);
+        }
+        tmp_success = check_almost_equal(topic, res, tester.sind_res, out);
+        success = success && tmp_success;
+
+        topic = "cosd          : ";
+        for (size_t i = 0; i < tester.degree_input.size(); i += tester.size)
+        {
+            detail::load_vec(input, tester.degree_input, i);
+            vres = cosd(input);
+            detail::store_vec(vres, res, i);
+        }
+        tmp_success = check_almost_equal(topic, res, tester.cosd_res, out);
+        success = success && tmp_success;
+
         topic = "asin  : ";
         for (size_t i = 0; i < tester.ainput.size(); i += tester.size)
         {